@@ -35,6 +35,7 @@
 #include "../domain/effects/effect_factory.hpp"
 #include "../domain/midi/midi_note_data.hpp"
 #include "../domain/tracker/column_settings.hpp"
+#include "../domain/utility/dsp_profiler.hpp"
 #include "../infra/audio/audio_engine.hpp"
 #include "../infra/audio/backend/audio_file_reader.hpp"
 #include "../infra/audio/backend/sndfile_reader.hpp"
@@ -77,6 +78,7 @@
 #include "service/automation_service.hpp"
 #include "service/device_service.hpp"
 #include "service/editor_service.hpp"
+#include "service/freeze_service.hpp"
 #include "service/jack_service.hpp"
 #include "service/keyboard_service.hpp"
 #include "service/manual_service.hpp"
@@ -85,6 +87,7 @@
 #include "service/player_service.hpp"
 #include "service/property_service.hpp"
 #include "service/recent_files_manager.hpp"
+#include "service/render_ahead_service.hpp"
 #include "service/render_service.hpp"
 #include "service/render_worker.hpp"
 #include "service/selection_service.hpp"
@@ -157,6 +160,8 @@ Application::Application(int & argc, char ** argv)
   , m_renderSettingsModel { std::make_unique<RenderSettingsModel>(m_editorService) }
   , m_songSettingsModel { std::make_unique<SongSettingsModel>(m_editorService) }
   , m_renderService { std::make_shared<RenderService>(m_audioEngine, m_deviceService, m_mixerService, m_editorService, m_automationService, m_sideChainService) }
+  , m_freezeService { std::make_shared<FreezeService>(m_audioEngine, m_deviceService, m_mixerService, m_editorService, m_automationService, m_sideChainService, m_settingsService, m_renderService) }
+  , m_renderAheadService { std::make_shared<RenderAheadService>(m_audioEngine, m_deviceService, m_mixerService, m_editorService, m_automationService, m_sideChainService, m_settingsService, m_renderService) }
   , m_midiCcAutomationsModel { std::make_unique<MidiCcAutomationsModel>() }
   , m_pitchBendAutomationsModel { std::make_unique<PitchBendAutomationsModel>() }
   , m_columnSettingsModel { std::make_unique<ColumnSettingsModel>() }
@@ -292,6 +297,7 @@ void Application::setContextProperties()
     m_engine->rootContext()->setContextProperty("renderSettingsModel", m_renderSettingsModel.get());
     m_engine->rootContext()->setContextProperty("songSettingsModel", m_songSettingsModel.get());
     m_engine->rootContext()->setContextProperty("renderService", m_renderService.get());
+    m_engine->rootContext()->setContextProperty("freezeService", m_freezeService.get());
     m_engine->rootContext()->setContextProperty("selectionService", m_selectionService.get());
     m_engine->rootContext()->setContextProperty("settingsService", m_settingsService.get());
     m_engine->rootContext()->setContextProperty("themeService", m_themeService.get());
@@ -340,6 +346,9 @@ void Application::handleCommandLineArguments(int & argc, char ** argv)
             throw std::runtime_error { std::string { "Invalid audio backend: " } + value };
         } }, false, "Force the audio backend: [alsa, pulse, jack]");
 
+    ae.addOption({ "--profile" }, [this](const std::string & value) {
+        m_profileTracePath = value; }, false, "Profile the audio engine for the whole session and write a Chrome trace to the given file on exit.");
+
     ae.setPositionalArgumentCallback([this](const std::vector<std::string> & args) {
         if (!args.empty()) {
             const QString path = QString::fromStdString(args.front());
@@ -399,6 +408,7 @@ void Application::connectDeviceService()
     m_synthController->setDeviceService(m_deviceService);
     m_wavetableSynthController->setDeviceService(m_deviceService);
     connect(m_deviceService.get(), &DeviceService::synthUserPresetsChanged, m_synthController.get(), &SynthController::setUserPresets);
+    connect(m_deviceService.get(), &DeviceService::statusTextRequested, m_applicationService.get(), &ApplicationService::statusTextRequested);
 
     connect(m_deviceService.get(), &DeviceService::dataChanged, this, [this]() {
         m_editorService->setIsModified(true);
@@ -422,6 +432,12 @@ void Application::connectJackService()
         m_audioEngine->setPlaybackThreadingEnabled(m_settingsService->multiThreadedPlaybackEnabled());
     });
     m_audioEngine->setPlaybackThreadingEnabled(m_settingsService->multiThreadedPlaybackEnabled());
+    connect(m_settingsService.get(), &SettingsService::masterPipelineEnabledChanged, this, [this] {
+        m_audioEngine->setMasterPipelineEnabled(m_settingsService->masterPipelineEnabled());
+        m_jackService->onEngineLatencyChanged();
+    });
+    connect(m_settingsService.get(), &SettingsService::multiThreadedPlaybackEnabledChanged, m_jackService.get(), &JackService::onEngineLatencyChanged);
+    m_audioEngine->setMasterPipelineEnabled(m_settingsService->masterPipelineEnabled());
 
     connect(m_jackService.get(), &JackService::errorOccurred, m_applicationService.get(), &ApplicationService::requestAlertDialog);
     connect(m_jackService.get(), &JackService::rewindRequested, this, [this]() {
@@ -713,7 +729,18 @@ void Application::connectPlayerService()
 {
     connect(m_playerService.get(), &PlayerService::songRequested, this, [this] {
         m_playerService->setSong(m_editorService->song());
+        // Ahead of the player's own events. The files are held back until its first tick, below.
+        m_freezeService->startPlayback(m_playerService->songPosition(), m_playerService->isLooping());
+        // A frozen device already plays from disk, and the render cannot have its file in it.
+        if (!m_freezeService->isPlayingFrozenDevices()) {
+            m_renderAheadService->startPlayback(m_playerService->songPosition(), m_playerService->isLooping());
+        }
     });
+    // On the player's thread, so that the frozen devices start in the very block its first tick
+    // reaches, however long the player took to get going.
+    connect(m_playerService.get(), &PlayerService::songStarted, m_freezeService.get(), &FreezeService::startFrozenDevices, Qt::DirectConnection);
+    // Likewise on the player's thread, which waits there for the render's head start rather than the UI.
+    connect(m_playerService.get(), &PlayerService::songStarted, m_renderAheadService.get(), &RenderAheadService::startPlayingRenderedAhead, Qt::DirectConnection);
     connect(m_playerService.get(), &PlayerService::tickUpdated, m_editorService.get(), &EditorService::requestPositionByTick);
 
     connect(m_playerService.get(), &PlayerService::isPlayingChanged, this, [this]() {
@@ -727,6 +754,8 @@ void Application::connectPlayerService()
             // Playback is over, so nothing it wrote may outlive it: the devices go back to the
             // values the user set, and a save from here on stores those.
             m_deviceService->clearAutomation();
+            m_freezeService->stopPlayback();
+            m_renderAheadService->stopPlayback();
         }
         if (m_settingsService->recordingEnabled()) {
             applyAudioRecording(isPlaying, m_playerService->tick());
@@ -739,6 +768,15 @@ void Application::connectPlayerService()
         }
     });
 
+    connect(m_renderAheadService.get(), &RenderAheadService::isRenderingAheadChanged, this, [this]() {
+        const auto isRenderingAhead = m_renderAheadService->isRenderingAhead();
+        m_playerService->setIsRenderedAhead(isRenderingAhead);
+        m_midiService->setIsRenderingAhead(isRenderingAhead);
+    });
+    // Before the live event reaches the devices, so that it is heard rather than cleared with the rest.
+    connect(m_midiService.get(), &MidiService::renderAheadInterrupted, m_renderAheadService.get(), &RenderAheadService::fallBackToLive, Qt::DirectConnection);
+    connect(m_effectRackController.get(), &EffectRackController::revisionChanged, m_renderAheadService.get(), &RenderAheadService::invalidate);
+
     connect(m_jackService.get(), &JackService::playRequested, m_playerService.get(), &PlayerService::play, Qt::QueuedConnection);
     connect(m_jackService.get(), &JackService::stopRequested, m_playerService.get(), &PlayerService::stop, Qt::QueuedConnection);
 }
@@ -870,7 +908,20 @@ int Application::initializeTracker()
     connectServices();
     m_stateMachine->calculateState(StateMachine::Action::ApplicationInitialized);
 
-    return m_application->exec();
+    if (m_profileTracePath.empty()) {
+        return m_application->exec();
+    }
+
+    // Covers everything played or rendered in the session; there is no headless render to attach to.
+    m_audioEngine->dspProfiler().setActive(true);
+    const int exitCode = m_application->exec();
+    m_audioEngine->dspProfiler().setActive(false);
+    if (m_audioEngine->dspProfiler().writeChromeTrace(m_profileTracePath)) {
+        juzzlin::L(TAG).info() << "DSP profile written to " << m_profileTracePath;
+    } else {
+        juzzlin::L(TAG).error() << "Could not write DSP profile to " << m_profileTracePath;
+    }
+    return exitCode;
 }
 
 int Application::initialize()
@@ -22,6 +22,7 @@
 
 #include <memory>
 #include <optional>
+#include <string>
 
 #include <QObject>
 
@@ -75,6 +76,8 @@ class RecentFilesModel;
 class RenderSettingsModel;
 class SongSettingsModel;
 class RenderService;
+class FreezeService;
+class RenderAheadService;
 class SamplerController;
 class SelectionService;
 class SettingsService;
@@ -199,6 +202,8 @@ private:
     std::unique_ptr<SongSettingsModel> m_songSettingsModel;
 
     std::shared_ptr<RenderService> m_renderService;
+    std::shared_ptr<FreezeService> m_freezeService;
+    std::shared_ptr<RenderAheadService> m_renderAheadService;
 
     std::unique_ptr<MidiCcAutomationsModel> m_midiCcAutomationsModel;
     std::unique_ptr<PitchBendAutomationsModel> m_pitchBendAutomationsModel;
@@ -216,6 +221,9 @@ private:
 
     std::shared_ptr<Instrument> m_livePositionNoteInstrument;
     std::optional<uint8_t> m_livePositionNote;
+
+    //! Where --profile writes the session's DSP profile on exit. Empty when not profiling.
+    std::string m_profileTracePath;
 };
 
 } // namespace noteahead
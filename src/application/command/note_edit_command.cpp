@@ -28,30 +28,41 @@ NoteEditCommand::NoteEditCommand(SongS song, ChangeList changes, Position undoPo
 {
 }
 
-void NoteEditCommand::undo()
+NoteEditCommand::NoteEditCommand(SongS song, ChangeList changes, Position undoPosition, Position redoPosition, ChangesCallback changesCallback, CursorCallback cursorCallback)
+  : m_song { std::move(song) }
+  , m_changes { std::move(changes) }
+  , m_undoPosition { undoPosition }
+  , m_redoPosition { redoPosition }
+  , m_changesCallback { std::move(changesCallback) }
+  , m_cursorCallback { std::move(cursorCallback) }
 {
-    for (auto && change : m_changes) {
-        m_song->setNoteDataAtPosition(change.oldNoteData, change.position);
-        if (m_callback) {
+}
+
+void NoteEditCommand::notify(const Position & cursorPosition)
+{
+    if (m_callback) {
+        for (auto && change : m_changes) {
             m_callback(change.position);
         }
     }
+    if (m_changesCallback) {
+        m_changesCallback(m_changes);
+    }
     if (m_cursorCallback) {
-        m_cursorCallback(m_undoPosition);
+        m_cursorCallback(cursorPosition);
     }
 }
 
+void NoteEditCommand::undo()
+{
+    m_song->applyNoteChanges(m_changes, true);
+    notify(m_undoPosition);
+}
+
 void NoteEditCommand::redo()
 {
-    for (auto && change : m_changes) {
-        m_song->setNoteDataAtPosition(change.newNoteData, change.position);
-        if (m_callback) {
-            m_callback(change.position);
-        }
-    }
-    if (m_cursorCallback) {
-        m_cursorCallback(m_redoPosition);
-    }
+    m_song->applyNoteChanges(m_changes);
+    notify(m_redoPosition);
 }
 
 } // namespace noteahead
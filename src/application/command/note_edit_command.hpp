@@ -37,19 +37,25 @@ public:
     using Change = NoteChange;
     using ChangeList = NoteChangeList;
     using Callback = std::function<void(const Position &)>;
+    using ChangesCallback = std::function<void(const ChangeList &)>;
     using CursorCallback = std::function<void(const Position &)>;
 
     NoteEditCommand(SongS song, ChangeList changes, Position undoPosition, Position redoPosition, Callback callback, CursorCallback cursorCallback);
+    //! For bulk edits: the callback runs once with all of the changes after they have been applied.
+    NoteEditCommand(SongS song, ChangeList changes, Position undoPosition, Position redoPosition, ChangesCallback changesCallback, CursorCallback cursorCallback);
 
     void undo() override;
     void redo() override;
 
 private:
+    void notify(const Position & cursorPosition);
+
     SongS m_song;
     ChangeList m_changes;
     Position m_undoPosition;
     Position m_redoPosition;
     Callback m_callback;
+    ChangesCallback m_changesCallback;
     CursorCallback m_cursorCallback;
 };
 
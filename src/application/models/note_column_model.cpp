@@ -49,8 +49,8 @@ QString NoteColumnModel::noDataString() const
 
 QString NoteColumnModel::displayNote(const Line & line) const
 {
-    if (const auto noteData = line.noteData(); noteData->type() != NoteData::Type::None) {
-        return noteData->type() == NoteData::Type::NoteOff ? "OFF" : QString::fromStdString(NoteConverter::midiToString(*noteData->note()));
+    if (const auto & noteData = line.noteData(); noteData.type() != NoteData::Type::None) {
+        return noteData.type() == NoteData::Type::NoteOff ? "OFF" : QString::fromStdString(NoteConverter::midiToString(*noteData.note()));
     } else {
         return noDataString();
     }
@@ -63,8 +63,8 @@ QString NoteColumnModel::padVelocityToThreeDigits(const QString & velocity) cons
 
 QString NoteColumnModel::displayVelocity(const Line & line) const
 {
-    if (const auto noteData = line.noteData(); noteData->type() != NoteData::Type::None) {
-        return noteData->type() == NoteData::Type::NoteOff ? noDataString() : padVelocityToThreeDigits(QString::number(noteData->velocity()));
+    if (const auto & noteData = line.noteData(); noteData.type() != NoteData::Type::None) {
+        return noteData.type() == NoteData::Type::NoteOff ? noDataString() : padVelocityToThreeDigits(QString::number(noteData.velocity()));
     } else {
         return noDataString();
     }
@@ -77,11 +77,11 @@ QString NoteColumnModel::padDelayToTwoDigits(const QString & delay) const
 
 QString NoteColumnModel::displayDelay(const Line & line) const
 {
-    if (const auto noteData = line.noteData(); noteData->type() != NoteData::Type::None) {
-        if (noteData->type() == NoteData::Type::NoteOff && noteData->delay() == 0) {
+    if (const auto & noteData = line.noteData(); noteData.type() != NoteData::Type::None) {
+        if (noteData.type() == NoteData::Type::NoteOff && noteData.delay() == 0) {
             return "--";
         }
-        return padDelayToTwoDigits(QString::number(noteData->delay()));
+        return padDelayToTwoDigits(QString::number(noteData.delay()));
     } else {
         return "--";
     }
@@ -89,8 +89,8 @@ QString NoteColumnModel::displayDelay(const Line & line) const
 
 QString NoteColumnModel::displayPan(const Line & line) const
 {
-    if (const auto noteData = line.noteData(); noteData->pan().has_value()) {
-        return QString::number(*noteData->pan()).rightJustified(3, '0', true);
+    if (const auto & noteData = line.noteData(); noteData.pan().has_value()) {
+        return QString::number(*noteData.pan()).rightJustified(3, '0', true);
     }
     return noDataString();
 }
@@ -329,7 +329,12 @@ void NoteColumnModel::updateIndexHighlightRange(quint64 startLine, quint64 endLi
 
 void NoteColumnModel::updateNoteDataAtPosition(quint64 line)
 {
-    notifyDataChanged(static_cast<int>(line), static_cast<int>(line), { static_cast<int>(DataRole::Note), static_cast<int>(DataRole::Velocity), static_cast<int>(DataRole::Delay), static_cast<int>(DataRole::Pan), static_cast<int>(DataRole::Line) });
+    updateNoteDataRange(line, line);
+}
+
+void NoteColumnModel::updateNoteDataRange(quint64 startLine, quint64 endLine)
+{
+    notifyDataChanged(static_cast<int>(startLine), static_cast<int>(endLine), { static_cast<int>(DataRole::Note), static_cast<int>(DataRole::Velocity), static_cast<int>(DataRole::Delay), static_cast<int>(DataRole::Pan), static_cast<int>(DataRole::Line) });
 }
 
 void NoteColumnModel::updateRowCount()
@@ -85,6 +85,7 @@ public:
     void updateIndexHighlightAtPosition(quint64 line);
     void updateIndexHighlightRange(quint64 startLine, quint64 endLine);
     void updateNoteDataAtPosition(quint64 line);
+    void updateNoteDataRange(quint64 startLine, quint64 endLine);
 
 private:
     QString displayNote(const Line & line) const;
@@ -28,6 +28,7 @@ NoteColumnModelHandler::NoteColumnModelHandler(EditorServiceS editorService, Sel
     connect(m_editorService.get(), &EditorService::currentLineCountChanged, this, &NoteColumnModelHandler::updateCurrentLineCount);
     connect(m_editorService.get(), &EditorService::lineDataChanged, this, &NoteColumnModelHandler::updateIndexHighlightAtPosition);
     connect(m_editorService.get(), &EditorService::noteDataAtPositionChanged, this, &NoteColumnModelHandler::updateNoteDataAtPosition);
+    connect(m_editorService.get(), &EditorService::noteDataRangeChanged, this, &NoteColumnModelHandler::updateNoteDataRange);
     connect(m_editorService.get(), &EditorService::positionChanged, this, &NoteColumnModelHandler::updatePosition);
     connect(m_editorService.get(), &EditorService::currentPatternChanged, this, &NoteColumnModelHandler::updateGhostData);
     connect(m_editorService.get(), &EditorService::songPositionChanged, this, &NoteColumnModelHandler::updateGhostData);
@@ -123,6 +124,13 @@ void NoteColumnModelHandler::updateNoteDataAtPosition(const Position & position)
     }
 }
 
+void NoteColumnModelHandler::updateNoteDataRange(const Position & startPosition, const Position & endPosition)
+{
+    if (const auto columnAddress = positionToColumnAddress(startPosition); m_noteColumnModels.contains(columnAddress)) {
+        m_noteColumnModels.at(columnAddress)->updateNoteDataRange(startPosition.line, endPosition.line);
+    }
+}
+
 void NoteColumnModelHandler::updatePosition(const Position & newPosition, const Position & oldPosition)
 {
     if (const auto columnAddress = positionToColumnAddress(oldPosition); m_noteColumnModels.contains(columnAddress)) {
@@ -62,6 +62,7 @@ private:
     void updateIndexHighlightAtPosition(const Position & position);
     void updateIndexHighlightRange(const Position & startPosition, const Position & endPosition);
     void updateNoteDataAtPosition(const Position & position);
+    void updateNoteDataRange(const Position & startPosition, const Position & endPosition);
     void updatePosition(const Position & newPosition, const Position & oldPosition);
 
     EditorServiceS m_editorService;
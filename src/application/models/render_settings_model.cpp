@@ -220,4 +220,24 @@ void RenderSettingsModel::setAnalyzeEnabled(bool enabled)
     apply([&](RenderSettings & settings) { settings.setAnalyzeEnabled(enabled); });
 }
 
+bool RenderSettingsModel::reproducibleEnabled() const
+{
+    return read(m_editorService, [](const RenderSettings & s) { return s.reproducibleEnabled(); });
+}
+
+void RenderSettingsModel::setReproducibleEnabled(bool enabled)
+{
+    apply([&](RenderSettings & settings) { settings.setReproducibleEnabled(enabled); });
+}
+
+int RenderSettingsModel::randomSeed() const
+{
+    return read(m_editorService, [](const RenderSettings & s) { return s.randomSeed(); });
+}
+
+void RenderSettingsModel::setRandomSeed(int seed)
+{
+    apply([&](RenderSettings & settings) { settings.setRandomSeed(seed); });
+}
+
 } // namespace noteahead
@@ -54,6 +54,8 @@ class RenderSettingsModel : public QObject
     Q_PROPERTY(int silenceSeconds READ silenceSeconds WRITE setSilenceSeconds NOTIFY changed)
     Q_PROPERTY(int silenceTenths READ silenceTenths WRITE setSilenceTenths NOTIFY changed)
     Q_PROPERTY(bool analyzeEnabled READ analyzeEnabled WRITE setAnalyzeEnabled NOTIFY changed)
+    Q_PROPERTY(bool reproducibleEnabled READ reproducibleEnabled WRITE setReproducibleEnabled NOTIFY changed)
+    Q_PROPERTY(int randomSeed READ randomSeed WRITE setRandomSeed NOTIFY changed)
 
 public:
     using EditorServiceS = std::shared_ptr<EditorService>;
@@ -109,6 +111,12 @@ public:
     bool analyzeEnabled() const;
     void setAnalyzeEnabled(bool enabled);
 
+    bool reproducibleEnabled() const;
+    void setReproducibleEnabled(bool enabled);
+
+    int randomSeed() const;
+    void setRandomSeed(int seed);
+
 signals:
     //! One signal for the lot: the dialog reads all of them together and there is nothing to gain
     //! from ten separate notifications.
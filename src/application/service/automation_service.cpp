@@ -58,7 +58,7 @@ quint64 AutomationService::addMidiCcAutomation(quint64 pattern, quint64 track, q
     auto automation = MidiCcAutomation { id, location, controller, parameters, comment, enabled };
     automation.setEventsPerBeat(eventsPerBeat);
     automation.setLineOffset(lineOffset);
-    m_automations.midiCc.push_back(automation);
+    pushMidiCcAutomation(automation);
     notifyChangedLines(pattern, track, column, line0, line1);
     juzzlin::L(TAG).info() << "MIDI CC Automation added: " << automation.toString().toStdString();
     return automation.id();
@@ -75,7 +75,7 @@ quint64 AutomationService::addMidiCcAutomation(const MidiCcAutomation & automati
     const auto id = maxIdItem != m_automations.midiCc.end() ? (*maxIdItem).id() + 1 : 1;
     auto newAutomation = automation;
     newAutomation.setId(id);
-    m_automations.midiCc.push_back(newAutomation);
+    pushMidiCcAutomation(newAutomation);
     notifyChangedLines(newAutomation);
     juzzlin::L(TAG).info() << "MIDI CC Automation added (from object): " << newAutomation.toString().toStdString();
     return newAutomation.id();
@@ -83,7 +83,7 @@ quint64 AutomationService::addMidiCcAutomation(const MidiCcAutomation & automati
 
 void AutomationService::addMidiCcAutomationWithId(const MidiCcAutomation & automation)
 {
-    m_automations.midiCc.push_back(automation);
+    pushMidiCcAutomation(automation);
     notifyChangedLines(automation);
     juzzlin::L(TAG).info() << "MIDI CC Automation added (with ID): " << automation.toString().toStdString();
 }
@@ -156,7 +156,10 @@ void AutomationService::deleteMidiCcAutomation(const MidiCcAutomation & automati
             return automationToDelete.id() == existingAutomation.id();
         });
         iter != m_automations.midiCc.end()) {
+        const auto location = iter->location();
+        const auto position = static_cast<size_t>(std::distance(m_automations.midiCc.begin(), iter));
         m_automations.midiCc.erase(iter);
+        m_automations.midiCcIndex.remove(location, position);
         notifyChangedLines(automationToDelete);
         juzzlin::L(TAG).info() << "MIDI CC Automation deleted: " << automationToDelete.toString().toStdString();
     } else {
@@ -172,6 +175,10 @@ void AutomationService::updateMidiCcAutomation(const MidiCcAutomation & updatedA
         iter != m_automations.midiCc.end()) {
         if (const auto oldAutomation = *iter; oldAutomation != updatedAutomation) {
             *iter = updatedAutomation;
+            if (oldAutomation.location() != updatedAutomation.location() || oldAutomation.interpolation().line0 != updatedAutomation.interpolation().line0 || oldAutomation.interpolation().line1 != updatedAutomation.interpolation().line1) {
+                const auto position = static_cast<size_t>(std::distance(m_automations.midiCc.begin(), iter));
+                m_automations.midiCcIndex.update(oldAutomation.location(), updatedAutomation.location(), updatedAutomation.interpolation().line0, updatedAutomation.interpolation().line1, position);
+            }
             if (oldAutomation.interpolation() != updatedAutomation.interpolation() || //
                 oldAutomation.enabled() != updatedAutomation.enabled() || oldAutomation.modulation() != updatedAutomation.modulation()) {
                 notifyChangedLinesMerged(oldAutomation, updatedAutomation);
@@ -197,7 +204,7 @@ quint64 AutomationService::addPitchBendAutomation(quint64 pattern, quint64 track
     const AutomationLocation location = { pattern, track, column };
     const PitchBendAutomation::InterpolationParameters parameters = { line0, line1, value0, value1 };
     const auto automation = PitchBendAutomation { id, location, parameters, comment, enabled };
-    m_automations.pitchBend.push_back(automation);
+    pushPitchBendAutomation(automation);
     notifyChangedLines(pattern, track, column, line0, line1);
     juzzlin::L(TAG).info() << "Pitch Bend Automation added: " << automation.toString().toStdString();
     return automation.id();
@@ -209,7 +216,10 @@ void AutomationService::deletePitchBendAutomation(const PitchBendAutomation & au
             return automationToDelete.id() == existingAutomation.id();
         });
         iter != m_automations.pitchBend.end()) {
+        const auto location = iter->location();
+        const auto position = static_cast<size_t>(std::distance(m_automations.pitchBend.begin(), iter));
         m_automations.pitchBend.erase(iter);
+        m_automations.pitchBendIndex.remove(location, position);
         notifyChangedLines(automationToDelete);
         juzzlin::L(TAG).info() << "Pitch Bend Automation deleted: " << automationToDelete.toString().toStdString();
     } else {
@@ -225,6 +235,10 @@ void AutomationService::updatePitchBendAutomation(const PitchBendAutomation & up
         iter != m_automations.pitchBend.end()) {
         if (const auto oldAutomation = *iter; oldAutomation != updatedAutomation) {
             *iter = updatedAutomation;
+            if (oldAutomation.location() != updatedAutomation.location() || oldAutomation.interpolation().line0 != updatedAutomation.interpolation().line0 || oldAutomation.interpolation().line1 != updatedAutomation.interpolation().line1) {
+                const auto position = static_cast<size_t>(std::distance(m_automations.pitchBend.begin(), iter));
+                m_automations.pitchBendIndex.update(oldAutomation.location(), updatedAutomation.location(), updatedAutomation.interpolation().line0, updatedAutomation.interpolation().line1, position);
+            }
             if (oldAutomation.interpolation() != updatedAutomation.interpolation() || //
                 oldAutomation.enabled() != updatedAutomation.enabled() || oldAutomation.modulation() != updatedAutomation.modulation()) {
                 notifyChangedLinesMerged(oldAutomation, updatedAutomation);
@@ -244,7 +258,7 @@ quint64 AutomationService::addPitchBendAutomation(const PitchBendAutomation & au
     const auto id = maxIdItem != m_automations.pitchBend.end() ? (*maxIdItem).id() + 1 : 1;
     auto newAutomation = automation;
     newAutomation.setId(id);
-    m_automations.pitchBend.push_back(newAutomation);
+    pushPitchBendAutomation(newAutomation);
     notifyChangedLines(newAutomation);
     juzzlin::L(TAG).info() << "Pitch Bend Automation added (from object): " << newAutomation.toString().toStdString();
     return newAutomation.id();
@@ -252,7 +266,7 @@ quint64 AutomationService::addPitchBendAutomation(const PitchBendAutomation & au
 
 void AutomationService::addPitchBendAutomationWithId(const PitchBendAutomation & automation)
 {
-    m_automations.pitchBend.push_back(automation);
+    pushPitchBendAutomation(automation);
     notifyChangedLines(automation);
     juzzlin::L(TAG).info() << "Pitch Bend Automation added (with ID): " << automation.toString().toStdString();
 }
@@ -264,22 +278,16 @@ bool AutomationService::hasAutomations(quint64 pattern, quint64 track, quint64 c
 
 bool AutomationService::hasMidiCcAutomations(quint64 pattern, quint64 track, quint64 column, quint64 line) const
 {
-    const auto match = std::ranges::find_if(m_automations.midiCc, [&](auto && automation) {
-        auto && location = automation.location();
-        auto && interpolation = automation.interpolation();
-        return automation.enabled() && location.pattern() == pattern && location.track() == track && location.column() == column && line >= interpolation.line0 && line <= interpolation.line1;
+    return m_automations.midiCcIndex.anyAt({ pattern, track, column }, line, [&](size_t position) {
+        return m_automations.midiCc.at(position).enabled();
     });
-    return match != m_automations.midiCc.end();
 }
 
 bool AutomationService::hasPitchBendAutomations(quint64 pattern, quint64 track, quint64 column, quint64 line) const
 {
-    const auto match = std::ranges::find_if(m_automations.pitchBend, [&](auto && automation) {
-        auto && location = automation.location();
-        auto && interpolation = automation.interpolation();
-        return automation.enabled() && location.pattern() == pattern && location.track() == track && location.column() == column && line >= interpolation.line0 && line <= interpolation.line1;
+    return m_automations.pitchBendIndex.anyAt({ pattern, track, column }, line, [&](size_t position) {
+        return m_automations.pitchBend.at(position).enabled();
     });
-    return match != m_automations.pitchBend.end();
 }
 
 AutomationService::AutomationCurveList AutomationService::automationCurves(quint64 pattern, quint64 track, quint64 column, quint64 startLine, quint64 endLine) const
@@ -310,19 +318,20 @@ AutomationService::AutomationCurveList AutomationService::automationCurves(quint
         }
     };
 
-    for (const auto & automation : m_automations.midiCc) {
-        const auto & location = automation.location();
-        if (!automation.enabled() || location.pattern() != pattern || location.track() != track || location.column() != column) {
+    const AutomationLocation columnLocation { pattern, track, column };
+    for (auto && position : m_automations.midiCcIndex.positions(columnLocation)) {
+        const auto & automation = m_automations.midiCc.at(position);
+        if (!automation.enabled()) {
             continue;
         }
-        const auto maxValue = controllerMaxValue(automation.controller(), location.track());
+        const auto maxValue = controllerMaxValue(automation.controller(), track);
         collect(automation.id(), false, automation.interpolation().line0, automation.interpolation().line1,
                 [&](size_t line) { return maxValue > 0 ? static_cast<double>(midiCcValueAt(automation, line)) / maxValue : 0.0; });
     }
 
-    for (const auto & automation : m_automations.pitchBend) {
-        const auto & location = automation.location();
-        if (!automation.enabled() || location.pattern() != pattern || location.track() != track || location.column() != column) {
+    for (auto && position : m_automations.pitchBendIndex.positions(columnLocation)) {
+        const auto & automation = m_automations.pitchBend.at(position);
+        if (!automation.enabled()) {
             continue;
         }
         collect(automation.id(), true, automation.interpolation().line0, automation.interpolation().line1,
@@ -343,16 +352,15 @@ double AutomationService::midiCcAutomationWeight(quint64 pattern, quint64 track,
     // every column on every repaint, and rendering allocated a shared Event per automation per call.
     double sum = 0.0;
     int count = 0;
-    for (const auto & automation : m_automations.midiCc) {
-        const auto & location = automation.location();
-        const auto & interpolation = automation.interpolation();
-        if (automation.enabled() && location.pattern() == pattern && location.track() == track && location.column() == column && line >= interpolation.line0 && line <= interpolation.line1) {
-            if (const auto maxValue = controllerMaxValue(automation.controller(), location.track()); maxValue > 0) {
+    m_automations.midiCcIndex.forEachAt({ pattern, track, column }, line, [&](size_t position) {
+        const auto & automation = m_automations.midiCc.at(position);
+        if (automation.enabled()) {
+            if (const auto maxValue = controllerMaxValue(automation.controller(), track); maxValue > 0) {
                 sum += static_cast<double>(midiCcValueAt(automation, static_cast<size_t>(line))) / maxValue;
                 count++;
             }
         }
-    }
+    });
     return count ? sum / count : 0;
 }
 
@@ -360,39 +368,31 @@ double AutomationService::pitchBendAutomationWeight(quint64 pattern, quint64 tra
 {
     double sum = 0.0;
     int count = 0;
-    for (const auto & automation : m_automations.pitchBend) {
-        const auto & location = automation.location();
-        const auto & interpolation = automation.interpolation();
-        if (automation.enabled() && location.pattern() == pattern && location.track() == track && location.column() == column && line >= interpolation.line0 && line <= interpolation.line1) {
+    m_automations.pitchBendIndex.forEachAt({ pattern, track, column }, line, [&](size_t position) {
+        const auto & automation = m_automations.pitchBend.at(position);
+        if (automation.enabled()) {
             sum += (static_cast<double>(pitchBendValueAt(automation, static_cast<size_t>(line))) + 100.0) / 200.0;
             count++;
         }
-    }
+    });
     return count ? sum / count : 0;
 }
 
 AutomationService::MidiCcAutomationList AutomationService::midiCcAutomationsByLine(quint64 pattern, quint64 track, quint64 column, quint64 line) const
 {
     MidiCcAutomationList automations;
-    std::ranges::copy(m_automations.midiCc
-                        | std::views::filter([&](auto && automation) {
-                              auto && location = automation.location();
-                              auto && interpolation = automation.interpolation();
-                              return location.pattern() == pattern && location.track() == track && location.column() == column && line >= interpolation.line0 && line <= interpolation.line1;
-                          }),
-                      std::back_inserter(automations));
+    for (auto && position : m_automations.midiCcIndex.positionsAt({ pattern, track, column }, line)) {
+        automations.push_back(m_automations.midiCc.at(position));
+    }
     return automations;
 }
 
 AutomationService::MidiCcAutomationList AutomationService::midiCcAutomationsByColumn(quint64 pattern, quint64 track, quint64 column) const
 {
     MidiCcAutomationList automations;
-    std::ranges::copy(m_automations.midiCc
-                        | std::views::filter([&](auto && automation) {
-                              auto && location = automation.location();
-                              return location.pattern() == pattern && location.track() == track && location.column() == column;
-                          }),
-                      std::back_inserter(automations));
+    for (auto && position : m_automations.midiCcIndex.positions({ pattern, track, column })) {
+        automations.push_back(m_automations.midiCc.at(position));
+    }
     return automations;
 }
 
@@ -428,25 +428,18 @@ AutomationService::MidiCcAutomationList AutomationService::midiCcAutomations() c
 AutomationService::PitchBendAutomationList AutomationService::pitchBendAutomationsByLine(quint64 pattern, quint64 track, quint64 column, quint64 line) const
 {
     PitchBendAutomationList automations;
-    std::ranges::copy(m_automations.pitchBend
-                        | std::views::filter([&](auto && automation) {
-                              auto && location = automation.location();
-                              auto && interpolation = automation.interpolation();
-                              return location.pattern() == pattern && location.track() == track && location.column() == column && line >= interpolation.line0 && line <= interpolation.line1;
-                          }),
-                      std::back_inserter(automations));
+    for (auto && position : m_automations.pitchBendIndex.positionsAt({ pattern, track, column }, line)) {
+        automations.push_back(m_automations.pitchBend.at(position));
+    }
     return automations;
 }
 
 AutomationService::PitchBendAutomationList AutomationService::pitchBendAutomationsByColumn(quint64 pattern, quint64 track, quint64 column) const
 {
     PitchBendAutomationList automations;
-    std::ranges::copy(m_automations.pitchBend
-                        | std::views::filter([&](auto && automation) {
-                              auto && location = automation.location();
-                              return location.pattern() == pattern && location.track() == track && location.column() == column;
-                          }),
-                      std::back_inserter(automations));
+    for (auto && position : m_automations.pitchBendIndex.positions({ pattern, track, column })) {
+        automations.push_back(m_automations.pitchBend.at(position));
+    }
     return automations;
 }
 
@@ -525,14 +518,10 @@ AutomationService::EventList AutomationService::renderMidiCcToEventsByLine(size_
 {
     EventList events;
 
-    for (const auto & automation : m_automations.midiCc) {
-        if (automation.enabled()) {
-            const auto & location = automation.location();
-            const auto & interpolation = automation.interpolation();
-            if (location.pattern() == pattern && location.track() == track && location.column() == column && line >= interpolation.line0 && line <= interpolation.line1) {
-                const auto value = midiCcValueAt(automation, line);
-                events.push_back(std::make_shared<Event>(tick, MidiCcData { track, column, automation.controller(), static_cast<uint8_t>(value) }));
-            }
+    for (auto && position : m_automations.midiCcIndex.positionsAt({ pattern, track, column }, line)) {
+        if (const auto & automation = m_automations.midiCc.at(position); automation.enabled()) {
+            const auto value = midiCcValueAt(automation, line);
+            events.push_back(std::make_shared<Event>(tick, MidiCcData { track, column, automation.controller(), static_cast<uint8_t>(value) }));
         }
     }
 
@@ -590,14 +579,10 @@ AutomationService::EventList AutomationService::renderPitchBendToEventsByLine(si
 {
     EventList events;
 
-    for (const auto & automation : m_automations.pitchBend) {
-        if (automation.enabled()) {
-            const auto & location = automation.location();
-            const auto & interpolation = automation.interpolation();
-            if (location.pattern() == pattern && location.track() == track && location.column() == column && line >= interpolation.line0 && line <= interpolation.line1) {
-                const auto percentage = pitchBendValueAt(automation, line);
-                events.push_back(std::make_shared<Event>(tick, PitchBendData { track, column, static_cast<double>(percentage) }));
-            }
+    for (auto && position : m_automations.pitchBendIndex.positionsAt({ pattern, track, column }, line)) {
+        if (const auto & automation = m_automations.pitchBend.at(position); automation.enabled()) {
+            const auto percentage = pitchBendValueAt(automation, line);
+            events.push_back(std::make_shared<Event>(tick, PitchBendData { track, column, static_cast<double>(percentage) }));
         }
     }
 
@@ -616,66 +601,65 @@ AutomationService::EventList AutomationService::renderMidiCcToEventsByColumn(siz
 {
     EventList events;
 
-    for (const auto & automation : m_automations.midiCc) {
+    for (auto && position : m_automations.midiCcIndex.positions({ pattern, track, column })) {
+        const auto & automation = m_automations.midiCc.at(position);
         if (automation.enabled()) {
             const auto & location = automation.location();
             const auto & interpolation = automation.interpolation();
             const auto & modulation = automation.modulation();
-            if (location.pattern() == pattern && location.track() == track && location.column() == column) {
-                Interpolator interpolator {
-                    static_cast<size_t>(interpolation.line0),
-                    static_cast<size_t>(interpolation.line1),
-                    static_cast<double>(interpolation.value0),
-                    static_cast<double>(interpolation.value1),
-                    interpolation.curve
-                };
-
-                const uint8_t eventsPerBeat = automation.eventsPerBeat() > 0 ? std::min(automation.eventsPerBeat(), static_cast<uint8_t>(linesPerBeat)) : static_cast<uint8_t>(linesPerBeat);
-                const double interval = static_cast<double>(linesPerBeat) / static_cast<double>(eventsPerBeat);
-
-                juzzlin::L(TAG).debug() << "Rendering MidiCcAutomation " << automation.id() << ": eventsPerBeat=" << (int)eventsPerBeat << ", interval=" << interval << ", lineOffset=" << (int)automation.lineOffset();
-
-                std::optional<uint8_t> prevValue;
-                for (size_t line = interpolation.line0; line <= interpolation.line1; line++) {
-                    // Check if this line is an automated line based on Events Per Beat and Line Offset
-                    const size_t beatRelativeLine = line % linesPerBeat;
-                    bool shouldFire = false;
-
-                    for (int i = 0; i < eventsPerBeat; ++i) {
-                        const size_t fireLine = (static_cast<size_t>(std::round(i * interval)) + automation.lineOffset()) % linesPerBeat;
-                        if (beatRelativeLine == fireLine) {
-                            shouldFire = true;
-                            break;
-                        }
+            Interpolator interpolator {
+                static_cast<size_t>(interpolation.line0),
+                static_cast<size_t>(interpolation.line1),
+                static_cast<double>(interpolation.value0),
+                static_cast<double>(interpolation.value1),
+                interpolation.curve
+            };
+
+            const uint8_t eventsPerBeat = automation.eventsPerBeat() > 0 ? std::min(automation.eventsPerBeat(), static_cast<uint8_t>(linesPerBeat)) : static_cast<uint8_t>(linesPerBeat);
+            const double interval = static_cast<double>(linesPerBeat) / static_cast<double>(eventsPerBeat);
+
+            juzzlin::L(TAG).debug() << "Rendering MidiCcAutomation " << automation.id() << ": eventsPerBeat=" << (int)eventsPerBeat << ", interval=" << interval << ", lineOffset=" << (int)automation.lineOffset();
+
+            std::optional<uint8_t> prevValue;
+            for (size_t line = interpolation.line0; line <= interpolation.line1; line++) {
+                // Check if this line is an automated line based on Events Per Beat and Line Offset
+                const size_t beatRelativeLine = line % linesPerBeat;
+                bool shouldFire = false;
+
+                for (int i = 0; i < eventsPerBeat; ++i) {
+                    const size_t fireLine = (static_cast<size_t>(std::round(i * interval)) + automation.lineOffset()) % linesPerBeat;
+                    if (beatRelativeLine == fireLine) {
+                        shouldFire = true;
+                        break;
                     }
+                }
 
-                    if (!shouldFire && line != interpolation.line1) {
-                        continue;
-                    }
+                if (!shouldFire && line != interpolation.line1) {
+                    continue;
+                }
 
-                    juzzlin::L(TAG).trace() << "Firing event for MidiCcAutomation " << automation.id() << " on line " << line;
+                juzzlin::L(TAG).trace() << "Firing event for MidiCcAutomation " << automation.id() << " on line " << line;
 
-                    double interpolatedValue = interpolator.getValue(static_cast<size_t>(line));
+                double interpolatedValue = interpolator.getValue(static_cast<size_t>(line));
 
-                    double totalModulation = 0.0;
-                    if (modulation.cycles > 0.f || modulation.amplitude > 0.f) {
-                        const double phase = interpolation.line1 > interpolation.line0 ? static_cast<double>(line - interpolation.line0) / (static_cast<double>(interpolation.line1 - interpolation.line0)) : 0;
-                        double modulationValue = 0.0;
-                        if (modulation.type == ModulationParameters::ModulationType::SineWave) {
-                            modulationValue = sineModulationValue(modulation, phase);
-                        } else if (modulation.type == ModulationParameters::ModulationType::Random) {
-                            modulationValue = randomModulationValue(automation.id(), modulation, phase);
-                        }
-                        totalModulation = modulationValue * modulation.amplitude / 100.0;
+                double totalModulation = 0.0;
+                if (modulation.cycles > 0.f || modulation.amplitude > 0.f) {
+                    const double phase = interpolation.line1 > interpolation.line0 ? static_cast<double>(line - interpolation.line0) / (static_cast<double>(interpolation.line1 - interpolation.line0)) : 0;
+                    double modulationValue = 0.0;
+                    if (modulation.type == ModulationParameters::ModulationType::SineWave) {
+                        modulationValue = sineModulationValue(modulation, phase);
+                    } else if (modulation.type == ModulationParameters::ModulationType::Random) {
+                        modulationValue = randomModulationValue(automation.id(), modulation, phase);
                     }
-                    totalModulation += modulation.offset / 100.0;
-                    interpolatedValue += totalModulation * controllerMaxValue(automation.controller(), location.track());
+                    totalModulation = modulationValue * modulation.amplitude / 100.0;
+                }
+                totalModulation += modulation.offset / 100.0;
+                interpolatedValue += totalModulation * controllerMaxValue(automation.controller(), location.track());
 
-                    const auto clampedValue = std::clamp(static_cast<int>(std::round(interpolatedValue)), 0, controllerMaxValue(automation.controller(), location.track())); // Value range of the destination
-                    if (!prevValue || *prevValue != clampedValue) {
-                        events.push_back(std::make_shared<Event>(tick + line * ticksPerLine, MidiCcData { track, column, automation.controller(), static_cast<uint8_t>(clampedValue) }));
-                        prevValue = clampedValue;
-                    }
+                const auto clampedValue = std::clamp(static_cast<int>(std::round(interpolatedValue)), 0, controllerMaxValue(automation.controller(), location.track())); // Value range of the destination
+                if (!prevValue || *prevValue != clampedValue) {
+                    events.push_back(std::make_shared<Event>(tick + line * ticksPerLine, MidiCcData { track, column, automation.controller(), static_cast<uint8_t>(clampedValue) }));
+                    prevValue = clampedValue;
                 }
             }
         }
@@ -688,43 +672,41 @@ AutomationService::EventList AutomationService::renderPitchBendToEventsByColumn(
 {
     EventList events;
 
-    for (const auto & automation : m_automations.pitchBend) {
+    for (auto && position : m_automations.pitchBendIndex.positions({ pattern, track, column })) {
+        const auto & automation = m_automations.pitchBend.at(position);
         if (automation.enabled()) {
-            const auto & location = automation.location();
             const auto & interpolation = automation.interpolation();
             const auto & modulation = automation.modulation();
-            if (location.pattern() == pattern && location.track() == track && location.column() == column) {
-                Interpolator interpolator {
-                    static_cast<size_t>(interpolation.line0),
-                    static_cast<size_t>(interpolation.line1),
-                    static_cast<double>(interpolation.value0),
-                    static_cast<double>(interpolation.value1),
-                    interpolation.curve
-                };
-                std::optional<double> prevValue;
-                for (size_t line = interpolation.line0; line <= interpolation.line1; line++) {
-                    double interpolatedValue = interpolator.getValue(static_cast<size_t>(line));
-
-                    double totalModulation = 0.0;
-                    if (modulation.cycles > 0.f || modulation.amplitude > 0.f) {
-                        const double phase = interpolation.line1 > interpolation.line0 ? static_cast<double>(line - interpolation.line0) / (static_cast<double>(interpolation.line1 - interpolation.line0)) : 0;
-                        double modulationValue = 0.0;
-                        if (modulation.type == ModulationParameters::ModulationType::SineWave) {
-                            modulationValue = sineModulationValue(modulation, phase);
-                        } else if (modulation.type == ModulationParameters::ModulationType::Random) {
-                            modulationValue = randomModulationValue(automation.id(), modulation, phase);
-                        }
-                        totalModulation = modulationValue * modulation.amplitude / 100.0;
-                    }
-                    totalModulation += modulation.offset / 100.0;
-                    interpolatedValue += totalModulation * 100.0;
-
-                    const auto percentage = std::clamp(static_cast<int>(std::round(interpolatedValue)), -100, 100);
-                    const double minDiff = 200.0 / 16383;
-                    if (!prevValue || std::fabs(*prevValue - percentage) > minDiff) {
-                        events.push_back(std::make_shared<Event>(tick + line * ticksPerLine, PitchBendData { track, column, static_cast<double>(percentage) }));
-                        prevValue = percentage;
+            Interpolator interpolator {
+                static_cast<size_t>(interpolation.line0),
+                static_cast<size_t>(interpolation.line1),
+                static_cast<double>(interpolation.value0),
+                static_cast<double>(interpolation.value1),
+                interpolation.curve
+            };
+            std::optional<double> prevValue;
+            for (size_t line = interpolation.line0; line <= interpolation.line1; line++) {
+                double interpolatedValue = interpolator.getValue(static_cast<size_t>(line));
+
+                double totalModulation = 0.0;
+                if (modulation.cycles > 0.f || modulation.amplitude > 0.f) {
+                    const double phase = interpolation.line1 > interpolation.line0 ? static_cast<double>(line - interpolation.line0) / (static_cast<double>(interpolation.line1 - interpolation.line0)) : 0;
+                    double modulationValue = 0.0;
+                    if (modulation.type == ModulationParameters::ModulationType::SineWave) {
+                        modulationValue = sineModulationValue(modulation, phase);
+                    } else if (modulation.type == ModulationParameters::ModulationType::Random) {
+                        modulationValue = randomModulationValue(automation.id(), modulation, phase);
                     }
+                    totalModulation = modulationValue * modulation.amplitude / 100.0;
+                }
+                totalModulation += modulation.offset / 100.0;
+                interpolatedValue += totalModulation * 100.0;
+
+                const auto percentage = std::clamp(static_cast<int>(std::round(interpolatedValue)), -100, 100);
+                const double minDiff = 200.0 / 16383;
+                if (!prevValue || std::fabs(*prevValue - percentage) > minDiff) {
+                    events.push_back(std::make_shared<Event>(tick + line * ticksPerLine, PitchBendData { track, column, static_cast<double>(percentage) }));
+                    prevValue = percentage;
                 }
             }
         }
@@ -751,6 +733,36 @@ void AutomationService::deletePatterns(const std::set<size_t> & patternsToDelete
     std::erase_if(m_automations.pitchBend, [&](auto && automation) {
         return patternsToDelete.contains(automation.location().pattern());
     });
+
+    // Every later position moves, so this is cheaper done once over the lot.
+    rebuildIndex();
+}
+
+void AutomationService::pushMidiCcAutomation(const MidiCcAutomation & automation)
+{
+    m_automations.midiCc.push_back(automation);
+    m_automations.midiCcIndex.add(automation.location(), automation.interpolation().line0, automation.interpolation().line1, m_automations.midiCc.size() - 1);
+}
+
+void AutomationService::pushPitchBendAutomation(const PitchBendAutomation & automation)
+{
+    m_automations.pitchBend.push_back(automation);
+    m_automations.pitchBendIndex.add(automation.location(), automation.interpolation().line0, automation.interpolation().line1, m_automations.pitchBend.size() - 1);
+}
+
+void AutomationService::rebuildIndex()
+{
+    m_automations.midiCcIndex.clear();
+    for (size_t position = 0; position < m_automations.midiCc.size(); position++) {
+        const auto & automation = m_automations.midiCc.at(position);
+        m_automations.midiCcIndex.add(automation.location(), automation.interpolation().line0, automation.interpolation().line1, position);
+    }
+
+    m_automations.pitchBendIndex.clear();
+    for (size_t position = 0; position < m_automations.pitchBend.size(); position++) {
+        const auto & automation = m_automations.pitchBend.at(position);
+        m_automations.pitchBendIndex.add(automation.location(), automation.interpolation().line0, automation.interpolation().line1, position);
+    }
 }
 
 void AutomationService::notifyChangedLines(quint64 pattern, quint64 track, quint64 column, quint64 line0, quint64 line1)
@@ -803,12 +815,12 @@ void AutomationService::deserializeFromXml(ProjectReader & reader)
         if (reader.isStartElement() && !reader.name().compare(Constants::NahdXml::xmlKeyMidiCcAutomation())) {
             if (const auto automation = MidiCcAutomation::deserializeFromXml(reader); automation) {
                 automation->setId(m_automations.midiCc.size() + 1); // Assign id on-the-fly
-                m_automations.midiCc.push_back(*automation);
+                pushMidiCcAutomation(*automation);
             }
         } else if (reader.isStartElement() && !reader.name().compare(Constants::NahdXml::xmlKeyPitchBendAutomation())) {
             if (const auto automation = PitchBendAutomation::deserializeFromXml(reader); automation) {
                 automation->setId(m_automations.pitchBend.size() + 1); // Assign id on-the-fly
-                m_automations.pitchBend.push_back(*automation);
+                pushPitchBendAutomation(*automation);
             }
         }
         reader.readNext();
@@ -26,6 +26,7 @@
 
 #include "../../domain/midi/midi_cc_automation.hpp"
 #include "../../domain/midi/pitch_bend_automation.hpp"
+#include "../../domain/tracker/automation_index.hpp"
 #include "../../domain/tracker/event.hpp"
 
 namespace noteahead {
@@ -152,10 +153,19 @@ private:
     double sineModulationValue(const ModulationParameters & modulation, double phase) const;
     double randomModulationValue(size_t automationId, const ModulationParameters & modulation, double phase) const;
 
+    //! Appends to the list and indexes the automation at its new position.
+    void pushMidiCcAutomation(const MidiCcAutomation & automation);
+    void pushPitchBendAutomation(const PitchBendAutomation & automation);
+    void rebuildIndex();
+
     struct Automations
     {
         MidiCcAutomationList midiCc;
         PitchBendAutomationList pitchBend;
+        //! Kept in step with the lists by every add, update and delete, so the per-line lookups the
+        //! editor makes on each repaint and the per-column ones playback makes do not scan them.
+        AutomationIndex midiCcIndex;
+        AutomationIndex pitchBendIndex;
     };
 
     //! Value range of a controller at the given track's destination.
@@ -32,9 +32,11 @@
 
 #include <QDateTime>
 #include <QFile>
+#include <QTimer>
 #include <QVariant>
 
 #include <algorithm>
+#include <exception>
 #include <format>
 #include <ranges>
 #include <set>
@@ -43,14 +45,21 @@ namespace noteahead {
 
 static const auto TAG = "DeviceService";
 
+//! One frame of a 60 Hz display: a dialog cannot show values any faster than that.
+static const int ParameterChangeIntervalMs = 16;
+
 DeviceService::DeviceService(AudioEngineS audioEngine, DataServiceS dataService, QObject * parent)
   : QObject { parent }
   , m_audioEngine { std::move(audioEngine) }
   , m_dataService { std::move(dataService) }
+  , m_parameterChangeTimer { new QTimer(this) }
 {
     for (int i = 0; i < 128; i++) {
         m_synthUserPresets[i] = SynthPresets::initPreset();
     }
+
+    m_parameterChangeTimer->setInterval(ParameterChangeIntervalMs);
+    connect(m_parameterChangeTimer, &QTimer::timeout, this, &DeviceService::dispatchParameterChanges);
 }
 
 DeviceService::~DeviceService() = default;
@@ -58,6 +67,17 @@ DeviceService::~DeviceService() = default;
 void DeviceService::setDevice(size_t slotIndex, DeviceS device)
 {
     connect(device.get(), &Device::dataChanged, this, &DeviceService::dataChanged);
+    // Queued when the mark comes from a transport thread, which must not touch the timer.
+    connect(device.get(), &Device::parametersChangePending, this, &DeviceService::startParameterChangeDispatch);
+    prepareDevice(slotIndex, device);
+    m_audioEngine->setDevice(slotIndex, std::move(device));
+    // A mark made before the connection emitted to no one: one frame picks it up.
+    startParameterChangeDispatch();
+    emit dataChanged();
+}
+
+void DeviceService::prepareDevice(size_t slotIndex, const DeviceS & device)
+{
     device->setId(slotIndex);
     if (const auto sampler = std::dynamic_pointer_cast<SamplerDevice>(device)) {
         sampler->setProjectPath(m_projectPath);
@@ -65,8 +85,6 @@ void DeviceService::setDevice(size_t slotIndex, DeviceS device)
             return m_dataService->resolvePath(path);
         });
     }
-    m_audioEngine->setDevice(slotIndex, std::move(device));
-    emit dataChanged();
 }
 
 void DeviceService::clearDevice(size_t slotIndex)
@@ -106,7 +124,7 @@ bool DeviceService::wouldCreateCycle(size_t subMixerSlot, size_t memberSlot) con
 
 void DeviceService::pruneSubMixerMembers()
 {
-    for (size_t slotIndex = 0; slotIndex < Constants::deviceRackSize(); slotIndex++) {
+    for (const auto slotIndex : deviceSlots()) {
         const auto sub = std::dynamic_pointer_cast<SubMixerDevice>(device(slotIndex));
         if (!sub) {
             continue;
@@ -144,7 +162,7 @@ bool DeviceService::addSubMixerMember(int subMixerSlot, int memberSlot)
     const auto sub = std::dynamic_pointer_cast<SubMixerDevice>(device(subSlot));
 
     // Exclusive membership: being summed by two SubMixers would play the device twice.
-    for (size_t other = 0; other < Constants::deviceRackSize(); other++) {
+    for (const auto other : deviceSlots()) {
         if (other == subSlot) {
             continue;
         }
@@ -210,7 +228,7 @@ int DeviceService::subMixerOwningSlot(int memberSlot) const
     if (memberSlot < 0) {
         return -1;
     }
-    for (size_t slotIndex = 0; slotIndex < Constants::deviceRackSize(); slotIndex++) {
+    for (const auto slotIndex : deviceSlots()) {
         if (const auto sub = std::dynamic_pointer_cast<SubMixerDevice>(device(slotIndex))) {
             const auto members = sub->members();
             if (std::ranges::find(members, static_cast<size_t>(memberSlot)) != members.end()) {
@@ -327,11 +345,47 @@ void DeviceService::clearAutomation()
     }
 }
 
+void DeviceService::dispatchParameterChanges()
+{
+    // Never under a device lock: the receivers read back from the audio engine, whose callback
+    // holds the engine mutex and then waits for the device's.
+    bool dispatched = false;
+    for (auto && slot : deviceSlots()) {
+        if (const auto dev = device(slot); dev && dev->takeParametersChanged()) {
+            emit dev->parametersChanged();
+            dispatched = true;
+        }
+    }
+    // A frame with nothing to report ends the run. The next mark starts it again.
+    if (!dispatched) {
+        m_parameterChangeTimer->stop();
+    }
+}
+
+bool DeviceService::isDispatchingParameterChanges() const
+{
+    return m_parameterChangeTimer->isActive();
+}
+
+void DeviceService::startParameterChangeDispatch()
+{
+    // Restarting a running timer would put the next frame off again for as long as marks kept
+    // coming, so a dense automation would not be reported at all.
+    if (!m_parameterChangeTimer->isActive()) {
+        m_parameterChangeTimer->start();
+    }
+}
+
 DeviceService::InternalDeviceNames DeviceService::internalDeviceNames() const
 {
     return m_audioEngine->deviceNames();
 }
 
+DeviceService::DeviceSlots DeviceService::deviceSlots() const
+{
+    return m_audioEngine->deviceSlots();
+}
+
 QStringList DeviceService::internalDeviceNamesQt() const
 {
     QStringList names;
@@ -396,8 +450,8 @@ void DeviceService::saveSynthUserPreset(int index, const SynthPreset & preset)
 void DeviceService::setProjectPath(const std::string & projectPath)
 {
     m_projectPath = projectPath;
-    for (size_t i = 0; i < Constants::deviceRackSize(); i++) {
-        if (const auto dev = m_audioEngine->device(i)) {
+    for (const auto slotIndex : deviceSlots()) {
+        if (const auto dev = m_audioEngine->device(slotIndex)) {
             if (const auto sampler = std::dynamic_pointer_cast<SamplerDevice>(dev)) {
                 sampler->setProjectPath(m_projectPath);
             }
@@ -405,6 +459,15 @@ void DeviceService::setProjectPath(const std::string & projectPath)
     }
 }
 
+void DeviceService::prepareSampleRate(uint32_t sampleRate)
+{
+    for (const auto slotIndex : deviceSlots()) {
+        if (const auto sampler = std::dynamic_pointer_cast<SamplerDevice>(m_audioEngine->device(slotIndex))) {
+            sampler->prepareSampleRate(sampleRate);
+        }
+    }
+}
+
 std::map<QString, QString> DeviceService::getFilesToEmbed() const
 {
     std::map<QString, QString> allFiles;
@@ -438,7 +501,7 @@ void DeviceService::serializeDevices(ProjectWriter & writer) const
 
 void DeviceService::serializeReverbSends(ProjectWriter & writer) const
 {
-    for (int deviceSlot = 0; deviceSlot < static_cast<int>(Constants::deviceRackSize()); deviceSlot++) {
+    for (const auto deviceSlot : deviceSlots()) {
         if (const auto dev = m_audioEngine->device(deviceSlot)) {
             for (int effectSlot = 0; effectSlot < static_cast<int>(Constants::effectRackSize()); effectSlot++) {
                 const float send = dev->reverbSend(effectSlot);
@@ -557,19 +620,21 @@ DeviceService::DeviceS DeviceService::getDevice(std::string name, std::string ty
     }
 }
 
-void DeviceService::deserializeDevice(ProjectReader & reader)
+void DeviceService::deserializeDevice(ProjectReader & reader, PendingDevices & pendingDevices)
 {
     const auto name = reader.attribute(Constants::NahdXml::xmlKeyName()).toString();
     const auto typeId = reader.attribute(Constants::NahdXml::xmlKeyTypeId()).toString();
     const auto slotAttr = reader.attribute(Constants::NahdXml::xmlKeySlot());
-    if (slotAttr.isNull() || slotAttr.toUInt() > Constants::deviceRackSize()) {
+    if (slotAttr.isNull() || slotAttr.toUInt() >= Constants::deviceRackSize()) {
         juzzlin::L(TAG).warning() << std::format("Skipping device {} ({}) with slot index {} out of bounds!", typeId.toStdString(), name.toStdString(), slotAttr.toUInt());
         reader.skipCurrentElement();
         return;
     }
     if (const auto dev = getDevice(name.toStdString(), typeId.toStdString()); dev) {
-        setDevice(slotAttr.toUInt(), dev);
-        dev->deserializeFromXml(reader);
+        // Created here, on the thread the service lives on, so the device is owned by it too.
+        // Only reading the element waits for loadDevices().
+        prepareDevice(slotAttr.toUInt(), dev);
+        pendingDevices.push_back({ slotAttr.toUInt(), dev, reader.readElementXml() });
     } else {
         juzzlin::L(TAG).error() << std::format("Failed to create device {} ({}) with slot index {}", typeId.toStdString(), name.toStdString(), slotAttr.toUInt());
         reader.skipCurrentElement();
@@ -698,12 +763,49 @@ void DeviceService::deserializeUserPresets(ProjectReader & reader)
     setSynthUserPresets(m_synthUserPresets);
 }
 
+void DeviceService::loadDevices(PendingDevices & pendingDevices)
+{
+    if (pendingDevices.empty()) {
+        return;
+    }
+
+    juzzlin::L(TAG).info() << "Loading " << pendingDevices.size() << " devices";
+    // Reported on the calling thread only: the receivers live on it.
+    const auto reportProgress = [&](size_t count) {
+        juzzlin::L(TAG).debug() << "Loaded device " << count << "/" << pendingDevices.size();
+        emit statusTextRequested(tr("Loading devices: %1/%2").arg(count).arg(pendingDevices.size()));
+    };
+    const auto load = [&](size_t i) {
+        NahdXmlReader reader { pendingDevices.at(i).xml };
+        reader.readNextStartElement();
+        pendingDevices.at(i).device->deserializeFromXml(reader);
+    };
+    try {
+        Utils::Parallel::run(pendingDevices.size(), load, reportProgress);
+    } catch (...) {
+        // All or nothing, as when devices were read in line: a device that failed fails the project.
+        pendingDevices.clear();
+        throw;
+    }
+
+    for (auto && pending : pendingDevices) {
+        setDevice(pending.slotIndex, std::move(pending.device));
+    }
+    pendingDevices.clear();
+}
+
 void DeviceService::deserializeFromXml(ProjectReader & reader)
 {
+    // Devices are gathered and loaded as a batch once their run ends: the sections after them
+    // find devices by slot.
+    PendingDevices pendingDevices;
     while (reader.readNextStartElement()) {
         if (reader.name() == Constants::NahdXml::xmlKeyDevice()) {
-            deserializeDevice(reader);
-        } else if (reader.name() == Constants::NahdXml::xmlKeySynth()) {
+            deserializeDevice(reader, pendingDevices);
+            continue;
+        }
+        loadDevices(pendingDevices);
+        if (reader.name() == Constants::NahdXml::xmlKeySynth()) {
             // Handled via generic Device element if present in slot
         } else if (reader.name() == Constants::NahdXml::xmlKeyMasterEffects()) {
             deserializeMasterEffects(reader);
@@ -713,6 +815,7 @@ void DeviceService::deserializeFromXml(ProjectReader & reader)
             reader.skipCurrentElement();
         }
     }
+    loadDevices(pendingDevices);
     emit dataChanged();
 }
 
@@ -908,7 +1011,7 @@ void DeviceService::resetLoudnessMeters()
 
     resetRack(m_audioEngine->sendEffectRack());
     resetRack(m_audioEngine->insertEffectRack());
-    for (size_t slotIndex = 0; slotIndex < Constants::deviceRackSize(); slotIndex++) {
+    for (const auto slotIndex : deviceSlots()) {
         if (const auto device = this->device(slotIndex)) {
             resetRack(device->insertEffectRack());
         }
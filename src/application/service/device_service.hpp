@@ -29,6 +29,8 @@
 #include <memory>
 #include <string>
 
+class QTimer;
+
 namespace noteahead {
 
 class AudioEngine;
@@ -87,8 +89,18 @@ public:
     //! sweep for everything the message never reached.
     void clearAutomation();
 
+    //! Emits parametersChanged() once for every device that marked a parameter as moved since the
+    //! last call, however many times it did. Runs once per display frame on the thread this service
+    //! lives on, so automation at any density costs the UI at most one refresh per device per frame.
+    //! The frames run only from a device's first mark until one of them finds nothing to report.
+    void dispatchParameterChanges();
+    bool isDispatchingParameterChanges() const;
+
     using InternalDeviceNames = std::vector<std::string>;
     virtual InternalDeviceNames internalDeviceNames() const;
+    //! The slots holding a device, in order. What to walk instead of the whole rack.
+    using DeviceSlots = std::vector<size_t>;
+    virtual DeviceSlots deviceSlots() const;
 
     //! Add a device slot to a SubMixer's member list.
     //!
@@ -115,6 +127,10 @@ public:
 
     void setProjectPath(const std::string & projectPath);
 
+    //! Gets the devices ready to be rendered at the given rate, ahead of the first block: the
+    //! Samplers convert their samples to it. Blocks until they have.
+    void prepareSampleRate(uint32_t sampleRate);
+
     void serializeToXml(ProjectWriter & writer) const;
     void deserializeFromXml(ProjectReader & reader);
 
@@ -157,6 +173,8 @@ public:
 signals:
     void dataChanged();
     void synthUserPresetsChanged(const UserPresets & presets);
+    //! How far loading a project's devices has got.
+    void statusTextRequested(QString message);
 
 private:
     bool importDeviceSettingsFromXml(int slotIndex, const QString & xml);
@@ -168,8 +186,13 @@ private:
     //! Drops member slots that no longer hold a device, so a deleted device cannot leave a
     //! SubMixer silently claiming an empty slot.
     void pruneSubMixerMembers();
+    //! Starts the frame timer unless it is already running.
+    void startParameterChangeDispatch();
 
     DeviceService::DeviceS getDevice(std::string name, std::string typeId);
+    //! What a device needs from the service before it can load anything: its id, and for a
+    //! Sampler where relative and embedded sample paths point.
+    void prepareDevice(size_t slotIndex, const DeviceS & device);
 
     std::shared_ptr<SynthDevice> findFirstSynthDevice() const;
 
@@ -181,7 +204,21 @@ private:
     void serializePreset(ProjectWriter & writer, int index, const SynthPreset & preset, const std::shared_ptr<SynthDevice> & synth) const;
     void serializePresetParameter(ProjectWriter & writer, const std::string & paramName, float value, const std::shared_ptr<SynthDevice> & synth) const;
 
-    void deserializeDevice(ProjectReader & reader);
+    //! A device read out of the project but not loaded yet: its element, kept as a document of
+    //! its own so it can be read on any thread.
+    struct PendingDevice
+    {
+        size_t slotIndex { 0 };
+        DeviceS device;
+        QString xml;
+    };
+    using PendingDevices = std::vector<PendingDevice>;
+
+    void deserializeDevice(ProjectReader & reader, PendingDevices & pendingDevices);
+    //! Loads the pending devices side by side, one worker thread per core, then puts them in the
+    //! rack together in slot order. Decoding a Sampler's samples and building a synth's tables
+    //! dominate opening a project and nothing in them is shared between devices.
+    void loadDevices(PendingDevices & pendingDevices);
     void deserializeMasterEffects(ProjectReader & reader);
     void deserializeSendEffects(ProjectReader & reader);
     void deserializeEffectSend(ProjectReader & reader);
@@ -195,6 +232,7 @@ private:
     UserPresets m_synthUserPresets;
     std::string m_projectPath;
     SamplerAudioFileReaderFactory m_samplerAudioFileReaderFactory;
+    QTimer * m_parameterChangeTimer = nullptr;
 };
 
 } // namespace noteahead
@@ -17,6 +17,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <map>
+#include <tuple>
 
 #include "../../common/constants.hpp"
 #include "../../common/utils.hpp"
@@ -1904,6 +1906,30 @@ void EditorService::notifyPositionChange(const Position & oldPosition)
     }
 }
 
+void EditorService::notifyNoteDataChanges(const NoteChangeList & changes)
+{
+    std::map<std::tuple<quint64, quint64, quint64>, std::pair<Position, Position>> ranges; // Pattern, Track, Column
+    for (auto && change : changes) {
+        const auto & position = change.position;
+        if (const auto [it, inserted] = ranges.try_emplace({ position.pattern, position.track, position.column }, position, position); !inserted) {
+            auto && [startPosition, endPosition] = it->second;
+            if (position.line < startPosition.line) {
+                startPosition = position;
+            } else if (position.line > endPosition.line) {
+                endPosition = position;
+            }
+        }
+    }
+
+    for (auto && [column, range] : ranges) {
+        emit noteDataRangeChanged(range.first, range.second);
+    }
+
+    if (!changes.empty()) {
+        setIsModified(true);
+    }
+}
+
 void EditorService::requestColumnCut()
 {
     juzzlin::L(TAG).info() << "Requesting column cut";
@@ -1918,9 +1944,8 @@ void EditorService::requestColumnCut()
         return;
     }
 
-    auto noteEditCommand = std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const Position & pos) {
-        emit noteDataAtPositionChanged(pos);
-        setIsModified(true);
+    auto noteEditCommand = std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const NoteChangeList & noteChanges) {
+        notifyNoteDataChanges(noteChanges);
         updateDuration(); }, [this](const Position & pos) { requestPosition(pos); });
 
     if (m_automationService) {
@@ -1971,9 +1996,8 @@ void EditorService::requestColumnPaste()
             }
         }
 
-        auto noteEditCommand = std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const Position & pos) {
-            emit noteDataAtPositionChanged(pos);
-            setIsModified(true);
+        auto noteEditCommand = std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const NoteChangeList & noteChanges) {
+            notifyNoteDataChanges(noteChanges);
             updateDuration(); }, [this](const Position & pos) { requestPosition(pos); });
 
         if (m_automationService) {
@@ -2006,9 +2030,8 @@ void EditorService::requestColumnPaste()
 void EditorService::requestColumnTranspose(int semitones)
 {
     if (auto changes = m_song->transposeColumn(m_state.cursorPosition, semitones); !changes.empty()) {
-        m_undoStack->push(std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const Position & pos) {
-            emit noteDataAtPositionChanged(pos);
-            setIsModified(true); }, [this](const Position & pos) { requestPosition(pos); }));
+        m_undoStack->push(std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const NoteChangeList & noteChanges) {
+            notifyNoteDataChanges(noteChanges); }, [this](const Position & pos) { requestPosition(pos); }));
     }
 }
 
@@ -2038,9 +2061,8 @@ void EditorService::requestTrackCut()
         return;
     }
 
-    auto noteEditCommand = std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const Position & pos) {
-        emit noteDataAtPositionChanged(pos);
-        setIsModified(true);
+    auto noteEditCommand = std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const NoteChangeList & noteChanges) {
+        notifyNoteDataChanges(noteChanges);
         updateDuration(); }, [this](const Position & pos) { requestPosition(pos); });
 
     if (m_automationService) {
@@ -2091,9 +2113,8 @@ void EditorService::requestTrackPaste()
             }
         }
 
-        auto noteEditCommand = std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const Position & pos) {
-            emit noteDataAtPositionChanged(pos);
-            setIsModified(true);
+        auto noteEditCommand = std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const NoteChangeList & noteChanges) {
+            notifyNoteDataChanges(noteChanges);
             updateDuration(); }, [this](const Position & pos) { requestPosition(pos); });
 
         if (m_automationService) {
@@ -2131,9 +2152,8 @@ bool EditorService::hasTrackToPaste() const
 void EditorService::requestTrackTranspose(int semitones)
 {
     if (auto changes = m_song->transposeTrack(m_state.cursorPosition, semitones); !changes.empty()) {
-        m_undoStack->push(std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const Position & pos) {
-            emit noteDataAtPositionChanged(pos);
-            setIsModified(true); }, [this](const Position & pos) { requestPosition(pos); }));
+        m_undoStack->push(std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const NoteChangeList & noteChanges) {
+            notifyNoteDataChanges(noteChanges); }, [this](const Position & pos) { requestPosition(pos); }));
     }
 }
 
@@ -2151,9 +2171,8 @@ void EditorService::requestPatternCut()
         return;
     }
 
-    auto noteEditCommand = std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const Position & pos) {
-        emit noteDataAtPositionChanged(pos);
-        setIsModified(true);
+    auto noteEditCommand = std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const NoteChangeList & noteChanges) {
+        notifyNoteDataChanges(noteChanges);
         updateDuration(); }, [this](const Position & pos) { requestPosition(pos); });
 
     if (m_automationService) {
@@ -2213,9 +2232,8 @@ void EditorService::requestPatternPaste()
             }
         }
 
-        auto noteEditCommand = std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const Position & pos) {
-            emit noteDataAtPositionChanged(pos);
-            setIsModified(true);
+        auto noteEditCommand = std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const NoteChangeList & noteChanges) {
+            notifyNoteDataChanges(noteChanges);
             updateDuration(); }, [this](const Position & pos) { requestPosition(pos); });
 
         if (m_automationService) {
@@ -2253,18 +2271,16 @@ bool EditorService::hasPatternToPaste() const
 void EditorService::requestPatternTranspose(int semitones)
 {
     if (auto changes = m_song->transposePattern(m_state.cursorPosition, semitones); !changes.empty()) {
-        m_undoStack->push(std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const Position & pos) {
-            emit noteDataAtPositionChanged(pos);
-            setIsModified(true); }, [this](const Position & pos) { requestPosition(pos); }));
+        m_undoStack->push(std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const NoteChangeList & noteChanges) {
+            notifyNoteDataChanges(noteChanges); }, [this](const Position & pos) { requestPosition(pos); }));
     }
 }
 
 void EditorService::requestSongTranspose(int semitones)
 {
     if (auto changes = m_song->transposeSong(semitones); !changes.empty()) {
-        m_undoStack->push(std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const Position & pos) {
-            emit noteDataAtPositionChanged(pos);
-            setIsModified(true); }, [this](const Position & pos) { requestPosition(pos); }));
+        m_undoStack->push(std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const NoteChangeList & noteChanges) {
+            notifyNoteDataChanges(noteChanges); }, [this](const Position & pos) { requestPosition(pos); }));
     }
 }
 
@@ -2282,9 +2298,8 @@ void EditorService::requestSelectionCut()
         return;
     }
 
-    auto noteEditCommand = std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const Position & pos) {
-        emit noteDataAtPositionChanged(pos);
-        setIsModified(true);
+    auto noteEditCommand = std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const NoteChangeList & noteChanges) {
+        notifyNoteDataChanges(noteChanges);
         updateDuration(); }, [this](const Position & pos) { requestPosition(pos); });
 
     if (m_automationService) {
@@ -2335,9 +2350,8 @@ void EditorService::requestSelectionPaste()
             }
         }
 
-        auto noteEditCommand = std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const Position & pos) {
-            emit noteDataAtPositionChanged(pos);
-            setIsModified(true);
+        auto noteEditCommand = std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const NoteChangeList & noteChanges) {
+            notifyNoteDataChanges(noteChanges);
             updateDuration(); }, [this](const Position & pos) { requestPosition(pos); });
 
         if (m_automationService) {
@@ -2411,9 +2425,8 @@ void EditorService::requestSelectionTranspose(int semitones)
             }
         }
         if (!changes.empty()) {
-            m_undoStack->push(std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const Position & pos) {
-                emit noteDataAtPositionChanged(pos);
-                setIsModified(true); }, [this](const Position & pos) { requestPosition(pos); }));
+            m_undoStack->push(std::make_shared<NoteEditCommand>(m_song, std::move(changes), m_state.cursorPosition, m_state.cursorPosition, [this](const NoteChangeList & noteChanges) {
+                notifyNoteDataChanges(noteChanges); }, [this](const Position & pos) { requestPosition(pos); }));
         }
     }
 }
@@ -459,6 +459,8 @@ signals:
     void audioRecorderDeserializationRequested(ProjectReader & xmlStreamReader);
 
     void noteDataAtPositionChanged(const Position & position);
+    //! Lines startPosition.line..endPosition.line of one column have changed.
+    void noteDataRangeChanged(const Position & startPosition, const Position & endPosition);
     void patternAtCurrentSongPositionChanged(); // For the play order widget
     void songPositionChanged(quint64 position); // For the play order widget
     void patternCreated(quint64 patternIndex);
@@ -507,6 +509,8 @@ private:
     void logPosition() const;
 
     void notifyPositionChange(const Position & oldPosition);
+    //! Notifies bulk note edits as one line range per column they touched.
+    void notifyNoteDataChanges(const NoteChangeList & changes);
     //! Moves the cursor off a column that has just been deleted.
     void ensureCursorIsOnLiveColumn(quint64 trackIndex);
 
@@ -0,0 +1,348 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "freeze_service.hpp"
+
+#include "../../common/constants.hpp"
+#include "../../contrib/SimpleLogger/src/simple_logger.hpp"
+#include "../../domain/tracker/instrument.hpp"
+#include "../../infra/audio/audio_engine.hpp"
+#include "../../infra/audio/frozen_device_player.hpp"
+#include "../../infra/xml/nahd_xml_writer.hpp"
+#include "device_service.hpp"
+#include "editor_service.hpp"
+#include "mixer_service.hpp"
+#include "random_service.hpp"
+#include "render_service.hpp"
+#include "settings_service.hpp"
+
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QRegularExpression>
+#include <QStandardPaths>
+
+#include <exception>
+
+namespace noteahead {
+
+static const auto TAG = "FreezeService";
+
+FreezeService::FreezeService(AudioEngineS audioEngine,
+                             DeviceServiceS deviceService,
+                             MixerServiceS mixerService,
+                             EditorServiceS editorService,
+                             AutomationServiceS automationService,
+                             SideChainServiceS sideChainService,
+                             SettingsServiceS settingsService,
+                             RenderServiceS renderService,
+                             QObject * parent)
+  : QObject { parent }
+  , m_audioEngine { std::move(audioEngine) }
+  , m_deviceService { std::move(deviceService) }
+  , m_mixerService { std::move(mixerService) }
+  , m_editorService { std::move(editorService) }
+  , m_automationService { std::move(automationService) }
+  , m_sideChainService { std::move(sideChainService) }
+  , m_settingsService { std::move(settingsService) }
+  , m_renderService { std::move(renderService) }
+{
+    connect(m_renderService.get(), &RenderService::renderingFinished, this, &FreezeService::onRenderingFinished);
+    // The slots of one song mean nothing in the next.
+    connect(m_editorService.get(), &EditorService::songChanged, this, &FreezeService::clear);
+}
+
+FreezeService::~FreezeService()
+{
+    stopPlayback();
+}
+
+void FreezeService::freezeDevice(int slotIndex)
+{
+    const auto slot = static_cast<size_t>(slotIndex);
+    if (slotIndex < 0 || !m_deviceService->device(slot) || m_renderService->isRendering() || !m_editorService->song()) {
+        return;
+    }
+
+    const auto fileName = cacheFilePath(slot, sampleRate(), songEvents());
+    m_frozenSlots.insert(slot);
+    m_revision++;
+    emit frozenDevicesChanged();
+
+    if (QFileInfo::exists(fileName)) {
+        juzzlin::L(TAG).info() << "Slot " << slot << " is already cached as " << fileName.toStdString();
+        return;
+    }
+
+    if (!QDir {}.mkpath(cacheDirectory())) {
+        juzzlin::L(TAG).error() << "Cannot create the freeze cache in " << cacheDirectory().toStdString();
+        unfreezeDevice(slotIndex);
+        return;
+    }
+
+    const auto partialFileName = QFileInfo { fileName }.completeBaseName() + ".partial.wav";
+    m_pendingFreeze = PendingFreeze { slot, QDir { cacheDirectory() }.filePath(partialFileName), fileName };
+    m_renderService->renderDevice(slot, m_pendingFreeze->partialFileName, sampleRate());
+}
+
+void FreezeService::unfreezeDevice(int slotIndex)
+{
+    if (m_frozenSlots.erase(static_cast<size_t>(slotIndex))) {
+        m_revision++;
+        emit frozenDevicesChanged();
+    }
+}
+
+int FreezeService::revision() const
+{
+    return m_revision;
+}
+
+bool FreezeService::isDeviceFrozen(int slotIndex) const
+{
+    return m_frozenSlots.contains(static_cast<size_t>(slotIndex));
+}
+
+void FreezeService::onRenderingFinished(bool success, QString message)
+{
+    if (!m_pendingFreeze) {
+        return;
+    }
+
+    const auto freeze = *m_pendingFreeze;
+    m_pendingFreeze.reset();
+
+    QFile::remove(freeze.fileName);
+    if (success && QFile::rename(freeze.partialFileName, freeze.fileName)) {
+        juzzlin::L(TAG).info() << "Froze slot " << freeze.slotIndex << " to " << freeze.fileName.toStdString();
+        return;
+    }
+
+    juzzlin::L(TAG).error() << "Freezing slot " << freeze.slotIndex << " failed: " << message.toStdString();
+    QFile::remove(freeze.partialFileName);
+    unfreezeDevice(static_cast<int>(freeze.slotIndex));
+}
+
+void FreezeService::startPlayback(size_t songPosition, bool isLooping)
+{
+    stopPlayback();
+
+    const auto song = m_editorService->song();
+    if (m_frozenSlots.empty() || !song) {
+        return;
+    }
+
+    if (isLooping || (m_settingsService->jackSyncEnabled() && m_settingsService->jackBpmSyncEnabled())) {
+        juzzlin::L(TAG).info() << "Not following the song's own timeline, so frozen devices play live";
+        return;
+    }
+
+    // Where the position starts in the rendered song, which skips what the play order skips.
+    size_t startTick = 0;
+    for (size_t position = 0; position < songPosition && position < song->length(); position++) {
+        if (!song->isSkipped(position)) {
+            startTick += song->lineCount(song->patternAtSongPosition(position)) * song->ticksPerLine();
+        }
+    }
+    const double secondsPerTick = 60.0 / static_cast<double>(m_editorService->beatsPerMinute() * m_editorService->linesPerBeat() * m_editorService->ticksPerLine());
+    const double startSeconds = static_cast<double>(startTick) * secondsPerTick;
+
+    const auto events = songEvents();
+    const auto rate = sampleRate();
+    for (auto && slot : m_frozenSlots) {
+        const auto fileName = cacheFilePath(slot, rate, events);
+        if (fileName.isEmpty() || !QFileInfo::exists(fileName)) {
+            juzzlin::L(TAG).info() << "Slot " << slot << " has changed since it was frozen and plays live";
+            continue;
+        }
+        auto player = std::make_shared<FrozenDevicePlayer>();
+        try {
+            player->start(fileName.toStdString(), startSeconds);
+        } catch (const std::exception & e) {
+            juzzlin::L(TAG).error() << "Slot " << slot << " plays live: " << e.what();
+            continue;
+        }
+        m_audioEngine->setFrozenDevicePlayer(slot, player);
+        m_players.push_back(std::move(player));
+    }
+}
+
+void FreezeService::startFrozenDevices()
+{
+    m_audioEngine->startFrozenDevicePlayers();
+}
+
+void FreezeService::stopPlayback()
+{
+    // Even with no players, as it also holds the next ones back until their song starts.
+    m_audioEngine->clearFrozenDevicePlayers();
+    for (auto && player : m_players) {
+        player->stop();
+    }
+    m_players.clear();
+}
+
+bool FreezeService::isPlayingFrozenDevices() const
+{
+    return !m_players.empty();
+}
+
+void FreezeService::clear()
+{
+    stopPlayback();
+    if (!m_frozenSlots.empty()) {
+        m_frozenSlots.clear();
+        m_revision++;
+        emit frozenDevicesChanged();
+    }
+}
+
+QString FreezeService::cacheDirectory()
+{
+    return QDir { QStandardPaths::writableLocation(QStandardPaths::CacheLocation) }.filePath("freeze");
+}
+
+QString FreezeService::cacheFilePath(size_t slotIndex, quint32 sampleRate, const Song::EventList & events) const
+{
+    const auto key = freezeKey(slotIndex, sampleRate, events);
+    return key.isEmpty() ? QString {} : QDir { cacheDirectory() }.filePath(key + ".wav");
+}
+
+Song::EventList FreezeService::songEvents() const
+{
+    const auto song = m_editorService->song();
+    // The very draws the freeze render makes, or a track with velocity jitter would never match.
+    // Scoped, so that working the key out leaves the session's own draws where they were.
+    const RandomService::ScopedSeed seed { static_cast<RandomService::Generator::result_type>(song->metadata().renderSettings().randomSeed()) };
+    return song->renderToEvents(m_automationService, m_sideChainService, 0);
+}
+
+std::set<size_t> FreezeService::inputSlots(size_t slotIndex) const
+{
+    std::set<size_t> slots;
+    std::vector<size_t> pending { slotIndex };
+    while (!pending.empty()) {
+        const auto slot = pending.back();
+        pending.pop_back();
+        if (!slots.insert(slot).second) {
+            continue;
+        }
+        if (const auto device = m_deviceService->device(slot)) {
+            for (auto && dependency : device->sidechainDependencies()) {
+                pending.push_back(dependency);
+            }
+        }
+    }
+    return slots;
+}
+
+quint32 FreezeService::sampleRate() const
+{
+    const auto rate = m_audioEngine->playbackSampleRate();
+    return rate ? rate : static_cast<quint32>(Constants::defaultSampleRate());
+}
+
+QString FreezeService::freezeKey(size_t slotIndex, quint32 sampleRate, const Song::EventList & events) const
+{
+    if (!m_deviceService->device(slotIndex)) {
+        return {};
+    }
+
+    QCryptographicHash hash { QCryptographicHash::Sha256 };
+    const auto addNumber = [&hash](quint64 value) {
+        hash.addData(QByteArrayView { reinterpret_cast<const char *>(&value), sizeof(value) });
+    };
+    // Bumped whenever what goes into the key, or how a freeze is rendered, changes.
+    hash.addData(QByteArrayView { "noteahead-freeze-2" });
+    addNumber(sampleRate);
+    addNumber(m_audioEngine->playbackOversampleFactor());
+    addNumber(m_editorService->beatsPerMinute());
+    addNumber(m_editorService->linesPerBeat());
+    addNumber(m_editorService->ticksPerLine());
+    addNumber(m_editorService->song()->totalTicks());
+
+    std::set<QString> portNames;
+    for (auto && slot : inputSlots(slotIndex)) {
+        addNumber(slot);
+        if (const auto device = m_deviceService->device(slot)) {
+            QString xml;
+            {
+                NahdXmlWriter writer { xml };
+                device->serializeToXml(writer);
+            }
+            // The file is taken ahead of the device's fader, which it still goes through live, so
+            // riding the fader keeps the freeze. The fader of a slot it reads is heard in the file.
+            if (slot == slotIndex) {
+                static const QRegularExpression faderElement { QString { R"(<%1 %2="%3"[^>]*/>)" }.arg(Constants::NahdXml::xmlKeyParameter(), Constants::NahdXml::xmlKeyName(), Constants::NahdXml::xmlKeyFader()) };
+                xml.remove(faderElement);
+            }
+            hash.addData(xml.toUtf8());
+            portNames.insert(QString::fromStdString(device->name()));
+        }
+    }
+
+    // What the render would hand those devices, after the mixer's say: a muted column sends nothing
+    // and a column's velocity scaling is part of the note.
+    std::set<const Instrument *> instruments;
+    for (auto && event : events) {
+        const auto instrument = event->instrument();
+        if (!instrument || !portNames.contains(instrument->midiAddress().portName())) {
+            continue;
+        }
+        if (instruments.insert(instrument.get()).second) {
+            const auto & settings = instrument->settings();
+            addNumber(settings.patch.has_value() ? 0x100 + *settings.patch : 0);
+            for (auto && midiCcSetting : settings.midiCcSettings) {
+                if (midiCcSetting.enabled()) {
+                    addNumber(midiCcSetting.controller());
+                    addNumber(midiCcSetting.value());
+                }
+            }
+        }
+        const auto channel = instrument->midiAddress().channel();
+        event->visit([&](auto && data) {
+            using T = std::decay_t<decltype(data)>;
+            if constexpr (std::is_same_v<T, NoteData>) {
+                if (data.type() == NoteData::Type::NoteOff && data.note().has_value()) {
+                    addNumber(event->tick());
+                    addNumber(0x200 + *data.note());
+                } else if (data.type() == NoteData::Type::NoteOn && data.note().has_value() && m_mixerService->shouldColumnPlay(data.track(), data.column())) {
+                    addNumber(event->tick());
+                    addNumber(0x300 + *data.note());
+                    addNumber(m_mixerService->effectiveVelocity(data.track(), data.column(), data.velocity()));
+                }
+            } else if constexpr (std::is_same_v<T, MidiCcData>) {
+                addNumber(event->tick());
+                addNumber(0x400 + data.controller());
+                addNumber(data.value());
+                addNumber(channel);
+            } else if constexpr (std::is_same_v<T, PitchBendData>) {
+                addNumber(event->tick());
+                addNumber(0x500 + channel);
+                addNumber((static_cast<quint64>(data.msb()) << 7) | data.lsb());
+            } else if constexpr (std::is_same_v<T, Event::InstrumentSettingsS>) {
+                if (data) {
+                    addNumber(event->tick());
+                    addNumber(0x600);
+                }
+            }
+        });
+    }
+
+    return QString::fromLatin1(hash.result().toHex());
+}
+
+} // namespace noteahead
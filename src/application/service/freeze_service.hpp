@@ -0,0 +1,139 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef FREEZE_SERVICE_HPP
+#define FREEZE_SERVICE_HPP
+
+#include "../../domain/tracker/song.hpp"
+
+#include <QObject>
+#include <QString>
+
+#include <memory>
+#include <optional>
+#include <set>
+#include <vector>
+
+namespace noteahead {
+
+class AudioEngine;
+class AutomationService;
+class DeviceService;
+class EditorService;
+class FrozenDevicePlayer;
+class MixerService;
+class RenderService;
+class SettingsService;
+class SideChainService;
+
+//! Freezes devices: renders a device's part of the song once, into a cache, and plays the file in
+//! its place from then on, so that a heavy device costs a disk stream instead of its DSP.
+//!
+//! The cached file is named after a hash of everything that went into it: the device and whatever
+//! it reads as a sidechain or sums as a SubMixer, the events those devices are sent, the tempo and
+//! the rate. Playback hashes them again, so a device whose part has changed since it was frozen is
+//! simply played live until it is frozen again, and undoing the change finds the old file again.
+class FreezeService : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(int revision READ revision NOTIFY frozenDevicesChanged)
+
+public:
+    using AudioEngineS = std::shared_ptr<AudioEngine>;
+    using AutomationServiceS = std::shared_ptr<AutomationService>;
+    using DeviceServiceS = std::shared_ptr<DeviceService>;
+    using EditorServiceS = std::shared_ptr<EditorService>;
+    using MixerServiceS = std::shared_ptr<MixerService>;
+    using RenderServiceS = std::shared_ptr<RenderService>;
+    using SettingsServiceS = std::shared_ptr<SettingsService>;
+    using SideChainServiceS = std::shared_ptr<SideChainService>;
+
+    FreezeService(AudioEngineS audioEngine,
+                  DeviceServiceS deviceService,
+                  MixerServiceS mixerService,
+                  EditorServiceS editorService,
+                  AutomationServiceS automationService,
+                  SideChainServiceS sideChainService,
+                  SettingsServiceS settingsService,
+                  RenderServiceS renderService,
+                  QObject * parent = nullptr);
+    ~FreezeService() override;
+
+    //! Renders the device's part into the cache, unless the cache already holds it as it stands.
+    //! Takes effect from the next play.
+    Q_INVOKABLE void freezeDevice(int slotIndex);
+    Q_INVOKABLE void unfreezeDevice(int slotIndex);
+    Q_INVOKABLE bool isDeviceFrozen(int slotIndex) const;
+    //! Bumped whenever a device is frozen or unfrozen, for bindings to depend on.
+    int revision() const;
+
+    //! Opens the frozen devices' files at the given song position, silent until
+    //! startFrozenDevices(). Looping a pattern and following JACK's tempo both leave the song's own
+    //! timeline, so the devices then play live.
+    void startPlayback(size_t songPosition, bool isLooping);
+    //! Lets the files run from the engine's next block. Called on the player's thread as it plays
+    //! the song's first tick, so it touches nothing but the engine.
+    void startFrozenDevices();
+    void stopPlayback();
+    bool isPlayingFrozenDevices() const;
+
+    //! Where frozen devices are cached, and the file a device's part at the given rate goes to.
+    //! Empty when the slot holds no device.
+    static QString cacheDirectory();
+    QString cacheFilePath(size_t slotIndex, quint32 sampleRate, const Song::EventList & events) const;
+
+signals:
+    void frozenDevicesChanged();
+
+private slots:
+    void onRenderingFinished(bool success, QString message);
+
+private:
+    //! The song's events as a render makes them, from the project's seed.
+    Song::EventList songEvents() const;
+    QString freezeKey(size_t slotIndex, quint32 sampleRate, const Song::EventList & events) const;
+    //! The slot and every slot it reads from, transitively, in order.
+    std::set<size_t> inputSlots(size_t slotIndex) const;
+    //! The rate playback runs at, which is what a frozen file has to match.
+    quint32 sampleRate() const;
+    void clear();
+
+    AudioEngineS m_audioEngine;
+    DeviceServiceS m_deviceService;
+    MixerServiceS m_mixerService;
+    EditorServiceS m_editorService;
+    AutomationServiceS m_automationService;
+    SideChainServiceS m_sideChainService;
+    SettingsServiceS m_settingsService;
+    RenderServiceS m_renderService;
+
+    std::set<size_t> m_frozenSlots;
+    int m_revision { 0 };
+    std::vector<std::shared_ptr<FrozenDevicePlayer>> m_players;
+
+    //! The freeze being rendered: rendered beside its final name, and moved there once complete,
+    //! so that an aborted render can never be taken for a cached one.
+    struct PendingFreeze
+    {
+        size_t slotIndex = 0;
+        QString partialFileName;
+        QString fileName;
+    };
+    std::optional<PendingFreeze> m_pendingFreeze;
+};
+
+} // namespace noteahead
+
+#endif // FREEZE_SERVICE_HPP
@@ -112,6 +112,7 @@ void JackService::initialize()
         m_lastFrame = pos.frame;
 
         jack_set_process_callback(m_client, &JackService::processCallback, this);
+        jack_set_latency_callback(m_client, &JackService::latencyCallback, this);
 
         if (jack_activate(m_client) != 0) {
             const auto message = tr("Could not activate JACK client!");
@@ -139,6 +140,15 @@ void JackService::initialize()
 #endif
 }
 
+void JackService::onEngineLatencyChanged()
+{
+#ifdef HAVE_JACK
+    if (m_client) {
+        jack_recompute_total_latencies(m_client);
+    }
+#endif
+}
+
 void JackService::deinitialize()
 {
 #ifdef HAVE_JACK
@@ -265,6 +275,21 @@ double JackService::playbackPosition() const
     return m_streamer.position();
 }
 
+void JackService::latencyCallback(jack_latency_callback_mode_t mode, void * arg)
+{
+    // The outputs carry what the engine generates, not the inputs passed through, so the only
+    // latency to add to them is the engine's own. A client recording them needs it to line them up.
+    const auto self = static_cast<JackService *>(arg);
+    if (mode != JackCaptureLatency || !self->m_audioEngine) {
+        return;
+    }
+
+    const jack_nframes_t latency = self->m_audioEngine->masterPipelineLatency(jack_get_buffer_size(self->m_client));
+    jack_latency_range_t range { latency, latency };
+    jack_port_set_latency_range(self->m_outputPortL, JackCaptureLatency, &range);
+    jack_port_set_latency_range(self->m_outputPortR, JackCaptureLatency, &range);
+}
+
 int JackService::processCallback(jack_nframes_t frameCount, void * arg)
 {
     enableHardwareDenormalProtection();
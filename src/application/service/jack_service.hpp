@@ -63,6 +63,8 @@ public:
     double playbackPosition() const;
 
     void onAudioBackendChanged();
+    //! Has JACK ask again for the latency the engine adds, after something changed it.
+    void onEngineLatencyChanged();
 
 #ifdef HAVE_JACK
     jack_nframes_t currentFrame() const;
@@ -78,6 +80,7 @@ signals:
 private:
 #ifdef HAVE_JACK
     static int processCallback(jack_nframes_t frameCount, void * arg);
+    static void latencyCallback(jack_latency_callback_mode_t mode, void * arg);
 
     jack_client_t * m_client = nullptr;
     jack_port_t * m_inputPortL = nullptr;
@@ -133,6 +133,9 @@ QStringList MidiService::outputPorts() const
 void MidiService::handleInstrumentRequest(const InstrumentRequest & instrumentRequest)
 {
     if (m_deviceService && m_deviceService->isInternalDevice(instrumentRequest.instrument().midiAddress().portName())) {
+        if (m_isRenderingAhead) {
+            emit renderAheadInterrupted();
+        }
         handleInternalDeviceInstrumentRequest(instrumentRequest);
         return;
     }
@@ -176,9 +179,17 @@ void MidiService::setIsPlaying(bool isPlaying)
     m_outputWorker->setIsPlaying(isPlaying);
 }
 
+void MidiService::setIsRenderingAhead(bool isRenderingAhead)
+{
+    m_isRenderingAhead = isRenderingAhead;
+}
+
 void MidiService::playAndStopMiddleC(QString portName, quint8 channel, quint8 velocity)
 {
     if (m_deviceService && m_deviceService->isInternalDevice(portName)) {
+        if (m_isRenderingAhead) {
+            emit renderAheadInterrupted();
+        }
         m_deviceService->processMidiNoteOn(portName, 60, velocity);
         // FIXME: need a way to stop it after a delay for internal devices if wanted
         return;
@@ -191,6 +202,9 @@ void MidiService::playNote(InstrumentW instrument, MidiNoteDataCR data)
     if (const auto instr = instrument.lock()) {
         const auto portName = instr->midiAddress().portName();
         if (m_deviceService && m_deviceService->isInternalDevice(portName)) {
+            if (m_isRenderingAhead) {
+                emit renderAheadInterrupted();
+            }
             m_deviceService->processMidiNoteOn(portName, data.note(), data.velocity());
         } else {
             m_outputWorker->playNote(portName, instr->midiAddress().channel(), data.note(), data.velocity());
@@ -203,6 +217,9 @@ void MidiService::stopNote(InstrumentW instrument, MidiNoteDataCR data)
     if (const auto instr = instrument.lock()) {
         const auto portName = instr->midiAddress().portName();
         if (m_deviceService && m_deviceService->isInternalDevice(portName)) {
+            if (m_isRenderingAhead) {
+                emit renderAheadInterrupted();
+            }
             m_deviceService->processMidiNoteOff(portName, data.note());
         } else {
             m_outputWorker->stopNote(portName, instr->midiAddress().channel(), data.note());
@@ -215,6 +232,9 @@ void MidiService::stopAllNotes(InstrumentW instrument)
     if (const auto instr = instrument.lock()) {
         const auto portName = instr->midiAddress().portName();
         if (m_deviceService && m_deviceService->isInternalDevice(portName)) {
+            if (m_isRenderingAhead) {
+                return;
+            }
             m_deviceService->processMidiAllNotesOff(portName);
             m_deviceService->processMidiCc(portName, static_cast<uint8_t>(MidiCcMapping::Controller::ResetAllControllers), 127, instr->midiAddress().channel());
         } else {
@@ -225,7 +245,7 @@ void MidiService::stopAllNotes(InstrumentW instrument)
 
 void MidiService::stopAllNotes()
 {
-    if (m_deviceService) {
+    if (m_deviceService && !m_isRenderingAhead) {
         m_deviceService->processMidiAllNotesOff();
         for (auto && name : m_deviceService->internalDeviceNames()) {
             m_deviceService->processMidiCc(name.c_str(), static_cast<uint8_t>(MidiCcMapping::Controller::ResetAllControllers), 127, 0);
@@ -238,6 +258,9 @@ void MidiService::sendCcData(InstrumentW instrument, MidiCcDataCR data)
     if (const auto instr = instrument.lock()) {
         const auto portName = instr->midiAddress().portName();
         if (m_deviceService && m_deviceService->isInternalDevice(portName)) {
+            if (m_isRenderingAhead) {
+                emit renderAheadInterrupted();
+            }
             m_deviceService->processMidiCc(portName, data.controller(), data.value(), instr->midiAddress().channel());
         } else {
             // Last line of defence for the wire: an internal device may accept values past the MIDI
@@ -273,6 +296,9 @@ void MidiService::sendPitchBendData(InstrumentW instrument, MidiService::PitchBe
     if (const auto instr = instrument.lock()) {
         const auto portName = instr->midiAddress().portName();
         if (m_deviceService && m_deviceService->isInternalDevice(portName)) {
+            if (m_isRenderingAhead) {
+                emit renderAheadInterrupted();
+            }
             m_deviceService->processMidiPitchBend(portName, (static_cast<uint16_t>(data.msb()) << 7) | data.lsb(), instr->midiAddress().channel());
         } else {
             m_outputWorker->sendPitchBendData(portName, instr->midiAddress().channel(), data.msb(), data.lsb());
@@ -49,6 +49,10 @@ public:
 
     // QML API
     Q_INVOKABLE void setIsPlaying(bool isPlaying);
+    //! While the song plays from a render made ahead of the playhead, the internal devices belong
+    //! to the render: stopping all notes leaves them alone, and anything else sent to them is live
+    //! and reported with renderAheadInterrupted() before it is passed on.
+    void setIsRenderingAhead(bool isRenderingAhead);
     Q_INVOKABLE void playAndStopMiddleC(QString portName, quint8 channel, quint8 velocity);
 
     // Internal API
@@ -104,6 +108,7 @@ signals:
     //! General signals
     void statusTextRequested(QString message);
     void instrumentRequestHandlingRequested(const InstrumentRequest & instrumentRequest);
+    void renderAheadInterrupted();
 
 protected:
     MidiService(DeviceServiceS deviceService, QObject * parent, bool initializeRealWorkers);
@@ -128,6 +133,8 @@ private:
     QStringList m_inputPorts;
 
     DeviceServiceS m_deviceService;
+
+    bool m_isRenderingAhead = false;
 };
 
 } // namespace noteahead
@@ -67,6 +67,11 @@ void PlayerService::setSongPosition(quint64 position)
     }
 }
 
+quint64 PlayerService::songPosition() const
+{
+    return m_songPosition;
+}
+
 void PlayerService::setSong(SongS song)
 {
     m_song = song;
@@ -78,6 +83,7 @@ void PlayerService::initializeWorker()
         m_tick = tick;
         emit tickUpdated(tick); }, Qt::QueuedConnection);
     connect(m_playerWorker.get(), &PlayerWorker::isPlayingChanged, this, &PlayerService::isPlayingChanged, Qt::QueuedConnection);
+    connect(m_playerWorker.get(), &PlayerWorker::songStarted, this, &PlayerService::songStarted, Qt::DirectConnection);
     connect(m_playerWorker.get(), &PlayerWorker::songEnded, this, &PlayerService::songEnded, Qt::QueuedConnection);
     m_playerWorker->moveToThread(&m_playerWorkerThread);
     m_playerWorkerThread.start(QThread::HighestPriority);
@@ -155,6 +161,11 @@ void PlayerService::setIsLooping(bool isLooping)
     emit isLoopingChanged();
 }
 
+void PlayerService::setIsRenderedAhead(bool isRenderedAhead)
+{
+    m_playerWorker->setIsRenderedAhead(isRenderedAhead);
+}
+
 double PlayerService::beatsPerMinute() const
 {
     if (m_settingsService->jackSyncEnabled() && m_settingsService->jackBpmSyncEnabled()) {
@@ -66,9 +66,13 @@ public:
 
     Q_INVOKABLE double beatsPerMinute() const;
 
+    //! See PlayerWorker::setIsRenderedAhead().
+    void setIsRenderedAhead(bool isRenderedAhead);
+
     quint64 tick() const;
 
     void setSongPosition(quint64 position);
+    quint64 songPosition() const;
 
     using SongS = std::shared_ptr<Song>;
     void setSong(SongS song);
@@ -80,6 +84,9 @@ signals:
     void songEnded();
 
     void songRequested();
+    //! Emitted on the player's own thread as it plays the song's first tick, so that a direct
+    //! connection can start whatever has to keep time with it.
+    void songStarted();
 
     void tickUpdated(quint64 tick);
     void beatsPerMinuteChanged();
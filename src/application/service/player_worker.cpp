@@ -112,6 +112,18 @@ bool PlayerWorker::shouldEventPlay(size_t track, size_t column) const
 
 void PlayerWorker::handleEvent(const Event & event)
 {
+    if (m_isRenderedAhead) {
+        switch (event.type()) {
+        case Event::Type::NoteData:
+        case Event::Type::MidiCcData:
+        case Event::Type::PitchBendData:
+        case Event::Type::InstrumentSettings:
+            return;
+        default:
+            break;
+        }
+    }
+
     event.visit([&](auto && data) {
         using T = std::decay_t<decltype(data)>;
         if constexpr (std::is_same_v<T, NoteData>) {
@@ -184,6 +196,11 @@ void PlayerWorker::setJackBpmSyncEnabled(bool enabled)
     m_jackBpmSyncEnabled = enabled;
 }
 
+void PlayerWorker::setIsRenderedAhead(bool isRenderedAhead)
+{
+    m_isRenderedAhead = isRenderedAhead;
+}
+
 void PlayerWorker::processEvents()
 {
     if (m_eventMap.empty()) {
@@ -200,6 +217,9 @@ void PlayerWorker::processEvents()
     juzzlin::L(TAG).debug() << "Lines per beat: " << m_timing.linesPerBeat;
     juzzlin::L(TAG).debug() << "Ticks per line: " << m_timing.ticksPerLine;
 
+    // Ahead of the clock, which whatever keeps time with the song may hold back until it is ready.
+    emit songStarted();
+
     const auto startTime = std::chrono::steady_clock::now();
 
     auto tick = minTick;
@@ -70,8 +70,15 @@ public:
 
     void setJackBpmSyncEnabled(bool enabled);
 
+    //! The internal devices play a render made ahead of the playhead, so the notes and the
+    //! controllers are not sent to them. Every track plays one while this holds.
+    void setIsRenderedAhead(bool isRenderedAhead);
+
 signals:
     void isPlayingChanged();
+    //! Emitted on the worker's own thread just before it plays the first tick. The song's clock
+    //! starts once the slots connected directly return.
+    void songStarted();
     void songEnded();
     void tickUpdated(quint64 tick);
 
@@ -109,6 +116,7 @@ private:
     std::atomic_bool m_isPlaying = false;
     std::atomic_bool m_isLooping = false;
     std::atomic_bool m_jackBpmSyncEnabled = false;
+    std::atomic_bool m_isRenderedAhead = false;
 
     std::condition_variable m_cv;
     std::mutex m_mutex;
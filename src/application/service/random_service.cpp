@@ -23,4 +23,20 @@ RandomService::GeneratorR RandomService::generator()
     return gen;
 }
 
+void RandomService::seed(Generator::result_type value)
+{
+    generator().seed(value);
+}
+
+RandomService::ScopedSeed::ScopedSeed(Generator::result_type value)
+  : m_saved { generator() }
+{
+    seed(value);
+}
+
+RandomService::ScopedSeed::~ScopedSeed()
+{
+    generator() = m_saved;
+}
+
 } // namespace noteahead
@@ -23,6 +23,25 @@ namespace noteahead::RandomService {
 using Generator = std::mt19937;
 using GeneratorR = Generator &;
 GeneratorR generator();
+//! Restarts the generator from the given seed, so that whatever draws from it next comes out the same
+//! every time.
+void seed(Generator::result_type value);
+
+//! Seeds the generator for as long as it lives and then puts back the state it found. A reproducible
+//! render holds one while it generates its events, so live playback does not carry on from the
+//! render's sequence.
+class ScopedSeed
+{
+public:
+    explicit ScopedSeed(Generator::result_type value);
+    ~ScopedSeed();
+
+    ScopedSeed(const ScopedSeed &) = delete;
+    ScopedSeed & operator=(const ScopedSeed &) = delete;
+
+private:
+    Generator m_saved;
+};
 } // namespace noteahead::RandomService
 
 #endif // RANDOM_SERVICE_HPP
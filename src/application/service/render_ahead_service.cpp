@@ -0,0 +1,293 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "render_ahead_service.hpp"
+
+#include "../../contrib/SimpleLogger/src/simple_logger.hpp"
+#include "../../domain/tracker/event.hpp"
+#include "../../domain/tracker/instrument.hpp"
+#include "../../infra/audio/audio_engine.hpp"
+#include "../../infra/audio/render_ahead_buffer.hpp"
+#include "device_service.hpp"
+#include "editor_service.hpp"
+#include "mixer_service.hpp"
+#include "random_service.hpp"
+#include "render_service.hpp"
+#include "settings_service.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <optional>
+#include <set>
+#include <thread>
+
+namespace noteahead {
+
+static const auto TAG = "RenderAheadService";
+
+//! How far the render may get ahead of the playhead.
+static const double bufferSeconds = 4.0;
+//! How much is rendered before playback is let go.
+static const double primeSeconds = 0.1;
+//! How long playback waits for that at most: a project too heavy for even this plays late rather
+//! than not at all.
+static const auto primeTimeout = std::chrono::seconds { 1 };
+//! Where a restarted render picks up, ahead of the playhead: the time it has to catch up in, and
+//! all of what was rendered before that is still heard after a change.
+static const double restartMarginSeconds = 0.2;
+//! Changes come in bursts, a knob being turned, so a restart waits for the burst to settle.
+static const int restartDelayMs = 100;
+
+RenderAheadService::RenderAheadService(AudioEngineS audioEngine,
+                                       DeviceServiceS deviceService,
+                                       MixerServiceS mixerService,
+                                       EditorServiceS editorService,
+                                       AutomationServiceS automationService,
+                                       SideChainServiceS sideChainService,
+                                       SettingsServiceS settingsService,
+                                       RenderServiceS renderService,
+                                       QObject * parent)
+  : QObject { parent }
+  , m_audioEngine { std::move(audioEngine) }
+  , m_deviceService { std::move(deviceService) }
+  , m_mixerService { std::move(mixerService) }
+  , m_editorService { std::move(editorService) }
+  , m_automationService { std::move(automationService) }
+  , m_sideChainService { std::move(sideChainService) }
+  , m_settingsService { std::move(settingsService) }
+  , m_renderService { std::move(renderService) }
+  , m_worker { m_audioEngine, m_deviceService, m_mixerService }
+{
+    m_restartTimer.setSingleShot(true);
+    m_restartTimer.setInterval(restartDelayMs);
+    connect(&m_restartTimer, &QTimer::timeout, this, &RenderAheadService::restart);
+
+    // Whatever changes what the devices are sent, or what they are.
+    connect(m_mixerService.get(), &MixerService::columnMuted, this, &RenderAheadService::invalidate);
+    connect(m_mixerService.get(), &MixerService::columnSoloed, this, &RenderAheadService::invalidate);
+    connect(m_mixerService.get(), &MixerService::columnVelocityScaleChanged, this, &RenderAheadService::invalidate);
+    connect(m_mixerService.get(), &MixerService::trackMuted, this, &RenderAheadService::invalidate);
+    connect(m_mixerService.get(), &MixerService::trackSoloed, this, &RenderAheadService::invalidate);
+    connect(m_mixerService.get(), &MixerService::trackVelocityScaleChanged, this, &RenderAheadService::invalidate);
+    connect(m_mixerService.get(), &MixerService::cleared, this, &RenderAheadService::invalidate);
+    connect(m_mixerService.get(), &MixerService::configurationChanged, this, &RenderAheadService::invalidate);
+    connect(m_deviceService.get(), &DeviceService::dataChanged, this, &RenderAheadService::invalidate);
+
+    // An export takes the devices over.
+    connect(m_renderService.get(), &RenderService::isRenderingChanged, this, [this] {
+        if (m_renderService->isRendering()) {
+            stopPlayback();
+        }
+    });
+}
+
+RenderAheadService::~RenderAheadService()
+{
+    stopPlayback();
+}
+
+bool RenderAheadService::isRenderingAhead() const
+{
+    return m_isRenderingAhead;
+}
+
+void RenderAheadService::setIsRenderingAhead(bool isRenderingAhead)
+{
+    if (m_isRenderingAhead != isRenderingAhead) {
+        m_isRenderingAhead = isRenderingAhead;
+        emit isRenderingAheadChanged();
+    }
+}
+
+bool RenderAheadService::canRenderAhead(const EventList & events) const
+{
+    std::set<const Instrument *> checked;
+    for (auto && event : events) {
+        if (auto && instrument = event->instrument(); instrument && checked.insert(instrument.get()).second) {
+            if (!m_deviceService->isInternalDevice(instrument->midiAddress().portName())) {
+                juzzlin::L(TAG).info() << "Plays live: " << instrument->midiAddress().portName().toStdString() << " is not an internal device";
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void RenderAheadService::startPlayback(size_t songPosition, bool isLooping)
+{
+    stopPlayback();
+
+    const auto song = m_editorService->song();
+    if (!m_settingsService->renderAheadEnabled() || !song || m_renderService->isRendering()) {
+        return;
+    }
+
+    if (isLooping || (m_settingsService->jackSyncEnabled() && m_settingsService->jackBpmSyncEnabled())) {
+        juzzlin::L(TAG).info() << "Not following the song's own timeline, so the song plays live";
+        return;
+    }
+
+    // The rate the callback runs at, which the render has to match. Unknown before it first ran.
+    const auto sampleRate = m_audioEngine->playbackSampleRate();
+    if (!sampleRate) {
+        return;
+    }
+
+    // Drawn as an export draws them, so that what is heard is what an export of it would put out.
+    std::optional<RandomService::ScopedSeed> seed;
+    if (const auto & renderSettings = song->metadata().renderSettings(); renderSettings.reproducibleEnabled()) {
+        seed.emplace(static_cast<RandomService::Generator::result_type>(renderSettings.randomSeed()));
+    }
+    auto events = song->renderToEvents(m_automationService, m_sideChainService, songPosition);
+    seed.reset();
+    if (events.empty() || !canRenderAhead(events)) {
+        return;
+    }
+
+    m_events = std::move(events);
+    m_timing.beatsPerMinute = m_editorService->beatsPerMinute();
+    m_timing.linesPerBeat = m_editorService->linesPerBeat();
+    m_timing.ticksPerLine = m_editorService->ticksPerLine();
+    m_startTick = song->positionToTick(songPosition);
+    m_maxTick = (*std::ranges::max_element(m_events, {}, [](auto && event) { return event->tick(); }))->tick();
+
+    // As playback does on play, and as an export does before its first tick.
+    std::set<const Instrument *> applied;
+    for (auto && event : m_events) {
+        if (auto && instrument = event->instrument(); instrument && applied.insert(instrument.get()).second) {
+            m_deviceService->applyInstrumentSettings(*instrument);
+        }
+    }
+
+    auto buffer = std::make_shared<RenderAheadBuffer>(sampleRate, static_cast<size_t>(bufferSeconds * sampleRate));
+    m_audioEngine->setRenderAheadBuffer(buffer);
+    m_worker.start(m_events, m_startTick, m_maxTick, m_timing, buffer, m_audioEngine->playbackOversampleFactor());
+    {
+        std::lock_guard<std::mutex> lock { m_bufferMutex };
+        m_buffer = std::move(buffer);
+    }
+
+    juzzlin::L(TAG).info() << "Rendering ahead from tick " << m_startTick << " at " << sampleRate << " Hz";
+    setIsRenderingAhead(true);
+}
+
+void RenderAheadService::startPlayingRenderedAhead()
+{
+    RenderAheadBufferS buffer;
+    {
+        std::lock_guard<std::mutex> lock { m_bufferMutex };
+        buffer = m_buffer;
+    }
+    if (!buffer) {
+        return;
+    }
+
+    // A head start, so that the first blocks are not already late.
+    const auto primeFrames = static_cast<size_t>(primeSeconds * buffer->sampleRate());
+    const auto deadline = std::chrono::steady_clock::now() + primeTimeout;
+    while (buffer->framesAvailable() < primeFrames && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds { 1 });
+    }
+
+    // Whichever buffer is current by now: one restarted meanwhile has taken over from this one.
+    std::lock_guard<std::mutex> lock { m_bufferMutex };
+    if (m_buffer) {
+        m_buffer->start();
+    }
+}
+
+void RenderAheadService::stopPlayback()
+{
+    m_restartTimer.stop();
+    if (!m_isRenderingAhead) {
+        return;
+    }
+
+    m_worker.stop();
+    m_audioEngine->setRenderAheadBuffer({});
+    {
+        std::lock_guard<std::mutex> lock { m_bufferMutex };
+        m_buffer.reset();
+    }
+    m_events.clear();
+    silenceDevices();
+    setIsRenderingAhead(false);
+}
+
+void RenderAheadService::fallBackToLive()
+{
+    if (!m_isRenderingAhead) {
+        return;
+    }
+
+    juzzlin::L(TAG).info() << "Played live, so the rest of the song plays live too";
+    stopPlayback();
+}
+
+void RenderAheadService::silenceDevices()
+{
+    m_deviceService->processMidiAllNotesOff();
+    m_audioEngine->reset();
+}
+
+void RenderAheadService::invalidate()
+{
+    if (m_isRenderingAhead) {
+        m_restartTimer.start();
+    }
+}
+
+void RenderAheadService::restart()
+{
+    RenderAheadBufferS previous;
+    {
+        std::lock_guard<std::mutex> lock { m_bufferMutex };
+        previous = m_buffer;
+    }
+    if (!m_isRenderingAhead || !previous) {
+        return;
+    }
+
+    // The new render starts on a tick a little past the playhead. Until then the old one plays on,
+    // and what it rendered beyond that is dropped.
+    const auto sampleRate = previous->sampleRate();
+    const double secondsPerTick = 60.0 / (static_cast<double>(m_timing.beatsPerMinute * m_timing.linesPerBeat * m_timing.ticksPerLine));
+    const double samplesPerTick = secondsPerTick * sampleRate;
+    const double restartFrame = static_cast<double>(previous->position()) + restartMarginSeconds * sampleRate;
+    const auto tickOffset = static_cast<quint64>(std::ceil(restartFrame / samplesPerTick));
+    const auto startTick = m_startTick + tickOffset;
+    if (startTick > m_maxTick) {
+        return;
+    }
+
+    juzzlin::L(TAG).debug() << "Restarting the render at tick " << startTick;
+
+    m_worker.stop();
+
+    // The render ran the devices ahead of the restart, so the voices it left are the song's future:
+    // they go, and the worker strikes again the notes held at the restart. The effects ring on.
+    m_audioEngine->resetDevices();
+
+    auto buffer = std::make_shared<RenderAheadBuffer>(sampleRate, static_cast<size_t>(bufferSeconds * sampleRate), static_cast<uint64_t>(std::llround(static_cast<double>(tickOffset) * samplesPerTick)));
+    m_worker.start(m_events, startTick, m_maxTick, m_timing, buffer, m_audioEngine->playbackOversampleFactor());
+    {
+        std::lock_guard<std::mutex> lock { m_bufferMutex };
+        m_audioEngine->setRenderAheadBuffer(buffer);
+        m_buffer = std::move(buffer);
+    }
+}
+
+} // namespace noteahead
@@ -0,0 +1,127 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef RENDER_AHEAD_SERVICE_HPP
+#define RENDER_AHEAD_SERVICE_HPP
+
+#include "render_ahead_worker.hpp"
+
+#include <QObject>
+#include <QTimer>
+
+#include <memory>
+#include <mutex>
+
+namespace noteahead {
+
+class AutomationService;
+class EditorService;
+class RenderService;
+class SettingsService;
+class SideChainService;
+
+//! Plays the song out of a render made a few seconds ahead of the playhead, the way an export
+//! makes it, instead of rendering the devices in the audio callback. A heavy project then costs
+//! the callback a copy, and a spike in the devices is absorbed by what is already rendered.
+//!
+//! Only a song whose tracks all play internal devices can be rendered ahead. A change that alters
+//! what is heard -- the mixer, a device, the effects -- restarts the render a moment after the
+//! playhead, and anything played live hands the rest of the play back to the callback. Notes and
+//! automation are what they were when playback started, as they are when the song plays live.
+class RenderAheadService : public QObject
+{
+    Q_OBJECT
+
+public:
+    using AudioEngineS = std::shared_ptr<AudioEngine>;
+    using AutomationServiceS = std::shared_ptr<AutomationService>;
+    using DeviceServiceS = std::shared_ptr<DeviceService>;
+    using EditorServiceS = std::shared_ptr<EditorService>;
+    using MixerServiceS = std::shared_ptr<MixerService>;
+    using RenderServiceS = std::shared_ptr<RenderService>;
+    using SettingsServiceS = std::shared_ptr<SettingsService>;
+    using SideChainServiceS = std::shared_ptr<SideChainService>;
+    using EventList = RenderAheadWorker::EventList;
+    using Timing = RenderAheadWorker::Timing;
+    using RenderAheadBufferS = RenderAheadWorker::RenderAheadBufferS;
+
+    RenderAheadService(AudioEngineS audioEngine,
+                       DeviceServiceS deviceService,
+                       MixerServiceS mixerService,
+                       EditorServiceS editorService,
+                       AutomationServiceS automationService,
+                       SideChainServiceS sideChainService,
+                       SettingsServiceS settingsService,
+                       RenderServiceS renderService,
+                       QObject * parent = nullptr);
+    ~RenderAheadService() override;
+
+    //! Starts rendering ahead from the given song position, without waiting for it. Does nothing when
+    //! the song cannot be rendered ahead, and then the song simply plays live.
+    void startPlayback(size_t songPosition, bool isLooping);
+    //! Lets playback move on to the render once it has a head start, waiting up to a second for
+    //! one. Called on the player's thread as it plays the song's first tick, so that the song's
+    //! clock starts with its sound and the UI is never held up.
+    void startPlayingRenderedAhead();
+    void stopPlayback();
+
+    //! Something was played live, which the render cannot have in it: the devices go back to the
+    //! audio callback for the rest of the play.
+    void fallBackToLive();
+
+    //! Restarts the render a moment ahead of the playhead, so that a change is heard from there.
+    void invalidate();
+
+    bool isRenderingAhead() const;
+
+signals:
+    //! The player and the MIDI service leave the internal devices to the render for as long as
+    //! this holds.
+    void isRenderingAheadChanged();
+
+private:
+    //! Whether every track plays an internal device, the only ones the render can reach.
+    bool canRenderAhead(const EventList & events) const;
+    void restart();
+    void setIsRenderingAhead(bool isRenderingAhead);
+    //! Silences whatever the render had sounding, for the callback to start over from.
+    void silenceDevices();
+
+    AudioEngineS m_audioEngine;
+    DeviceServiceS m_deviceService;
+    MixerServiceS m_mixerService;
+    EditorServiceS m_editorService;
+    AutomationServiceS m_automationService;
+    SideChainServiceS m_sideChainService;
+    SettingsServiceS m_settingsService;
+    RenderServiceS m_renderService;
+
+    RenderAheadWorker m_worker;
+    //! Read on the player's thread too, by startPlayingRenderedAhead().
+    RenderAheadBufferS m_buffer;
+    std::mutex m_bufferMutex;
+    QTimer m_restartTimer;
+
+    EventList m_events;
+    Timing m_timing;
+    quint64 m_startTick = 0;
+    quint64 m_maxTick = 0;
+
+    bool m_isRenderingAhead = false;
+};
+
+} // namespace noteahead
+
+#endif // RENDER_AHEAD_SERVICE_HPP
@@ -0,0 +1,161 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "render_ahead_worker.hpp"
+
+#include "../../contrib/SimpleLogger/src/simple_logger.hpp"
+#include "../../domain/tracker/event.hpp"
+#include "../../domain/tracker/instrument.hpp"
+#include "../../domain/tracker/note_data.hpp"
+#include "../../infra/audio/audio_engine.hpp"
+#include "../../infra/audio/render_ahead_buffer.hpp"
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace noteahead {
+
+static const auto TAG = "RenderAheadWorker";
+
+RenderAheadWorker::RenderAheadWorker(AudioEngineS audioEngine, DeviceServiceS deviceService, MixerServiceS mixerService)
+  : m_audioEngine { std::move(audioEngine) }
+  , m_deviceService { std::move(deviceService) }
+  , m_mixerService { std::move(mixerService) }
+{
+}
+
+RenderAheadWorker::~RenderAheadWorker()
+{
+    stop();
+}
+
+void RenderAheadWorker::start(const EventList & events, quint64 startTick, quint64 maxTick, const Timing & timing, RenderAheadBufferS buffer, quint8 oversampleFactor)
+{
+    stop();
+
+    juzzlin::L(TAG).info() << "Rendering ahead from tick " << startTick << " to " << maxTick;
+
+    m_isRunning = true;
+    m_thread = std::thread { &RenderAheadWorker::run, this, events, startTick, maxTick, timing, std::move(buffer), oversampleFactor };
+}
+
+void RenderAheadWorker::stop()
+{
+    m_isRunning = false;
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+void RenderAheadWorker::run(EventList events, quint64 startTick, quint64 maxTick, Timing timing, RenderAheadBufferS buffer, quint8 oversampleFactor)
+{
+    std::map<quint64, std::vector<EventS>> eventMap {};
+    // The notes still held at startTick, by port and note, struck again there.
+    std::map<std::pair<std::string, uint8_t>, EventS> heldNotes {};
+    for (auto && event : events) {
+        if (event->tick() >= startTick) {
+            eventMap[event->tick()].push_back(event);
+        } else if (event->type() == Event::Type::MidiCcData || event->type() == Event::Type::PitchBendData) {
+            RenderWorker::handleEvent(*event, *m_deviceService, *m_mixerService);
+        } else if (const auto instrument = event->instrument(); instrument) {
+            const auto portName = instrument->midiAddress().portName().toStdString();
+            if (const auto noteData = event->noteData(); noteData && noteData->note().has_value()) {
+                if (noteData->type() == NoteData::Type::NoteOn) {
+                    heldNotes[{ portName, *noteData->note() }] = event;
+                } else if (noteData->type() == NoteData::Type::NoteOff) {
+                    heldNotes.erase({ portName, *noteData->note() });
+                }
+            } else if (event->type() == Event::Type::InstrumentSettings) {
+                std::erase_if(heldNotes, [&](auto && held) { return held.first.first == portName; });
+            }
+        }
+    }
+    for (auto && [key, event] : heldNotes) {
+        RenderWorker::handleEvent(*event, *m_deviceService, *m_mixerService);
+    }
+
+    m_audioEngine->setBpm(static_cast<float>(timing.beatsPerMinute));
+
+    const auto sampleRate = buffer->sampleRate();
+    const double secondsPerTick = 60.0 / (static_cast<double>(timing.beatsPerMinute * timing.linesPerBeat * timing.ticksPerLine));
+    const double samplesPerTick = secondsPerTick * sampleRate;
+
+    double sampleCounter = 0.0;
+    uint64_t framesWritten = 0;
+    std::vector<double> audioBuffer {};
+    const auto render = [&](quint32 frameCount) {
+        audioBuffer.assign(static_cast<size_t>(frameCount) * 2, 0.0);
+        AudioContext audioContext { std::span(audioBuffer.data(), audioBuffer.size()), frameCount, sampleRate };
+        audioContext.oversampleFactor = oversampleFactor;
+        m_audioEngine->renderAhead(audioContext);
+    };
+
+    for (quint64 tick = startTick; tick <= maxTick && m_isRunning; tick++) {
+        if (auto it = eventMap.find(tick); it != eventMap.end()) {
+            for (auto && event : it->second) {
+                RenderWorker::handleEvent(*event, *m_deviceService, *m_mixerService);
+            }
+        }
+
+        sampleCounter += samplesPerTick;
+        const auto framesToProcess = static_cast<quint32>(sampleCounter);
+        if (!framesToProcess) {
+            continue;
+        }
+
+        render(framesToProcess);
+        sampleCounter -= static_cast<double>(framesToProcess);
+        if (!write(*buffer, audioBuffer, framesToProcess)) {
+            return;
+        }
+        framesWritten += framesToProcess;
+    }
+
+    if (!m_isRunning) {
+        return;
+    }
+
+    // Live playback takes the devices on from the end of the song, as they are: nothing is cut off.
+    // It takes over on a block of its own, so the render carries on to the end of the one playback
+    // is going to be in.
+    if (const auto blockFrames = buffer->blockFrames(); blockFrames) {
+        if (const auto padding = static_cast<quint32>((blockFrames - framesWritten % blockFrames) % blockFrames); padding) {
+            render(padding);
+            if (!write(*buffer, audioBuffer, padding)) {
+                return;
+            }
+        }
+    }
+    buffer->finish();
+
+    juzzlin::L(TAG).debug() << "Rendered ahead up to tick " << maxTick;
+}
+
+bool RenderAheadWorker::write(RenderAheadBuffer & buffer, const std::vector<double> & audioBuffer, quint32 frameCount) const
+{
+    // As far ahead as the buffer holds, and no further: the rest waits for playback to catch up.
+    while (!buffer.write(audioBuffer, frameCount)) {
+        if (!m_isRunning) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds { 2 });
+    }
+    return true;
+}
+
+} // namespace noteahead
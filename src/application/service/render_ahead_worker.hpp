@@ -0,0 +1,67 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef RENDER_AHEAD_WORKER_HPP
+#define RENDER_AHEAD_WORKER_HPP
+
+#include "render_worker.hpp"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+namespace noteahead {
+
+class RenderAheadBuffer;
+
+//! Renders the song into a RenderAheadBuffer on a thread of its own, as far ahead of the playhead
+//! as the buffer holds, and waits while it is full.
+class RenderAheadWorker
+{
+public:
+    using AudioEngineS = std::shared_ptr<AudioEngine>;
+    using DeviceServiceS = std::shared_ptr<DeviceService>;
+    using MixerServiceS = std::shared_ptr<MixerService>;
+    using EventS = RenderWorker::EventS;
+    using EventList = RenderWorker::EventList;
+    using Timing = RenderWorker::Timing;
+    using RenderAheadBufferS = std::shared_ptr<RenderAheadBuffer>;
+
+    RenderAheadWorker(AudioEngineS audioEngine, DeviceServiceS deviceService, MixerServiceS mixerService);
+    ~RenderAheadWorker();
+
+    //! Renders from startTick up to and including maxTick into the buffer, whose first frame is
+    //! startTick. The events before startTick only set the controllers, so that the devices pick
+    //! up as the song left them, and strike again the notes still held at startTick.
+    void start(const EventList & events, quint64 startTick, quint64 maxTick, const Timing & timing, RenderAheadBufferS buffer, quint8 oversampleFactor);
+    //! Returns once the thread has finished with the devices.
+    void stop();
+
+private:
+    void run(EventList events, quint64 startTick, quint64 maxTick, Timing timing, RenderAheadBufferS buffer, quint8 oversampleFactor);
+    //! Writes all of the frames, waiting for playback to make room. False if stopped meanwhile.
+    bool write(RenderAheadBuffer & buffer, const std::vector<double> & audioBuffer, quint32 frameCount) const;
+
+    AudioEngineS m_audioEngine;
+    DeviceServiceS m_deviceService;
+    MixerServiceS m_mixerService;
+
+    std::thread m_thread;
+    std::atomic_bool m_isRunning = false;
+};
+
+} // namespace noteahead
+
+#endif // RENDER_AHEAD_WORKER_HPP
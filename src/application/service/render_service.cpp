@@ -18,8 +18,10 @@
 #include "../../common/constants.hpp"
 #include "../../contrib/SimpleLogger/src/simple_logger.hpp"
 #include "../../domain/tracker/song.hpp"
+#include "../../infra/audio/audio_engine.hpp"
 #include "editor_service.hpp"
 #include "mixer_service.hpp"
+#include "random_service.hpp"
 #include "render_worker.hpp"
 
 #include <QDateTime>
@@ -106,6 +108,21 @@ void RenderService::renderIndividualTracks(const QString & directory)
     beginRender();
 }
 
+void RenderService::renderDevice(size_t slotIndex, const QString & fileName, quint32 sampleRate)
+{
+    if (m_isRendering)
+        return;
+
+    juzzlin::L(TAG).info() << "Rendering device in slot " << slotIndex << " to " << fileName.toStdString();
+
+    m_mixerService->pushState();
+
+    m_queue.clear();
+    m_queue.push_back({ fileName, {}, slotIndex, sampleRate });
+
+    beginRender();
+}
+
 void RenderService::beginRender()
 {
     m_currentJobIndex = 0;
@@ -248,13 +265,30 @@ void RenderService::startNextRender()
     timing.linesPerBeat = m_editorService->linesPerBeat();
     timing.ticksPerLine = m_editorService->ticksPerLine();
 
-    const auto events = song->renderToEvents(m_automationService, m_sideChainService, 0);
-    const auto maxTick = song->totalTicks();
     // Render settings belong to the song, so exporting one song cannot inherit another's trim.
     const auto & renderSettings = song->metadata().renderSettings();
-    const auto sampleRate = renderSettings.sampleRate();
-    const auto options = [&renderSettings]() {
+    // The velocity jitter and the arpeggiator shuffle are drawn while the events are generated. Every
+    // job starts over from the project's seed, so that each stem gets the very notes the master did,
+    // and the generator goes back to where playback left it once the events are made.
+    const bool deviceRender = job.captureSlot.has_value();
+    std::optional<RandomService::ScopedSeed> seed;
+    if (renderSettings.reproducibleEnabled() || deviceRender) {
+        seed.emplace(static_cast<RandomService::Generator::result_type>(renderSettings.randomSeed()));
+    }
+    const auto events = song->renderToEvents(m_automationService, m_sideChainService, 0);
+    seed.reset();
+    const auto maxTick = song->totalTicks();
+    const auto sampleRate = deviceRender ? job.sampleRate : renderSettings.sampleRate();
+    const auto options = [this, &renderSettings, &job, deviceRender]() {
         RenderOptions options;
+        // Played back in the device's place, so it is rendered just as the device would be heard
+        // live: no trim, fade or normalizing, and no rounding to a file format on the way.
+        if (deviceRender) {
+            options.bitDepth = BitDepth::Float_32;
+            options.oversampleFactor = m_audioEngine->playbackOversampleFactor();
+            options.captureSlot = job.captureSlot;
+            return options;
+        }
         options.bitDepth = static_cast<BitDepth>(renderSettings.bitDepth());
         options.format = static_cast<AudioFormat>(renderSettings.format());
         options.normalize = renderSettings.normalizeEnabled();
@@ -270,6 +304,7 @@ void RenderService::startNextRender()
         options.silenceTenths = renderSettings.silenceTenths();
         options.analyze = renderSettings.analyzeEnabled();
         options.oversampleFactor = static_cast<quint8>(renderSettings.oversampleFactor());
+        options.reproducible = renderSettings.reproducibleEnabled();
         return options;
     }();
 
@@ -294,6 +329,10 @@ void RenderService::startNextRender()
         return t;
     }();
 
+    // Left to the first block, the Samplers would convert to the export's rate while it runs, and
+    // the notes before and after that would be played from different data.
+    m_deviceService->prepareSampleRate(sampleRate);
+
     juzzlin::L(TAG).info() << "Invoking RenderWorker::render... events=" << events.size() << " maxTick=" << maxTick << " sampleRate=" << sampleRate << " bitDepth=" << static_cast<int>(options.bitDepth);
 
     const auto renderWorker = m_worker.get();
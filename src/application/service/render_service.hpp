@@ -19,6 +19,7 @@
 #include "device_service.hpp"
 
 #include <memory>
+#include <optional>
 
 #include <QObject>
 #include <QString>
@@ -61,6 +62,11 @@ public:
     Q_INVOKABLE void renderMaster(const QString & fileName);
     Q_INVOKABLE void renderIndividualTracks(const QString & directory);
     Q_INVOKABLE bool isRendering() const;
+
+    //! Renders the whole song as only the device in the slot puts it out, as 32-bit float at the
+    //! given rate, without the render settings' processing. The random draws start from the
+    //! project's seed whether or not reproducible renders are on. What freezing a device plays.
+    void renderDevice(size_t slotIndex, const QString & fileName, quint32 sampleRate);
     Q_INVOKABLE double progress() const;
 
     QString defaultRenderFileName() const;
@@ -99,6 +105,9 @@ private:
     {
         QString fileName;
         std::vector<quint64> soloTracks;
+        //! Set for a device render, which then runs at its own rate too.
+        std::optional<size_t> captureSlot;
+        quint32 sampleRate = 0;
     };
 
     std::vector<RenderJob> m_queue;
@@ -28,6 +28,7 @@
 #include "device_service.hpp"
 #include "mixer_service.hpp"
 
+#include <QCryptographicHash>
 #include <QDateTime>
 #include <QDir>
 #include <QFile>
@@ -81,6 +82,8 @@ void RenderWorker::render(const QString & fileName,
 
     // Isolate engine from real-time process
     m_audioEngine->setIsExclusive(true);
+    m_audioEngine->setFixedOrderSumming(options.reproducible);
+    m_audioEngine->setCaptureSlot(options.captureSlot);
 
     try {
         std::map<quint64, std::vector<EventS>> eventMap {};
@@ -169,6 +172,7 @@ void RenderWorker::render(const QString & fileName,
         };
 
         // Both the per-tick chunk and the sub-sample remainder below go out through this.
+        QCryptographicHash contentHash { QCryptographicHash::Sha256 };
         const auto convertAndPush = [&](size_t totalSamples, quint64 startFrame) {
             for (size_t i = 0; i < totalSamples; i++) {
                 auto sample = audioBuffer[i];
@@ -178,6 +182,9 @@ void RenderWorker::render(const QString & fileName,
                 // Clamp to prevent overflow when writing to PCM, but leave Float_32 alone
                 finalBuffer[i] = static_cast<float>(actualBitDepth == BitDepth::Float_32 ? sample : std::clamp(sample, -1.0, 1.0));
             }
+            if (options.reproducible) {
+                contentHash.addData(QByteArrayView { reinterpret_cast<const char *>(finalBuffer.data()), static_cast<qsizetype>(totalSamples * sizeof(float)) });
+            }
             while (!recorder.push(finalBuffer.data(), totalSamples)) {
                 std::this_thread::sleep_for(std::chrono::milliseconds { 1 });
             }
@@ -190,7 +197,7 @@ void RenderWorker::render(const QString & fileName,
 
             if (auto it = eventMap.find(tick); it != eventMap.end()) {
                 for (auto && event : it->second) {
-                    handleEvent(*event);
+                    handleEvent(*event, *m_deviceService, *m_mixerService);
                 }
             }
 
@@ -287,12 +294,24 @@ void RenderWorker::render(const QString & fileName,
             report += QString { "<br/>Saved to: %1" }.arg(QFileInfo { analysisFilePath(fileName) }.fileName());
         }
 
+        if (options.reproducible) {
+            const auto hash = QString::fromLatin1(contentHash.result().toHex());
+            juzzlin::L(TAG).info() << "Content hash of " << fileName.toStdString() << ": " << hash.toStdString();
+            writeContentHashFile(fileName, hash);
+            if (!report.isEmpty()) {
+                report += "<br/>";
+            }
+            report += QString { "Content hash: %1" }.arg(hash);
+        }
+
         m_audioEngine->reset();
         // A render drives the devices with the song's automation exactly as playback does, so it
         // has to hand them back the same way. Otherwise exporting a song would leave the panels
         // wherever the last rendered tick put them.
         m_deviceService->clearAutomation();
         m_audioEngine->setIsExclusive(false);
+        m_audioEngine->setFixedOrderSumming(false);
+        m_audioEngine->setCaptureSlot({});
         m_isRendering = false;
         juzzlin::L(TAG).info() << "Render finished successfully";
         emit finished(true, report);
@@ -300,45 +319,47 @@ void RenderWorker::render(const QString & fileName,
         m_audioEngine->reset();
         m_deviceService->clearAutomation();
         m_audioEngine->setIsExclusive(false);
+        m_audioEngine->setFixedOrderSumming(false);
+        m_audioEngine->setCaptureSlot({});
         m_isRendering = false;
         juzzlin::L(TAG).error() << "Render failed: " << e.what();
         emit finished(false, QString::fromStdString(e.what()));
     }
 }
 
-void RenderWorker::handleEvent(const Event & event)
+void RenderWorker::handleEvent(const Event & event, DeviceService & deviceService, const MixerService & mixerService)
 {
     event.visit([&](auto && data) {
         using T = std::decay_t<decltype(data)>;
         if constexpr (std::is_same_v<T, NoteData>) {
             if (auto && instrument = event.instrument(); instrument) {
-                if (const auto portName = instrument->midiAddress().portName(); m_deviceService->isInternalDevice(portName)) {
+                if (const auto portName = instrument->midiAddress().portName(); deviceService.isInternalDevice(portName)) {
                     if (data.type() == NoteData::Type::NoteOff) {
-                        m_deviceService->processMidiNoteOff(portName, *data.note());
+                        deviceService.processMidiNoteOff(portName, *data.note());
                     } else if (data.type() == NoteData::Type::NoteOn && data.note().has_value()) {
-                        if (m_mixerService->shouldColumnPlay(data.track(), data.column())) {
-                            const auto effectiveVelocity = m_mixerService->effectiveVelocity(data.track(), data.column(), data.velocity());
-                            m_deviceService->processMidiNoteOn(portName, *data.note(), effectiveVelocity);
+                        if (mixerService.shouldColumnPlay(data.track(), data.column())) {
+                            const auto effectiveVelocity = mixerService.effectiveVelocity(data.track(), data.column(), data.velocity());
+                            deviceService.processMidiNoteOn(portName, *data.note(), effectiveVelocity);
                         }
                     }
                 }
             }
         } else if constexpr (std::is_same_v<T, MidiCcData>) {
             if (auto && instrument = event.instrument(); instrument) {
-                if (const auto portName = instrument->midiAddress().portName(); m_deviceService->isInternalDevice(portName)) {
-                    m_deviceService->processMidiCc(portName, data.controller(), data.value(), instrument->midiAddress().channel());
+                if (const auto portName = instrument->midiAddress().portName(); deviceService.isInternalDevice(portName)) {
+                    deviceService.processMidiCc(portName, data.controller(), data.value(), instrument->midiAddress().channel());
                 }
             }
         } else if constexpr (std::is_same_v<T, PitchBendData>) {
             if (auto && instrument = event.instrument(); instrument) {
-                if (const auto portName = instrument->midiAddress().portName(); m_deviceService->isInternalDevice(portName)) {
-                    m_deviceService->processMidiPitchBend(portName, (static_cast<uint16_t>(data.msb()) << 7) | data.lsb(), instrument->midiAddress().channel());
+                if (const auto portName = instrument->midiAddress().portName(); deviceService.isInternalDevice(portName)) {
+                    deviceService.processMidiPitchBend(portName, (static_cast<uint16_t>(data.msb()) << 7) | data.lsb(), instrument->midiAddress().channel());
                 }
             }
         } else if constexpr (std::is_same_v<T, Event::InstrumentSettingsS>) {
             if (data) {
                 if (auto && instrument = event.instrument(); instrument) {
-                    m_deviceService->processMidiAllNotesOff(instrument->midiAddress().portName());
+                    deviceService.processMidiAllNotesOff(instrument->midiAddress().portName());
                     // Settings like transpose/delay are already applied to events by Song::applyInstrumentsOnEvents
                 }
             }
@@ -502,4 +523,23 @@ void RenderWorker::writeAnalysisFile(const QString & renderedPath, const QString
     juzzlin::L(TAG).info() << "Analysis written to " << path.toStdString();
 }
 
+QString RenderWorker::contentHashFilePath(const QString & renderedPath)
+{
+    return renderedPath + ".hash.txt";
+}
+
+void RenderWorker::writeContentHashFile(const QString & renderedPath, const QString & hash)
+{
+    const auto path = contentHashFilePath(renderedPath);
+    QFile file { path };
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        juzzlin::L(TAG).error() << "Failed to write the content hash file: " << path.toStdString();
+        return;
+    }
+    QTextStream stream { &file };
+    stream << "File: " << QFileInfo { renderedPath }.fileName() << "\n";
+    stream << "SHA-256 of the rendered samples: " << hash << "\n";
+    file.close();
+}
+
 } // namespace noteahead
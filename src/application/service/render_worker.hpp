@@ -23,6 +23,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "../../infra/audio/backend/audio_file_reader.hpp"
@@ -61,6 +62,12 @@ struct RenderOptions
     //! Analyzes the rendered file for loudness, which is both reported back and written next to it
     //! as "<rendered file name>.loudness.txt".
     bool analyze = false;
+    //! Sums the devices in a fixed order and writes a hash of the rendered audio next to the file
+    //! as "<rendered file name>.hash.txt". The random seeds are fixed before the events are made.
+    bool reproducible = false;
+    //! Renders only the device in this slot, without the sends and the master inserts. What
+    //! freezing a device records.
+    std::optional<size_t> captureSlot;
     quint8 oversampleFactor = 2;
 };
 
@@ -90,6 +97,11 @@ public:
 
     void setAudioFileReaderFactory(AudioFileReaderFactory factory);
 
+    //! Hands an event to the internal device it addresses, as a render does: after the mixer's
+    //! say, and with the instrument settings already applied up front. Events for external ports
+    //! are left alone. Shared with rendering ahead of the playhead, which has to sound the same.
+    static void handleEvent(const Event & event, DeviceService & deviceService, const MixerService & mixerService);
+
 public slots:
     void render(const QString & fileName,
                 const noteahead::RenderWorker::EventList & events,
@@ -104,7 +116,6 @@ signals:
     void finished(bool success, QString message);
 
 private:
-    void handleEvent(const Event & event);
     double runNormalizationScan(const QString & tempPath);
     void writeFinalFile(const QString & tempPath, const QString & finalPath, double gain, quint32 sampleRate, quint32 recordingBufferSize, noteahead::BitDepth bitDepth, noteahead::AudioFormat format, const std::map<noteahead::AudioFileReader::TagType, std::string> & tags);
     LoudnessAnalyzer::Result runLoudnessAnalysis(const QString & finalPath, quint32 sampleRate);
@@ -124,6 +135,14 @@ private:
     //! audio is what the user asked for, and it is already on disk by this point.
     static void writeAnalysisFile(const QString & renderedPath, const QString & report);
 
+    //! Path of the content hash written beside a rendered file, named the same way as the analysis.
+    static QString contentHashFilePath(const QString & renderedPath);
+
+    //! The hash covers the samples as the engine rendered them, before normalizing and before the
+    //! conversion to the file's format, so it tells whether the mix changed whatever it was saved as.
+    //! Failing to write it is logged and swallowed, as for the analysis.
+    static void writeContentHashFile(const QString & renderedPath, const QString & hash);
+
     AudioEngineS m_audioEngine;
     DeviceServiceS m_deviceService;
     MixerServiceS m_mixerService;
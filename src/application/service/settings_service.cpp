@@ -40,6 +40,8 @@ SettingsService::SettingsService()
   , m_audioInputDeviceId { Settings::audioInputDeviceId() }
   , m_audioOutputDeviceId { Settings::audioOutputDeviceId() }
   , m_multiThreadedPlaybackEnabled { Settings::multiThreadedPlaybackEnabled() }
+  , m_masterPipelineEnabled { Settings::masterPipelineEnabled() }
+  , m_renderAheadEnabled { Settings::renderAheadEnabled() }
   , m_jackSyncEnabled { Settings::jackSyncEnabled() }
   , m_jackBpmSyncEnabled { Settings::jackBpmSyncEnabled() }
   , m_midiSyncEnabled { Settings::midiSyncEnabled() }
@@ -224,6 +226,34 @@ void SettingsService::setMultiThreadedPlaybackEnabled(bool enabled)
     }
 }
 
+bool SettingsService::masterPipelineEnabled() const
+{
+    return m_masterPipelineEnabled;
+}
+
+void SettingsService::setMasterPipelineEnabled(bool enabled)
+{
+    if (m_masterPipelineEnabled != enabled) {
+        m_masterPipelineEnabled = enabled;
+        Settings::setMasterPipelineEnabled(enabled);
+        emit masterPipelineEnabledChanged();
+    }
+}
+
+bool SettingsService::renderAheadEnabled() const
+{
+    return m_renderAheadEnabled;
+}
+
+void SettingsService::setRenderAheadEnabled(bool enabled)
+{
+    if (m_renderAheadEnabled != enabled) {
+        m_renderAheadEnabled = enabled;
+        Settings::setRenderAheadEnabled(enabled);
+        emit renderAheadEnabledChanged();
+    }
+}
+
 bool SettingsService::jackSyncEnabled() const
 {
     return m_jackSyncEnabled;
@@ -35,6 +35,8 @@ class SettingsService : public QObject
     Q_PROPERTY(bool recordingEnabled READ recordingEnabled WRITE setRecordingEnabled NOTIFY recordingEnabledChanged)
     Q_PROPERTY(int audioBackend READ audioBackend WRITE setAudioBackend NOTIFY audioBackendChanged)
     Q_PROPERTY(bool multiThreadedPlaybackEnabled READ multiThreadedPlaybackEnabled WRITE setMultiThreadedPlaybackEnabled NOTIFY multiThreadedPlaybackEnabledChanged)
+    Q_PROPERTY(bool masterPipelineEnabled READ masterPipelineEnabled WRITE setMasterPipelineEnabled NOTIFY masterPipelineEnabledChanged)
+    Q_PROPERTY(bool renderAheadEnabled READ renderAheadEnabled WRITE setRenderAheadEnabled NOTIFY renderAheadEnabledChanged)
     Q_PROPERTY(bool jackSyncEnabled READ jackSyncEnabled WRITE setJackSyncEnabled NOTIFY jackSyncEnabledChanged)
     Q_PROPERTY(bool jackBpmSyncEnabled READ jackBpmSyncEnabled WRITE setJackBpmSyncEnabled NOTIFY jackBpmSyncEnabledChanged)
     Q_PROPERTY(bool midiSyncEnabled READ midiSyncEnabled WRITE setMidiSyncEnabled NOTIFY midiSyncEnabledChanged)
@@ -91,6 +93,12 @@ public:
     virtual Q_INVOKABLE bool multiThreadedPlaybackEnabled() const;
     virtual Q_INVOKABLE void setMultiThreadedPlaybackEnabled(bool enabled);
 
+    virtual Q_INVOKABLE bool masterPipelineEnabled() const;
+    virtual Q_INVOKABLE void setMasterPipelineEnabled(bool enabled);
+
+    virtual Q_INVOKABLE bool renderAheadEnabled() const;
+    virtual Q_INVOKABLE void setRenderAheadEnabled(bool enabled);
+
     virtual Q_INVOKABLE bool jackSyncEnabled() const;
     virtual Q_INVOKABLE void setJackSyncEnabled(bool enabled);
 
@@ -146,6 +154,8 @@ signals:
     void recordingEnabledChanged();
     void audioBackendChanged();
     void multiThreadedPlaybackEnabledChanged();
+    void masterPipelineEnabledChanged();
+    void renderAheadEnabledChanged();
     void jackSyncEnabledChanged();
     void jackBpmSyncEnabledChanged();
     void midiSyncEnabledChanged();
@@ -180,6 +190,8 @@ private:
     int m_audioOutputDeviceId;
 
     bool m_multiThreadedPlaybackEnabled;
+    bool m_masterPipelineEnabled;
+    bool m_renderAheadEnabled;
     bool m_jackSyncEnabled;
     bool m_jackBpmSyncEnabled;
     bool m_midiSyncEnabled;
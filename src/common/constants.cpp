@@ -108,6 +108,11 @@ quint64 minTrackCount()
 }
 
 size_t deviceRackSize()
+{
+    return 256;
+}
+
+size_t deviceRackMinVisibleSlots()
 {
     return 16;
 }
@@ -912,6 +917,16 @@ QString xmlKeyAnalyzeEnabled()
     return "analyzeEnabled";
 }
 
+QString xmlKeyReproducibleEnabled()
+{
+    return "reproducibleEnabled";
+}
+
+QString xmlKeyRandomSeed()
+{
+    return "randomSeed";
+}
+
 QString xmlKeyTags()
 {
     return "Tags";
@@ -2257,6 +2272,11 @@ QString xmlKeyPitchDecay()
     return "pitchDecay";
 }
 
+QString xmlKeyHitCache()
+{
+    return "hitCache";
+}
+
 QString xmlKeyFrequency()
 {
     return "frequency";
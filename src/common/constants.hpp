@@ -56,7 +56,11 @@ quint64 minVisibleUnitCount();
 // A song always keeps at least this many tracks, regardless of how many of them fit on screen.
 quint64 minTrackCount();
 
+// Slots a project can put devices in. Only the occupied ones cost anything: the engine and the
+// rack UI both follow the devices actually there, not this bound.
 size_t deviceRackSize();
+// Rack UIs show at least this many device slots, and always one free slot past the last device.
+size_t deviceRackMinVisibleSlots();
 size_t effectRackSize();
 
 int transposeMin();
@@ -334,6 +338,8 @@ QString xmlKeySilenceEnabled();
 QString xmlKeySilenceSeconds();
 QString xmlKeySilenceTenths();
 QString xmlKeyAnalyzeEnabled();
+QString xmlKeyReproducibleEnabled();
+QString xmlKeyRandomSeed();
 QString xmlKeyTags();
 QString xmlKeyTag();
 QString xmlKeyTitle();
@@ -644,6 +650,7 @@ QString xmlKeySnappy();
 QString xmlKeyTone();
 QString xmlKeyPitchDepth();
 QString xmlKeyPitchDecay();
+QString xmlKeyHitCache();
 
 QString xmlKeyFrequency();
 QString xmlKeyQ();
@@ -21,8 +21,13 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <charconv>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include <QVariant>
 
@@ -82,6 +87,67 @@ QStringList stdStringVectorToQStringList(const std::vector<std::string> & string
 }
 } // namespace Misc
 
+namespace Parallel {
+void run(size_t count, const std::function<void(size_t)> & work, const std::function<void(size_t)> & progress)
+{
+    std::vector<std::exception_ptr> errors(count);
+    std::atomic<size_t> next { 0 };
+    // Counted under a lock the calling thread can wait on, so that it reports each one as it is
+    // done. Only the calling thread reports: its receivers may not be thread safe.
+    std::mutex doneMutex;
+    std::condition_variable doneChanged;
+    size_t done = 0;
+    const auto worker = [&](bool callingThread) {
+        for (size_t i = next++; i < count; i = next++) {
+            try {
+                work(i);
+            } catch (...) {
+                errors.at(i) = std::current_exception();
+            }
+            size_t doneCount = 0;
+            {
+                const std::lock_guard<std::mutex> lock { doneMutex };
+                doneCount = ++done;
+            }
+            doneChanged.notify_one();
+            if (callingThread && progress) {
+                progress(doneCount);
+            }
+        }
+    };
+
+    // The calling thread takes a share too, so a single item starts no thread.
+    const auto workerCount = std::min<size_t>(count, std::max(1u, std::thread::hardware_concurrency())) - (count ? 1 : 0);
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; i++) {
+        workers.emplace_back(worker, false);
+    }
+    worker(true);
+    {
+        std::unique_lock<std::mutex> lock { doneMutex };
+        for (size_t reported = done; reported < count; reported = done) {
+            doneChanged.wait(lock, [&] { return done != reported; });
+            const auto doneCount = done;
+            lock.unlock();
+            if (progress) {
+                progress(doneCount);
+            }
+            lock.lock();
+        }
+    }
+    for (auto && thread : workers) {
+        thread.join();
+    }
+
+    for (auto && error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+} // namespace Parallel
+
 namespace Xml {
 std::optional<bool> readBoolAttribute(ProjectReader & reader, QString name, bool required)
 {
@@ -19,6 +19,7 @@
 #include <array>
 #include <chrono>
 #include <filesystem>
+#include <functional>
 #include <optional>
 #include <string>
 #include <vector>
@@ -37,6 +38,13 @@ QStringList stdStringVectorToQStringList(const std::vector<std::string> & string
 std::optional<double> parseDecimal(std::string_view string);
 } // namespace Misc
 
+namespace Parallel {
+//! Runs @p work for 0..count - 1 over the cores, the calling thread included, and rethrows the first
+//! error once all of it has finished. @p progress, if given, is called on the calling thread with
+//! the number done so far as they finish.
+void run(size_t count, const std::function<void(size_t)> & work, const std::function<void(size_t)> & progress = {});
+} // namespace Parallel
+
 namespace Midi {
 uint8_t scaleVelocityByKey(uint8_t velocity, uint8_t note, int keyTrackPercentage, int keyTrackOffset = 0);
 double portNameMatchScore(const std::string & s1, const std::string & s2);
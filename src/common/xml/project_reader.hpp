@@ -48,6 +48,11 @@ public:
     virtual QString errorString() const = 0;
 
     virtual QString readElementText() = 0;
+
+    //! The current element and everything inside it, as a document of its own, leaving the reader
+    //! on the element's end like skipCurrentElement() does. Lets a part of the project be read
+    //! later or elsewhere, e.g. on another thread, by a reader of its own.
+    virtual QString readElementXml() = 0;
 };
 
 } // namespace noteahead
@@ -148,6 +148,7 @@ std::vector<MidiCcController> BassSynthDevice::availableMidiCcControllers() cons
 void BassSynthDevice::processMidiNoteOn(uint8_t note, uint8_t velocity)
 {
     const std::lock_guard<std::recursive_mutex> lock { mutex() };
+    wake();
     handleNoteOn(note, velocity);
 }
 
@@ -161,6 +162,7 @@ void BassSynthDevice::processMidiCc(uint8_t controller, uint8_t value, uint8_t)
 {
     using namespace MidiCcMapping;
 
+    wake();
     bool changed = false;
     {
         std::lock_guard<std::recursive_mutex> lock { mutex() };
@@ -193,13 +195,14 @@ void BassSynthDevice::processMidiCc(uint8_t controller, uint8_t value, uint8_t)
     }
 
     if (changed) {
-        emit parametersChanged();
+        markParametersChanged();
     }
 }
 
 void BassSynthDevice::processMidiPitchBend(uint16_t value, uint8_t)
 {
     const std::lock_guard<std::recursive_mutex> lock { mutex() };
+    wake();
     m_pitchBend = value;
 }
 
@@ -222,6 +222,14 @@ size_t Device::reverbSendCount() const
     return m_reverbSends.size();
 }
 
+void Device::reverbSends(std::span<double> out) const
+{
+    std::lock_guard<std::recursive_mutex> lock { m_mutex };
+    for (size_t index = 0; index < out.size(); index++) {
+        out[index] = index < m_reverbSends.size() ? static_cast<double>(m_reverbSends[index]) : 0.0;
+    }
+}
+
 bool Device::updateVolumeParameter(float volume, bool authored)
 {
     std::lock_guard<std::recursive_mutex> lock { m_mutex };
@@ -373,10 +381,8 @@ void Device::clearAutomation()
         std::lock_guard<std::recursive_mutex> lock { m_mutex };
         changed = clearAutomationInternal();
     }
-    // Never emitted under the lock: the receivers read back from the audio engine, whose callback
-    // holds the engine mutex and then waits for this one.
     if (changed) {
-        emit parametersChanged();
+        markParametersChanged();
     }
 }
 
@@ -491,6 +497,43 @@ const LoadMeter & Device::loadMeter() const
     return m_loadMeter;
 }
 
+Device::Lifecycle Device::lifecycle() const
+{
+    return m_lifecycle.load(std::memory_order_relaxed);
+}
+
+void Device::setLifecycle(Lifecycle lifecycle)
+{
+    m_lifecycle.store(lifecycle, std::memory_order_relaxed);
+}
+
+void Device::wake()
+{
+    m_wakeRequested.store(true, std::memory_order_release);
+}
+
+bool Device::takeWake()
+{
+    // Cheap to ask of every sleeping device each block: it only writes when there is a request.
+    return m_wakeRequested.load(std::memory_order_relaxed) && m_wakeRequested.exchange(false, std::memory_order_acquire);
+}
+
+void Device::markParametersChanged()
+{
+    if (m_parametersDirty.load(std::memory_order_relaxed)) {
+        return;
+    }
+    if (!m_parametersDirty.exchange(true, std::memory_order_acq_rel)) {
+        emit parametersChangePending();
+    }
+}
+
+bool Device::takeParametersChanged()
+{
+    // Asked of every device every frame, so only a device that has something to report writes.
+    return m_parametersDirty.load(std::memory_order_relaxed) && m_parametersDirty.exchange(false, std::memory_order_acquire);
+}
+
 float Device::volumeInternal() const
 {
     return m_volume;
@@ -26,9 +26,11 @@
 #include "../utility/level_meter.hpp"
 #include "../utility/load_meter.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -76,6 +78,19 @@ public:
         PreFader = 1
     };
 
+    //! Where the engine has the device between blocks.
+    enum class Lifecycle : uint8_t
+    {
+        //! Its voices are sounding.
+        Active,
+        //! Its voices have stopped, but what they left in the device's own effects or its insert
+        //! rack is still dying away.
+        Tailing,
+        //! Nothing is left. The engine neither renders the device nor asks it whether it should,
+        //! until wake() is called.
+        Asleep
+    };
+
     Device();
     virtual ~Device() override = default;
 
@@ -152,11 +167,44 @@ public:
     ClipDetector & clipDetector();
     const ClipDetector & clipDetector() const;
 
+    //! Whether the device's voices are sounding. Asked only while the device is awake. A device
+    //! that does not say is taken to be always playing, and never sleeps.
     virtual bool hasActiveAudio() const
     {
         return true;
     }
 
+    Lifecycle lifecycle() const;
+    //! Audio-thread: the engine's account of the block just rendered.
+    void setLifecycle(Lifecycle lifecycle);
+
+    //! Brings the device back from sleep for the next block. Lock-free and constant time, so a
+    //! note-on can always afford it: every device calls it there and on a CC or pitch bend, and so
+    //! must anything else that starts one of its voices or moves what they sound like.
+    void wake();
+    //! Audio-thread: whether wake() was called since the engine last asked, clearing it.
+    bool takeWake();
+
+    //! Whether a parameter moved since the last call, clearing the mark. DeviceService asks this
+    //! once per display frame and turns a yes into a single parametersChanged().
+    bool takeParametersChanged();
+
+    //! Whether processAudio() can render into the planar float view of the AudioContext. The engine
+    //! then hands it one and converts the result to the interleaved double buffer itself, so the
+    //! device's own render loop never touches the wide, interleaved form.
+    virtual bool supportsPlanarAudio() const
+    {
+        return false;
+    }
+
+    //! Whether processAudio() splits its voices across AudioContext::fork. A device that does can
+    //! keep several cores busy on its own, so the engine brings in its workers even when this is
+    //! the only device playing.
+    virtual bool rendersVoicesInParallel() const
+    {
+        return false;
+    }
+
     virtual void setBpm(float bpm);
 
     virtual void reset() override;
@@ -206,6 +254,9 @@ public:
     float reverbSend(size_t index) const;
     virtual void setReverbSend(size_t index, float send);
     size_t reverbSendCount() const;
+    //! Every send level at once, for the engine's per-block snapshot, which would otherwise take
+    //! the lock once per send of every device. Entries past the device's own sends are zeroed.
+    void reverbSends(std::span<double> out) const;
 
 signals:
     //! The device itself changed in a way the rest of the application has to react to: it was
@@ -214,7 +265,12 @@ signals:
     //! A parameter value moved. Emitted for MIDI CC traffic, which during playback of an automation
     //! arrives many times per beat, so only the device's own dialog listens to it. Routing that
     //! through dataChanged() reset the Device Rack model and rebuilt the port lists per event.
+    //! The transport's threads never emit it themselves: they markParametersChanged(), and
+    //! DeviceService emits at most once per device per display frame.
     void parametersChanged();
+    //! The first markParametersChanged() since DeviceService last took the mark, and the only one
+    //! of them that emits: it is what starts the frame timer, which stops again once idle.
+    void parametersChangePending();
     void sampleRateChanged();
 
 protected:
@@ -228,6 +284,11 @@ protected:
     //! anything actually moved. Devices with transient state of their own extend this.
     virtual bool clearAutomationInternal();
 
+    //! Notes that a parameter moved, for DeviceService to report on its next frame. Lock-free and
+    //! allocation-free, and the hundredth call between two frames costs what the first one did, so
+    //! the MIDI CC handlers call it for every event instead of emitting per event.
+    void markParametersChanged();
+
     void setContinuousParameterValue(const std::string & key, float value);
     void setDiscreteParameterValue(const std::string & key, int value);
 
@@ -270,6 +331,12 @@ private:
     LoadMeter m_loadMeter;
     ClipDetector m_clipDetector;
 
+    //! Starts out awake, so a new device is asked about its voices at least once.
+    std::atomic<Lifecycle> m_lifecycle { Lifecycle::Active };
+    std::atomic<bool> m_wakeRequested { false };
+    //! One flag rather than one per parameter: the listeners read every setting back anyway.
+    std::atomic<bool> m_parametersDirty { false };
+
     mutable std::recursive_mutex m_mutex;
 };
 
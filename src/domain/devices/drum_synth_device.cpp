@@ -22,9 +22,12 @@
 #include "../../infra/midi/midi_cc_mapping.hpp"
 
 #include "../dsp/drum/clap_engine.hpp"
+#include "../dsp/fast_math.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <numbers>
+#include <span>
 
 namespace noteahead {
 
@@ -46,6 +49,7 @@ DrumSynthDevice::DrumSynthDevice(std::string name)
     for (int i { 0 }; i < NumVoices; i++) {
         addVoiceParameters(i);
     }
+    addParameter(Parameter { Constants::NahdXml::xmlKeyHitCache().toStdString(), 0.0f, 0, 1, 0, 1, Parameter::Type::Boolean });
 
     DrumSynthDevice::syncParameters();
 }
@@ -109,18 +113,18 @@ std::vector<MidiCcController> DrumSynthDevice::availableMidiCcControllers() cons
 void DrumSynthDevice::processMidiNoteOn(uint8_t note, uint8_t velocity)
 {
     const std::lock_guard<std::recursive_mutex> lock { mutex() };
+    wake();
 
     using enum DrumSynth::MidiNote;
 
     // Hi-hat choking logic: Closed Hat or Pedal Hat chokes Open Hat
     if (note == static_cast<uint8_t>(ClosedHiHat) || note == static_cast<uint8_t>(PedalHiHat)) {
-        m_voices[static_cast<int>(VoiceIndex::OpenHiHat)].engine->stop();
+        stopVoice(m_voices[static_cast<int>(VoiceIndex::OpenHiHat)]);
     }
 
-    for (auto && voice : m_voices) {
-        if (voice.midiNote == note) {
-            const float vel { static_cast<float>(velocity) / 127.0f };
-            voice.engine->trigger(vel);
+    for (int i { 0 }; i < NumVoices; i++) {
+        if (m_voices.at(i).midiNote == note) {
+            triggerVoice(i, static_cast<float>(velocity) / 127.0f);
             break;
         }
     }
@@ -134,7 +138,7 @@ void DrumSynthDevice::processMidiNoteOff(uint8_t note)
 
     // Closed Hat choke logic: smoothly stop Open Hat on CHH/Pedal release
     if (note == static_cast<uint8_t>(ClosedHiHat) || note == static_cast<uint8_t>(PedalHiHat)) {
-        m_voices[static_cast<int>(VoiceIndex::OpenHiHat)].engine->stop();
+        stopVoice(m_voices[static_cast<int>(VoiceIndex::OpenHiHat)]);
     }
 }
 
@@ -142,6 +146,7 @@ void DrumSynthDevice::processMidiCc(uint8_t controller, uint8_t value, uint8_t /
 {
     using namespace MidiCcMapping;
 
+    wake();
     // Nothing here may emit while the lock is held: dataChanged() receivers read back from the
     // audio engine, whose callback takes the engine mutex before this one. parametersChanged() is
     // emitted below, once the lock is gone, and is what the dialog follows anyway.
@@ -181,7 +186,7 @@ void DrumSynthDevice::processMidiCc(uint8_t controller, uint8_t value, uint8_t /
     }
 
     if (changed) {
-        emit parametersChanged();
+        markParametersChanged();
     }
 }
 
@@ -189,7 +194,7 @@ void DrumSynthDevice::processMidiAllNotesOff()
 {
     const std::lock_guard<std::recursive_mutex> lock { mutex() };
     for (auto && voice : m_voices) {
-        voice.engine->stop();
+        stopVoice(voice);
     }
 }
 
@@ -207,6 +212,17 @@ void DrumSynthDevice::processAudio(AudioContext & context)
         voice.hpf->setSampleRate(oversampledRate);
     }
 
+    // A hit half rendered at the old rate would be found again at the new one.
+    if (oversampledRate != m_hitCacheSampleRate || oversampleFactor != m_hitCacheOversampleFactor) {
+        m_hitCacheSampleRate = oversampledRate;
+        m_hitCacheOversampleFactor = oversampleFactor;
+        if (m_hitCache) {
+            for (auto && voice : m_voices) {
+                voice.hitPlayer.invalidate(*voice.engine, *m_hitCache);
+            }
+        }
+    }
+
     // Snapshot each voice's insert-rack effects for per-sample processing at the oversampled rate. The
     // rack is inserted after the fixed per-voice DSP chain and runs sample-by-sample like the other voice
     // effects, so time-based effects stay correct (their times derive from the oversampled sample rate).
@@ -239,8 +255,8 @@ void DrumSynthDevice::processAudio(AudioContext & context)
 
             for (int v = 0; v < NumVoices; v++) {
                 auto & voice = m_voices.at(v);
-                if (voice.engine->isActive()) {
-                    float sample = voice.engine->nextSample();
+                if (isVoiceActive(voice)) {
+                    const float sample = m_hitCache ? voice.hitPlayer.nextSample(*voice.engine, *m_hitCache) : voice.engine->nextSample();
                     double l = sample;
                     double r = sample;
 
@@ -267,13 +283,15 @@ void DrumSynthDevice::processAudio(AudioContext & context)
     const float panL = static_cast<float>(std::cos(panAngle));
     const float panR = static_cast<float>(std::sin(panAngle));
 
+    // Soft-clip at high rate in one pass over the whole block, and then downsample
+    FastMath::tanh(std::span { oversampledBuffer.data(), oversampledSize });
+
     std::array<float, 4> highL {};
     std::array<float, 4> highR {};
     for (uint32_t i = 0; i < context.frameCount; i++) {
-        // Soft-clip at high rate and then downsample
         for (uint8_t os = 0; os < oversampleFactor; os++) {
-            highL[os] = std::tanh(oversampledBuffer[(i * oversampleFactor + os) * 2]);
-            highR[os] = std::tanh(oversampledBuffer[(i * oversampleFactor + os) * 2 + 1]);
+            highL[os] = oversampledBuffer[(i * oversampleFactor + os) * 2];
+            highR[os] = oversampledBuffer[(i * oversampleFactor + os) * 2 + 1];
         }
 
         const float l = m_downsamplerL.process(highL.data(), oversampleFactor);
@@ -287,12 +305,7 @@ void DrumSynthDevice::processAudio(AudioContext & context)
 bool DrumSynthDevice::hasActiveAudio() const
 {
     const std::lock_guard<std::recursive_mutex> lock { mutex() };
-    for (const auto & voice : m_voices) {
-        if (voice.engine->isActive()) {
-            return true;
-        }
-    }
-    return false;
+    return std::ranges::any_of(m_voices, [this](auto && voice) { return isVoiceActive(voice); });
 }
 
 void DrumSynthDevice::reset()
@@ -306,7 +319,11 @@ void DrumSynthDevice::resetAudio()
 {
     const std::lock_guard<std::recursive_mutex> lock { mutex() };
     for (auto && voice : m_voices) {
-        voice.engine->reset();
+        if (m_hitCache) {
+            voice.hitPlayer.reset(*voice.engine, *m_hitCache);
+        } else {
+            voice.engine->reset();
+        }
         voice.effectRack.reset();
     }
     m_downsamplerL.reset();
@@ -541,11 +558,106 @@ void DrumSynthDevice::syncParameters()
 {
     Device::syncParameters();
 
+    syncHitCache();
     for (int i { 0 }; i < NumVoices; i++) {
         syncVoiceParameters(i);
     }
 }
 
+void DrumSynthDevice::syncHitCache()
+{
+    bool enabled { false };
+    if (auto p = parameter(Constants::NahdXml::xmlKeyHitCache().toStdString()); p) {
+        enabled = p->get().xmlValue() != 0;
+    }
+    if (enabled == static_cast<bool>(m_hitCache)) {
+        return;
+    }
+
+    // The voices change hands between their engines and their players, so whatever rings stops.
+    for (auto && voice : m_voices) {
+        if (m_hitCache) {
+            voice.hitPlayer.reset(*voice.engine, *m_hitCache);
+        } else {
+            voice.engine->reset();
+        }
+    }
+    m_hitCache = enabled ? std::make_unique<DrumHitCache>() : nullptr;
+}
+
+void DrumSynthDevice::updateEngineParameters(int index)
+{
+    // Everything under the voice's prefix reaches the engine, bar the chain that follows it.
+    const std::string prefix { voiceId(index) + "_" };
+    const std::array chainKeys {
+        Constants::NahdXml::xmlKeyLevel().toStdString(),
+        Constants::NahdXml::xmlKeyPan().toStdString(),
+        Constants::NahdXml::xmlKeyCutoff().toStdString(),
+        Constants::NahdXml::xmlKeyHpfCutoff().toStdString()
+    };
+
+    std::array<float, DrumHitCache::MaxParameters> engineParameters {};
+    size_t count { 0 };
+    for (auto && [name, parameter] : parameters()) {
+        if (name.starts_with(prefix) && std::ranges::find(chainKeys, name.substr(prefix.size())) == chainKeys.end() && count < engineParameters.size()) {
+            engineParameters.at(count++) = parameter.value();
+        }
+    }
+
+    auto & voice { m_voices.at(index) };
+    if (engineParameters != voice.engineParameters) {
+        voice.engineParameters = engineParameters;
+        if (m_hitCache) {
+            voice.hitPlayer.invalidate(*voice.engine, *m_hitCache);
+        }
+    }
+}
+
+DrumHitCache::Key DrumSynthDevice::hitCacheKey(int index) const
+{
+    return { index, m_hitCacheSampleRate, m_hitCacheOversampleFactor, m_voices.at(index).engineParameters };
+}
+
+void DrumSynthDevice::triggerVoice(int index, float velocity)
+{
+    auto & voice { m_voices.at(index) };
+    if (m_hitCache) {
+        voice.hitPlayer.trigger(*voice.engine, *m_hitCache, hitCacheKey(index), velocity);
+    } else {
+        voice.engine->trigger(velocity);
+    }
+}
+
+void DrumSynthDevice::stopVoice(Voice & voice)
+{
+    if (m_hitCache) {
+        voice.hitPlayer.stop(*voice.engine);
+    } else {
+        voice.engine->stop();
+    }
+}
+
+bool DrumSynthDevice::isVoiceActive(const Voice & voice) const
+{
+    return m_hitCache ? voice.hitPlayer.isActive(*voice.engine) : voice.engine->isActive();
+}
+
+bool DrumSynthDevice::hitCacheEnabled() const
+{
+    const std::lock_guard<std::recursive_mutex> lock { mutex() };
+    return m_hitCache != nullptr;
+}
+
+void DrumSynthDevice::setHitCacheEnabled(bool enabled)
+{
+    setDiscreteParameterValue(Constants::NahdXml::xmlKeyHitCache().toStdString(), enabled ? 1 : 0);
+}
+
+const DrumHitCache * DrumSynthDevice::hitCache() const
+{
+    return m_hitCache.get();
+}
+
 void DrumSynthDevice::syncVoiceParameters(int index)
 {
     const std::string prefix { voiceId(index) + "_" };
@@ -576,6 +688,8 @@ void DrumSynthDevice::syncVoiceParameters(int index)
         syncTomParameters(index, prefix);
     else if (voiceIdx >= VoiceIndex::Crash && voiceIdx <= VoiceIndex::ReverseCrash)
         syncCymbalParameters(index, prefix);
+
+    updateEngineParameters(index);
 }
 
 void DrumSynthDevice::syncCommonEngineParameters(int index, const std::string & prefix)
@@ -17,6 +17,7 @@
 #define DRUM_SYNTH_DEVICE_HPP
 
 #include "../dsp/drum/crash_engine.hpp"
+#include "../dsp/drum/drum_hit_player.hpp"
 #include "../dsp/drum/hihat_engine.hpp"
 #include "../dsp/drum/kick_engine.hpp"
 #include "../dsp/drum/ride_engine.hpp"
@@ -78,6 +79,14 @@ public:
     //! that. MIDI CC must use automateVoiceParameter() instead -- see processMidiCc().
     bool updateVoiceParameter(int voiceIndex, const std::string & paramName, float value);
 
+    //! Plays every hit back from a render of it kept in a DrumHitCache, so a hit is only ever
+    //! synthesized once per set of voice parameters. Off by default: each hit of a voice then
+    //! repeats the noise of the first rather than drawing its own.
+    bool hitCacheEnabled() const;
+    void setHitCacheEnabled(bool enabled);
+    //! Null while the hit cache is off.
+    const DrumHitCache * hitCache() const;
+
 protected:
     void syncParameters() override;
 
@@ -107,6 +116,10 @@ private:
         float lpfCutoff { 1.0f };
         float hpfCutoff { 0.0f };
 
+        DrumHitPlayer hitPlayer;
+        //! The engine's parameters as last synced, for its hit cache key.
+        std::array<float, DrumHitCache::MaxParameters> engineParameters {};
+
         void updateEffects();
     };
 
@@ -121,6 +134,10 @@ private:
     Decimator m_downsamplerL;
     Decimator m_downsamplerR;
 
+    std::unique_ptr<DrumHitCache> m_hitCache;
+    uint32_t m_hitCacheSampleRate { 0 };
+    uint8_t m_hitCacheOversampleFactor { 1 };
+
     void initializeVoices();
     void addVoiceParameters(int index);
     void addKickParameters(const std::string & prefix);
@@ -130,6 +147,14 @@ private:
     void addCymbalParameters(const std::string & prefix);
 
     void syncVoiceParameters(int index);
+    void syncHitCache();
+    //! Collects what the voice's engine renders from, and drops a hit half rendered from the old.
+    void updateEngineParameters(int index);
+    DrumHitCache::Key hitCacheKey(int index) const;
+
+    void triggerVoice(int index, float velocity);
+    void stopVoice(Voice & voice);
+    bool isVoiceActive(const Voice & voice) const;
     void syncCommonEngineParameters(int index, const std::string & prefix);
     void syncKickParameters(const std::string & prefix);
     void syncSnareParameters(const std::string & prefix);
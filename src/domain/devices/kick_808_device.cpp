@@ -128,6 +128,7 @@ float Kick808Device::effectiveNote(uint8_t note) const
 void Kick808Device::processMidiNoteOn(uint8_t note, uint8_t velocity)
 {
     const std::lock_guard<std::recursive_mutex> lock { mutex() };
+    wake();
     m_engine.setSampleRate(sampleRate());
     m_engine.setNote(effectiveNote(note));
     m_engine.trigger(static_cast<float>(velocity) / 127.0f);
@@ -142,6 +143,7 @@ void Kick808Device::processMidiCc(uint8_t controller, uint8_t value, uint8_t)
 {
     using namespace MidiCcMapping;
 
+    wake();
     bool changed = false;
     {
         std::lock_guard<std::recursive_mutex> lock { mutex() };
@@ -169,7 +171,7 @@ void Kick808Device::processMidiCc(uint8_t controller, uint8_t value, uint8_t)
     }
 
     if (changed) {
-        emit parametersChanged();
+        markParametersChanged();
     }
 }
 
@@ -94,6 +94,7 @@ std::vector<MidiCcController> PianoSynthDevice::availableMidiCcControllers() con
 void PianoSynthDevice::processMidiNoteOn(uint8_t note, uint8_t velocity)
 {
     const std::lock_guard<std::recursive_mutex> lock { mutex() };
+    wake();
     handleNoteOn(note, velocity);
 }
 
@@ -107,6 +108,7 @@ void PianoSynthDevice::processMidiCc(uint8_t controller, uint8_t value, uint8_t)
 {
     using namespace MidiCcMapping;
 
+    wake();
     bool changed = false;
     {
         std::lock_guard<std::recursive_mutex> lock { mutex() };
@@ -139,7 +141,7 @@ void PianoSynthDevice::processMidiCc(uint8_t controller, uint8_t value, uint8_t)
     }
 
     if (changed) {
-        emit parametersChanged();
+        markParametersChanged();
     }
 }
 
@@ -109,6 +109,7 @@ std::vector<MidiCcController> PianoSynthV2Device::availableMidiCcControllers() c
 void PianoSynthV2Device::processMidiNoteOn(uint8_t note, uint8_t velocity)
 {
     const std::lock_guard<std::recursive_mutex> lock { mutex() };
+    wake();
     handleNoteOn(note, velocity);
 }
 
@@ -122,6 +123,7 @@ void PianoSynthV2Device::processMidiCc(uint8_t controller, uint8_t value, uint8_
 {
     using namespace MidiCcMapping;
 
+    wake();
     bool changed = false;
     {
         std::lock_guard<std::recursive_mutex> lock { mutex() };
@@ -151,7 +153,7 @@ void PianoSynthV2Device::processMidiCc(uint8_t controller, uint8_t value, uint8_
     }
 
     if (changed) {
-        emit parametersChanged();
+        markParametersChanged();
     }
 }
 
@@ -189,30 +191,32 @@ void PianoSynthV2Device::processAudio(AudioContext & context)
         v.string.setSampleRate(context.sampleRate);
     }
 
-    const double gain = OutputGain * linearGainInternal();
+    // Each voice renders its whole block on its own, possibly on another lane, into a slice of
+    // its own. The slices are summed afterwards in voice order, frame by frame, so the mix comes
+    // out exactly as it did when the voices were summed as they went.
+    size_t voiceCount = 0;
+    for (size_t index = 0; index < m_voices.size(); index++) {
+        if (m_voices[index].active) {
+            m_activeVoices[voiceCount++] = index;
+        }
+    }
+
+    const size_t stride = static_cast<size_t>(context.frameCount) * 2;
+    if (m_voiceBuffer.size() < stride * MaxVoices) {
+        m_voiceBuffer.resize(stride * MaxVoices);
+    }
+
+    VoiceBlock block { this, OutputGain * linearGainInternal(), context.frameCount, stride };
+    context.parallelFor(voiceCount, &block, renderVoice);
 
     for (uint32_t i = 0; i < context.frameCount; i++) {
         double outL = 0.0;
         double outR = 0.0;
 
-        for (auto & v : m_voices) {
-            if (!v.active) {
-                continue;
-            }
-
-            const double sample = v.string.nextSample() * gain;
-
-            if (!v.string.isActive()) {
-                v.active = false;
-                continue;
-            }
-
-            double voiceL = 0.0;
-            double voiceR = 0.0;
-            m_voicePanner.setPan(static_cast<double>(noteToPan(v.note)));
-            m_voicePanner.processMono(sample, voiceL, voiceR);
-            outL += voiceL;
-            outR += voiceR;
+        for (size_t voice = 0; voice < voiceCount; voice++) {
+            const double * frame = m_voiceBuffer.data() + voice * stride + i * 2;
+            outL += frame[0];
+            outR += frame[1];
         }
 
         m_panner.process(outL, outR);
@@ -227,6 +231,37 @@ void PianoSynthV2Device::processAudio(AudioContext & context)
     }
 }
 
+void PianoSynthV2Device::renderVoice(void * context, size_t index)
+{
+    const auto & block = *static_cast<VoiceBlock *>(context);
+    auto & device = *block.device;
+    auto & v = device.m_voices[device.m_activeVoices[index]];
+    double * out = device.m_voiceBuffer.data() + index * block.stride;
+
+    TrueStereoPanner panner;
+    panner.setPan(static_cast<double>(device.noteToPan(v.note)));
+
+    uint32_t i = 0;
+    for (; i < block.frameCount; i++) {
+        const double sample = v.string.nextSample() * block.gain;
+
+        if (!v.string.isActive()) {
+            v.active = false;
+            break;
+        }
+
+        panner.processMono(sample, out[i * 2], out[i * 2 + 1]);
+    }
+    std::fill(out + i * 2, out + block.stride, 0.0);
+}
+
+bool PianoSynthV2Device::rendersVoicesInParallel() const
+{
+    // Every voice is a bank of resonators of its own, so a chord is as many independent blocks
+    // of work, and on its own this device can saturate a core.
+    return true;
+}
+
 bool PianoSynthV2Device::hasActiveAudio() const
 {
     const std::lock_guard<std::recursive_mutex> lock { mutex() };
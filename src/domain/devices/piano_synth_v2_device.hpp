@@ -24,6 +24,7 @@
 
 #include <array>
 #include <string>
+#include <vector>
 
 namespace noteahead {
 
@@ -50,6 +51,7 @@ public:
     void processMidiAllNotesOff() override;
 
     void processAudio(AudioContext & context) override;
+    bool rendersVoicesInParallel() const override;
     bool hasActiveAudio() const override;
 
     void reset() override;
@@ -116,7 +118,24 @@ private:
     CascadedSvf m_hpfR;
 
     TrueStereoPanner m_panner;
-    TrueStereoPanner m_voicePanner;
+
+    //! What every voice of one processAudio() call renders against.
+    struct VoiceBlock
+    {
+        PianoSynthV2Device * device;
+        double gain;
+        uint32_t frameCount;
+        size_t stride;
+    };
+
+    //! Renders the index-th active voice's block into its slice of m_voiceBuffer. Touches nothing
+    //! but that voice and that slice, so any number of them can run at once.
+    static void renderVoice(void * context, size_t index);
+
+    //! Indices into m_voices of the voices being rendered this block.
+    std::array<size_t, MaxVoices> m_activeVoices {};
+    //! One interleaved stereo block per active voice.
+    std::vector<double> m_voiceBuffer;
 
     float m_brightness { 0.5f };
     float m_decay { 0.5f };
@@ -220,6 +220,7 @@ bool SamplerDevice::updatePadParameter(int note, const std::string & parameterNa
 void SamplerDevice::processMidiNoteOn(uint8_t note, uint8_t velocity)
 {
     std::lock_guard<std::recursive_mutex> lock { mutex() };
+    wake();
 
     if (note >= maxSamples) {
         return;
@@ -259,6 +260,7 @@ void SamplerDevice::processMidiNoteOn(uint8_t note, uint8_t velocity)
             voice.sample = sample;
             voice.pitchRatio = pitchRatio;
             voice.position = voice.sample->startOffset * voice.sample->sampleRate;
+            voice.positionRate = voice.sample->sampleRate;
             voice.velocity = static_cast<float>(velocity) / 127.0f;
             voice.pan = panInternal();
             voice.cutoff = m_globalCutoff;
@@ -291,6 +293,7 @@ void SamplerDevice::processMidiCc(uint8_t controller, uint8_t value, uint8_t cha
 {
     using namespace MidiCcMapping;
 
+    wake();
     bool changed = false;
     {
         std::lock_guard<std::recursive_mutex> lock { mutex() };
@@ -356,7 +359,7 @@ void SamplerDevice::processMidiCc(uint8_t controller, uint8_t value, uint8_t cha
     }
 
     if (changed) {
-        emit parametersChanged();
+        markParametersChanged();
     }
 }
 
@@ -373,12 +376,16 @@ void SamplerDevice::processMidiAllNotesOff()
 
     // Transport traffic, not an edit: this runs on every stop, so routing it through dataChanged()
     // marked the project modified just for playing it.
-    emit parametersChanged();
+    markParametersChanged();
 }
 
 void SamplerDevice::processAudio(AudioContext & context)
 {
     setSampleRate(context.sampleRate);
+    // Converting is far too slow for this thread, so it is handed to the one the device lives on.
+    if (m_blockSampleRate.exchange(context.sampleRate) != context.sampleRate) {
+        QMetaObject::invokeMethod(this, [this] { prepareSampleRate(m_blockSampleRate.load()); }, Qt::QueuedConnection);
+    }
     const std::lock_guard<std::recursive_mutex> lock { mutex() };
 
     const uint32_t bufferSize = context.frameCount * 2;
@@ -389,6 +396,13 @@ void SamplerDevice::processAudio(AudioContext & context)
     }
     std::fill(m_mixBuffer.begin(), m_mixBuffer.begin() + bufferSize, 0.0);
     std::vector<double> & buffer = m_mixBuffer;
+    if (m_voiceLeft.size() < context.frameCount) {
+        m_voiceLeft.resize(context.frameCount);
+        m_voiceRight.resize(context.frameCount);
+    }
+
+    // Realtime playback gets the shorter kernels, export the longest, as with effect oversampling.
+    m_resampler.setQuality(SincResampler::qualityForOversampleFactor(context.oversampleFactor));
 
     // Per-pad sub-mix buffers for samples carrying a non-empty insert rack. Voices are grouped by their
     // Sample so a single stateful rack instance processes the summed signal of that pad (correct also in
@@ -431,35 +445,22 @@ void SamplerDevice::processAudio(AudioContext & context)
         std::vector<double> & target = hasRack ? padBufferFor(voice.sample) : buffer;
         const double voiceGain = hasRack ? 1.0 : gain;
 
-        const auto & sampleData { *voice.sample->data };
-        const int channels = voice.sample->channels;
-        const double pitchScale = static_cast<double>(voice.sample->sampleRate) / static_cast<double>(context.sampleRate) * voice.pitchRatio;
-
-        for (uint32_t i = 0; i < context.frameCount; i++) {
-            const double currentPos = voice.position;
-            const size_t index = static_cast<size_t>(currentPos);
-            const float fract = static_cast<float>(currentPos - index);
-
-            if ((index + 1) * static_cast<size_t>(channels) >= sampleData.size()) {
-                voice.active = false;
-                break;
+        const auto [sampleData, dataRate] = playbackData(*voice.sample, context.sampleRate);
+        if (voice.positionRate != dataRate) {
+            // A conversion arrived or went since the last block: the same point in time, in its frames.
+            if (voice.positionRate > 0) {
+                voice.position = voice.position * dataRate / voice.positionRate;
             }
+            voice.positionRate = dataRate;
+        }
+        const double pitchScale = static_cast<double>(dataRate) / static_cast<double>(context.sampleRate) * voice.pitchRatio;
+        const size_t rendered = m_resampler.render(*sampleData, voice.sample->channels, voice.position, pitchScale,
+                                                   std::span<double> { m_voiceLeft.data(), context.frameCount },
+                                                   std::span<double> { m_voiceRight.data(), context.frameCount });
 
-            double left = 0.0;
-            double right = 0.0;
-
-            if (channels == 1) {
-                const double s0 = static_cast<double>(sampleData.at(index));
-                const double s1 = static_cast<double>(sampleData.at(index + 1));
-                left = right = s0 + (s1 - s0) * fract;
-            } else if (channels == 2) {
-                const double l0 = static_cast<double>(sampleData.at(index * 2));
-                const double l1 = static_cast<double>(sampleData.at((index + 1) * 2));
-                const double r0 = static_cast<double>(sampleData.at(index * 2 + 1));
-                const double r1 = static_cast<double>(sampleData.at((index + 1) * 2 + 1));
-                left = l0 + (l1 - l0) * fract;
-                right = r0 + (r1 - r0) * fract;
-            }
+        for (size_t i = 0; i < rendered; i++) {
+            double left = m_voiceLeft[i];
+            double right = m_voiceRight[i];
 
             for (auto && effect : voice.effects) {
                 effect->process(left, right);
@@ -478,8 +479,10 @@ void SamplerDevice::processAudio(AudioContext & context)
 
             target[i * 2] += left * voiceGain;
             target[i * 2 + 1] += right * voiceGain;
+        }
 
-            voice.position += pitchScale;
+        if (rendered < context.frameCount) {
+            voice.active = false;
         }
     }
 
@@ -591,6 +594,13 @@ void SamplerDevice::loadSample(uint8_t note, const std::string & filePath)
     sample->sampleRate = info.samplerate;
     sample->data = std::move(data);
 
+    // Only to a rate the device has actually been played at. Before its first block that is not
+    // known, and the first block has the rest converted.
+    if (const auto blockRate = m_blockSampleRate.load(); needsConversion(*sample, blockRate)) {
+        juzzlin::L(TAG).info() << "Converting sample from " << info.samplerate << " Hz to " << blockRate << " Hz";
+        addConversion(*sample, blockRate, std::make_shared<const std::vector<float>>(SincResampler::convert(*sample->data, info.channels, info.samplerate, blockRate)));
+    }
+
     {
         std::lock_guard<std::recursive_mutex> lock { mutex() };
         // Preserve the pad's insert rack across sample reloads (e.g. re-recording onto the same pad).
@@ -604,6 +614,71 @@ void SamplerDevice::loadSample(uint8_t note, const std::string & filePath)
     emit dataChanged();
 }
 
+void SamplerDevice::prepareSampleRate(uint32_t sampleRate)
+{
+    struct Pending
+    {
+        size_t note = 0;
+        std::shared_ptr<const std::vector<float>> source;
+        int channels = 0;
+        int sampleRate = 0;
+    };
+    std::vector<Pending> pending;
+    {
+        std::lock_guard<std::recursive_mutex> lock { mutex() };
+        for (size_t note = 0; note < maxSamples; note++) {
+            if (const auto & sample = m_samples.at(note); sample && needsConversion(*sample, sampleRate)) {
+                pending.push_back({ note, sample->data, sample->channels, sample->sampleRate });
+            }
+        }
+    }
+    if (pending.empty()) {
+        return;
+    }
+
+    // Outside the lock, which the audio thread takes every block.
+    juzzlin::L(TAG).info() << "Converting " << pending.size() << " sample(s) to " << sampleRate << " Hz";
+    std::vector<std::shared_ptr<const std::vector<float>>> converted;
+    converted.reserve(pending.size());
+    for (auto && item : pending) {
+        converted.push_back(std::make_shared<const std::vector<float>>(SincResampler::convert(*item.source, item.channels, item.sampleRate, sampleRate)));
+    }
+
+    std::lock_guard<std::recursive_mutex> lock { mutex() };
+    for (size_t i = 0; i < pending.size(); i++) {
+        // A sample replaced in the meantime was converted for nothing.
+        if (const auto & sample = m_samples.at(pending.at(i).note); sample && sample->data == pending.at(i).source && needsConversion(*sample, sampleRate)) {
+            addConversion(*sample, sampleRate, std::move(converted.at(i)));
+        }
+    }
+}
+
+bool SamplerDevice::needsConversion(const Sample & sample, uint32_t sampleRate)
+{
+    if (!sampleRate || !sample.data || sample.sampleRate <= 0 || static_cast<uint32_t>(sample.sampleRate) == sampleRate) {
+        return false;
+    }
+    return std::ranges::none_of(sample.conversions, [sampleRate](auto && conversion) { return static_cast<uint32_t>(conversion.sampleRate) == sampleRate; });
+}
+
+void SamplerDevice::addConversion(Sample & sample, uint32_t sampleRate, std::shared_ptr<const std::vector<float>> data)
+{
+    sample.conversions.push_back({ static_cast<int>(sampleRate), std::move(data) });
+    if (sample.conversions.size() > maxConversions) {
+        sample.conversions.erase(sample.conversions.begin());
+    }
+}
+
+std::pair<const std::vector<float> *, int> SamplerDevice::playbackData(const Sample & sample, uint32_t sampleRate)
+{
+    for (auto && conversion : sample.conversions) {
+        if (static_cast<uint32_t>(conversion.sampleRate) == sampleRate) {
+            return { conversion.data.get(), conversion.sampleRate };
+        }
+    }
+    return { sample.data.get(), sample.sampleRate };
+}
+
 std::unique_ptr<SamplerDevice::Sample> SamplerDevice::cloneSample(const Sample & source) const
 {
     // The sample data is immutable, so the clone shares the buffer instead of re-reading the file.
@@ -982,8 +1057,9 @@ double SamplerDevice::playbackPosition(uint8_t note) const
     for (auto const & voice : m_voices) {
         if (voice.active && voice.note == note && voice.sample && voice.sample->data) {
             const size_t totalFrames = voice.sample->data->size() / static_cast<size_t>(voice.sample->channels);
-            if (totalFrames > 0) {
-                return voice.position / static_cast<double>(totalFrames);
+            if (totalFrames > 0 && voice.positionRate > 0) {
+                // The position counts frames of whichever data the voice reads, the file's frames do not.
+                return voice.position * voice.sample->sampleRate / voice.positionRate / static_cast<double>(totalFrames);
             }
         }
     }
@@ -20,12 +20,14 @@
 #include "../dsp/high_pass_filter.hpp"
 #include "../dsp/low_pass_filter.hpp"
 #include "../dsp/panning.hpp"
+#include "../dsp/sinc_resampler.hpp"
 #include "../dsp/volume.hpp"
 #include "../effects/effect.hpp"
 #include "../tracker/parameter_container.hpp"
 #include "device.hpp"
 
 #include <array>
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -87,10 +89,21 @@ public:
         Sample();
 
         std::string filePath;
+        //! The frames as the file holds them, at the file's rate.
         std::shared_ptr<const std::vector<float>> data;
         int channels = 0;
         int sampleRate = 0;
 
+        //! The data converted to a rate the device is played at, so that a voice at unity pitch
+        //! reads the frames as they are instead of interpolating every one of them.
+        struct Conversion
+        {
+            int sampleRate = 0;
+            std::shared_ptr<const std::vector<float>> data;
+        };
+        //! Playback's rate and an export's, at most; see SamplerDevice::prepareSampleRate().
+        std::vector<Conversion> conversions;
+
         float pan = 0.5f;
         //! Fader position, not a gain: seeded to unity in the constructor, mapped by mapFader().
         float volume = 1.0f;
@@ -104,6 +117,12 @@ public:
     };
 
     void loadSample(uint8_t note, const std::string & filePath);
+    //! Converts every sample to the given rate on the calling thread, which must not be the audio
+    //! thread, unless it is already at it. The device does this by itself once it has played a
+    //! block at a new rate, but only by the time the conversion is done, and a voice resamples the
+    //! file's own data until then. An export calls it up front so that it plays the converted data
+    //! from its first block to its last.
+    void prepareSampleRate(uint32_t sampleRate);
     //! Duplicates the sample of sourceNote onto targetNote: the sample data, the pad settings and an
     //! independent clone of the per-pad insert rack. Does nothing if the source pad is empty.
     void copySample(uint8_t sourceNote, uint8_t targetNote);
@@ -196,6 +215,14 @@ private:
     //! Resolves a controller number against the per-pad CC blocks. Nothing when it falls outside them.
     std::optional<PadCcTarget> padCcTarget(uint8_t controller, uint8_t value) const;
 
+    //! How many rates a sample keeps a converted copy for; the oldest goes first.
+    static constexpr size_t maxConversions = 2;
+    static bool needsConversion(const Sample & sample, uint32_t sampleRate);
+    static void addConversion(Sample & sample, uint32_t sampleRate, std::shared_ptr<const std::vector<float>> data);
+    //! The data a voice reads at the given rate, and the rate the data is at: the converted copy
+    //! when there is one, the file's own data otherwise. Either way it is interpolated only once.
+    static std::pair<const std::vector<float> *, int> playbackData(const Sample & sample, uint32_t sampleRate);
+
     //! Copies a pad's parameters into the plain fields the voices read.
     void syncSampleFields(Sample & sample);
 
@@ -223,7 +250,9 @@ private:
 
         uint8_t note = 0;
         Sample * sample = nullptr;
+        //! In frames of the data the voice last read, which is at positionRate.
         double position = 0.0;
+        int positionRate = 0;
         double pitchRatio = 1.0;
         float velocity = 1.0f;
         float pan = 0.5f;
@@ -249,6 +278,12 @@ private:
     // every callback. m_padBuffers is a pool of per-pad sub-mix buffers reused across callbacks.
     std::vector<double> m_mixBuffer;
     std::vector<std::pair<Sample *, std::vector<double>>> m_padBuffers;
+    //! One voice's resampled frames, before its effects and release fade are applied.
+    std::vector<double> m_voiceLeft;
+    std::vector<double> m_voiceRight;
+    SincResampler m_resampler;
+    //! Rate of the last block, or 0 before the first: what the samples are converted to.
+    std::atomic<uint32_t> m_blockSampleRate { 0 };
 
     std::string m_name;
     float m_globalCutoff = 1.0f;
@@ -150,6 +150,7 @@ std::vector<MidiCcController> StringEnsembleDevice::availableMidiCcControllers()
 void StringEnsembleDevice::processMidiNoteOn(uint8_t note, uint8_t velocity)
 {
     const std::lock_guard<std::recursive_mutex> lock { mutex() };
+    wake();
 
     auto & key = m_keys.at(note);
     key.gate.setSampleRate(static_cast<double>(sampleRate()));
@@ -183,6 +184,7 @@ void StringEnsembleDevice::processMidiCc(uint8_t controller, uint8_t value, uint
 {
     using namespace MidiCcMapping;
 
+    wake();
     bool changed = false;
     {
         const std::lock_guard<std::recursive_mutex> lock { mutex() };
@@ -200,7 +202,7 @@ void StringEnsembleDevice::processMidiCc(uint8_t controller, uint8_t value, uint
     }
 
     if (changed) {
-        emit parametersChanged();
+        markParametersChanged();
     }
 }
 
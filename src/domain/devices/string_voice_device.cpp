@@ -219,6 +219,7 @@ int StringVoiceDevice::allocateVoice()
 void StringVoiceDevice::processMidiNoteOn(uint8_t note, uint8_t velocity)
 {
     const std::lock_guard<std::recursive_mutex> lock { mutex() };
+    wake();
 
     // Trace, not info: every note of every pattern comes through here, and no other device
     // announces its notes at all.
@@ -286,6 +287,7 @@ void StringVoiceDevice::processMidiCc(uint8_t controller, uint8_t value, uint8_t
 {
     using namespace MidiCcMapping;
 
+    wake();
     bool changed { false };
     {
         const std::lock_guard<std::recursive_mutex> lock { mutex() };
@@ -303,7 +305,7 @@ void StringVoiceDevice::processMidiCc(uint8_t controller, uint8_t value, uint8_t
     }
 
     if (changed) {
-        emit parametersChanged();
+        markParametersChanged();
     }
 }
 
@@ -532,6 +534,19 @@ std::vector<size_t> StringVoiceDevice::sidechainDependencies() const
     return deps;
 }
 
+void StringVoiceDevice::sidechainDependencies(std::vector<size_t> & out) const
+{
+    // The engine only keeps an output buffer for slots some device reads, so the vocoder's
+    // modulator has to be declared here or it would find nothing to read.
+    Device::sidechainDependencies(out);
+    const std::lock_guard<std::recursive_mutex> lock { mutex() };
+    if (m_vocoderEnabled) {
+        if (const auto idx { vocoderSidechainIndex() }) {
+            out.push_back(*idx);
+        }
+    }
+}
+
 void StringVoiceDevice::reset()
 {
     const std::lock_guard<std::recursive_mutex> lock { mutex() };
@@ -55,6 +55,7 @@ public:
     bool hasActiveAudio() const override;
 
     std::vector<size_t> sidechainDependencies() const override;
+    void sidechainDependencies(std::vector<size_t> & out) const override;
 
     void reset() override;
     void resetAudio() override;
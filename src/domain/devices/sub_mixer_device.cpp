@@ -95,6 +95,7 @@ void SubMixerDevice::processMidiCc(uint8_t controller, uint8_t value, uint8_t)
 {
     using namespace MidiCcMapping;
 
+    wake();
     bool changed = false;
     {
         const std::lock_guard<std::recursive_mutex> lock { mutex() };
@@ -113,7 +114,7 @@ void SubMixerDevice::processMidiCc(uint8_t controller, uint8_t value, uint8_t)
     }
 
     if (changed) {
-        emit parametersChanged();
+        markParametersChanged();
     }
 }
 
@@ -144,7 +145,7 @@ void SubMixerDevice::sidechainDependencies(std::vector<size_t> & out) const
 
 bool SubMixerDevice::hasActiveAudio() const
 {
-    return true;
+    return m_membersSounding.load(std::memory_order_relaxed);
 }
 
 void SubMixerDevice::processAudio(AudioContext & context)
@@ -157,6 +158,7 @@ void SubMixerDevice::processAudio(AudioContext & context)
     TrueStereoPanner panner;
     panner.setPan(static_cast<double>(panInternal()));
 
+    bool membersSounding = false;
     for (const auto slotIndex : m_members) {
         // A member may have been removed since the list was resolved, and a member that has not
         // rendered yet this callback would be stale rather than silent, so skip anything the engine
@@ -170,8 +172,10 @@ void SubMixerDevice::processAudio(AudioContext & context)
         }
         for (uint32_t i = 0; i < bufferSize; i++) {
             context.buffer[i] += memberBuffer[i] * gain;
+            membersSounding |= memberBuffer[i] != 0.0;
         }
     }
+    m_membersSounding.store(membersSounding, std::memory_order_relaxed);
 
     for (uint32_t i = 0; i < context.frameCount; i++) {
         auto & left = context.buffer[i * 2];
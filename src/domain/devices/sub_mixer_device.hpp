@@ -18,6 +18,7 @@
 
 #include "device.hpp"
 
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -69,8 +70,8 @@ public:
     std::vector<size_t> sidechainDependencies() const override;
     void sidechainDependencies(std::vector<size_t> & out) const override;
 
-    //! Always true: a SubMixer cannot cheaply tell whether its members are silent, and reporting
-    //! false would let the engine skip it while a member still had a tail running.
+    //! Whether any member put something out in the last block summed. A SubMixer has no voices of
+    //! its own: it is as active as its members, and a member that starts playing wakes it.
     bool hasActiveAudio() const override;
 
     void serializeToXml(ProjectWriter & writer) const override;
@@ -79,6 +80,7 @@ public:
 private:
     std::string m_name;
     SlotList m_members;
+    std::atomic<bool> m_membersSounding { false };
 };
 
 } // namespace noteahead
@@ -44,6 +44,9 @@ void SynthDevice::Voice::reset()
     lfo2.reset();
     unisonDamp.reset();
     glideFrequency = 0.0;
+    controlCountdown = 0;
+    controlPrimed = false;
+    configuredRevision = 0;
     cancelPendingTrigger();
     active = false;
 }
@@ -98,6 +101,13 @@ void SynthDevice::Voice::applyTrigger(const Trigger & trigger, std::optional<Pha
         modEg.reset();
     }
 
+    // The new note's modulation is evaluated on its first sample. A voice carrying on under it ramps
+    // there from where it was; one starting over jumps.
+    controlCountdown = 0;
+    if (restartEnvelopes || !active) {
+        controlPrimed = false;
+    }
+
     active = true;
     pendingTrigger.reset();
     declickGain = 1.0;
@@ -273,10 +283,36 @@ void SynthDevice::processAudio(AudioContext & context)
     const double pbOffset = (static_cast<double>(m_pitchBend) - 8192.0) / 8192.0 * m_pitchBendRange;
     const double pbRatio = std::exp2(pbOffset / 12.0);
 
+    size_t laneCount = 0;
     for (size_t i = 0; i < m_voices.size(); i++) {
-        auto & voice = m_voices.at(i);
-        if (voice.active) {
-            renderVoice(voice, context, oversampleFactor, oversampledRate, portamentoCoeff, pbRatio, i);
+        if (m_voices.at(i).active) {
+            prepareVoiceLane(m_voices.at(i), oversampledRate, i, laneCount++);
+        }
+    }
+
+    const size_t samples = static_cast<size_t>(context.frameCount) * oversampleFactor;
+    for (size_t offset = 0; offset < samples; offset += CascadedSvfBank::MaxFrames) {
+        const size_t frames = std::min(CascadedSvfBank::MaxFrames, samples - offset);
+        for (size_t lane = 0; lane < laneCount; lane++) {
+            renderVoiceSource(m_lanes.at(lane), lane, frames, oversampleFactor, oversampledRate, portamentoCoeff, pbRatio);
+        }
+        m_lpfBank.run(std::span { m_laneLpfs.data(), laneCount }, frames);
+        for (size_t frame = 0; frame < frames; frame++) {
+            for (size_t lane = 0; lane < laneCount; lane++) {
+                m_hpfBank.sample(frame, lane) = m_lpfBank.sample(frame, lane);
+            }
+        }
+        m_hpfBank.run(std::span { m_laneHpfs.data(), laneCount }, frames);
+        for (size_t lane = 0; lane < laneCount; lane++) {
+            renderVoiceOutput(m_lanes.at(lane), lane, offset, frames);
+        }
+    }
+
+    // A voice with a note waiting on it is not free, however silent the interrupted note has gone.
+    for (size_t lane = 0; lane < laneCount; lane++) {
+        auto & voice = *m_lanes.at(lane).voice;
+        if (voice.ampEg.isSilent() && !voice.pendingTrigger) {
+            voice.active = false;
         }
     }
 
@@ -288,11 +324,9 @@ void SynthDevice::prepareForProcessing(AudioContext & context)
     setSampleRate(context.sampleRate);
     m_delay.setSampleRate(static_cast<double>(context.sampleRate));
 
-    const size_t requiredSize = static_cast<size_t>(context.frameCount) * clampOversampleFactor(context.oversampleFactor) * 2;
-    if (m_oversampledBuffer.size() < requiredSize) {
-        m_oversampledBuffer.resize(requiredSize);
-    }
-    std::fill(m_oversampledBuffer.begin(), m_oversampledBuffer.begin() + requiredSize, 0.0f);
+    const size_t requiredSize = static_cast<size_t>(context.frameCount) * clampOversampleFactor(context.oversampleFactor);
+    m_oversampledBuffer.reserve(requiredSize);
+    m_oversampledBuffer.clear(requiredSize);
 }
 
 bool SynthDevice::isStacked(VoiceMode mode)
@@ -399,62 +433,96 @@ double SynthDevice::voiceDampingHz(size_t index) const
     return brightestHz + (darkestHz - brightestHz) * amount;
 }
 
-void SynthDevice::renderVoice(Voice & voice, AudioContext & context, uint8_t oversampleFactor, uint32_t oversampledRate, double portamentoCoeff, double pbRatio, size_t index)
+void SynthDevice::prepareVoiceLane(Voice & voice, uint32_t oversampledRate, size_t index, size_t lane)
 {
     updateVoiceParameters(voice, oversampledRate, index);
 
+    auto & voiceLane = m_lanes.at(lane);
+    voiceLane.voice = &voice;
     // The 1/MaxVoices base is the headroom for a full chord: every voice sounding at once reaches
     // full scale. The stack normalization then keeps one note at the same level whatever the voice
     // mode, so switching modes changes the character and not the gain.
-    const float gain = (1.0f / static_cast<float>(MaxVoices)) * voiceStackNormalization() * linearGainInternal() * voice.velocity * voiceLevel(index);
+    voiceLane.gain = (1.0f / static_cast<float>(MaxVoices)) * voiceStackNormalization() * linearGainInternal() * voice.velocity * voiceLevel(index);
 
     const double dampingHz = voiceDampingHz(index);
-    const bool damped = dampingHz > 0.0 && dampingHz < OnePoleFilter::maxCorner(oversampledRate);
-    if (damped) {
+    voiceLane.damped = dampingHz > 0.0 && dampingHz < OnePoleFilter::maxCorner(oversampledRate);
+    if (voiceLane.damped) {
         voice.unisonDamp.calculate(dampingHz, oversampledRate);
     }
 
-    const double declickStep = 1.0 / std::max(1.0, declickSeconds * oversampledRate);
+    m_laneLpfs.at(lane) = &voice.lpf;
+    m_laneHpfs.at(lane) = &voice.hpf;
+}
 
-    for (uint32_t i = 0; i < context.frameCount; i++) {
-        for (uint8_t os = 0; os < oversampleFactor; os++) {
-            // Ahead of the sample, so the note that is waiting lands on a voice already at zero
-            // rather than one with a sample of the interrupted note still to emit.
-            if (voice.pendingTrigger) {
-                voice.declickGain -= declickStep;
-                if (voice.declickGain <= 0.0) {
-                    voice.applyTrigger(*voice.pendingTrigger, Voice::Phases { 0.0, 0.0, 0.0 }, true);
-                }
+void SynthDevice::renderVoiceSource(VoiceLane & lane, size_t laneIndex, size_t frames, uint8_t oversampleFactor, double oversampledRate, double portamentoCoeff, double pbRatio)
+{
+    auto & voice = *lane.voice;
+    const double declickStep = 1.0 / std::max(1.0, declickSeconds * oversampledRate);
+    const size_t controlSamples = ControlFrames * oversampleFactor;
+
+    for (size_t frame = 0; frame < frames; frame++) {
+        // Ahead of the sample, so the note that is waiting lands on a voice already at zero
+        // rather than one with a sample of the interrupted note still to emit.
+        if (voice.pendingTrigger) {
+            voice.declickGain -= declickStep;
+            if (voice.declickGain <= 0.0) {
+                voice.applyTrigger(*voice.pendingTrigger, Voice::Phases { 0.0, 0.0, 0.0 }, true);
             }
+        }
 
-            voice.glideFrequency += (voice.frequency - voice.glideFrequency) * portamentoCoeff;
+        voice.glideFrequency += (voice.frequency - voice.glideFrequency) * portamentoCoeff;
 
-            const ModulationValues mods = calculateModulation(voice);
-            float voiceSample = generateVoiceSample(voice, mods, oversampledRate, pbRatio);
-            if (damped) {
-                voice.unisonDamp.process(static_cast<double>(voiceSample));
-                voiceSample = static_cast<float>(voice.unisonDamp.lowPass());
-            }
-            const float finalHighRateSample = voiceSample * gain * static_cast<float>(voice.declickGain);
+        if (!voice.controlCountdown) {
+            updateModulation(voice, controlSamples, oversampledRate);
+            voice.controlCountdown = controlSamples;
+        }
+        voice.controlCountdown--;
 
-            const float voicePan = std::clamp(panInternal() + voice.pan - 0.5f + static_cast<float>(mods.panMod) * 0.5f, 0.0f, 1.0f);
-            const double panAngle = static_cast<double>(voicePan) * std::numbers::pi * 0.5;
-            const float panL = static_cast<float>(std::cos(panAngle));
-            const float panR = static_cast<float>(std::sin(panAngle));
+        lane.ampEnvelope.at(frame) = static_cast<float>(voice.ampEg.nextSample());
+        lane.ampMod.at(frame) = static_cast<float>(voice.ampMod.nextSample());
+        lane.declickGain.at(frame) = static_cast<float>(voice.declickGain);
 
-            m_oversampledBuffer[(i * oversampleFactor + os) * 2] += finalHighRateSample * panL;
-            m_oversampledBuffer[(i * oversampleFactor + os) * 2 + 1] += finalHighRateSample * panR;
-        }
+        // The filters' coefficients are on the ramp updateModulation() set them on.
+        m_lpfBank.sample(frame, laneIndex) = static_cast<float>(generateVoiceSource(voice, oversampledRate, pbRatio));
+        m_lpfBank.setCoefficients(frame, laneIndex, voice.lpf.nextCoefficients());
+        m_hpfBank.setCoefficients(frame, laneIndex, voice.hpf.nextCoefficients());
     }
+}
 
-    // A voice with a note waiting on it is not free, however silent the interrupted note has gone.
-    if (voice.ampEg.isSilent() && !voice.pendingTrigger) {
-        voice.active = false;
+void SynthDevice::renderVoiceOutput(VoiceLane & lane, size_t laneIndex, size_t offset, size_t frames)
+{
+    auto & voice = *lane.voice;
+    float * highLeft = m_oversampledBuffer.left() + offset;
+    float * highRight = m_oversampledBuffer.right() + offset;
+    for (size_t frame = 0; frame < frames; frame++) {
+        const float filtered = static_cast<float>(m_hpfBank.sample(frame, laneIndex));
+        float voiceSample = filtered * lane.ampEnvelope.at(frame) * lane.ampMod.at(frame);
+        if (lane.damped) {
+            voice.unisonDamp.process(static_cast<double>(voiceSample));
+            voiceSample = static_cast<float>(voice.unisonDamp.lowPass());
+        }
+        const float finalHighRateSample = voiceSample * lane.gain * lane.declickGain.at(frame);
+
+        highLeft[frame] += finalHighRateSample * static_cast<float>(voice.panLeft.nextSample());
+        highRight[frame] += finalHighRateSample * static_cast<float>(voice.panRight.nextSample());
     }
 }
 
 void SynthDevice::updateVoiceParameters(Voice & voice, uint32_t oversampledRate, size_t index)
 {
+    // Nothing below moves unless a parameter, the rate or the note does.
+    if (voice.configuredRevision == m_parameterRevision && voice.configuredRate == oversampledRate //
+        && voice.configuredOversampleFactor == m_oversampleFactor && voice.configuredTriggerId == voice.triggerId) {
+        return;
+    }
+    voice.configuredRevision = m_parameterRevision;
+    voice.configuredRate = oversampledRate;
+    voice.configuredOversampleFactor = m_oversampleFactor;
+    voice.configuredTriggerId = voice.triggerId;
+
+    // The mod envelope and the LFOs are only stepped once per control step.
+    const double controlRate = static_cast<double>(oversampledRate) / static_cast<double>(ControlFrames * m_oversampleFactor);
+
     voice.vco1.setSampleRate(oversampledRate);
     voice.vco2.setSampleRate(oversampledRate);
     voice.vco3.setSampleRate(oversampledRate);
@@ -463,11 +531,10 @@ void SynthDevice::updateVoiceParameters(Voice & voice, uint32_t oversampledRate,
     voice.lpf.setSampleRate(oversampledRate);
     voice.hpf.setSampleRate(oversampledRate);
     voice.ampEg.setSampleRate(oversampledRate);
-    voice.modEg.setSampleRate(oversampledRate);
-    voice.lfo.setSampleRate(oversampledRate);
-    voice.lfo2.setSampleRate(oversampledRate);
+    voice.modEg.setSampleRate(controlRate);
+    voice.lfo.setSampleRate(controlRate);
+    voice.lfo2.setSampleRate(controlRate);
 
-    voice.lpf.setResonance(m_lpfResonance);
     voice.vco1.setWaveform(m_vco1Waveform);
     voice.vco2.setWaveform(m_vco2Waveform);
     voice.vco3.setWaveform(m_vco3Waveform);
@@ -501,22 +568,22 @@ void SynthDevice::applyGlobalEffects(AudioContext & context)
     const uint8_t oversampleFactor = clampOversampleFactor(context.oversampleFactor);
     m_dcBlockerL.setSampleRate(context.sampleRate);
     m_dcBlockerR.setSampleRate(context.sampleRate);
-    std::array<float, 4> highL {};
-    std::array<float, 4> highR {};
+    const float * highLeft = m_oversampledBuffer.left();
+    const float * highRight = m_oversampledBuffer.right();
     for (uint32_t i = 0; i < context.frameCount; i++) {
-        for (uint8_t os = 0; os < oversampleFactor; os++) {
-            highL[os] = m_oversampledBuffer[(i * oversampleFactor + os) * 2];
-            highR[os] = m_oversampledBuffer[(i * oversampleFactor + os) * 2 + 1];
-        }
-
-        double l = m_dcBlockerL.process(static_cast<double>(m_downsamplerL.process(highL.data(), oversampleFactor)));
-        double r = m_dcBlockerR.process(static_cast<double>(m_downsamplerR.process(highR.data(), oversampleFactor)));
+        double l = m_dcBlockerL.process(static_cast<double>(m_downsamplerL.process(highLeft + i * oversampleFactor, oversampleFactor)));
+        double r = m_dcBlockerR.process(static_cast<double>(m_downsamplerR.process(highRight + i * oversampleFactor, oversampleFactor)));
 
         // Ahead of the delay, not after it: the feedback path would otherwise integrate the offset.
         m_delay.process(l, r);
 
-        context.buffer[i * 2] += l;
-        context.buffer[i * 2 + 1] += r;
+        if (context.isPlanar()) {
+            context.left[i] += static_cast<float>(l);
+            context.right[i] += static_cast<float>(r);
+        } else {
+            context.buffer[i * 2] += l;
+            context.buffer[i * 2 + 1] += r;
+        }
     }
 }
 
@@ -526,9 +593,15 @@ bool SynthDevice::hasActiveAudio() const
     return std::ranges::any_of(m_voices, [](const auto & voice) { return voice.active; });
 }
 
+bool SynthDevice::supportsPlanarAudio() const
+{
+    return true;
+}
+
 void SynthDevice::processMidiNoteOn(uint8_t note, uint8_t velocity)
 {
     const std::lock_guard<std::recursive_mutex> lock { mutex() };
+    wake();
     handleNoteOn(note, velocity);
 }
 
@@ -542,6 +615,7 @@ void SynthDevice::processMidiCc(uint8_t controller, uint8_t value, uint8_t)
 {
     using namespace MidiCcMapping;
 
+    wake();
     bool changed = false;
     {
         std::lock_guard<std::recursive_mutex> lock { mutex() };
@@ -592,7 +666,7 @@ void SynthDevice::processMidiCc(uint8_t controller, uint8_t value, uint8_t)
     }
 
     if (changed) {
-        emit parametersChanged();
+        markParametersChanged();
     }
 }
 
@@ -638,6 +712,7 @@ void SynthDevice::resetAudio()
     m_dualNextPair = 0;
     m_monoPanSlot.reset();
     m_nextTriggerId = 1;
+    m_phaseNoise.seed(0);
 }
 
 double SynthDevice::voiceGlideFrequency(size_t index) const
@@ -809,7 +884,7 @@ void SynthDevice::startVoice(Voice & voice, const Trigger & trigger)
     if (m_vco1Sync) {
         voice.triggerSynced(trigger);
     } else {
-        voice.triggerFree(trigger, m_phaseDist(m_rng));
+        voice.triggerFree(trigger, m_phaseNoise.nextUnipolar());
     }
 }
 
@@ -830,7 +905,6 @@ double SynthDevice::midiNoteToFreq(uint8_t note) const
 SynthDevice::ModulationValues SynthDevice::calculateModulation(Voice & voice) const
 {
     ModulationValues mods;
-    mods.ampEnvelope = voice.ampEg.nextSample();
     const double modEnv = voice.modEg.nextSample() * m_modInt;
     const double lfoVal = voice.lfo.nextSample() * m_lfoInt;
     const double lfo2Val = voice.lfo2.nextSample() * m_lfo2Int;
@@ -904,41 +978,63 @@ SynthDevice::ModulationValues SynthDevice::calculateModulation(Voice & voice) co
     return mods;
 }
 
-float SynthDevice::generateVoiceSample(Voice & voice, const ModulationValues & mods, double oversampledRate, double pbRatio)
+void SynthDevice::updateModulation(Voice & voice, size_t controlSamples, double oversampledRate)
 {
-    double vco1Freq = voice.glideFrequency * m_vco1BasePitchRatio * pbRatio;
-    double vco2Freq = voice.glideFrequency * m_vco2BasePitchRatio * pbRatio;
-    double vco3Freq = voice.glideFrequency * m_vco3BasePitchRatio * pbRatio;
-
-    if (mods.vco1PitchMod != 0.0) {
-        vco1Freq *= std::exp2(mods.vco1PitchMod);
-    }
-    if (mods.vco2PitchMod != 0.0) {
-        vco2Freq *= std::exp2(mods.vco2PitchMod);
-    }
-    if (mods.vco3PitchMod != 0.0) {
-        vco3Freq *= std::exp2(mods.vco3PitchMod);
+    // Each step evaluates the modulation where the step ends and ramps there, so the ramps follow it
+    // instead of trailing a step behind. A voice with nothing to ramp from first jumps to where the
+    // step begins.
+    if (!voice.controlPrimed) {
+        stepModulation(voice, 0, oversampledRate);
+        voice.controlPrimed = true;
     }
+    stepModulation(voice, controlSamples, oversampledRate);
+}
+
+void SynthDevice::stepModulation(Voice & voice, size_t rampSamples, double oversampledRate)
+{
+    const ModulationValues mods = calculateModulation(voice);
 
     // Drift voice mode has no fixed detune, so the wander is the detune: the depth knob feeds the
     // same per-voice oscillator drift the Drift parameter uses, on top of whatever that is set to.
     // Each voice has its own rate, and the rates are mutually irrational enough that no two voices
     // ever settle into a steady beat, which is what keeps the stack from combing.
+    double driftRatio = 1.0;
     const double driftCents = static_cast<double>(m_oscillatorDrift) * 5.0
       + (m_voiceMode == VoiceMode::Drift ? static_cast<double>(m_voiceDepth) * driftModeMaxCents : 0.0);
     if (driftCents > 0.0) {
-        voice.driftPhase = std::fmod(voice.driftPhase + voice.driftRate / oversampledRate, 1.0);
-        const double driftRatio = std::exp2(driftCents / 1200.0 * std::sin(voice.driftPhase * (2.0 * M_PI)));
-        vco1Freq *= driftRatio;
-        vco2Freq *= driftRatio;
-        vco3Freq *= driftRatio;
+        voice.driftPhase = std::fmod(voice.driftPhase + voice.driftRate * static_cast<double>(rampSamples) / oversampledRate, 1.0);
+        driftRatio = std::exp2(driftCents / 1200.0 * std::sin(voice.driftPhase * (2.0 * M_PI)));
+    }
+
+    const std::array<double, 3> pitchMods { mods.vco1PitchMod, mods.vco2PitchMod, mods.vco3PitchMod };
+    for (size_t i = 0; i < pitchMods.size(); i++) {
+        voice.pitchRatio.at(i).setTarget((pitchMods.at(i) != 0.0 ? std::exp2(pitchMods.at(i)) : 1.0) * driftRatio, rampSamples);
     }
+    voice.shapeMod.setTarget(mods.shapeMod, rampSamples);
+    voice.ampMod.setTarget(std::max(0.0, 1.0 + mods.volumeMod), rampSamples);
+
+    const double cutoffMod = mods.cutoffMod + (voice.note - 60.0) / 127.0 * m_filterKeyTrack;
+    voice.lpf.rampTo(std::clamp(m_lpfCutoff + cutoffMod, 0.0, 1.0), std::clamp(m_lpfResonance + static_cast<float>(mods.resonanceMod), 0.0f, 1.0f), rampSamples);
+    voice.hpf.setCutoff(m_hpfCutoff);
+
+    const float voicePan = std::clamp(panInternal() + voice.pan - 0.5f + static_cast<float>(mods.panMod) * 0.5f, 0.0f, 1.0f);
+    const double panAngle = static_cast<double>(voicePan) * std::numbers::pi * 0.5;
+    voice.panLeft.setTarget(std::cos(panAngle), rampSamples);
+    voice.panRight.setTarget(std::sin(panAngle), rampSamples);
+}
+
+double SynthDevice::generateVoiceSource(Voice & voice, double oversampledRate, double pbRatio)
+{
+    const double vco1Freq = voice.glideFrequency * m_vco1BasePitchRatio * pbRatio * voice.pitchRatio.at(0).nextSample();
+    double vco2Freq = voice.glideFrequency * m_vco2BasePitchRatio * pbRatio * voice.pitchRatio.at(1).nextSample();
+    const double vco3Freq = voice.glideFrequency * m_vco3BasePitchRatio * pbRatio * voice.pitchRatio.at(2).nextSample();
+    const double shapeMod = voice.shapeMod.nextSample();
 
     double vco1Val = 0.0;
     double oldPhase1 = voice.vco1.phase();
     if (m_mixVco1 >= 0.001f || m_crossModDepth >= 0.001f) {
         voice.vco1.setFrequency(vco1Freq);
-        voice.vco1.setShape(std::clamp(m_vco1Shape + mods.shapeMod, 0.0, 1.0));
+        voice.vco1.setShape(std::clamp(m_vco1Shape + shapeMod, 0.0, 1.0));
         oldPhase1 = voice.vco1.phase();
         vco1Val = voice.vco1.nextSample();
     }
@@ -953,7 +1049,7 @@ float SynthDevice::generateVoiceSample(Voice & voice, const ModulationValues & m
     double oldPhase2 = voice.vco2.phase();
     if (m_mixVco2 >= 0.001f) {
         voice.vco2.setFrequency(vco2Freq);
-        voice.vco2.setShape(std::clamp(m_vco2Shape + mods.shapeMod, 0.0, 1.0));
+        voice.vco2.setShape(std::clamp(m_vco2Shape + shapeMod, 0.0, 1.0));
 
         if (m_vco2Sync && voice.vco1.phase() < oldPhase1) {
             // Calculate fractional phase for VCO2 to maintain sync accuracy
@@ -973,7 +1069,7 @@ float SynthDevice::generateVoiceSample(Voice & voice, const ModulationValues & m
     double vco3Val = 0.0;
     if (m_mixVco3 >= 0.001f) {
         voice.vco3.setFrequency(vco3Freq);
-        voice.vco3.setShape(std::clamp(m_vco3Shape + mods.shapeMod, 0.0, 1.0));
+        voice.vco3.setShape(std::clamp(m_vco3Shape + shapeMod, 0.0, 1.0));
 
         // VCO3 Hard Sync to VCO2
         if (m_vco3Sync && voice.vco2.phase() < oldPhase2) {
@@ -995,23 +1091,13 @@ float SynthDevice::generateVoiceSample(Voice & voice, const ModulationValues & m
     }
 
     const double mix = (vco1Val * m_mixVco1) + (vco2Val * m_mixVco2) + (vco3Val * m_mixVco3) + (multiVal * m_multiLevel);
-    const double mixHeadroom = mix * 0.4; // Slightly more headroom for 3rd VCO + Multi engine
-
-    // Filter
-    const double cutoffMod = mods.cutoffMod + (voice.note - 60.0) / 127.0 * m_filterKeyTrack;
-
-    voice.lpf.setCutoff(std::clamp(m_lpfCutoff + cutoffMod, 0.0, 1.0));
-    voice.lpf.setResonance(std::clamp(m_lpfResonance + static_cast<float>(mods.resonanceMod), 0.0f, 1.0f));
-    voice.hpf.setCutoff(m_hpfCutoff);
-
-    const float filtered = voice.hpf.process(voice.lpf.process(static_cast<float>(mixHeadroom)));
-    const float ampMod = static_cast<float>(std::max(0.0, 1.0 + mods.volumeMod));
-    return filtered * static_cast<float>(mods.ampEnvelope) * ampMod;
+    return mix * 0.4; // Slightly more headroom for 3rd VCO + Multi engine
 }
 
 void SynthDevice::syncParameters()
 {
     Device::syncParameters();
+    m_parameterRevision++;
     if (const auto p = parameter(Constants::NahdXml::xmlKeyVco1Waveform().toStdString()); p)
         m_vco1Waveform = static_cast<PolyBlepOscillator::Waveform>(p->get().xmlValue());
     if (const auto p = parameter(Constants::NahdXml::xmlKeyVco1Octave().toStdString()); p)
@@ -1275,6 +1361,7 @@ void SynthDevice::deserializeFromXml(ProjectReader & reader)
 void SynthDevice::processMidiPitchBend(uint16_t value, uint8_t)
 {
     const std::lock_guard<std::recursive_mutex> lock { mutex() };
+    wake();
     m_pitchBend = value;
 }
 
@@ -1338,7 +1425,7 @@ void SynthDevice::applyPreset(int bank, int index, bool authored)
     if (authored) {
         emit dataChanged();
     } else {
-        emit parametersChanged();
+        markParametersChanged();
     }
 }
 
@@ -18,10 +18,14 @@
 
 #include "../dsp/adsr_envelope.hpp"
 #include "../dsp/cascaded_svf.hpp"
+#include "../dsp/cascaded_svf_bank.hpp"
+#include "../dsp/control_ramp.hpp"
 #include "../dsp/dc_blocker.hpp"
 #include "../dsp/lfo.hpp"
 #include "../dsp/multi_engine.hpp"
+#include "../dsp/noise_generator.hpp"
 #include "../dsp/one_pole_filter.hpp"
+#include "../dsp/planar_buffer.hpp"
 #include "../dsp/poly_blep_oscillator.hpp"
 #include "../dsp/upsampler.hpp"
 #include "../effects/delay.hpp"
@@ -31,7 +35,6 @@
 #include <array>
 #include <mutex>
 #include <optional>
-#include <random>
 #include <vector>
 
 namespace noteahead {
@@ -112,6 +115,7 @@ public:
 
     void processAudio(AudioContext & context) override;
     bool hasActiveAudio() const override;
+    bool supportsPlanarAudio() const override;
 
     void setBpm(float bpm) override;
 
@@ -352,6 +356,26 @@ private:
         //! Level of that fade, 1 down to 0 while a pending trigger waits.
         double declickGain { 1.0 };
 
+        //! What the modulation last asked for, ramped to between control steps: the pitch ratio of
+        //! each oscillator with the drift folded in, the shape and volume offsets, and the pan gains.
+        std::array<ControlRamp, 3> pitchRatio;
+        ControlRamp shapeMod;
+        ControlRamp ampMod;
+        ControlRamp panLeft;
+        ControlRamp panRight;
+        //! Oversampled samples until the next control step.
+        size_t controlCountdown { 0 };
+        //! Whether the ramps hold anything to start from. A note starting from silence jumps to its
+        //! first control values instead of sliding in from wherever the last note left them.
+        bool controlPrimed { false };
+
+        //! What updateVoiceParameters() last configured the voice for, so a block that changes none
+        //! of it does not push every setter again.
+        uint64_t configuredRevision { 0 };
+        uint32_t configuredRate { 0 };
+        uint8_t configuredOversampleFactor { 0 };
+        uint64_t configuredTriggerId { 0 };
+
         void reset();
 
         //! Phase Sync on: the note starts from a known oscillator phase and its own attack, every
@@ -371,15 +395,39 @@ private:
         void release();
     };
 
+    //! Frames between two evaluations of the envelopes, LFOs and everything they modulate, a third of
+    //! a millisecond at 48 kHz. Counted at the base rate so oversampling does not multiply the work.
+    static constexpr size_t ControlFrames { 16 };
+
     std::vector<Voice> m_voices;
+
+    //! A voice sounding in the block being rendered, holding its lane in the filter banks.
+    struct VoiceLane
+    {
+        Voice * voice { nullptr };
+        float gain { 0.0f };
+        bool damped { false };
+        //! What the source pass leaves for the output pass, a frame at a time.
+        std::array<float, CascadedSvfBank::MaxFrames> ampEnvelope {};
+        std::array<float, CascadedSvfBank::MaxFrames> ampMod {};
+        std::array<float, CascadedSvfBank::MaxFrames> declickGain {};
+    };
+
+    //! Voices render a chunk at a time in three passes: each voice's oscillators up to the filter,
+    //! then every voice's filters side by side in the banks, then each voice's output stage. Only
+    //! the filters share work across voices; the rest keeps its per-voice state.
+    std::array<VoiceLane, MaxVoices> m_lanes;
+    std::array<CascadedSvf *, MaxVoices> m_laneLpfs {};
+    std::array<CascadedSvf *, MaxVoices> m_laneHpfs {};
+    CascadedSvfBank m_lpfBank;
+    CascadedSvfBank m_hpfBank;
     size_t m_polyNextVoice = 0;
     size_t m_dualNextPair { 0 };
     //! Pan-spread slot of the note Mono is currently sounding. Unset until the first note, so the
     //! line starts at the same position a poly patch would.
     std::optional<size_t> m_monoPanSlot;
 
-    mutable std::mt19937 m_rng { 0 };
-    mutable std::uniform_real_distribution<double> m_phaseDist { 0.0, 1.0 };
+    NoiseGenerator m_phaseNoise;
 
     // Internal parameter storage
     PolyBlepOscillator::Waveform m_vco1Waveform { PolyBlepOscillator::Waveform::Saw };
@@ -445,6 +493,8 @@ private:
 
     VoiceMode m_voiceMode { VoiceMode::Poly };
     uint64_t m_nextTriggerId { 1 };
+    //! Bumped whenever the parameters are synced, which is what tells the voices to pick them up.
+    uint64_t m_parameterRevision { 1 };
     float m_voiceDepth { 0.0f };
     float m_portamento { 0.0f };
     float m_panSpread { 0.0f };
@@ -479,7 +529,9 @@ private:
     DcBlocker m_dcBlockerL;
     DcBlocker m_dcBlockerR;
 
-    std::vector<float> m_oversampledBuffer;
+    //! Voices sum here at the oversampled rate. Planar, so the decimators read each channel's
+    //! consecutive high-rate samples in place instead of having them gathered out of a stride.
+    PlanarBuffer m_oversampledBuffer;
 
     double m_vco1BasePitchRatio { 1.0 };
     double m_vco2BasePitchRatio { 1.0 };
@@ -500,7 +552,6 @@ private:
 
     struct ModulationValues
     {
-        double ampEnvelope { 0.0 };
         double modEnvelope { 0.0 };
         double lfoValue { 0.0 };
         double cutoffMod { 0.0 };
@@ -513,8 +564,15 @@ private:
         double volumeMod { 0.0 };
     };
 
+    //! Steps the mod envelope and both LFOs, which all run at the control rate.
     ModulationValues calculateModulation(Voice & voice) const;
-    float generateVoiceSample(Voice & voice, const ModulationValues & mods, double oversampledRate, double pbRatio);
+    //! One control step: evaluates the modulation and sets the voice's ramps and filter heading for
+    //! it over the next @p controlSamples.
+    void updateModulation(Voice & voice, size_t controlSamples, double oversampledRate);
+    //! Sets the ramps heading for the modulation as it stands after @p rampSamples more samples.
+    void stepModulation(Voice & voice, size_t rampSamples, double oversampledRate);
+    //! The voice's oscillators mixed for the filter, which the caller runs in the banks.
+    double generateVoiceSource(Voice & voice, double oversampledRate, double pbRatio);
 
     void prepareForProcessing(AudioContext & context);
     void updateVoiceParameters(Voice & voice, uint32_t oversampledRate, size_t index);
@@ -533,7 +591,12 @@ private:
     //! Corner for the voice's damping filter, or 0 when the mode damps nothing.
     double voiceDampingHz(size_t index) const;
 
-    void renderVoice(Voice & voice, AudioContext & context, uint8_t oversampleFactor, uint32_t oversampledRate, double portamentoCoeff, double pbRatio, size_t index);
+    //! Sets the voice up for the block and gives it the next lane.
+    void prepareVoiceLane(Voice & voice, uint32_t oversampledRate, size_t index, size_t lane);
+    //! Runs the lane's voice up to its filters for @p frames, recording their input in the banks.
+    void renderVoiceSource(VoiceLane & lane, size_t laneIndex, size_t frames, uint8_t oversampleFactor, double oversampledRate, double portamentoCoeff, double pbRatio);
+    //! Takes the lane's filtered samples through the amp and pan into the oversampled buffer.
+    void renderVoiceOutput(VoiceLane & lane, size_t laneIndex, size_t offset, size_t frames);
     void applyGlobalEffects(AudioContext & context);
 
     std::string m_name;
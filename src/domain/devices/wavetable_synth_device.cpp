@@ -21,11 +21,13 @@
 #include "../../common/xml/project_reader.hpp"
 #include "../../common/xml/project_writer.hpp"
 #include "../../infra/midi/midi_cc_mapping.hpp"
+#include "../dsp/wavetable_cache.hpp"
 
 #include <algorithm>
 #include <array>
 #include <cmath>
 #include <numbers>
+#include <span>
 
 namespace noteahead {
 
@@ -62,6 +64,9 @@ void WavetableSynthDevice::Voice::reset()
     pan = 0.5f;
     driftPhase = 0.0;
     damping.reset();
+    controlCountdown = 0;
+    controlPrimed = false;
+    configuredRevision = 0;
 }
 
 void WavetableSynthDevice::Voice::trigger(uint8_t n, double freq, float p, float vel, uint64_t tid, double startPhase)
@@ -86,6 +91,13 @@ void WavetableSynthDevice::Voice::trigger(uint8_t n, double freq, float p, float
         osc2.snapPosition();
     }
 
+    // The new note's modulation is evaluated on its first sample. A voice still sounding ramps there
+    // from where it was; an idle one jumps.
+    controlCountdown = 0;
+    if (!active) {
+        controlPrimed = false;
+    }
+
     active = true;
     ampEg.trigger();
     modEg.trigger();
@@ -101,20 +113,6 @@ void WavetableSynthDevice::Voice::release()
 
 namespace {
 
-//! Wavetables cost tens of milliseconds to build and several megabytes to hold, so they are built
-//! on first use and then shared by every instance of the device for the rest of the session.
-Wavetable::WavetableCS sharedWavetable(int index)
-{
-    static std::mutex mutex;
-    static std::map<int, Wavetable::WavetableCS> cache;
-
-    const std::lock_guard<std::mutex> lock { mutex };
-    if (const auto iter = cache.find(index); iter != cache.end()) {
-        return iter->second;
-    }
-    return cache.emplace(index, Wavetable::createSet(static_cast<size_t>(index))).first->second;
-}
-
 //! Turns an intensity knob position into the modulation depth it stands for. The taper is the one
 //! the knob reads out with, and the one the Synth applies: fine near the centre, so that a small
 //! reading really is a small amount of modulation.
@@ -128,7 +126,7 @@ double intensityToDepth(float intensity)
 void WavetableSynthDevice::prepareWavetable(int index)
 {
     if (index >= 0 && index < static_cast<int>(Wavetable::setNames().size())) {
-        sharedWavetable(index);
+        WavetableCache::instance().wavetable(static_cast<size_t>(index));
     }
 }
 
@@ -257,48 +255,36 @@ void WavetableSynthDevice::processAudio(AudioContext & context)
 
     for (size_t index = 0; index < m_voices.size(); index++) {
         auto & voice = m_voices.at(index);
-        voice.lfo.setWaveform(m_lfoWaveform);
-        voice.lfo.setMode(m_lfoMode);
-        if (m_lfoMode == Lfo::Mode::BPM) {
-            voice.lfo.setFrequency(m_bpm, m_lfoRate);
-        } else {
-            voice.lfo.setFrequency(ParameterMapper::mapLfoFrequency(m_lfoRate, 0.05, 20.0));
-        }
-
-        voice.lfo2.setWaveform(m_lfo2Waveform);
-        voice.lfo2.setMode(m_lfo2Mode);
-        if (m_lfo2Mode == Lfo::Mode::BPM) {
-            voice.lfo2.setFrequency(m_bpm, m_lfo2Rate);
-        } else {
-            voice.lfo2.setFrequency(ParameterMapper::mapLfoFrequency(m_lfo2Rate, 0.05, 20.0));
-        }
-
         if (voice.active) {
             renderVoice(voice, context, oversampleFactor, oversampledRate, portamentoCoeff, pbRatio, index);
         }
     }
 
-    std::array<float, 4> highL {};
-    std::array<float, 4> highR {};
-    for (uint32_t i = 0; i < context.frameCount; i++) {
-        for (uint8_t os = 0; os < oversampleFactor; os++) {
-            highL[os] = m_oversampledBuffer[(i * oversampleFactor + os) * 2];
-            highR[os] = m_oversampledBuffer[(i * oversampleFactor + os) * 2 + 1];
+    const float * highLeft = m_oversampledBuffer.left();
+    const float * highRight = m_oversampledBuffer.right();
+    if (context.isPlanar()) {
+        for (uint32_t i = 0; i < context.frameCount; i++) {
+            context.left[i] += m_downsamplerL.process(highLeft + i * oversampleFactor, oversampleFactor);
+            context.right[i] += m_downsamplerR.process(highRight + i * oversampleFactor, oversampleFactor);
         }
+        return;
+    }
 
-        context.buffer[i * 2] += static_cast<double>(m_downsamplerL.process(highL.data(), oversampleFactor));
-        context.buffer[i * 2 + 1] += static_cast<double>(m_downsamplerR.process(highR.data(), oversampleFactor));
+    for (uint32_t i = 0; i < context.frameCount; i++) {
+        context.buffer[i * 2] += static_cast<double>(m_downsamplerL.process(highLeft + i * oversampleFactor, oversampleFactor));
+        context.buffer[i * 2 + 1] += static_cast<double>(m_downsamplerR.process(highRight + i * oversampleFactor, oversampleFactor));
     }
 }
 
 void WavetableSynthDevice::prepareForProcessing(AudioContext & context)
 {
     setSampleRate(context.sampleRate);
-    const size_t requiredSize = static_cast<size_t>(context.frameCount) * clampOversampleFactor(context.oversampleFactor) * 2;
-    if (m_oversampledBuffer.size() < requiredSize) {
-        m_oversampledBuffer.resize(requiredSize);
+    const size_t requiredSize = static_cast<size_t>(context.frameCount) * clampOversampleFactor(context.oversampleFactor);
+    m_oversampledBuffer.reserve(requiredSize);
+    m_oversampledBuffer.clear(requiredSize);
+    if (m_noiseBuffer.size() < requiredSize) {
+        m_noiseBuffer.resize(requiredSize);
     }
-    std::fill(m_oversampledBuffer.begin(), m_oversampledBuffer.begin() + requiredSize, 0.0f);
 }
 
 bool WavetableSynthDevice::isStacked(VoiceMode mode)
@@ -405,7 +391,7 @@ double WavetableSynthDevice::voiceDampingHz(size_t index) const
 
 void WavetableSynthDevice::renderVoice(Voice & voice, AudioContext & context, uint8_t oversampleFactor, uint32_t oversampledRate, double portamentoCoeff, double pbRatio, size_t index)
 {
-    updateVoiceParameters(voice, oversampledRate, index);
+    updateVoiceParameters(voice, oversampledRate, oversampleFactor, index);
 
     // The 1/MaxVoices base is the headroom for a full chord: every voice sounding at once reaches
     // full scale. The stack normalization then keeps one note at the same level whatever the voice
@@ -418,24 +404,34 @@ void WavetableSynthDevice::renderVoice(Voice & voice, AudioContext & context, ui
         voice.damping.calculate(dampingHz, oversampledRate);
     }
 
+    const size_t controlSamples = ControlFrames * oversampleFactor;
+
+    const std::span noise { m_noiseBuffer.data(), static_cast<size_t>(context.frameCount) * oversampleFactor };
+    if (m_noiseLevel > 0.0f) {
+        m_noise.fill(noise);
+    }
+
+    float * highLeft = m_oversampledBuffer.left();
+    float * highRight = m_oversampledBuffer.right();
     for (uint32_t i = 0; i < context.frameCount; i++) {
         for (uint8_t subSample = 0; subSample < oversampleFactor; subSample++) {
             voice.glideFrequency += (voice.frequency - voice.glideFrequency) * portamentoCoeff;
-            const ModulationValues mods = calculateModulation(voice);
-            float voiceSample = generateVoiceSample(voice, mods, oversampledRate, pbRatio);
+
+            if (!voice.controlCountdown) {
+                updateModulation(voice, controlSamples, oversampledRate);
+                voice.controlCountdown = controlSamples;
+            }
+            voice.controlCountdown--;
+
+            float voiceSample = generateVoiceSample(voice, pbRatio, noise[i * oversampleFactor + subSample]);
             if (damped) {
                 voice.damping.process(static_cast<double>(voiceSample));
                 voiceSample = static_cast<float>(voice.damping.lowPass());
             }
             const float sample = voiceSample * gain;
 
-            const float voicePan = std::clamp(panInternal() + voice.pan - 0.5f + static_cast<float>(mods.panMod) * 0.5f, 0.0f, 1.0f);
-            const double panAngle = static_cast<double>(voicePan) * std::numbers::pi * 0.5;
-            const float panL = static_cast<float>(std::cos(panAngle));
-            const float panR = static_cast<float>(std::sin(panAngle));
-
-            m_oversampledBuffer[(i * oversampleFactor + subSample) * 2] += sample * panL;
-            m_oversampledBuffer[(i * oversampleFactor + subSample) * 2 + 1] += sample * panR;
+            highLeft[i * oversampleFactor + subSample] += sample * static_cast<float>(voice.panLeft.nextSample());
+            highRight[i * oversampleFactor + subSample] += sample * static_cast<float>(voice.panRight.nextSample());
         }
 
         if (voice.ampEg.isSilent()) {
@@ -445,23 +441,49 @@ void WavetableSynthDevice::renderVoice(Voice & voice, AudioContext & context, ui
     }
 }
 
-void WavetableSynthDevice::updateVoiceParameters(Voice & voice, uint32_t oversampledRate, size_t index)
+void WavetableSynthDevice::updateVoiceParameters(Voice & voice, uint32_t oversampledRate, uint8_t oversampleFactor, size_t index)
 {
     // The detune has to follow the depth knob while a note sounds, not only at the note on.
     if (isStacked(m_voiceMode) || m_voiceMode == VoiceMode::Dual) {
         voice.frequency = midiNoteToFreq(voice.note) * std::pow(2.0, voiceDetuneSemitones(index) / 12.0);
     }
 
+    // Nothing below moves unless a parameter, the tempo or the rate does.
+    if (voice.configuredRevision == m_parameterRevision && voice.configuredRate == oversampledRate && voice.configuredOversampleFactor == oversampleFactor) {
+        return;
+    }
+    voice.configuredRevision = m_parameterRevision;
+    voice.configuredRate = oversampledRate;
+    voice.configuredOversampleFactor = oversampleFactor;
+
+    // The mod envelope and the LFOs are only stepped once per control step.
+    const double controlRate = static_cast<double>(oversampledRate) / static_cast<double>(ControlFrames * oversampleFactor);
+
     voice.osc1.setSampleRate(oversampledRate);
     voice.osc2.setSampleRate(oversampledRate);
     voice.lpf.setSampleRate(oversampledRate);
     voice.hpf.setSampleRate(oversampledRate);
     voice.ampEg.setSampleRate(oversampledRate);
-    voice.modEg.setSampleRate(oversampledRate);
-    voice.lfo.setSampleRate(oversampledRate);
-    voice.lfo2.setSampleRate(oversampledRate);
+    voice.modEg.setSampleRate(controlRate);
+    voice.lfo.setSampleRate(controlRate);
+    voice.lfo2.setSampleRate(controlRate);
+
+    voice.lfo.setWaveform(m_lfoWaveform);
+    voice.lfo.setMode(m_lfoMode);
+    if (m_lfoMode == Lfo::Mode::BPM) {
+        voice.lfo.setFrequency(m_bpm, m_lfoRate);
+    } else {
+        voice.lfo.setFrequency(ParameterMapper::mapLfoFrequency(m_lfoRate, 0.05, 20.0));
+    }
+
+    voice.lfo2.setWaveform(m_lfo2Waveform);
+    voice.lfo2.setMode(m_lfo2Mode);
+    if (m_lfo2Mode == Lfo::Mode::BPM) {
+        voice.lfo2.setFrequency(m_bpm, m_lfo2Rate);
+    } else {
+        voice.lfo2.setFrequency(ParameterMapper::mapLfoFrequency(m_lfo2Rate, 0.05, 20.0));
+    }
 
-    voice.lpf.setResonance(m_lpfResonance);
     voice.hpf.setResonance(0.0f);
 }
 
@@ -471,9 +493,15 @@ bool WavetableSynthDevice::hasActiveAudio() const
     return std::ranges::any_of(m_voices, [](const auto & voice) { return voice.active; });
 }
 
+bool WavetableSynthDevice::supportsPlanarAudio() const
+{
+    return true;
+}
+
 void WavetableSynthDevice::processMidiNoteOn(uint8_t note, uint8_t velocity)
 {
     const std::lock_guard<std::recursive_mutex> lock { mutex() };
+    wake();
     handleNoteOn(note, velocity);
 }
 
@@ -487,6 +515,7 @@ void WavetableSynthDevice::processMidiCc(uint8_t controller, uint8_t value, uint
 {
     using namespace MidiCcMapping;
 
+    wake();
     const float val = static_cast<float>(value) / 127.0f;
     bool changed = false;
 
@@ -537,13 +566,14 @@ void WavetableSynthDevice::processMidiCc(uint8_t controller, uint8_t value, uint
     }
 
     if (changed) {
-        emit parametersChanged();
+        markParametersChanged();
     }
 }
 
 void WavetableSynthDevice::processMidiPitchBend(uint16_t value, uint8_t)
 {
     const std::lock_guard<std::recursive_mutex> lock { mutex() };
+    wake();
     m_pitchBend = value;
 }
 
@@ -561,6 +591,7 @@ void WavetableSynthDevice::setBpm(float bpm)
 {
     const std::lock_guard<std::recursive_mutex> lock { mutex() };
     m_bpm = bpm;
+    m_parameterRevision++;
 }
 
 void WavetableSynthDevice::reset()
@@ -581,6 +612,7 @@ void WavetableSynthDevice::resetAudio()
     m_dualNextPair = 0;
     m_monoPanSlot.reset();
     m_nextTriggerId = 1;
+    m_noise.seed(NoiseSeed);
 }
 
 void WavetableSynthDevice::releaseVoicesAbove(size_t count)
@@ -614,7 +646,7 @@ void WavetableSynthDevice::handleNoteOn(uint8_t note, uint8_t velocity)
                 m_voices.at(i).glideFrequency = voiceFreq;
             }
 
-            m_voices.at(i).trigger(note, voiceFreq, voiceSpreadPan(i), finalVel, tid, m_phaseDist(m_rng));
+            m_voices.at(i).trigger(note, voiceFreq, voiceSpreadPan(i), finalVel, tid, m_noise.nextUnipolar());
         }
         return;
     }
@@ -668,8 +700,8 @@ void WavetableSynthDevice::handleNoteOn(uint8_t note, uint8_t velocity)
 
         const float pan0 = 0.5f - m_panSpread * 0.5f;
         const float pan1 = 0.5f + m_panSpread * 0.5f;
-        m_voices.at(v0).trigger(note, freq0, pan0, finalVel, tid, m_phaseDist(m_rng));
-        m_voices.at(v1).trigger(note, freq1, pan1, finalVel, tid, m_phaseDist(m_rng));
+        m_voices.at(v0).trigger(note, freq0, pan0, finalVel, tid, m_noise.nextUnipolar());
+        m_voices.at(v1).trigger(note, freq1, pan1, finalVel, tid, m_noise.nextUnipolar());
         return;
     }
 
@@ -727,7 +759,7 @@ void WavetableSynthDevice::handleMonoNoteOn(uint8_t note, double frequency, floa
         voice.glideFrequency = frequency;
     }
 
-    voice.trigger(note, frequency, voiceSpreadPan(m_monoPanSlot.value_or(0)), velocity, m_nextTriggerId++, m_phaseDist(m_rng));
+    voice.trigger(note, frequency, voiceSpreadPan(m_monoPanSlot.value_or(0)), velocity, m_nextTriggerId++, m_noise.nextUnipolar());
 }
 
 void WavetableSynthDevice::handleNoteOff(uint8_t note)
@@ -747,7 +779,6 @@ double WavetableSynthDevice::midiNoteToFreq(uint8_t note) const
 WavetableSynthDevice::ModulationValues WavetableSynthDevice::calculateModulation(Voice & voice) const
 {
     ModulationValues mods = ModulationValues {};
-    mods.ampEnvelope = voice.ampEg.nextSample();
     mods.modEnvelope = voice.modEg.nextSample() * m_modDepth;
     mods.lfoValue = voice.lfo.nextSample() * m_lfoDepth;
     mods.lfo2Value = voice.lfo2.nextSample() * m_lfo2Depth;
@@ -791,22 +822,32 @@ WavetableSynthDevice::ModulationValues WavetableSynthDevice::calculateModulation
     return mods;
 }
 
-float WavetableSynthDevice::generateVoiceSample(Voice & voice, const ModulationValues & mods, double oversampledRate, double pbRatio)
+void WavetableSynthDevice::updateModulation(Voice & voice, size_t controlSamples, double oversampledRate)
+{
+    // Each step evaluates the modulation where the step ends and ramps there, so the ramps follow it
+    // instead of trailing a step behind. A voice with nothing to ramp from first jumps to where the
+    // step begins.
+    if (!voice.controlPrimed) {
+        stepModulation(voice, 0, oversampledRate);
+        voice.controlPrimed = true;
+    }
+    stepModulation(voice, controlSamples, oversampledRate);
+}
+
+void WavetableSynthDevice::stepModulation(Voice & voice, size_t rampSamples, double oversampledRate)
 {
-    double freq = voice.glideFrequency * pbRatio;
+    const ModulationValues mods = calculateModulation(voice);
 
     // Drift voice mode has no fixed detune, so the wander is the detune. Each voice has its own
     // rate, and the rates are mutually irrational enough that no two voices ever settle into a
     // steady beat, which is what keeps the stack from combing.
+    double driftRatio = 1.0;
     if (m_voiceMode == VoiceMode::Drift && m_voiceDepth > 0.0f) {
         const double driftCents = static_cast<double>(m_voiceDepth) * Utils::Dsp::driftModeMaxCents;
-        voice.driftPhase = std::fmod(voice.driftPhase + voice.driftRate / oversampledRate, 1.0);
-        freq *= std::exp2(driftCents / 1200.0 * std::sin(voice.driftPhase * 2.0 * std::numbers::pi));
+        voice.driftPhase = std::fmod(voice.driftPhase + voice.driftRate * static_cast<double>(rampSamples) / oversampledRate, 1.0);
+        driftRatio = std::exp2(driftCents / 1200.0 * std::sin(voice.driftPhase * 2.0 * std::numbers::pi));
     }
 
-    double osc1Freq = freq * m_osc1BasePitchRatio;
-    double osc2Freq = freq * m_osc2BasePitchRatio;
-
     double osc1PitchMod = 0.0;
     double osc2PitchMod = 0.0;
 
@@ -826,32 +867,43 @@ float WavetableSynthDevice::generateVoiceSample(Voice & voice, const ModulationV
         osc2PitchMod += mods.lfo2Value;
     }
 
-    osc1Freq *= std::exp2(osc1PitchMod);
-    osc2Freq *= std::exp2(osc2PitchMod);
-
-    voice.osc1.setFrequency(osc1Freq);
+    voice.pitchRatio.at(0).setTarget(std::exp2(osc1PitchMod) * driftRatio, rampSamples);
+    voice.pitchRatio.at(1).setTarget(std::exp2(osc2PitchMod) * driftRatio, rampSamples);
     voice.osc1.setPosition(std::clamp(m_osc1Pos + mods.osc1PosMod, 0.0, 1.0));
-    const float osc1Val = static_cast<float>(voice.osc1.nextSample()) * m_osc1Level;
-
-    voice.osc2.setFrequency(osc2Freq);
     voice.osc2.setPosition(std::clamp(m_osc2Pos + mods.osc2PosMod, 0.0, 1.0));
-    const float osc2Val = static_cast<float>(voice.osc2.nextSample()) * m_osc2Level;
+    voice.ampMod.setTarget(std::max(0.0, 1.0 + mods.volumeMod), rampSamples);
+
+    voice.lpf.rampTo(std::clamp(m_lpfCutoff + static_cast<float>(mods.cutoffMod), 0.0f, 1.0f), std::clamp(m_lpfResonance + static_cast<float>(mods.resonanceMod), 0.0f, 1.0f), rampSamples);
+    voice.hpf.setCutoff(m_hpfCutoff);
 
-    const float noise = m_noiseDist(m_rng) * m_noiseLevel * m_noiseOversampleGain;
+    const float voicePan = std::clamp(panInternal() + voice.pan - 0.5f + static_cast<float>(mods.panMod) * 0.5f, 0.0f, 1.0f);
+    const double panAngle = static_cast<double>(voicePan) * std::numbers::pi * 0.5;
+    voice.panLeft.setTarget(std::cos(panAngle), rampSamples);
+    voice.panRight.setTarget(std::sin(panAngle), rampSamples);
+}
 
-    const float mix = osc1Val + osc2Val + noise;
+float WavetableSynthDevice::generateVoiceSample(Voice & voice, double pbRatio, float noise)
+{
+    const double ampEnvelope = voice.ampEg.nextSample();
+    const double freq = voice.glideFrequency * pbRatio;
 
-    voice.lpf.setCutoff(std::clamp(m_lpfCutoff + static_cast<float>(mods.cutoffMod), 0.0f, 1.0f));
-    voice.lpf.setResonance(std::clamp(m_lpfResonance + static_cast<float>(mods.resonanceMod), 0.0f, 1.0f));
-    voice.hpf.setCutoff(m_hpfCutoff);
+    voice.osc1.setFrequency(freq * m_osc1BasePitchRatio * voice.pitchRatio.at(0).nextSample());
+    const float osc1Val = static_cast<float>(voice.osc1.nextSample()) * m_osc1Level;
+
+    voice.osc2.setFrequency(freq * m_osc2BasePitchRatio * voice.pitchRatio.at(1).nextSample());
+    const float osc2Val = static_cast<float>(voice.osc2.nextSample()) * m_osc2Level;
+
+    const float mix = osc1Val + osc2Val + noise * m_noiseLevel * m_noiseOversampleGain;
 
-    const float ampMod = static_cast<float>(std::max(0.0, 1.0 + mods.volumeMod));
-    return voice.hpf.process(voice.lpf.process(mix)) * static_cast<float>(mods.ampEnvelope) * ampMod;
+    // The filter's coefficients are on the ramp updateModulation() set them on.
+    const float ampMod = static_cast<float>(voice.ampMod.nextSample());
+    return voice.hpf.process(voice.lpf.process(mix)) * static_cast<float>(ampEnvelope) * ampMod;
 }
 
 void WavetableSynthDevice::syncParameters()
 {
     Device::syncParameters();
+    m_parameterRevision++;
 
     auto updateParam = [this](const QString & key, float & var) {
         if (const auto synthParameter = parameter(key.toStdString()); synthParameter) {
@@ -919,7 +971,7 @@ void WavetableSynthDevice::syncParameters()
     // A project saved by a newer build can name a set this one does not have; fall back to the
     // last one rather than refusing to load.
     m_wavetableIndex = std::clamp(m_wavetableIndex, 0, static_cast<int>(Wavetable::setNames().size()) - 1);
-    const auto currentWavetable = sharedWavetable(m_wavetableIndex);
+    const auto currentWavetable = WavetableCache::instance().wavetable(static_cast<size_t>(m_wavetableIndex));
 
     const double osc1PitchOffset = ParameterMapper::mapCubicCentered(m_osc1Pitch * 2.0 - 1.0, -1200, 1200);
     m_osc1BasePitchRatio = std::pow(2.0, (m_osc1Octave * 12.0 + osc1PitchOffset / 100.0) / 12.0);
@@ -18,16 +18,19 @@
 
 #include "../dsp/adsr_envelope.hpp"
 #include "../dsp/cascaded_svf.hpp"
+#include "../dsp/control_ramp.hpp"
 #include "../dsp/lfo.hpp"
+#include "../dsp/noise_generator.hpp"
 #include "../dsp/one_pole_filter.hpp"
+#include "../dsp/planar_buffer.hpp"
 #include "../dsp/upsampler.hpp"
 #include "../dsp/wavetable_oscillator.hpp"
 #include "device.hpp"
 
+#include <array>
 #include <map>
 #include <mutex>
 #include <optional>
-#include <random>
 #include <vector>
 
 namespace noteahead {
@@ -103,6 +106,7 @@ public:
 
     void processAudio(AudioContext & context) override;
     bool hasActiveAudio() const override;
+    bool supportsPlanarAudio() const override;
 
     void setBpm(float bpm) override;
 
@@ -215,7 +219,7 @@ public:
     void setWavetableIndex(int index);
     std::vector<std::string> wavetableNames() const;
 
-    //! Builds the given set into the shared cache if it isn't there yet. Call this off the audio
+    //! Gets the given set into WavetableCache if it isn't there yet. Call this off the audio
     //! path before selecting a set: the selection itself runs under the device lock, and building
     //! a set there would hold the audio thread off for as long as it takes.
     static void prepareWavetable(int index);
@@ -246,6 +250,25 @@ private:
         //! Takes the edge off the outer voices of a wide stack. Idle in the modes that do not stack.
         OnePoleFilter damping;
 
+        //! What the modulation last asked for, ramped to between control steps: the pitch ratio of
+        //! each oscillator with the drift folded in, the volume offset and the pan gains. The morph
+        //! positions need no ramp, the oscillators already glide to them.
+        std::array<ControlRamp, 2> pitchRatio;
+        ControlRamp ampMod;
+        ControlRamp panLeft;
+        ControlRamp panRight;
+        //! Oversampled samples until the next control step.
+        size_t controlCountdown { 0 };
+        //! Whether the ramps hold anything to start from. A voice starting from silence jumps to its
+        //! first control values instead of sliding in from wherever the last note left them.
+        bool controlPrimed { false };
+
+        //! What updateVoiceParameters() last configured the voice for, so a block that changes none
+        //! of it does not push every setter again.
+        uint64_t configuredRevision { 0 };
+        uint32_t configuredRate { 0 };
+        uint8_t configuredOversampleFactor { 0 };
+
         void reset();
         //! @p startPhase spreads unison voices apart. Voices started at the same phase stay
         //! correlated and simply sum, which is a level jump rather than the thickening unison is
@@ -254,18 +277,26 @@ private:
         void release();
     };
 
+    //! Frames between two evaluations of the mod envelope, the LFOs and everything they modulate.
+    //! Counted at the base rate so oversampling does not multiply the work.
+    static constexpr size_t ControlFrames { 16 };
+
     std::vector<Voice> m_voices;
     size_t m_polyNextVoice { 0 };
     size_t m_dualNextPair { 0 };
     //! Pan slot the sounding mono note took, so a mono line still travels across the field.
     std::optional<size_t> m_monoPanSlot;
     uint64_t m_nextTriggerId { 1 };
+    //! Bumped whenever the parameters are synced or the tempo changes, which is what tells the
+    //! voices to pick them up.
+    uint64_t m_parameterRevision { 1 };
 
     int m_wavetableIndex { 0 };
 
-    mutable std::mt19937 m_rng { 42 };
-    mutable std::uniform_real_distribution<float> m_noiseDist { -1.0f, 1.0f };
-    mutable std::uniform_real_distribution<double> m_phaseDist { 0.0, 1.0 };
+    //! Draws the start phases as well as the noise oscillator. Reseeded on reset so that a render
+    //! does not depend on what was played before it.
+    static constexpr uint32_t NoiseSeed { 42 };
+    NoiseGenerator m_noise { NoiseSeed };
 
     // Internal parameter storage
     float m_osc1Pos { 0.0f };
@@ -334,7 +365,6 @@ private:
 
     struct ModulationValues
     {
-        double ampEnvelope { 0.0 };
         double modEnvelope { 0.0 };
         double lfoValue { 0.0 };
         double lfo2Value { 0.0 };
@@ -346,11 +376,17 @@ private:
         double volumeMod { 0.0 };
     };
 
+    //! Steps the mod envelope and both LFOs, which all run at the control rate.
     ModulationValues calculateModulation(Voice & voice) const;
-    float generateVoiceSample(Voice & voice, const ModulationValues & mods, double oversampledRate, double pbRatio);
+    //! One control step: evaluates the modulation and sets the voice's ramps and filter heading for
+    //! it over the next @p controlSamples.
+    void updateModulation(Voice & voice, size_t controlSamples, double oversampledRate);
+    //! Sets the ramps heading for the modulation as it stands after @p rampSamples more samples.
+    void stepModulation(Voice & voice, size_t rampSamples, double oversampledRate);
+    float generateVoiceSample(Voice & voice, double pbRatio, float noise);
 
     void prepareForProcessing(AudioContext & context);
-    void updateVoiceParameters(Voice & voice, uint32_t oversampledRate, size_t index);
+    void updateVoiceParameters(Voice & voice, uint32_t oversampledRate, uint8_t oversampleFactor, size_t index);
     //! Voices the current voice mode spends on a single note. Poly and mono play one, dual pairs
     //! them up, and the stacked modes take the lot.
     int voicesPerNote() const;
@@ -374,7 +410,10 @@ private:
 
     std::string m_name;
 
-    std::vector<float> m_oversampledBuffer;
+    //! Planar, so each decimator reads its channel's high-rate samples in place.
+    PlanarBuffer m_oversampledBuffer;
+    //! A block of white noise at the high rate, generated in one pass for each voice that renders.
+    std::vector<float> m_noiseBuffer;
     Decimator m_downsamplerL;
     Decimator m_downsamplerR;
 };
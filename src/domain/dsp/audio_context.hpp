@@ -16,16 +16,34 @@
 #ifndef AUDIO_CONTEXT_HPP
 #define AUDIO_CONTEXT_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <span>
 
 namespace noteahead {
 
+//! Where a device can hand off independent parts of its block, its voices, to run alongside each
+//! other on the engine's worker lanes. The engine provides one only while it processes devices on
+//! its worker pool; see AudioContext::parallelFor().
+class TaskFork
+{
+public:
+    using Task = void (*)(void * context, size_t index);
+
+    virtual ~TaskFork() = default;
+
+    //! Runs task(context, i) for every i below count, in any order and possibly concurrently, and
+    //! returns once all of them have. The caller's locks stay held throughout, so the tasks may use
+    //! whatever those protect, as long as no two of them touch the same state.
+    virtual void run(size_t count, void * context, Task task) = 0;
+};
+
 /**
  * @brief Audio processing context.
  *
  * Uses double precision for the accumulation buffer to ensure high-quality
- * mixing and summing across many voices and tracks.
+ * mixing and summing across many voices and tracks. Devices that opt in render
+ * into a planar float view instead, which is converted at the block boundary.
  */
 struct AudioContext
 {
@@ -38,6 +56,33 @@ struct AudioContext
     //! higher rate. Lower for realtime playback to save CPU, higher for offline export. Default 2
     //! preserves the historical fixed 2x behaviour.
     uint8_t oversampleFactor { 2 };
+    //! Planar single-precision output, 64-byte aligned and frameCount long. Set by the engine only
+    //! for a device that opts in through Device::supportsPlanarAudio(), which then renders here
+    //! instead of into `buffer`; the engine converts to the interleaved form once afterwards. Null
+    //! otherwise, and any device has to keep working with `buffer` alone, as tests drive it that way.
+    float * left { nullptr };
+    float * right { nullptr };
+    //! Set by the engine when other lanes are free to take on part of this device's block. Null
+    //! otherwise, and in tests.
+    TaskFork * fork { nullptr };
+
+    bool isPlanar() const
+    {
+        return left && right;
+    }
+
+    //! Runs task(context, i) for every i below count, across the worker lanes when there is a fork
+    //! and one after the other on the calling thread when there is not.
+    void parallelFor(size_t count, void * context, TaskFork::Task task) const
+    {
+        if (fork && count > 1) {
+            fork->run(count, context, task);
+            return;
+        }
+        for (size_t index = 0; index < count; index++) {
+            task(context, index);
+        }
+    }
 };
 
 } // namespace noteahead
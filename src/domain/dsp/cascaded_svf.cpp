@@ -23,14 +23,69 @@ namespace noteahead {
 
 void CascadedSvf::setCutoff(double cutoff)
 {
+    cancelRamp();
     m_cutoff = std::clamp(cutoff, 0.0, 1.0);
 }
 
 void CascadedSvf::setResonance(double resonance)
 {
+    cancelRamp();
     m_resonance = std::clamp(resonance, 0.0, 1.0);
 }
 
+void CascadedSvf::rampTo(double cutoff, double resonance, size_t samples)
+{
+    const bool wasBypassed = bypassed();
+    cancelRamp();
+    m_cutoff = std::clamp(cutoff, 0.0, 1.0);
+    m_resonance = std::clamp(resonance, 0.0, 1.0);
+
+    // Coefficients left over from a bypass or from another sample rate are nothing to start a line
+    // from, so those jump, and process() works the new ones out on its next call.
+    if (samples == 0 || wasBypassed || bypassed() || std::abs(m_sampleRate - m_lastSampleRate) > 0.1) {
+        return;
+    }
+
+    const double g = m_g;
+    const double k = m_k;
+    updateCoefficients();
+    m_gTarget = m_g;
+    m_kTarget = m_k;
+    m_gStep = (m_gTarget - g) / static_cast<double>(samples);
+    m_kStep = (m_kTarget - k) / static_cast<double>(samples);
+    m_g = g;
+    m_k = k;
+    m_rampRemaining = samples;
+}
+
+void CascadedSvf::cancelRamp()
+{
+    if (m_rampRemaining) {
+        m_rampRemaining = 0;
+        m_lastCutoff = -1.0;
+    }
+}
+
+bool CascadedSvf::bypassed() const
+{
+    return (m_mode == Mode::LowPass && m_cutoff >= 0.999) || (m_mode == Mode::HighPass && m_cutoff <= 0.001);
+}
+
+void CascadedSvf::updateCoefficients()
+{
+    // Zero-Delay Feedback State Variable Filter
+    // Stable for all frequencies up to Nyquist
+    const double maxFreq = std::min(20000.0, m_sampleRate * 0.49);
+    const double freq = 20.0 * std::exp2(m_cutoff * std::log2(maxFreq / 20.0));
+    m_g = std::tan(std::numbers::pi * freq / m_sampleRate);
+    m_k = 2.0 * (1.0 - m_resonance);
+    m_damping = 1.0 / (1.0 + m_g * (m_g + m_k));
+
+    m_lastCutoff = m_cutoff;
+    m_lastResonance = m_resonance;
+    m_lastSampleRate = m_sampleRate;
+}
+
 void CascadedSvf::setMode(Mode mode)
 {
     m_mode = mode;
@@ -41,32 +96,35 @@ void CascadedSvf::setOrder(int order)
     m_order = (order == 2) ? 2 : 4;
 }
 
-double CascadedSvf::process(double input)
+CascadedSvf::Coefficients CascadedSvf::nextCoefficients()
 {
-    if (m_mode == Mode::LowPass && m_cutoff >= 0.999) {
-        return input;
-    }
-    if (m_mode == Mode::HighPass && m_cutoff <= 0.001) {
-        return input;
+    if (bypassed()) {
+        return {};
     }
 
-    // Zero-Delay Feedback State Variable Filter
-    // Stable for all frequencies up to Nyquist
-    if (std::abs(m_cutoff - m_lastCutoff) > 0.000001 || std::abs(m_resonance - m_lastResonance) > 0.000001 || std::abs(m_sampleRate - m_lastSampleRate) > 0.1) {
-        const double maxFreq = std::min(20000.0, m_sampleRate * 0.49);
-        const double freq = 20.0 * std::exp2(m_cutoff * std::log2(maxFreq / 20.0));
-        m_g = std::tan(std::numbers::pi * freq / m_sampleRate);
-        m_k = 2.0 * (1.0 - m_resonance);
+    if (m_rampRemaining) {
+        // The last step lands on the target exactly, so the rounding does not add up.
+        const bool last = --m_rampRemaining == 0;
+        m_g = last ? m_gTarget : m_g + m_gStep;
+        m_k = last ? m_kTarget : m_k + m_kStep;
         m_damping = 1.0 / (1.0 + m_g * (m_g + m_k));
+    } else if (std::abs(m_cutoff - m_lastCutoff) > 0.000001 || std::abs(m_resonance - m_lastResonance) > 0.000001 || std::abs(m_sampleRate - m_lastSampleRate) > 0.1) {
+        updateCoefficients();
+    }
+
+    return { m_g, m_damping, m_k, false };
+}
 
-        m_lastCutoff = m_cutoff;
-        m_lastResonance = m_resonance;
-        m_lastSampleRate = m_sampleRate;
+double CascadedSvf::process(double input)
+{
+    const auto coefficients = nextCoefficients();
+    if (coefficients.bypassed) {
+        return input;
     }
 
-    double out = m_unit1.process(input, m_g, m_damping, m_k, m_mode);
+    double out = m_unit1.process(input, coefficients.g, coefficients.damping, coefficients.k, m_mode);
     if (m_order == 4) {
-        out = m_unit2.process(out, m_g, m_damping, m_k, m_mode);
+        out = m_unit2.process(out, coefficients.g, coefficients.damping, coefficients.k, m_mode);
     }
 
     // NaN protection
@@ -16,6 +16,7 @@
 #ifndef CASCADED_SVF_HPP
 #define CASCADED_SVF_HPP
 
+#include <cstddef>
 #include <cstdint>
 
 #include "dsp_component.hpp"
@@ -35,13 +36,33 @@ public:
 
     void setCutoff(double cutoff); // 0.0 to 1.0
     void setResonance(double resonance); // 0.0 to 1.0
+    //! Moves to the given cutoff and resonance in a straight line over the next @p samples. The line
+    //! runs through the coefficients, not the parameters, so a modulated cutoff costs its exp2 and
+    //! tan once per control step rather than once per sample. Zero samples jumps there.
+    void rampTo(double cutoff, double resonance, size_t samples);
     void setMode(Mode mode);
     void setOrder(int order); // 2 or 4 (default)
 
+    //! What process() filters one sample with.
+    struct Coefficients
+    {
+        double g { 0.0 };
+        double damping { 0.0 };
+        double k { 0.0 };
+        //! The input passes through untouched, and the filter state with it.
+        bool bypassed { true };
+    };
+
+    //! The coefficient half of process(): steps the ramp or picks up a changed parameter, and
+    //! returns what this sample is filtered with. For running the filter itself in a bank.
+    Coefficients nextCoefficients();
+
     double process(double input);
     void reset();
 
 private:
+    friend class CascadedSvfBank;
+
     double m_cutoff { 1.0 };
     double m_resonance { 0.0 };
     Mode m_mode { Mode::LowPass };
@@ -54,6 +75,17 @@ private:
     double m_damping { 0.0 };
     double m_k { 0.0 };
 
+    double m_gTarget { 0.0 };
+    double m_kTarget { 0.0 };
+    double m_gStep { 0.0 };
+    double m_kStep { 0.0 };
+    size_t m_rampRemaining { 0 };
+
+    bool bypassed() const;
+    void updateCoefficients();
+    //! A parameter set directly overrides any ramp in flight, and the coefficients it left behind.
+    void cancelRamp();
+
     struct SvfUnit
     {
         double s1 = 0.0, s2 = 0.0;
@@ -0,0 +1,146 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "cascaded_svf_bank.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace noteahead {
+
+namespace {
+
+//! The output SvfUnit::process() picks for the mode, fixed at compile time so the lane loop has no
+//! branch left in it to stop it vectorising.
+template<CascadedSvf::Mode mode>
+double unitOutput(double lp, double hp, double bp)
+{
+    if constexpr (mode == CascadedSvf::Mode::LowPass) {
+        return lp;
+    } else if constexpr (mode == CascadedSvf::Mode::HighPass) {
+        return hp;
+    } else if constexpr (mode == CascadedSvf::Mode::BandPass) {
+        return bp;
+    } else {
+        return lp + hp;
+    }
+}
+
+} // namespace
+
+void CascadedSvfBank::run(std::span<CascadedSvf * const> filters, size_t frames)
+{
+    const size_t lanes = std::min(filters.size(), MaxLanes);
+    if (!lanes || !m_filtering) {
+        return;
+    }
+    m_filtering = false;
+
+    for (size_t lane = 0; lane < lanes; lane++) {
+        m_s1a[lane] = filters[lane]->m_unit1.s1;
+        m_s2a[lane] = filters[lane]->m_unit1.s2;
+        m_s1b[lane] = filters[lane]->m_unit2.s1;
+        m_s2b[lane] = filters[lane]->m_unit2.s2;
+    }
+
+    const bool fourthOrder = filters.front()->m_order == 4;
+    frames = std::min(frames, MaxFrames);
+    switch (filters.front()->m_mode) {
+    case CascadedSvf::Mode::LowPass:
+        fourthOrder ? runLanes<CascadedSvf::Mode::LowPass, true>(frames) : runLanes<CascadedSvf::Mode::LowPass, false>(frames);
+        break;
+    case CascadedSvf::Mode::HighPass:
+        fourthOrder ? runLanes<CascadedSvf::Mode::HighPass, true>(frames) : runLanes<CascadedSvf::Mode::HighPass, false>(frames);
+        break;
+    case CascadedSvf::Mode::BandPass:
+        fourthOrder ? runLanes<CascadedSvf::Mode::BandPass, true>(frames) : runLanes<CascadedSvf::Mode::BandPass, false>(frames);
+        break;
+    case CascadedSvf::Mode::Notch:
+        fourthOrder ? runLanes<CascadedSvf::Mode::Notch, true>(frames) : runLanes<CascadedSvf::Mode::Notch, false>(frames);
+        break;
+    }
+
+    for (size_t lane = 0; lane < lanes; lane++) {
+        filters[lane]->m_unit1.s1 = m_s1a[lane];
+        filters[lane]->m_unit1.s2 = m_s2a[lane];
+        filters[lane]->m_unit2.s1 = m_s1b[lane];
+        filters[lane]->m_unit2.s2 = m_s2b[lane];
+    }
+}
+
+template<CascadedSvf::Mode mode, bool fourthOrder>
+void CascadedSvfBank::runLanes(size_t frames)
+{
+    // The arithmetic is SvfUnit::process() and the tail of CascadedSvf::process() verbatim. Lanes
+    // nobody asked for run too, on whatever they last held, because a fixed count is what unrolls
+    // cleanly. Every lane is filtered first and the bypass and NaN checks applied after, in a loop
+    // of their own: with the two together, the compiler moves the filter under a branch on the
+    // bypass and then cannot vectorise either. The state is worked on in locals for the same
+    // reason, as a store to a member is not turned into a select.
+    auto s1aLanes = m_s1a;
+    auto s2aLanes = m_s2a;
+    auto s1bLanes = m_s1b;
+    auto s2bLanes = m_s2b;
+    for (size_t frame = 0; frame < frames; frame++) {
+        auto & samples = m_samples[frame];
+        const auto & g = m_g[frame];
+        const auto & damping = m_damping[frame];
+        const auto & k = m_k[frame];
+        const auto & bypassed = m_bypassed[frame];
+
+        Lanes s1a, s2a, s1b, s2b, out;
+        for (size_t lane = 0; lane < MaxLanes; lane++) {
+            const double hp1 = (samples[lane] - (g[lane] + k[lane]) * s1aLanes[lane] - s2aLanes[lane]) * damping[lane];
+            const double v11 = g[lane] * hp1;
+            const double bp1 = v11 + s1aLanes[lane];
+            s1a[lane] = v11 + bp1;
+            const double v21 = g[lane] * bp1;
+            const double lp1 = v21 + s2aLanes[lane];
+            s2a[lane] = v21 + lp1;
+            out[lane] = unitOutput<mode>(lp1, hp1, bp1);
+
+            if constexpr (fourthOrder) {
+                const double hp2 = (out[lane] - (g[lane] + k[lane]) * s1bLanes[lane] - s2bLanes[lane]) * damping[lane];
+                const double v12 = g[lane] * hp2;
+                const double bp2 = v12 + s1bLanes[lane];
+                s1b[lane] = v12 + bp2;
+                const double v22 = g[lane] * bp2;
+                const double lp2 = v22 + s2bLanes[lane];
+                s2b[lane] = v22 + lp2;
+                out[lane] = unitOutput<mode>(lp2, hp2, bp2);
+            } else {
+                s1b[lane] = s1bLanes[lane];
+                s2b[lane] = s2bLanes[lane];
+            }
+        }
+
+        for (size_t lane = 0; lane < MaxLanes; lane++) {
+            const bool pass = bypassed[lane] != 0.0;
+            // NaN protection: a filter that went to NaN resets both units and outputs silence.
+            const bool reset = !pass && std::isnan(out[lane]);
+            s1aLanes[lane] = reset ? 0.0 : pass ? s1aLanes[lane] : s1a[lane];
+            s2aLanes[lane] = reset ? 0.0 : pass ? s2aLanes[lane] : s2a[lane];
+            s1bLanes[lane] = reset ? 0.0 : pass ? s1bLanes[lane] : s1b[lane];
+            s2bLanes[lane] = reset ? 0.0 : pass ? s2bLanes[lane] : s2b[lane];
+            samples[lane] = reset ? 0.0 : pass ? samples[lane] : out[lane];
+        }
+    }
+    m_s1a = s1aLanes;
+    m_s2a = s2aLanes;
+    m_s1b = s1bLanes;
+    m_s2b = s2bLanes;
+}
+
+} // namespace noteahead
@@ -0,0 +1,88 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CASCADED_SVF_BANK_HPP
+#define CASCADED_SVF_BANK_HPP
+
+#include "cascaded_svf.hpp"
+
+#include <array>
+#include <cstddef>
+#include <span>
+
+namespace noteahead {
+
+//! CascadedSvfs of one mode and order run side by side, a lane each. One filter has to update its
+//! state a sample after the previous one; separate filters do not depend on each other, so here a
+//! sample of every lane goes through the units in one loop the compiler vectorises.
+//!
+//! The filters keep their parameters and ramps. The caller steps each one with nextCoefficients()
+//! at the sample it belongs to and records the result next to that sample's input; run() then takes
+//! the unit state from the filters, filters what was recorded and hands the state back. The output
+//! is what process() would have returned, sample for sample.
+class CascadedSvfBank
+{
+public:
+    static constexpr size_t MaxLanes { 8 };
+    //! Frames per run. Small enough that the recorded input and coefficients stay in L1.
+    static constexpr size_t MaxFrames { 32 };
+
+    //! The lane's input at the frame, which run() replaces with its output. Inline, as the caller
+    //! records a sample at a time.
+    double & sample(size_t frame, size_t lane)
+    {
+        return m_samples[frame][lane];
+    }
+
+    void setCoefficients(size_t frame, size_t lane, const CascadedSvf::Coefficients & coefficients)
+    {
+        m_g[frame][lane] = coefficients.g;
+        m_damping[frame][lane] = coefficients.damping;
+        m_k[frame][lane] = coefficients.k;
+        m_bypassed[frame][lane] = coefficients.bypassed ? 1.0 : 0.0;
+        m_filtering = m_filtering || !coefficients.bypassed;
+    }
+
+    //! Filters the first @p frames of lane i through filters[i].
+    void run(std::span<CascadedSvf * const> filters, size_t frames);
+
+private:
+    using Lanes = std::array<double, MaxLanes>;
+
+    template<CascadedSvf::Mode mode, bool fourthOrder>
+    void runLanes(size_t frames);
+
+    alignas(64) std::array<Lanes, MaxFrames> m_samples {};
+    alignas(64) std::array<Lanes, MaxFrames> m_g {};
+    alignas(64) std::array<Lanes, MaxFrames> m_damping {};
+    alignas(64) std::array<Lanes, MaxFrames> m_k {};
+    //! 1.0 where the filter was bypassed. A double rather than a bool so the select on it stays in
+    //! the same vector width as everything else.
+    alignas(64) std::array<Lanes, MaxFrames> m_bypassed {};
+
+    //! Whether any lane recorded since the last run is filtered at all. A bank of filters parked
+    //! at their bypass, the synth's HPF at zero being the usual one, then costs nothing to run.
+    bool m_filtering { false };
+
+    //! Unit state of each lane's filter, borrowed for the length of a run.
+    alignas(64) Lanes m_s1a {};
+    alignas(64) Lanes m_s2a {};
+    alignas(64) Lanes m_s1b {};
+    alignas(64) Lanes m_s2b {};
+};
+
+} // namespace noteahead
+
+#endif // CASCADED_SVF_BANK_HPP
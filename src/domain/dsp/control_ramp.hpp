@@ -0,0 +1,76 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CONTROL_RAMP_HPP
+#define CONTROL_RAMP_HPP
+
+#include <cstddef>
+
+namespace noteahead {
+
+//! A value computed at control rate and walked to in a straight line at audio rate.
+//!
+//! Modulation moves far slower than the audio it shapes, so a voice can afford to evaluate its
+//! envelopes, LFOs and the transcendentals they feed only every few dozen samples, as long as
+//! nothing between two evaluations steps. Defined here rather than in a .cpp for the same reason
+//! as BaseRateSource: it runs once per oversampled sample per voice.
+class ControlRamp
+{
+public:
+    //! Heads for @p target over the next @p samples. Zero samples jumps there, which is what a
+    //! note starting from nothing wants.
+    void setTarget(double target, size_t samples)
+    {
+        m_target = target;
+        if (samples == 0) {
+            m_value = target;
+            m_remaining = 0;
+            return;
+        }
+        m_step = (target - m_value) / static_cast<double>(samples);
+        m_remaining = samples;
+    }
+
+    double nextSample()
+    {
+        if (m_remaining) {
+            // The last step lands on the target exactly, so the rounding does not add up.
+            m_value = --m_remaining ? m_value + m_step : m_target;
+        }
+        return m_value;
+    }
+
+    double value() const
+    {
+        return m_value;
+    }
+
+    void reset(double value)
+    {
+        m_value = value;
+        m_target = value;
+        m_remaining = 0;
+    }
+
+private:
+    double m_value { 0.0 };
+    double m_target { 0.0 };
+    double m_step { 0.0 };
+    size_t m_remaining { 0 };
+};
+
+} // namespace noteahead
+
+#endif // CONTROL_RAMP_HPP
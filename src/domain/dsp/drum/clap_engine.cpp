@@ -26,7 +26,7 @@ static constexpr float LowPassCutoffRange { 0.44f };
 
 ClapEngine::ClapEngine()
 {
-    m_rng.seed(0);
+    m_noise.seed(0);
     m_highPassFilter.setMode(CascadedSvf::Mode::HighPass);
     m_lowPassFilter.setMode(CascadedSvf::Mode::LowPass);
     m_lowPassFilter.setOrder(2); // Gentle slope keeps some of the transient snap while darkening the body
@@ -78,7 +78,7 @@ float ClapEngine::nextSample()
 
     m_noiseBank.setOversampleFactor(oversampleFactor());
     if (m_noiseBank.needsBaseSample()) {
-        m_noiseBank.setBaseSample(m_dist(m_rng));
+        m_noiseBank.setBaseSample(m_noise.next());
     }
     const float noise { m_noiseBank.nextSample() };
     m_highPassFilter.setSampleRate(sr);
@@ -18,8 +18,8 @@
 
 #include "../base_rate_source.hpp"
 #include "../cascaded_svf.hpp"
+#include "../noise_generator.hpp"
 #include "drum_engine.hpp"
-#include <random>
 #include <vector>
 
 namespace noteahead {
@@ -48,8 +48,7 @@ private:
     float m_decay { 0.5f };
     float m_velocity { 1.0f };
 
-    std::mt19937 m_rng;
-    std::uniform_real_distribution<float> m_dist { -1.0f, 1.0f };
+    NoiseGenerator m_noise;
     //! Noise is drawn at the base rate and interpolated up, so what reaches the engine's
     //! saturation and filters is the same waveform at every oversampling factor.
     BaseRateSource m_noiseBank;
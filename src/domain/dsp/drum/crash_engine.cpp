@@ -23,7 +23,7 @@ namespace noteahead {
 
 CrashEngine::CrashEngine()
 {
-    m_rng.seed(0);
+    m_noise.seed(0);
     m_hpf.setMode(CascadedSvf::Mode::HighPass);
     m_bpf.setMode(CascadedSvf::Mode::BandPass);
     m_lpf.setMode(CascadedSvf::Mode::LowPass);
@@ -88,7 +88,7 @@ float CrashEngine::nextSample()
     const double sr { sampleRate() };
     m_noiseBank.setOversampleFactor(oversampleFactor());
     if (m_noiseBank.needsBaseSample()) {
-        m_noiseBank.setBaseSample(m_dist(m_rng));
+        m_noiseBank.setBaseSample(m_noise.next());
     }
     const float noise { m_noiseBank.nextSample() };
 
@@ -0,0 +1,161 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "drum_hit_cache.hpp"
+
+#include <algorithm>
+
+namespace noteahead {
+
+DrumHitCache::DrumHitCache(size_t capacityFrames)
+  : m_frames(std::max(capacityFrames / ChunkFrames, size_t { 1 }) * ChunkFrames)
+  , m_next(m_frames.size() / ChunkFrames)
+{
+    clear();
+}
+
+std::optional<size_t> DrumHitCache::find(const Key & key)
+{
+    for (size_t index = 0; index < m_entries.size(); index++) {
+        if (auto && entry = m_entries.at(index); entry.state == State::Complete && entry.key == key) {
+            entry.lastUse = ++m_clock;
+            return index;
+        }
+    }
+    return {};
+}
+
+std::optional<size_t> DrumHitCache::create(const Key & key)
+{
+    auto free = std::ranges::find(m_entries, State::Free, &Entry::state);
+    if (free == m_entries.end()) {
+        if (!evict()) {
+            return {};
+        }
+        free = std::ranges::find(m_entries, State::Free, &Entry::state);
+    }
+
+    *free = Entry { key, State::Rendering, true, NoChunk, NoChunk, 0, ++m_clock };
+    return static_cast<size_t>(free - m_entries.begin());
+}
+
+bool DrumHitCache::append(size_t entry, float frame)
+{
+    auto && target = m_entries.at(entry);
+    if (target.length % ChunkFrames == 0) {
+        const auto chunk = takeChunk();
+        if (!chunk) {
+            drop(entry);
+            return false;
+        }
+        if (target.lastChunk == NoChunk) {
+            target.firstChunk = *chunk;
+        } else {
+            m_next.at(target.lastChunk) = *chunk;
+        }
+        target.lastChunk = *chunk;
+    }
+
+    m_frames[static_cast<size_t>(target.lastChunk) * ChunkFrames + target.length % ChunkFrames] = frame;
+    target.length++;
+    return true;
+}
+
+void DrumHitCache::complete(size_t entry)
+{
+    m_entries.at(entry).state = State::Complete;
+}
+
+void DrumHitCache::drop(size_t entry)
+{
+    auto && target = m_entries.at(entry);
+    if (target.lastChunk != NoChunk) {
+        m_next.at(target.lastChunk) = m_freeChunks;
+        m_freeChunks = target.firstChunk;
+    }
+    target = {};
+}
+
+void DrumHitCache::hold(size_t entry)
+{
+    m_entries.at(entry).held = true;
+}
+
+void DrumHitCache::release(size_t entry)
+{
+    m_entries.at(entry).held = false;
+}
+
+const DrumHitCache::Key & DrumHitCache::key(size_t entry) const
+{
+    return m_entries.at(entry).key;
+}
+
+bool DrumHitCache::isComplete(size_t entry) const
+{
+    return m_entries.at(entry).state == State::Complete;
+}
+
+size_t DrumHitCache::length(size_t entry) const
+{
+    return m_entries.at(entry).length;
+}
+
+size_t DrumHitCache::entryCount() const
+{
+    return static_cast<size_t>(std::ranges::count_if(m_entries, [](auto && entry) { return entry.state != State::Free; }));
+}
+
+DrumHitCache::Cursor DrumHitCache::begin(size_t entry) const
+{
+    return { entry, NoChunk, 0 };
+}
+
+void DrumHitCache::clear()
+{
+    m_entries = {};
+    for (uint32_t chunk = 0; chunk < m_next.size(); chunk++) {
+        m_next.at(chunk) = chunk + 1 < m_next.size() ? chunk + 1 : NoChunk;
+    }
+    m_freeChunks = 0;
+}
+
+bool DrumHitCache::evict()
+{
+    Entry * oldest { nullptr };
+    for (auto && entry : m_entries) {
+        if (entry.state == State::Complete && !entry.held && (!oldest || entry.lastUse < oldest->lastUse)) {
+            oldest = &entry;
+        }
+    }
+    if (!oldest) {
+        return false;
+    }
+    drop(static_cast<size_t>(oldest - m_entries.data()));
+    return true;
+}
+
+std::optional<uint32_t> DrumHitCache::takeChunk()
+{
+    if (m_freeChunks == NoChunk && !evict()) {
+        return {};
+    }
+    const uint32_t chunk { m_freeChunks };
+    m_freeChunks = m_next.at(chunk);
+    m_next.at(chunk) = NoChunk;
+    return chunk;
+}
+
+} // namespace noteahead
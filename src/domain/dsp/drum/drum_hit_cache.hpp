@@ -0,0 +1,143 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DRUM_HIT_CACHE_HPP
+#define DRUM_HIT_CACHE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace noteahead {
+
+//! Whole drum hits, rendered once and kept for playing back as samples.
+//!
+//! A hit at the same parameters and rate comes out of its engine the same every time, bar the
+//! velocity it is scaled by, so the cache keeps one rendering at full velocity per Key. The frames
+//! live in one arena allocated up front, in chunks that are chained per entry, so nothing on the
+//! audio thread allocates or moves memory: an entry that needs room takes a free chunk, and when
+//! there is none the least recently used entry that no voice is holding gives its chunks back.
+//!
+//! An entry is usable while it is still being rendered. The voice that created it appends a frame
+//! for every frame it plays, so a cursor started at the hit never catches up with the end.
+class DrumHitCache
+{
+public:
+    static constexpr size_t ChunkFrames { 4096 };
+    static constexpr size_t MaxEntries { 128 };
+    static constexpr size_t MaxParameters { 8 };
+    //! 16 MiB of frames, some ninety seconds of hits at 48 kHz. Past that the least used go.
+    static constexpr size_t DefaultCapacityFrames { 4 * 1024 * 1024 };
+
+    //! Everything that decides what an engine renders, other than the velocity.
+    struct Key
+    {
+        //! Which engine, e.g. the voice index. Entries are never shared between sources.
+        int source { 0 };
+        uint32_t sampleRate { 0 };
+        uint8_t oversampleFactor { 1 };
+        std::array<float, MaxParameters> parameters {};
+
+        bool operator==(const Key & other) const = default;
+    };
+
+    //! A reader's position in an entry.
+    struct Cursor
+    {
+        size_t entry { 0 };
+        uint32_t chunk { 0 };
+        size_t position { 0 };
+    };
+
+    explicit DrumHitCache(size_t capacityFrames = DefaultCapacityFrames);
+
+    //! The complete entry for @p key, marked as just used.
+    std::optional<size_t> find(const Key & key);
+    //! A new, empty entry for @p key to be rendered into, or nothing if every slot is held.
+    std::optional<size_t> create(const Key & key);
+    //! Appends the next frame of an entry being rendered. False when no chunk can be had, in which
+    //! case the entry has been dropped and the index is no longer the caller's.
+    bool append(size_t entry, float frame);
+    //! The hit has rung out: the entry can be found from now on.
+    void complete(size_t entry);
+    //! Gives an entry back, whether it is complete or not.
+    void drop(size_t entry);
+
+    //! A held entry is never evicted. Its creator holds it from create().
+    void hold(size_t entry);
+    void release(size_t entry);
+
+    const Key & key(size_t entry) const;
+    bool isComplete(size_t entry) const;
+    //! Frames rendered so far.
+    size_t length(size_t entry) const;
+    size_t entryCount() const;
+
+    Cursor begin(size_t entry) const;
+
+    //! The frame under @p cursor, which must be short of length(), and advances it. Defined here
+    //! because it runs once per oversampled sample of every voice playing back.
+    float read(Cursor & cursor) const
+    {
+        const size_t offset { cursor.position % ChunkFrames };
+        // Looked up only now, as a chunk may not have been rendered yet when the one before it filled.
+        if (cursor.position == 0) {
+            cursor.chunk = m_entries[cursor.entry].firstChunk;
+        } else if (offset == 0) {
+            cursor.chunk = m_next[cursor.chunk];
+        }
+        cursor.position++;
+        return m_frames[static_cast<size_t>(cursor.chunk) * ChunkFrames + offset];
+    }
+
+    void clear();
+
+private:
+    static constexpr uint32_t NoChunk { UINT32_MAX };
+
+    enum class State
+    {
+        Free,
+        Rendering,
+        Complete
+    };
+
+    struct Entry
+    {
+        Key key;
+        State state { State::Free };
+        bool held { false };
+        uint32_t firstChunk { NoChunk };
+        uint32_t lastChunk { NoChunk };
+        size_t length { 0 };
+        uint64_t lastUse { 0 };
+    };
+
+    //! Frees the least recently used complete entry nobody holds. False if there is none.
+    bool evict();
+    std::optional<uint32_t> takeChunk();
+
+    std::vector<float> m_frames;
+    std::vector<uint32_t> m_next;
+    uint32_t m_freeChunks { NoChunk };
+    std::array<Entry, MaxEntries> m_entries {};
+    uint64_t m_clock { 0 };
+};
+
+} // namespace noteahead
+
+#endif // DRUM_HIT_CACHE_HPP
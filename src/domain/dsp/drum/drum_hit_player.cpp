@@ -0,0 +1,171 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "drum_hit_player.hpp"
+
+#include "drum_engine.hpp"
+
+#include <cmath>
+
+namespace noteahead {
+
+void DrumHitPlayer::trigger(DrumEngine & engine, DrumHitCache & cache, const DrumHitCache::Key & key, float velocity)
+{
+    m_retriggerOffset = m_lastOut;
+    m_velocity = velocity;
+    m_choking = false;
+    m_chokeGain = 1.0f;
+
+    // The same hit again, whether or not it has finished rendering.
+    if (m_entry && cache.key(*m_entry) == key) {
+        m_cursor = cache.begin(*m_entry);
+        m_playing = true;
+        return;
+    }
+
+    releaseEntry(cache);
+    engine.reset();
+    m_playing = false;
+    m_live = false;
+
+    if (const auto found = cache.find(key); found) {
+        m_entry = found;
+        cache.hold(*m_entry);
+    } else if (const auto created = cache.create(key); created) {
+        m_entry = created;
+        m_rendering = true;
+        engine.trigger(1.0f);
+    } else {
+        m_live = true;
+        engine.trigger(1.0f);
+        return;
+    }
+
+    m_cursor = cache.begin(*m_entry);
+    m_playing = true;
+}
+
+void DrumHitPlayer::stop(DrumEngine & engine)
+{
+    if (m_live) {
+        engine.stop();
+    } else if (m_playing && !m_choking) {
+        m_choking = true;
+        m_chokeRate = 1.0f - (1.0f / (DrumEngine::ChokeFadeSeconds * static_cast<float>(engine.sampleRate())));
+    }
+}
+
+float DrumHitPlayer::nextSample(DrumEngine & engine, DrumHitCache & cache)
+{
+    float hit { 0.0f };
+    if (m_rendering) {
+        const float frame { engine.nextSample() };
+        if (!cache.append(*m_entry, frame)) {
+            // Out of room, and the entry has gone with it. Whatever is still playing goes on live.
+            m_entry.reset();
+            m_rendering = false;
+            m_live = m_playing;
+            m_playing = false;
+            if (m_live) {
+                hit = frame;
+                if (m_choking) {
+                    engine.stop();
+                }
+            } else {
+                engine.reset();
+            }
+        } else if (!engine.isActive()) {
+            cache.complete(*m_entry);
+            m_rendering = false;
+        }
+    } else if (m_live) {
+        m_live = engine.isActive();
+        hit = m_live ? engine.nextSample() : 0.0f;
+    }
+
+    if (m_playing) {
+        if (m_cursor.position < cache.length(*m_entry)) {
+            hit = cache.read(m_cursor);
+        } else {
+            m_playing = false;
+        }
+        if (m_choking) {
+            m_chokeGain *= m_chokeRate;
+            m_playing = m_playing && m_chokeGain >= DrumEngine::AmplitudeThreshold;
+        }
+    }
+
+    const float out { hit * m_chokeGain * m_velocity + m_retriggerOffset };
+
+    // As the engines smooth their own retriggers.
+    m_retriggerOffset *= 0.95f;
+    if (std::abs(m_retriggerOffset) < DrumEngine::AmplitudeThreshold) {
+        m_retriggerOffset = 0.0f;
+    }
+
+    m_lastOut = out;
+    return out;
+}
+
+bool DrumHitPlayer::isActive(const DrumEngine & engine) const
+{
+    return m_playing || m_rendering || (m_live && engine.isActive()) || m_retriggerOffset != 0.0f;
+}
+
+void DrumHitPlayer::invalidate(DrumEngine & engine, DrumHitCache & cache)
+{
+    if (!m_rendering) {
+        return;
+    }
+
+    cache.drop(*m_entry);
+    m_entry.reset();
+    m_rendering = false;
+    m_live = m_playing;
+    m_playing = false;
+    if (!m_live) {
+        engine.reset();
+    } else if (m_choking) {
+        engine.stop();
+    }
+}
+
+void DrumHitPlayer::reset(DrumEngine & engine, DrumHitCache & cache)
+{
+    releaseEntry(cache);
+    engine.reset();
+    m_playing = false;
+    m_live = false;
+    m_choking = false;
+    m_chokeGain = 1.0f;
+    m_retriggerOffset = 0.0f;
+    m_lastOut = 0.0f;
+}
+
+void DrumHitPlayer::releaseEntry(DrumHitCache & cache)
+{
+    if (!m_entry) {
+        return;
+    }
+    if (m_rendering) {
+        cache.drop(*m_entry);
+    } else {
+        cache.release(*m_entry);
+    }
+    m_entry.reset();
+    m_rendering = false;
+}
+
+} // namespace noteahead
@@ -0,0 +1,71 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DRUM_HIT_PLAYER_HPP
+#define DRUM_HIT_PLAYER_HPP
+
+#include "drum_hit_cache.hpp"
+
+#include <optional>
+
+namespace noteahead {
+
+class DrumEngine;
+
+//! Plays one voice's hits from a DrumHitCache, standing in for calling its engine directly.
+//!
+//! A hit already in the cache is read back and scaled by the velocity. One that is not has the
+//! engine render it at full velocity into a new entry, a frame per frame played, and is read back
+//! from there too, so the next hit with the same key finds it. The rendering carries on to the end
+//! of the hit even when the voice is retriggered or choked in the meantime, as those only change
+//! what is read back.
+//!
+//! When there is no room in the cache the engine is simply played live. The engine's own retrigger
+//! smoothing only knows about its own output, so the player does the same for what it played last.
+class DrumHitPlayer
+{
+public:
+    void trigger(DrumEngine & engine, DrumHitCache & cache, const DrumHitCache::Key & key, float velocity);
+    //! Fades the hit out, as a choke does.
+    void stop(DrumEngine & engine);
+    float nextSample(DrumEngine & engine, DrumHitCache & cache);
+    bool isActive(const DrumEngine & engine) const;
+
+    //! The key no longer describes the engine. A hit still being rendered goes on live as the
+    //! engine now sounds, and the half-rendered entry is dropped.
+    void invalidate(DrumEngine & engine, DrumHitCache & cache);
+    //! Silences the voice and lets go of its entry.
+    void reset(DrumEngine & engine, DrumHitCache & cache);
+
+private:
+    void releaseEntry(DrumHitCache & cache);
+
+    std::optional<size_t> m_entry;
+    bool m_rendering { false };
+    bool m_playing { false };
+    bool m_live { false };
+    DrumHitCache::Cursor m_cursor;
+
+    float m_velocity { 1.0f };
+    bool m_choking { false };
+    float m_chokeGain { 1.0f };
+    float m_chokeRate { 1.0f };
+    float m_retriggerOffset { 0.0f };
+    float m_lastOut { 0.0f };
+};
+
+} // namespace noteahead
+
+#endif // DRUM_HIT_PLAYER_HPP
@@ -15,6 +15,8 @@
 
 #include "hihat_engine.hpp"
 
+#include "../fast_math.hpp"
+
 #include <algorithm>
 #include <cmath>
 
@@ -22,7 +24,7 @@ namespace noteahead {
 
 HiHatEngine::HiHatEngine()
 {
-    m_rng.seed(0);
+    m_noise.seed(0);
     m_filter.setMode(CascadedSvf::Mode::HighPass);
     m_bodyFilter.setMode(CascadedSvf::Mode::BandPass);
 }
@@ -85,7 +87,7 @@ float HiHatEngine::nextSample()
 
     m_noiseBank.setOversampleFactor(oversampleFactor());
     if (m_noiseBank.needsBaseSample()) {
-        m_noiseBank.setBaseSample(m_dist(m_rng));
+        m_noiseBank.setBaseSample(m_noise.next());
     }
     const float noise { m_noiseBank.nextSample() };
 
@@ -107,7 +109,7 @@ float HiHatEngine::nextSample()
 
     // Sum and saturate for "body" and warmth (909-style)
     float mixed = (m_filter.process(source) + bodyOut);
-    float out = std::tanh(mixed * 1.4f) * m_ampEnv * m_attackEnv * m_velocity * 1.1f;
+    float out = FastMath::tanh(mixed * 1.4f) * m_ampEnv * m_attackEnv * m_velocity * 1.1f;
 
     const float attackRate { 1.0f / (0.0005f * static_cast<float>(sampleRate())) };
     m_attackEnv = std::min(1.0f, m_attackEnv + attackRate);
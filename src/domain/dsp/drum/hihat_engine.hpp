@@ -18,9 +18,9 @@
 
 #include "../base_rate_source.hpp"
 #include "../cascaded_svf.hpp"
+#include "../noise_generator.hpp"
 #include "drum_engine.hpp"
 #include <array>
-#include <random>
 
 namespace noteahead {
 
@@ -53,8 +53,7 @@ private:
     float m_resonance { 0.3f };
     float m_velocity { 1.0f };
 
-    std::mt19937 m_rng;
-    std::uniform_real_distribution<float> m_dist { -1.0f, 1.0f };
+    NoiseGenerator m_noise;
     CascadedSvf m_filter;
     CascadedSvf m_bodyFilter;
 
@@ -15,6 +15,8 @@
 
 #include "kick_808_engine.hpp"
 
+#include "../fast_math.hpp"
+
 #include <algorithm>
 #include <cmath>
 #include <numbers>
@@ -262,9 +264,9 @@ float Kick808Engine::nextSample()
     // The pitch envelope rides on top of the glided frequency.
     const double sweptFrequency = m_currentFrequency * (1.0 + static_cast<double>(m_pitchDepth) * PitchDepthRange * static_cast<double>(m_pitchEnv));
     // Keep the rotation inside the unit circle's stable region even if a caller asks for a silly note.
-    const double omega = 2.0 * std::numbers::pi * std::clamp(sweptFrequency, 1.0, sr * 0.45) / sr;
-    const double cosOmega = std::cos(omega);
-    const double sinOmega = std::sin(omega);
+    const double cycles = std::clamp(sweptFrequency, 1.0, sr * 0.45) / sr;
+    const double cosOmega = FastMath::cos2pi(cycles);
+    const double sinOmega = FastMath::sin2pi(cycles);
 
     // Drive the resonator with the excitation pulse, then rotate and damp it.
     const double excitation = static_cast<double>(m_pulseEnv) * static_cast<double>(m_velocity) * m_excitationGain * m_excitationCompensation;
@@ -305,7 +307,7 @@ float Kick808Engine::nextSample()
     // Saturation stays fully bypassed at zero drive, so the clean tail is bit-for-bit unaffected.
     if (m_drive > 0.0f) {
         const double gain = 1.0 + static_cast<double>(m_drive) * 24.0;
-        const double saturated = std::tanh(out * gain) / std::tanh(gain) * DriveCeiling;
+        const double saturated = FastMath::tanh(out * gain) / std::tanh(gain) * DriveCeiling;
         out += (saturated - out) * static_cast<double>(m_drive);
     }
 
@@ -15,15 +15,15 @@
 
 #include "kick_engine.hpp"
 
+#include "../fast_math.hpp"
+
 #include <algorithm>
 #include <cmath>
-#include <numbers>
 
 namespace noteahead {
 
 KickEngine::KickEngine()
 {
-    m_rng.seed(0);
     m_noiseFilter.setMode(CascadedSvf::Mode::HighPass);
 }
 
@@ -66,7 +66,7 @@ float KickEngine::nextSample()
     const double clickEndFreq = 100.0;
     const double clickFreq = clickEndFreq + (clickStartFreq - clickEndFreq) * m_clickEnv * m_clickEnv * m_clickEnv;
     const double clickPhaseStep = clickFreq / sr;
-    const float clickOsc { static_cast<float>(std::sin(m_clickPhase * 2.0 * std::numbers::pi)) };
+    const float clickOsc { static_cast<float>(FastMath::sin2pi(m_clickPhase)) };
     m_clickPhase += clickPhaseStep;
     if (m_clickPhase >= 1.0)
         m_clickPhase -= 1.0;
@@ -75,7 +75,7 @@ float KickEngine::nextSample()
     const float click { clickOsc * m_clickEnv * m_attack * 0.35f };
 
     // Sine Component
-    const float sine { static_cast<float>(std::sin(m_phase * 2.0 * std::numbers::pi)) * 0.65f };
+    const float sine { static_cast<float>(FastMath::sin2pi(m_phase)) * 0.65f };
     m_phase += phaseStep;
     if (m_phase >= 1.0)
         m_phase -= 1.0;
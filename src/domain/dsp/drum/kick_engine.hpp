@@ -18,7 +18,6 @@
 
 #include "../cascaded_svf.hpp"
 #include "drum_engine.hpp"
-#include <random>
 
 namespace noteahead {
 
@@ -68,8 +67,6 @@ private:
     double m_lastSampleRate { 0.0 };
     bool m_stopping { false };
 
-    std::mt19937 m_rng;
-    std::uniform_real_distribution<float> m_dist { -1.0f, 1.0f };
     CascadedSvf m_noiseFilter;
 };
 
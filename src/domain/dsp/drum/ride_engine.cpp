@@ -22,7 +22,7 @@ namespace noteahead {
 
 RideEngine::RideEngine()
 {
-    m_rng.seed(0);
+    m_noise.seed(0);
     m_filter.setMode(CascadedSvf::Mode::HighPass);
 }
 
@@ -66,7 +66,7 @@ float RideEngine::nextSample()
     const double sr { sampleRate() };
     m_noiseBank.setOversampleFactor(oversampleFactor());
     if (m_noiseBank.needsBaseSample()) {
-        m_noiseBank.setBaseSample(m_dist(m_rng));
+        m_noiseBank.setBaseSample(m_noise.next());
     }
     const float noise { m_noiseBank.nextSample() };
 
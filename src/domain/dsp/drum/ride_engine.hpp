@@ -18,10 +18,10 @@
 
 #include "../base_rate_source.hpp"
 #include "../cascaded_svf.hpp"
+#include "../noise_generator.hpp"
 #include "drum_engine.hpp"
 
 #include <array>
-#include <random>
 
 namespace noteahead {
 
@@ -51,8 +51,7 @@ private:
     float m_resonance { 0.3f };
     float m_velocity { 1.0f };
 
-    std::mt19937 m_rng;
-    std::uniform_real_distribution<float> m_dist { -1.0f, 1.0f };
+    NoiseGenerator m_noise;
     CascadedSvf m_filter;
 
     //! Bank of square oscillators, run at the base rate so it is oversampling-independent.
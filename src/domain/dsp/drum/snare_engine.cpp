@@ -23,7 +23,7 @@ namespace noteahead {
 
 SnareEngine::SnareEngine()
 {
-    m_rng.seed(0);
+    m_noise.seed(0);
     m_noiseFilter.setMode(CascadedSvf::Mode::BandPass);
 }
 
@@ -36,8 +36,8 @@ void SnareEngine::trigger(float velocity)
     m_tonalEnv = 1.0f;
     m_pitchEnv = 1.0f;
     m_stopping = false;
-    m_tonalPhase1 = std::uniform_real_distribution<double>(0.0, 1.0)(m_rng);
-    m_tonalPhase2 = std::uniform_real_distribution<double>(0.0, 1.0)(m_rng);
+    m_tonalPhase1 = m_noise.nextUnipolar();
+    m_tonalPhase2 = m_noise.nextUnipolar();
     m_active = true;
     m_noiseBank.reset();
     m_noiseFilter.reset();
@@ -92,7 +92,7 @@ float SnareEngine::nextSample()
     // Noise part (Snappy bump 2000-12000 Hz)
     m_noiseBank.setOversampleFactor(oversampleFactor());
     if (m_noiseBank.needsBaseSample()) {
-        m_noiseBank.setBaseSample(m_dist(m_rng));
+        m_noiseBank.setBaseSample(m_noise.next());
     }
     const float noise { m_noiseBank.nextSample() };
     const auto filteredNoise = static_cast<float>(m_noiseFilter.process(noise));
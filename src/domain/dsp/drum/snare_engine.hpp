@@ -18,8 +18,8 @@
 
 #include "../base_rate_source.hpp"
 #include "../cascaded_svf.hpp"
+#include "../noise_generator.hpp"
 #include "drum_engine.hpp"
-#include <random>
 
 namespace noteahead {
 
@@ -65,8 +65,7 @@ private:
     double m_lastSampleRate { 0.0 };
     bool m_stopping { false };
 
-    std::mt19937 m_rng;
-    std::uniform_real_distribution<float> m_dist { -1.0f, 1.0f };
+    NoiseGenerator m_noise;
     //! Noise is drawn at the base rate and interpolated up, so what reaches the engine's
     //! saturation and filters is the same waveform at every oversampling factor.
     BaseRateSource m_noiseBank;
@@ -0,0 +1,217 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef FAST_MATH_HPP
+#define FAST_MATH_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+//! Transcendental functions for per-sample DSP: a range reduction and a short polynomial each, with
+//! no branches and no tables, so they inline into a render loop and a loop over a buffer turns into
+//! vector code without leaning on the C library's vector variants.
+//!
+//! The polynomials are cut off where they stop mattering for audio rather than at the last bit:
+//! - double: exp2(), pitchRatio() relative error below 5e-10; log2() absolute error below 5e-11;
+//!   sin2pi(), cos2pi(), sin(), cos(), tanh() absolute error below 1e-9
+//! - float: all of them within 1e-6, the last few bits of a float
+//!
+//! 1e-9 is -180 dB, far below the resolution of a 24-bit render, but not what std:: returns bit for
+//! bit, so anything that must stay sample-exact against an old render keeps the std:: function.
+//! Nothing here sets errno or handles NaN: inputs are expected to be finite. fast_math_test checks
+//! the bounds over the whole range of each function.
+//!
+//! One call at a time, the C library's table-driven exp2() is still the faster of the two; exp2()
+//! here pays off in the batch form and inside tanh().
+namespace noteahead::FastMath {
+
+namespace Detail {
+
+//! Taylor coefficients of 2^f, for |f| <= 1/2.
+inline constexpr std::array<double, 9> Exp2 {
+    1.0, 0.69314718055994529, 0.24022650695910072, 0.055504108664821583, 0.0096181291076284769,
+    0.0013333558146428443, 0.00015403530393381609, 1.5252733804059841e-05, 1.321548679014431e-06
+};
+
+//! Taylor coefficients of sin(2 pi r) in odd powers of r, for |r| <= 1/4.
+inline constexpr std::array<double, 7> Sin2Pi {
+    6.2831853071795862, -41.341702240399762, 81.605249276075057, -76.705859753061389,
+    42.058693944897655, -15.09464257682299, 3.819952584848282
+};
+
+//! log2(m) = 2 / ln 2 * atanh(s) with s = (m - 1) / (m + 1), in odd powers of s, for |s| <= 0.172.
+inline constexpr std::array<double, 6> Log2 {
+    2.8853900817779268, 0.96179669392597555, 0.57707801635558531, 0.41219858311113239,
+    0.3205988979753252, 0.26230818925253879
+};
+
+//! Float needs fewer terms for its own precision, which is most of what it saves.
+template<std::floating_point T>
+inline constexpr bool IsFloat = std::is_same_v<T, float>;
+
+template<std::floating_point T>
+using Bits = std::conditional_t<IsFloat<T>, uint32_t, uint64_t>;
+
+template<std::floating_point T>
+inline constexpr int MantissaBits = std::numeric_limits<T>::digits - 1;
+
+template<std::floating_point T>
+inline constexpr int ExponentBias = std::numeric_limits<T>::max_exponent - 1;
+
+//! Evaluates the first Terms coefficients as two interleaved halves in x^2, which halves the chain
+//! of dependent multiply-adds that a scalar call inside a feedback loop waits on.
+template<size_t Terms, std::floating_point T, size_t N>
+T polynomial(const std::array<double, N> & coefficients, T x)
+{
+    static_assert(Terms >= 2 && Terms <= N);
+    const T x2 = x * x;
+    constexpr size_t last = Terms - 1;
+    auto even = static_cast<T>(coefficients[last - last % 2]);
+    auto odd = static_cast<T>(coefficients[last - (last + 1) % 2]);
+    for (size_t i = last - last % 2; i >= 2; i -= 2) {
+        even = even * x2 + static_cast<T>(coefficients[i - 2]);
+    }
+    for (size_t i = last - (last + 1) % 2; i >= 3; i -= 2) {
+        odd = odd * x2 + static_cast<T>(coefficients[i - 2]);
+    }
+    return even + x * odd;
+}
+
+} // namespace Detail
+
+//! 2^x. Saturates to the smallest normal below the exponent range and to 2^max above it.
+template<std::floating_point T>
+T exp2(T x)
+{
+    using namespace Detail;
+    x = std::clamp(x, static_cast<T>(1 - ExponentBias<T>), static_cast<T>(ExponentBias<T>));
+    const T whole = std::round(x);
+    const T fraction = x - whole;
+
+    // Adding 1.5 * 2^mantissa leaves the integer in the low mantissa bits, from where it shifts
+    // straight into the exponent field. A float-to-int conversion would do the same, but for double
+    // it has no vector instruction before AVX-512.
+    constexpr T Shift = static_cast<T>(Bits<T> { 3 } << (MantissaBits<T> - 1)) + ExponentBias<T>;
+    const auto scale = std::bit_cast<T>(static_cast<Bits<T>>(std::bit_cast<Bits<T>>(whole + Shift) << MantissaBits<T>));
+    return polynomial<IsFloat<T> ? 7 : 9>(Exp2, fraction) * scale;
+}
+
+//! e^x, for the one-pole coefficients and the like.
+template<std::floating_point T>
+T exp(T x)
+{
+    return exp2(x * static_cast<T>(1.4426950408889634));
+}
+
+//! The frequency ratio of an interval in semitones.
+template<std::floating_point T>
+T pitchRatio(T semitones)
+{
+    return exp2(semitones / static_cast<T>(12));
+}
+
+//! log2(x) for a positive, normal x.
+template<std::floating_point T>
+T log2(T x)
+{
+    using namespace Detail;
+    constexpr Bits<T> MantissaMask = (Bits<T> { 1 } << MantissaBits<T>) - 1;
+    const auto bits = std::bit_cast<Bits<T>>(x);
+    auto exponent = static_cast<T>(static_cast<int>(bits >> MantissaBits<T>) - ExponentBias<T>);
+    T mantissa = std::bit_cast<T>((bits & MantissaMask) | std::bit_cast<Bits<T>>(T { 1 }));
+
+    // Centred on 1 so that the series converges fast from both sides.
+    const bool high = mantissa > static_cast<T>(1.4142135623730951);
+    mantissa = high ? mantissa * static_cast<T>(0.5) : mantissa;
+    exponent = high ? exponent + 1 : exponent;
+
+    const T s = (mantissa - 1) / (mantissa + 1);
+    return exponent + s * polynomial<IsFloat<T> ? 4 : 6>(Log2, s * s);
+}
+
+//! sin(2 pi x): x in cycles, the way the oscillators keep their phase.
+template<std::floating_point T>
+T sin2pi(T x)
+{
+    T r = x - std::round(x);
+
+    // Folded into [-1/4, 1/4] about the peak, where the series is short.
+    const T folded = std::copysign(static_cast<T>(0.5), r) - r;
+    r = std::abs(r) > static_cast<T>(0.25) ? folded : r;
+    return r * Detail::polynomial<Detail::IsFloat<T> ? 6 : 7>(Detail::Sin2Pi, r * r);
+}
+
+//! cos(2 pi x), x in cycles.
+template<std::floating_point T>
+T cos2pi(T x)
+{
+    return sin2pi(x + static_cast<T>(0.25));
+}
+
+template<std::floating_point T>
+T sin(T radians)
+{
+    return sin2pi(radians * static_cast<T>(0.15915494309189535));
+}
+
+template<std::floating_point T>
+T cos(T radians)
+{
+    return cos2pi(radians * static_cast<T>(0.15915494309189535));
+}
+
+template<std::floating_point T>
+T tanh(T x)
+{
+    // Past 20, 1 - tanh is below the last bit of either type.
+    const T e = exp2(std::min(std::abs(x), static_cast<T>(20)) * static_cast<T>(-2.8853900817779268));
+    return std::copysign((1 - e) / (1 + e), x);
+}
+
+//! In-place batch forms, for buffers that go through a function in one pass.
+template<std::floating_point T>
+void exp2(std::span<T> values)
+{
+    for (auto && value : values) {
+        value = exp2(value);
+    }
+}
+
+template<std::floating_point T>
+void sin2pi(std::span<T> values)
+{
+    for (auto && value : values) {
+        value = sin2pi(value);
+    }
+}
+
+template<std::floating_point T>
+void tanh(std::span<T> values)
+{
+    for (auto && value : values) {
+        value = tanh(value);
+    }
+}
+
+} // namespace noteahead::FastMath
+
+#endif // FAST_MATH_HPP
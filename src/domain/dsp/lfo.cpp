@@ -76,8 +76,8 @@ void Lfo::reset()
     m_phase = 0.0;
     m_oneShotActive = true;
     m_oneShotHold = 0.0;
-    m_rng.seed(0);
-    m_randomValue = m_dist(m_rng);
+    m_noise.seed(0);
+    m_randomValue = static_cast<double>(m_noise.next());
 }
 
 double Lfo::waveformValue(double phase) const
@@ -117,7 +117,7 @@ double Lfo::nextSample()
             m_oneShotHold = waveformValue(1.0);
             value = m_oneShotHold;
         } else if (m_waveform == Waveform::Random) {
-            m_randomValue = m_dist(m_rng);
+            m_randomValue = static_cast<double>(m_noise.next());
         }
     }
 
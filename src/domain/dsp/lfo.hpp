@@ -17,8 +17,8 @@
 #define LFO_HPP
 
 #include "dsp_component.hpp"
+#include "noise_generator.hpp"
 
-#include <random>
 #include <string>
 #include <vector>
 
@@ -68,8 +68,7 @@ private:
     double m_oneShotHold { 0.0 };
 
     double m_randomValue { 0.0 };
-    std::mt19937 m_rng { 0 };
-    std::uniform_real_distribution<double> m_dist { -1.0, 1.0 };
+    NoiseGenerator m_noise;
 
     void updatePhaseStep();
 
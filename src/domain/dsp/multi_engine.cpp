@@ -23,11 +23,7 @@
 
 namespace noteahead {
 
-MultiEngine::MultiEngine()
-  : m_rng(0)
-  , m_dist(-1.0f, 1.0f)
-{
-}
+MultiEngine::MultiEngine() = default;
 
 void MultiEngine::setType(Type type)
 {
@@ -62,6 +58,7 @@ void MultiEngine::reset()
     m_lastResonance = -1.0;
     m_lastDecimRateParam = -1.0f;
     m_lastNote = 0xFF;
+    m_noise.seed(0);
 }
 
 void MultiEngine::setOversampleFactor(uint8_t factor)
@@ -71,7 +68,7 @@ void MultiEngine::setOversampleFactor(uint8_t factor)
 
 float MultiEngine::nextSample()
 {
-    float noise = m_dist(m_rng) * m_noiseGain;
+    float noise = m_noise.next() * m_noiseGain;
 
     if (m_type == Type::High) {
         // High-pass [20Hz ... 20kHz]
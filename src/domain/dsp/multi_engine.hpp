@@ -17,9 +17,9 @@
 #define MULTI_ENGINE_HPP
 
 #include <cstdint>
-#include <random>
 
 #include "dsp_component.hpp"
+#include "noise_generator.hpp"
 
 namespace noteahead {
 
@@ -53,8 +53,7 @@ private:
     float m_keyTrack { 0.0f };
     uint8_t m_note { 60 };
 
-    std::mt19937 m_rng;
-    std::uniform_real_distribution<float> m_dist;
+    NoiseGenerator m_noise;
 
     // Filter states
     double m_s1 { 0.0 };
@@ -0,0 +1,41 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "noise_generator.hpp"
+
+namespace noteahead {
+
+NoiseGenerator::NoiseGenerator(uint32_t seed)
+{
+    this->seed(seed);
+}
+
+void NoiseGenerator::seed(uint32_t seed)
+{
+    // Hashed so that neighbouring seeds start far apart in the cycle rather than one sample apart.
+    m_key = hash(seed ^ 0x9e3779b9u);
+    m_counter = 0;
+}
+
+void NoiseGenerator::fill(std::span<float> buffer)
+{
+    const uint32_t start = m_counter;
+    for (size_t i = 0; i < buffer.size(); i++) {
+        buffer[i] = sampleAt(m_key, start + static_cast<uint32_t>(i));
+    }
+    m_counter = start + static_cast<uint32_t>(buffer.size());
+}
+
+} // namespace noteahead
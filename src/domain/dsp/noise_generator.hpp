@@ -0,0 +1,87 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef NOISE_GENERATOR_HPP
+#define NOISE_GENERATOR_HPP
+
+#include <cstdint>
+#include <span>
+
+namespace noteahead {
+
+//! White noise as a hash of a sample counter rather than the output of a stateful engine.
+//!
+//! The whole state is two 32-bit words, where std::mt19937 carries 2.5 KB per instance and draws
+//! through a distribution that never vectorises. Sample n of a stream is a function of the seed and
+//! n alone, so fill() computes a whole buffer as one loop of 32-bit multiplies and shifts that the
+//! compiler turns into vector code, and the same seed gives the same noise on every run, block size
+//! and thread.
+//!
+//! The hash is Wellons' triple32, a bijection on 32 bits whose output passes as uncorrelated for
+//! consecutive inputs. A seed picks the starting point in one cycle of 2^32 samples, a little over a
+//! day at 48 kHz.
+class NoiseGenerator
+{
+public:
+    explicit NoiseGenerator(uint32_t seed = 0);
+
+    //! Restarts the stream: after this the generator produces exactly what a new one would.
+    void seed(uint32_t seed);
+
+    //! The next sample in [-1, 1).
+    //!
+    //! This and the two below are defined here rather than in the .cpp because the drum voices call
+    //! them once per sample.
+    float next()
+    {
+        return sampleAt(m_key, m_counter++);
+    }
+
+    //! The next value in [0, 1), for random phases and the like. Takes a step of the same stream.
+    double nextUnipolar()
+    {
+        return static_cast<double>(hash(m_key + m_counter++)) * 0x1p-32;
+    }
+
+    //! The value next() returns as sample counter of the stream keyed by key.
+    static float sampleAt(uint32_t key, uint32_t counter)
+    {
+        // The top 24 bits, signed, are exactly what a float holds.
+        return static_cast<float>(static_cast<int32_t>(hash(key + counter)) >> 8) * 0x1p-23f;
+    }
+
+    //! Fills the buffer with the samples next() would have returned one at a time, and moves past them.
+    void fill(std::span<float> buffer);
+
+private:
+    static uint32_t hash(uint32_t x)
+    {
+        x ^= x >> 17;
+        x *= 0xed5ad4bbu;
+        x ^= x >> 11;
+        x *= 0xac4c1b51u;
+        x ^= x >> 15;
+        x *= 0x31848babu;
+        x ^= x >> 14;
+        return x;
+    }
+
+    uint32_t m_key { 0 };
+    uint32_t m_counter { 0 };
+};
+
+} // namespace noteahead
+
+#endif // NOISE_GENERATOR_HPP
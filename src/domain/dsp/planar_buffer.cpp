@@ -0,0 +1,120 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "planar_buffer.hpp"
+
+#include <algorithm>
+#include <new>
+#include <utility>
+
+namespace noteahead {
+
+namespace {
+
+constexpr size_t FloatsPerLine { PlanarBuffer::Alignment / sizeof(float) };
+
+} // namespace
+
+PlanarBuffer::PlanarBuffer(size_t frameCount)
+{
+    reserve(frameCount);
+}
+
+PlanarBuffer::PlanarBuffer(PlanarBuffer && other) noexcept
+  : m_data { std::move(other.m_data) }
+  , m_capacity { std::exchange(other.m_capacity, 0) }
+{
+}
+
+PlanarBuffer & PlanarBuffer::operator=(PlanarBuffer && other) noexcept
+{
+    m_data = std::move(other.m_data);
+    m_capacity = std::exchange(other.m_capacity, 0);
+    return *this;
+}
+
+void PlanarBuffer::AlignedDeleter::operator()(float * data) const
+{
+    ::operator delete[](data, std::align_val_t { Alignment });
+}
+
+void PlanarBuffer::reserve(size_t frameCount)
+{
+    if (frameCount <= m_capacity) {
+        return;
+    }
+
+    const size_t capacity = (frameCount + FloatsPerLine - 1) / FloatsPerLine * FloatsPerLine;
+    auto * data = static_cast<float *>(::operator new[](capacity * 2 * sizeof(float), std::align_val_t { Alignment }));
+    std::fill(data, data + capacity * 2, 0.0f);
+    m_data.reset(data);
+    m_capacity = capacity;
+}
+
+size_t PlanarBuffer::capacity() const
+{
+    return m_capacity;
+}
+
+float * PlanarBuffer::left()
+{
+    return m_data.get();
+}
+
+float * PlanarBuffer::right()
+{
+    return m_data.get() + m_capacity;
+}
+
+const float * PlanarBuffer::left() const
+{
+    return m_data.get();
+}
+
+const float * PlanarBuffer::right() const
+{
+    return m_data.get() + m_capacity;
+}
+
+void PlanarBuffer::clear(size_t frameCount)
+{
+    const size_t count = std::min(frameCount, m_capacity);
+    std::fill(left(), left() + count, 0.0f);
+    std::fill(right(), right() + count, 0.0f);
+}
+
+void PlanarBuffer::addToInterleaved(std::span<double> interleaved, size_t frameCount) const
+{
+    const size_t count = std::min({ frameCount, m_capacity, interleaved.size() / 2 });
+    const float * l = left();
+    const float * r = right();
+    for (size_t i = 0; i < count; i++) {
+        interleaved[i * 2] += static_cast<double>(l[i]);
+        interleaved[i * 2 + 1] += static_cast<double>(r[i]);
+    }
+}
+
+void PlanarBuffer::copyFromInterleaved(std::span<const double> interleaved, size_t frameCount)
+{
+    const size_t count = std::min({ frameCount, m_capacity, interleaved.size() / 2 });
+    float * l = left();
+    float * r = right();
+    for (size_t i = 0; i < count; i++) {
+        l[i] = static_cast<float>(interleaved[i * 2]);
+        r[i] = static_cast<float>(interleaved[i * 2 + 1]);
+    }
+}
+
+} // namespace noteahead
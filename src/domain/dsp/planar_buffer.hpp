@@ -0,0 +1,77 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef PLANAR_BUFFER_HPP
+#define PLANAR_BUFFER_HPP
+
+#include <cstddef>
+#include <memory>
+#include <span>
+
+namespace noteahead {
+
+//! Stereo audio held as two separate single-precision channels, each starting on a cache line.
+//!
+//! The interleaved double buffer the engine mixes in is right for summing many lanes, and wrong for
+//! rendering: a loop over one channel strides past the other, and every sample costs twice the
+//! bytes it needs to. Here a channel is a plain contiguous float array that a compiler can vectorise
+//! without being asked, at half the cache footprint. Conversion to and from the interleaved form
+//! happens only at the boundaries, once per block.
+//!
+//! Grows but never shrinks, so sizing it once ahead of the audio thread keeps that thread free of
+//! allocation.
+class PlanarBuffer
+{
+public:
+    //! One cache line, which is also the widest vector register in use, so no vector load ever splits.
+    static constexpr size_t Alignment { 64 };
+
+    PlanarBuffer() = default;
+    explicit PlanarBuffer(size_t frameCount);
+
+    PlanarBuffer(PlanarBuffer && other) noexcept;
+    PlanarBuffer & operator=(PlanarBuffer && other) noexcept;
+
+    //! Makes room for at least frameCount frames per channel. Existing content is not preserved.
+    void reserve(size_t frameCount);
+    size_t capacity() const;
+
+    float * left();
+    float * right();
+    const float * left() const;
+    const float * right() const;
+
+    void clear(size_t frameCount);
+
+    //! Adds the first frameCount frames into an interleaved stereo buffer.
+    void addToInterleaved(std::span<double> interleaved, size_t frameCount) const;
+    //! Replaces the first frameCount frames with the content of an interleaved stereo buffer.
+    void copyFromInterleaved(std::span<const double> interleaved, size_t frameCount);
+
+private:
+    struct AlignedDeleter
+    {
+        void operator()(float * data) const;
+    };
+
+    //! Both channels in one allocation, the right one starting at m_capacity. The capacity is kept
+    //! a multiple of a cache line's worth of floats so the right channel is aligned too.
+    std::unique_ptr<float[], AlignedDeleter> m_data;
+    size_t m_capacity { 0 };
+};
+
+} // namespace noteahead
+
+#endif // PLANAR_BUFFER_HPP
@@ -0,0 +1,292 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "sinc_resampler.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+
+namespace noteahead {
+
+namespace {
+
+//! Fractional positions the table resolves between two source frames. The two rows either side
+//! are blended, so this only has to be fine enough for that blend to be linear.
+constexpr size_t Phases = 256;
+
+double sinc(double x)
+{
+    return std::abs(x) < 1.0e-12 ? 1.0 : std::sin(std::numbers::pi * x) / (std::numbers::pi * x);
+}
+
+//! Zeroth-order modified Bessel function of the first kind, by its power series.
+double besselI0(double x)
+{
+    double sum = 1.0;
+    double term = 1.0;
+    for (int k = 1; k < 32; k++) {
+        const double factor = x / (2.0 * k);
+        term *= factor * factor;
+        sum += term;
+    }
+    return sum;
+}
+
+//! Kaiser window over [0, 1]. Its beta trades stopband depth against transition width, which
+//! a fixed window cannot do for a kernel only 8 taps long.
+double kaiser(double u, double beta)
+{
+    const double x = 2.0 * u - 1.0;
+    return besselI0(beta * std::sqrt(std::max(0.0, 1.0 - x * x))) / besselI0(beta);
+}
+
+} // namespace
+
+struct SincResampler::Kernel
+{
+    size_t taps { 0 };
+    ptrdiff_t half { 0 };
+    //! The windowed sinc itself, Phases points per source frame across the kernel's whole width.
+    //! The widened kernel is read from here.
+    std::vector<float> prototype;
+    //! Phases + 1 rows of taps, one row per fractional position, each normalised to unity gain.
+    std::vector<float> rows;
+
+    Kernel(size_t tapCount, double cutoff, double beta)
+      : taps { tapCount }
+      , half { static_cast<ptrdiff_t>(tapCount / 2) }
+      , prototype(tapCount * Phases + 1)
+      , rows((Phases + 1) * tapCount)
+    {
+        // A short kernel has a wide transition band, so its cutoff sits below Nyquist far enough
+        // for the band to end there instead of folding back across it.
+        for (size_t i = 0; i < prototype.size(); i++) {
+            const double t = static_cast<double>(i) / Phases - static_cast<double>(half);
+            const double u = static_cast<double>(i) / static_cast<double>(prototype.size() - 1);
+            prototype[i] = static_cast<float>(cutoff * sinc(cutoff * t) * kaiser(u, beta));
+        }
+
+        // Tap k of row p sits (k - (half - 1)) - p / Phases frames from the read position, which
+        // always lands on a prototype point.
+        for (size_t p = 0; p <= Phases; p++) {
+            double sum = 0.0;
+            for (size_t k = 0; k < taps; k++) {
+                sum += prototype[(k + 1) * Phases - p];
+            }
+            for (size_t k = 0; k < taps; k++) {
+                rows[p * taps + k] = static_cast<float>(prototype[(k + 1) * Phases - p] / sum);
+            }
+        }
+    }
+};
+
+SincResampler::Quality SincResampler::qualityForOversampleFactor(uint8_t factor)
+{
+    if (factor >= 4) {
+        return Quality::High;
+    }
+    return factor >= 2 ? Quality::Standard : Quality::Draft;
+}
+
+size_t SincResampler::tapCount(Quality quality)
+{
+    switch (quality) {
+    case Quality::Draft:
+        return 8;
+    case Quality::High:
+        return 32;
+    default:
+        return 16;
+    }
+}
+
+const SincResampler::Kernel & SincResampler::kernel(Quality quality)
+{
+    // Roughly 50, 65 and 100 dB of stopband, each flat to well within a tenth of a dB up to
+    // 0.4 of the source rate.
+    static const std::array<Kernel, 3> kernels {
+        Kernel { tapCount(Quality::Draft), 0.80, 5.0 },
+        Kernel { tapCount(Quality::Standard), 0.90, 6.0 },
+        Kernel { tapCount(Quality::High), 0.90, 10.0 }
+    };
+    return kernels.at(static_cast<size_t>(quality));
+}
+
+SincResampler::SincResampler(Quality quality)
+  : m_stretched(static_cast<size_t>(static_cast<double>(tapCount(Quality::High)) * MaxStretch) + 2, 0.0f)
+{
+    setQuality(quality);
+}
+
+void SincResampler::setQuality(Quality quality)
+{
+    m_quality = quality;
+    m_kernel = &kernel(quality);
+}
+
+SincResampler::Quality SincResampler::quality() const
+{
+    return m_quality;
+}
+
+size_t SincResampler::render(std::span<const float> source, int channels, double & position, double step, std::span<double> left, std::span<double> right)
+{
+    if (channels == 2) {
+        return renderChannels<2>(source, position, step, left, right);
+    }
+    if (channels == 1) {
+        return renderChannels<1>(source, position, step, left, right);
+    }
+    return 0;
+}
+
+template<int Channels>
+size_t SincResampler::renderChannels(std::span<const float> source, double & position, double step, std::span<double> left, std::span<double> right)
+{
+    const auto & kernel = *m_kernel;
+    const size_t frames = source.size() / Channels;
+    const size_t outFrames = std::min(left.size(), right.size());
+    const float * data = source.data();
+    size_t written = 0;
+
+    // Like the linear interpolation before it, a voice ends once the frame after the read position
+    // is gone, so where a sample stops does not depend on the quality it is played at.
+    const auto available = [&] {
+        return position >= 0.0 && static_cast<size_t>(position) + 1 < frames;
+    };
+
+    // Unity pitch from a whole frame, which is what a sample converted at load plays most of the
+    // time: every kernel would hand back the source frames unchanged, so skip it.
+    if (step == 1.0 && position == std::floor(position)) {
+        for (; written < outFrames && available(); written++) {
+            const auto index = static_cast<size_t>(position);
+            left[written] = data[index * Channels];
+            right[written] = data[index * Channels + Channels - 1];
+            position += 1.0;
+        }
+        return written;
+    }
+
+    const auto taps = kernel.taps;
+    const auto half = kernel.half;
+    const double stretch = std::clamp(step, 1.0, MaxStretch);
+    const auto tap = [&](ptrdiff_t frame, size_t channel) {
+        return frame >= 0 && static_cast<size_t>(frame) < frames ? data[static_cast<size_t>(frame) * Channels + channel] : 0.0f;
+    };
+
+    for (; written < outFrames && available(); written++) {
+        const auto index = static_cast<size_t>(position);
+        float sumL = 0.0f;
+        float sumR = 0.0f;
+
+        if (stretch == 1.0) {
+            const double phase = (position - static_cast<double>(index)) * Phases;
+            const auto row = std::min(static_cast<size_t>(phase), Phases - 1);
+            const auto blend = static_cast<float>(phase - static_cast<double>(row));
+            const float * row0 = kernel.rows.data() + row * taps;
+            const float * row1 = row0 + taps;
+            const ptrdiff_t first = static_cast<ptrdiff_t>(index) - (half - 1);
+
+            if (first >= 0 && static_cast<size_t>(first) + taps <= frames) {
+                const float * x = data + static_cast<size_t>(first) * Channels;
+                for (size_t k = 0; k < taps; k++) {
+                    const float c = row0[k] + (row1[k] - row0[k]) * blend;
+                    sumL += c * x[k * Channels];
+                    sumR += c * x[k * Channels + Channels - 1];
+                }
+            } else {
+                for (size_t k = 0; k < taps; k++) {
+                    const float c = row0[k] + (row1[k] - row0[k]) * blend;
+                    const auto frame = first + static_cast<ptrdiff_t>(k);
+                    sumL += c * tap(frame, 0);
+                    sumR += c * tap(frame, Channels - 1);
+                }
+            }
+        } else {
+            // Pitching up: the kernel is read from the prototype compressed by the step, which
+            // widens it across that many more source frames and lowers its cutoff by as much.
+            const double scale = 1.0 / stretch;
+            const double reach = static_cast<double>(half) * stretch;
+            const auto first = static_cast<ptrdiff_t>(std::floor(position - reach)) + 1;
+            const auto count = std::min(static_cast<size_t>(std::floor(position + reach) - static_cast<double>(first)) + 1, m_stretched.size());
+            const double end = static_cast<double>(kernel.prototype.size() - 1);
+
+            for (size_t j = 0; j < count; j++) {
+                const double u = ((static_cast<double>(first + static_cast<ptrdiff_t>(j)) - position) * scale + static_cast<double>(half)) * Phases;
+                if (u < 0.0 || u >= end) {
+                    m_stretched[j] = 0.0f;
+                    continue;
+                }
+                const auto i = static_cast<size_t>(u);
+                const auto a = static_cast<float>(u - static_cast<double>(i));
+                m_stretched[j] = (kernel.prototype[i] + (kernel.prototype[i + 1] - kernel.prototype[i]) * a) * static_cast<float>(scale);
+            }
+
+            if (first >= 0 && static_cast<size_t>(first) + count <= frames) {
+                const float * x = data + static_cast<size_t>(first) * Channels;
+                for (size_t j = 0; j < count; j++) {
+                    sumL += m_stretched[j] * x[j * Channels];
+                    sumR += m_stretched[j] * x[j * Channels + Channels - 1];
+                }
+            } else {
+                for (size_t j = 0; j < count; j++) {
+                    const auto frame = first + static_cast<ptrdiff_t>(j);
+                    sumL += m_stretched[j] * tap(frame, 0);
+                    sumR += m_stretched[j] * tap(frame, Channels - 1);
+                }
+            }
+        }
+
+        left[written] = sumL;
+        right[written] = sumR;
+        position += step;
+    }
+
+    return written;
+}
+
+std::vector<float> SincResampler::convert(std::span<const float> source, int channels, double fromRate, double toRate)
+{
+    if ((channels != 1 && channels != 2) || fromRate <= 0.0 || toRate <= 0.0) {
+        return { source.begin(), source.end() };
+    }
+
+    const size_t frames = source.size() / static_cast<size_t>(channels);
+    if (frames < 2) {
+        return { source.begin(), source.end() };
+    }
+
+    const double step = fromRate / toRate;
+    const auto outFrames = static_cast<size_t>(std::ceil(static_cast<double>(frames - 1) / step));
+    std::vector<double> left(outFrames);
+    std::vector<double> right(outFrames);
+
+    SincResampler resampler { Quality::High };
+    double position = 0.0;
+    const size_t written = resampler.render(source, channels, position, step, left, right);
+
+    std::vector<float> result(written * static_cast<size_t>(channels));
+    for (size_t i = 0; i < written; i++) {
+        result[i * static_cast<size_t>(channels)] = static_cast<float>(left[i]);
+        if (channels == 2) {
+            result[i * 2 + 1] = static_cast<float>(right[i]);
+        }
+    }
+    return result;
+}
+
+} // namespace noteahead
@@ -0,0 +1,87 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef SINC_RESAMPLER_HPP
+#define SINC_RESAMPLER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace noteahead {
+
+//! Band-limited reading of a sampled sound at an arbitrary rate: a windowed-sinc kernel stored as a
+//! polyphase table, so the taps for any fractional position are a lookup rather than a sin() apiece.
+//!
+//! Two-point linear interpolation, which this replaces in the Sampler, is cheap but neither keeps
+//! the top octave nor stops anything above the new Nyquist from folding back down when a sample is
+//! pitched up. Here the kernel widens with the read step instead, so pitching up lowers the cutoff
+//! along with it, up to MaxStretch.
+//!
+//! The table rows are contiguous and the taps are summed in one pass over both channels, which is a
+//! loop the compiler vectorises; the kernel is shared by every instance of a given quality.
+class SincResampler
+{
+public:
+    enum class Quality : uint8_t
+    {
+        //! 8 taps: realtime preview at the lowest oversampling setting.
+        Draft,
+        //! 16 taps.
+        Standard,
+        //! 32 taps: export, and converting samples at load.
+        High
+    };
+
+    //! The same trade the oversampling setting already makes between realtime playback and export,
+    //! so one setting decides both.
+    static Quality qualityForOversampleFactor(uint8_t factor);
+    static size_t tapCount(Quality quality);
+
+    //! How far the kernel widens for a read step above one. Pitching up further than two octaves
+    //! lets the part above this alias rather than let one voice cost a hundred taps a frame.
+    static constexpr double MaxStretch { 4.0 };
+
+    explicit SincResampler(Quality quality = Quality::Standard);
+
+    void setQuality(Quality quality);
+    Quality quality() const;
+
+    //! Reads an interleaved mono or stereo source from @p position onwards, advancing @p step source
+    //! frames per output frame, into @p left and @p right (a mono source lands in both). Stops where
+    //! the source runs out and returns the frames written; @p position is left on the next one.
+    size_t render(std::span<const float> source, int channels, double & position, double step, std::span<double> left, std::span<double> right);
+
+    //! Converts a whole interleaved source from one rate to another, at the High quality.
+    static std::vector<float> convert(std::span<const float> source, int channels, double fromRate, double toRate);
+
+private:
+    struct Kernel;
+    static const Kernel & kernel(Quality quality);
+
+    template<int Channels>
+    size_t renderChannels(std::span<const float> source, double & position, double step, std::span<double> left, std::span<double> right);
+
+    Quality m_quality { Quality::Standard };
+    const Kernel * m_kernel { nullptr };
+    //! Coefficients of the widened kernel, worked out per frame when pitching up. Sized for the
+    //! widest kernel up front so rendering never allocates.
+    std::vector<float> m_stretched;
+};
+
+} // namespace noteahead
+
+#endif // SINC_RESAMPLER_HPP
@@ -0,0 +1,62 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "tail_tracker.hpp"
+
+#include <algorithm>
+
+namespace noteahead {
+
+void TailTracker::setLength(uint32_t samples)
+{
+    m_length = samples;
+}
+
+uint32_t TailTracker::length() const
+{
+    return m_length;
+}
+
+void TailTracker::setThreshold(double threshold)
+{
+    m_threshold = threshold;
+}
+
+double TailTracker::threshold() const
+{
+    return m_threshold;
+}
+
+void TailTracker::addBlock(double storedPeak, uint32_t frameCount)
+{
+    // The loud sample may have been the block's last, so the quiet time starts after the block.
+    if (storedPeak > m_threshold) {
+        m_quietSamples = 0;
+    } else {
+        m_quietSamples = std::min<uint64_t>(m_quietSamples + frameCount, UINT32_MAX);
+    }
+}
+
+bool TailTracker::active() const
+{
+    return m_quietSamples < m_length;
+}
+
+void TailTracker::reset()
+{
+    m_quietSamples = UINT32_MAX;
+}
+
+} // namespace noteahead
@@ -0,0 +1,61 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef TAIL_TRACKER_HPP
+#define TAIL_TRACKER_HPP
+
+#include <cstdint>
+
+namespace noteahead {
+
+//! Tells when an effect with memory, a reverb or a delay, has nothing left to say.
+//!
+//! Judging that from the output alone is unreliable: a pre-delay is silent at the output while it
+//! holds the loudest thing the effect will play. Instead the effect reports the largest magnitude it
+//! stored into its memory each block, and how long anything stored can take to come back out. Once
+//! nothing above the threshold has been stored for that long, all it still holds is below it too.
+class TailTracker
+{
+public:
+    //! -120 dBFS: far below anything audible, and far above where denormals start to cost.
+    static constexpr double DefaultThreshold { 1.0e-6 };
+
+    //! The longest anything stored can take to come back out, in samples.
+    void setLength(uint32_t samples);
+    uint32_t length() const;
+
+    void setThreshold(double threshold);
+    double threshold() const;
+
+    //! Accounts for one block, given the largest magnitude stored during it.
+    void addBlock(double storedPeak, uint32_t frameCount);
+
+    //! Whether anything above the threshold may still come out.
+    bool active() const;
+
+    //! Forgets everything stored, as the effect's own reset does.
+    void reset();
+
+private:
+    uint32_t m_length { 0 };
+    //! Since the last block that stored anything above the threshold. Starts out as long ago as it
+    //! gets, so an effect that has never been fed reads as silent.
+    uint64_t m_quietSamples { UINT32_MAX };
+    double m_threshold { DefaultThreshold };
+};
+
+} // namespace noteahead
+
+#endif // TAIL_TRACKER_HPP
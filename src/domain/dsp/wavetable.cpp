@@ -40,41 +40,105 @@ float Wavetable::getSample(double phase, double position, double frequency, doub
         return 0.0f;
     }
 
+    return read(selectMips(frequency, sampleRate), selectWaves(position), phase);
+}
+
+Wavetable::MipSelection Wavetable::selectMips(double frequency, double sampleRate) const
+{
+    if (m_mips.empty()) {
+        return {};
+    }
+
     const double nyquist = sampleRate * 0.5;
     const double f0 = nyquist / static_cast<double>(WaveSize / 2);
 
     const double level = std::log2(std::max(frequency, f0) / f0);
-    const int level1 = std::clamp(static_cast<int>(std::floor(level)), 0, static_cast<int>(m_mips.size() - 1));
-    const int level2 = std::min(level1 + 1, static_cast<int>(m_mips.size() - 1));
-    const float levelT = static_cast<float>(level - static_cast<double>(level1));
+    const int lower = std::clamp(static_cast<int>(std::floor(level)), 0, static_cast<int>(m_mips.size() - 1));
+    const int upper = std::min(lower + 1, static_cast<int>(m_mips.size() - 1));
+    return { lower, upper, static_cast<float>(level - static_cast<double>(lower)) };
+}
 
+Wavetable::WaveSelection Wavetable::selectWaves(double position)
+{
     const double scaledPos = position * static_cast<double>(NumWaves - 1);
-    const int waveIndex1 = static_cast<int>(std::floor(scaledPos));
-    const int waveIndex2 = std::min(waveIndex1 + 1, NumWaves - 1);
-    const float waveT = static_cast<float>(scaledPos - static_cast<double>(waveIndex1));
+    const int lower = static_cast<int>(std::floor(scaledPos));
+    const int upper = std::min(lower + 1, NumWaves - 1);
+    return {
+        static_cast<size_t>(lower) * (WaveSize + 1),
+        static_cast<size_t>(upper) * (WaveSize + 1),
+        static_cast<float>(scaledPos - static_cast<double>(lower))
+    };
+}
 
-    const double readPos = phase * static_cast<double>(WaveSize);
-    const int i1 = static_cast<int>(std::floor(readPos));
-    const float t = static_cast<float>(readPos - static_cast<double>(i1));
+namespace {
 
-    const auto & mip1 = m_mips[level1];
-    const size_t w1Offset = static_cast<size_t>(waveIndex1) * (WaveSize + 1);
-    const size_t w2Offset = static_cast<size_t>(waveIndex2) * (WaveSize + 1);
+float mix(float a, float b, float t)
+{
+    return a + (b - a) * t;
+}
+
+//! One mip level's reading of two waves at one point of the cycle.
+float readMip(const float * lowerWave, const float * upperWave, size_t index, float t, float waveT)
+{
+    return mix(mix(lowerWave[index], lowerWave[index + 1], t), mix(upperWave[index], upperWave[index + 1], t), waveT);
+}
+
+} // namespace
+
+float Wavetable::read(const MipSelection & mips, const WaveSelection & waves, double phase) const
+{
+    if (m_mips.empty()) {
+        return 0.0f;
+    }
 
-    const float m1w1 = std::lerp(mip1.data[w1Offset + i1], mip1.data[w1Offset + i1 + 1], t);
-    const float m1w2 = std::lerp(mip1.data[w2Offset + i1], mip1.data[w2Offset + i1 + 1], t);
-    const float m1 = std::lerp(m1w1, m1w2, waveT);
+    const double readPos = phase * static_cast<double>(WaveSize);
+    const double whole = std::floor(readPos);
+    const auto index = static_cast<size_t>(whole);
+    const auto t = static_cast<float>(readPos - whole);
 
-    if (level1 == level2) {
+    const float * mip1 = m_mips[static_cast<size_t>(mips.lower)];
+    const float m1 = readMip(mip1 + waves.lower, mip1 + waves.upper, index, t, waves.blend);
+    if (mips.lower == mips.upper) {
         return m1;
     }
 
-    const auto & mip2 = m_mips[level2];
-    const float m2w1 = std::lerp(mip2.data[w1Offset + i1], mip2.data[w1Offset + i1 + 1], t);
-    const float m2w2 = std::lerp(mip2.data[w2Offset + i1], mip2.data[w2Offset + i1 + 1], t);
-    const float m2 = std::lerp(m2w1, m2w2, waveT);
+    const float * mip2 = m_mips[static_cast<size_t>(mips.upper)];
+    return mix(m1, readMip(mip2 + waves.lower, mip2 + waves.upper, index, t, waves.blend), mips.blend);
+}
+
+void Wavetable::render(const MipSelection & mips, const WaveSelection & waves, double & phase, double phaseStep, std::span<float> output) const
+{
+    if (m_mips.empty()) {
+        std::fill(output.begin(), output.end(), 0.0f);
+        return;
+    }
 
-    return std::lerp(m1, m2, levelT);
+    // The four waves are fixed for the whole block, so they are looked up once here instead of
+    // through the mip list on every frame.
+    const float * mip1 = m_mips[static_cast<size_t>(mips.lower)];
+    const float * mip2 = m_mips[static_cast<size_t>(mips.upper)];
+    const float * lower1 = mip1 + waves.lower;
+    const float * upper1 = mip1 + waves.upper;
+    const float * lower2 = mip2 + waves.lower;
+    const float * upper2 = mip2 + waves.upper;
+    const float waveT = waves.blend;
+    const float mipT = mips.blend;
+    const bool singleMip = mips.lower == mips.upper;
+
+    for (auto && sample : output) {
+        const double readPos = phase * static_cast<double>(WaveSize);
+        const double whole = std::floor(readPos);
+        const auto index = static_cast<size_t>(whole);
+        const auto t = static_cast<float>(readPos - whole);
+
+        const float m1 = readMip(lower1, upper1, index, t, waveT);
+        sample = singleMip ? m1 : mix(m1, readMip(lower2, upper2, index, t, waveT), mipT);
+
+        phase += phaseStep;
+        if (phase >= 1.0) {
+            phase -= 1.0;
+        }
+    }
 }
 
 namespace {
@@ -127,9 +191,8 @@ void normalizeWave(float * waveData, Wavetable::Normalization normalization)
 
 } // namespace
 
-void Wavetable::addMipLevel(const SpectrumList & waveSpectra, int maxHarmonics, Normalization normalization)
+void Wavetable::addMipLevel(const SpectrumList & waveSpectra, int maxHarmonics, Normalization normalization, float * data)
 {
-    std::vector<float> data(NumWaves * (WaveSize + 1), 0.0f);
     std::vector<double> re(WaveSize);
     std::vector<double> im(WaveSize);
 
@@ -161,7 +224,7 @@ void Wavetable::addMipLevel(const SpectrumList & waveSpectra, int maxHarmonics,
 
         Fft::inverse(re.data(), im.data(), WaveSize);
 
-        float * waveData = &data[w * (WaveSize + 1)];
+        float * waveData = data + static_cast<size_t>(w) * (WaveSize + 1);
         for (int i = 0; i < WaveSize; i++) {
             waveData[i] = static_cast<float>(re[i]);
         }
@@ -171,18 +234,46 @@ void Wavetable::addMipLevel(const SpectrumList & waveSpectra, int maxHarmonics,
         // Guard point for interpolation
         waveData[WaveSize] = waveData[0];
     }
-    m_mips.push_back({ std::move(data), 0.0f });
 }
 
 Wavetable::WavetableS Wavetable::createFromSpectra(std::string name, const SpectrumList & spectra, Normalization normalization)
 {
+    const auto data = std::make_shared<std::vector<float>>(MipLevels * MipSize, 0.0f);
+    for (size_t m = 0; m < MipLevels; m++) {
+        addMipLevel(spectra, (WaveSize / 2) >> m, normalization, data->data() + m * MipSize);
+    }
+
     auto table = std::make_shared<Wavetable>(std::move(name));
-    for (int m = 0; m <= NumMips; m++) {
-        table->addMipLevel(spectra, (WaveSize / 2) >> m, normalization);
+    table->setData(*data, data);
+    return table;
+}
+
+std::span<const float> Wavetable::data() const
+{
+    return m_data;
+}
+
+Wavetable::WavetableS Wavetable::fromData(std::string name, std::span<const float> data, std::shared_ptr<const void> owner)
+{
+    if (data.empty() || data.size() % MipSize != 0) {
+        return nullptr;
     }
+
+    auto table = std::make_shared<Wavetable>(std::move(name));
+    table->setData(data, std::move(owner));
     return table;
 }
 
+void Wavetable::setData(std::span<const float> data, std::shared_ptr<const void> owner)
+{
+    m_owner = std::move(owner);
+    m_data = data;
+    m_mips.clear();
+    for (size_t offset = 0; offset < data.size(); offset += MipSize) {
+        m_mips.push_back(data.data() + offset);
+    }
+}
+
 Wavetable::SpectrumList Wavetable::classicSpectra()
 {
     SpectrumList spectra(NumWaves);
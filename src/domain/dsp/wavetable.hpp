@@ -16,7 +16,9 @@
 #ifndef WAVETABLE_HPP
 #define WAVETABLE_HPP
 
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -32,12 +34,14 @@ public:
     static constexpr int NumWaves = 64;
     static constexpr int WaveSize = 2048; // Larger size for better quality before interpolation
     static constexpr int NumMips = 10; // MIP levels for band-limiting
+    //! Levels a built set holds: the full-band one plus NumMips halvings of it.
+    static constexpr size_t MipLevels = NumMips + 1;
+    //! Floats in one mip level: every wave, each with its guard point.
+    static constexpr size_t MipSize = static_cast<size_t>(NumWaves) * (WaveSize + 1);
 
-    struct MipLevel
-    {
-        std::vector<float> data;
-        float maxFrequency;
-    };
+    //! Bump whenever a change to how sets are built changes what they contain, so that tables
+    //! cached by an older build are built again instead of read back.
+    static constexpr uint32_t GeneratorVersion = 1;
 
     //! One harmonic of one wave. Phase is in radians, with zero meaning a sine: a table that wants
     //! only amplitudes leaves it alone. Asymmetric shapes such as a pulse need it.
@@ -73,16 +77,51 @@ public:
     // frequency: used to select the correct MIP level
     float getSample(double phase, double position, double frequency, double sampleRate) const;
 
+    //! The two mip levels a frequency reads and how far it sits between them. Working this out
+    //! takes a log2, so an oscillator holds on to it until its pitch changes.
+    struct MipSelection
+    {
+        int lower = 0;
+        int upper = 0;
+        float blend = 0.0f;
+    };
+
+    //! The two neighbouring waves a morph position reads, as offsets into a mip level.
+    struct WaveSelection
+    {
+        size_t lower = 0;
+        size_t upper = 0;
+        float blend = 0.0f;
+    };
+
+    MipSelection selectMips(double frequency, double sampleRate) const;
+    static WaveSelection selectWaves(double position);
+
+    //! What getSample() returns, for selections made beforehand.
+    float read(const MipSelection & mips, const WaveSelection & waves, double phase) const;
+
+    //! Fills @p output with one pair of selections throughout, reading from @p phase on in steps of
+    //! @p phaseStep, and leaves @p phase on the frame after. Nothing is selected per frame, so the
+    //! loop is only the interpolation.
+    void render(const MipSelection & mips, const WaveSelection & waves, double & phase, double phaseStep, std::span<float> output) const;
+
     //! Names of the selectable sets, in ordinal order.
     static std::vector<std::string> setNames();
 
     //! Builds the set at the given ordinal. Costs tens of milliseconds, so callers that can be on
-    //! or behind the audio thread should go through the synth's shared cache instead.
+    //! or behind the audio thread should go through WavetableCache instead.
     static WavetableS createSet(size_t index);
 
     static WavetableS createClassicSet();
     static WavetableS createSpectralSet();
 
+    //! Every mip level back to back, full band first. What the cache writes out.
+    std::span<const float> data() const;
+
+    //! A set over data built earlier, such as a memory-mapped cache file, which @p owner keeps
+    //! alive for as long as the set is. Nothing if the data is not a whole number of levels.
+    static WavetableS fromData(std::string name, std::span<const float> data, std::shared_ptr<const void> owner);
+
 private:
     //! A selectable set: its name, how to build its spectra, and how its waves are scaled. The synth
     //! stores the selection as an ordinal, so entries are only ever appended, never reordered.
@@ -104,10 +143,15 @@ private:
 
     static WavetableS createFromSpectra(std::string name, const SpectrumList & spectra, Normalization normalization);
 
-    void addMipLevel(const SpectrumList & waveSpectra, int maxHarmonics, Normalization normalization);
+    static void addMipLevel(const SpectrumList & waveSpectra, int maxHarmonics, Normalization normalization, float * data);
+
+    void setData(std::span<const float> data, std::shared_ptr<const void> owner);
 
     std::string m_name;
-    std::vector<MipLevel> m_mips;
+    //! Whoever the levels belong to: a vector for a set built here, a file mapping for a cached one.
+    std::shared_ptr<const void> m_owner;
+    std::span<const float> m_data;
+    std::vector<const float *> m_mips;
 };
 
 } // namespace noteahead
@@ -0,0 +1,224 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+#include "wavetable_cache.hpp"
+
+#include "../../contrib/SimpleLogger/src/simple_logger.hpp"
+
+#include <array>
+#include <cstring>
+
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+
+namespace noteahead {
+
+static const auto TAG = "WavetableCache";
+
+namespace {
+
+//! What every cache file starts with. The set's data follows it directly, and since this is a
+//! multiple of 16 bytes long the floats are aligned however the file is mapped.
+struct Header
+{
+    std::array<char, 8> magic;
+    //! Written as 0x01020304 in the writer's byte order, so a file carried over to a machine of the
+    //! other order reads as a mismatch instead of as noise.
+    uint32_t byteOrder;
+    uint32_t generatorVersion;
+    uint32_t numWaves;
+    uint32_t waveSize;
+    uint32_t mipLevels;
+    uint32_t reserved;
+    //! Of the set's name: sets are only ever appended, but a file must never answer for another.
+    uint64_t nameHash;
+    uint64_t floatCount;
+    std::array<uint8_t, 16> padding;
+};
+
+static_assert(sizeof(Header) == 64);
+
+constexpr std::array<char, 8> Magic { 'N', 'A', 'H', 'D', 'W', 'T', 'B', 'L' };
+constexpr uint32_t ByteOrder = 0x01020304;
+
+//! FNV-1a, which is stable across builds and platforms where std::hash is not.
+uint64_t nameHash(const std::string & name)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (auto && c : name) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+Header headerFor(const std::string & name, size_t floatCount)
+{
+    Header header {};
+    header.magic = Magic;
+    header.byteOrder = ByteOrder;
+    header.generatorVersion = Wavetable::GeneratorVersion;
+    header.numWaves = Wavetable::NumWaves;
+    header.waveSize = Wavetable::WaveSize;
+    header.mipLevels = Wavetable::MipLevels;
+    header.nameHash = nameHash(name);
+    header.floatCount = floatCount;
+    return header;
+}
+
+std::string pathFor(const std::string & directory, size_t index)
+{
+    return QDir { QString::fromStdString(directory) }.filePath(QString { "wavetable-%1.bin" }.arg(index)).toStdString();
+}
+
+} // namespace
+
+WavetableCache & WavetableCache::instance()
+{
+    static WavetableCache cache;
+    return cache;
+}
+
+WavetableCache::WavetableCache(std::string directory)
+  : m_directory { std::move(directory) }
+{
+}
+
+WavetableCache::~WavetableCache()
+{
+    m_stopping = true;
+    waitForPrewarm();
+}
+
+std::string WavetableCache::directory() const
+{
+    const std::scoped_lock lock { m_mutex };
+    return m_directory;
+}
+
+void WavetableCache::setDirectory(std::string directory)
+{
+    const std::scoped_lock lock { m_mutex };
+    m_directory = std::move(directory);
+}
+
+std::string WavetableCache::filePath(size_t index) const
+{
+    const std::scoped_lock lock { m_mutex };
+    return m_directory.empty() ? std::string {} : pathFor(m_directory, index);
+}
+
+Wavetable::WavetableCS WavetableCache::wavetable(size_t index)
+{
+    std::string directory;
+    {
+        const std::scoped_lock lock { m_mutex };
+        if (const auto iter = m_sets.find(index); iter != m_sets.end()) {
+            return iter->second;
+        }
+        directory = m_directory;
+    }
+
+    // Read or built without the lock, so one thread building a set does not hold up another that
+    // only wants a set already in memory. Two threads missing the same set both get one ready, and
+    // whichever arrives first is the one kept.
+    auto table = directory.empty() ? nullptr : read(index, directory);
+    if (!table) {
+        table = Wavetable::createSet(index);
+        if (!directory.empty()) {
+            write(*table, index, directory);
+        }
+    }
+
+    const std::scoped_lock lock { m_mutex };
+    return m_sets.emplace(index, std::move(table)).first->second;
+}
+
+void WavetableCache::prewarm()
+{
+    waitForPrewarm();
+    m_stopping = false;
+    m_prewarmThread = std::thread { [this] {
+        for (size_t index = 0; index < Wavetable::setNames().size() && !m_stopping; index++) {
+            wavetable(index);
+        }
+    } };
+}
+
+void WavetableCache::waitForPrewarm()
+{
+    if (m_prewarmThread.joinable()) {
+        m_prewarmThread.join();
+    }
+}
+
+Wavetable::WavetableS WavetableCache::read(size_t index, const std::string & directory) const
+{
+    const auto path = pathFor(directory, index);
+    const auto file = std::make_shared<QFile>(QString::fromStdString(path));
+    if (!file->open(QIODevice::ReadOnly)) {
+        return nullptr;
+    }
+
+    const auto size = file->size();
+    if (size < static_cast<qint64>(sizeof(Header))) {
+        return nullptr;
+    }
+
+    // The mapping lives as long as the QFile does, and the set keeps the QFile.
+    const uchar * mapped = file->map(0, size);
+    if (!mapped) {
+        return nullptr;
+    }
+
+    Header header {};
+    std::memcpy(&header, mapped, sizeof(Header));
+    const auto name = Wavetable::setNames().at(index);
+    const auto expected = headerFor(name, Wavetable::MipLevels * Wavetable::MipSize);
+    if (std::memcmp(&header, &expected, sizeof(Header)) != 0
+        || size != static_cast<qint64>(sizeof(Header) + header.floatCount * sizeof(float))) {
+        juzzlin::L(TAG).info() << "Ignoring stale wavetable cache " << path;
+        return nullptr;
+    }
+
+    const std::span<const float> data { reinterpret_cast<const float *>(mapped + sizeof(Header)), header.floatCount };
+    return Wavetable::fromData(name, data, file);
+}
+
+void WavetableCache::write(const Wavetable & table, size_t index, const std::string & directory) const
+{
+    const auto path = pathFor(directory, index);
+    if (!QDir {}.mkpath(QString::fromStdString(directory))) {
+        juzzlin::L(TAG).warning() << "Could not create wavetable cache directory " << directory;
+        return;
+    }
+
+    // Written aside and renamed into place, so a session reading the file can never see half of it.
+    QSaveFile file { QString::fromStdString(path) };
+    if (!file.open(QIODevice::WriteOnly)) {
+        juzzlin::L(TAG).warning() << "Could not write wavetable cache " << path;
+        return;
+    }
+
+    const auto data = table.data();
+    const auto header = headerFor(table.name(), data.size());
+    file.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+    file.write(reinterpret_cast<const char *>(data.data()), static_cast<qint64>(data.size_bytes()));
+    if (!file.commit()) {
+        juzzlin::L(TAG).warning() << "Could not write wavetable cache " << path;
+    }
+}
+
+} // namespace noteahead
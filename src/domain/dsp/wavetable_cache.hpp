@@ -0,0 +1,79 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+#ifndef WAVETABLE_CACHE_HPP
+#define WAVETABLE_CACHE_HPP
+
+#include "wavetable.hpp"
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace noteahead {
+
+//! Built wavetable sets, shared by every Wavetable Synth and kept on disk between sessions.
+//!
+//! Building a set runs a few hundred inverse FFTs and costs tens of milliseconds, which used to be
+//! paid by whichever thread first asked for it, often while a project was opening. A set is only
+//! ever built once per machine now: it is written to a versioned file in the directory given, and
+//! every later session maps that file read-only instead of building it again. The mapping is
+//! shared, so the pages are read from disk only when a voice first reads them, and any number of
+//! running instances hold one copy between them.
+//!
+//! A file that does not match this build, whether a different GeneratorVersion, different table
+//! dimensions or a different set at that index, is rebuilt and overwritten rather than read.
+class WavetableCache
+{
+public:
+    //! The one the application uses. Sets go to disk once it has been given a directory.
+    static WavetableCache & instance();
+
+    //! An empty directory keeps the sets in memory, for this session only.
+    explicit WavetableCache(std::string directory = {});
+    ~WavetableCache();
+
+    WavetableCache(const WavetableCache &) = delete;
+    WavetableCache & operator=(const WavetableCache &) = delete;
+
+    std::string directory() const;
+    void setDirectory(std::string directory);
+
+    //! The set at the given ordinal: from memory, else from its file, else built and then written.
+    Wavetable::WavetableCS wavetable(size_t index);
+
+    //! Gets every set ready on a background thread, so the first note played with one does not
+    //! wait for it. Returns at once; a set asked for meanwhile is simply ready sooner.
+    void prewarm();
+    void waitForPrewarm();
+
+    std::string filePath(size_t index) const;
+
+private:
+    Wavetable::WavetableS read(size_t index, const std::string & directory) const;
+    void write(const Wavetable & table, size_t index, const std::string & directory) const;
+
+    mutable std::mutex m_mutex;
+    std::string m_directory;
+    std::map<size_t, Wavetable::WavetableCS> m_sets;
+
+    std::thread m_prewarmThread;
+    std::atomic<bool> m_stopping { false };
+};
+
+} // namespace noteahead
+
+#endif // WAVETABLE_CACHE_HPP
@@ -23,6 +23,7 @@ namespace noteahead {
 void WavetableOscillator::setSampleRate(double sampleRate)
 {
     DspComponent::setSampleRate(sampleRate);
+    m_mipFrequency = -1.0;
     updatePhaseStep();
     updatePositionCoeff();
 }
@@ -51,6 +52,7 @@ void WavetableOscillator::snapPosition()
 void WavetableOscillator::setWavetable(Wavetable::WavetableCS wavetable)
 {
     m_wavetable = std::move(wavetable);
+    m_mipFrequency = -1.0;
 }
 
 double WavetableOscillator::nextSample()
@@ -59,12 +61,10 @@ double WavetableOscillator::nextSample()
         return 0.0;
     }
 
-    // A step in the morph position steps the output sample with it: the same phase reads a
-    // different waveform, and that jump is an audible click. Gliding the position keeps the
-    // waveform continuous no matter how abruptly the modulation source moves.
-    m_position += (m_targetPosition - m_position) * m_positionCoeff;
+    glidePosition();
+    updateSelection();
 
-    const double sample = m_wavetable->getSample(m_phase, m_position, m_frequency, m_sampleRate);
+    const double sample = m_wavetable->read(m_mips, m_waves, m_phase);
 
     m_phase += m_phaseStep;
     if (m_phase >= 1.0) {
@@ -74,6 +74,24 @@ double WavetableOscillator::nextSample()
     return sample;
 }
 
+void WavetableOscillator::render(std::span<float> output)
+{
+    if (!m_wavetable) {
+        std::fill(output.begin(), output.end(), 0.0f);
+        return;
+    }
+
+    // While the morph glides every sample reads a different pair of waves, so those go one at a
+    // time. Once it has arrived the rest of the block shares one selection.
+    size_t i = 0;
+    for (; i < output.size() && m_position != m_targetPosition; i++) {
+        output[i] = static_cast<float>(nextSample());
+    }
+
+    updateSelection();
+    m_wavetable->render(m_mips, m_waves, m_phase, m_phaseStep, output.subspan(i));
+}
+
 void WavetableOscillator::sync(double phase)
 {
     m_phase = std::fmod(phase, 1.0);
@@ -108,6 +126,32 @@ void WavetableOscillator::updatePhaseStep()
     }
 }
 
+void WavetableOscillator::glidePosition()
+{
+    // A step in the morph position steps the output sample with it: the same phase reads a
+    // different waveform, and that jump is an audible click. Gliding the position keeps the
+    // waveform continuous no matter how abruptly the modulation source moves.
+    m_position += (m_targetPosition - m_position) * m_positionCoeff;
+
+    // The glide only ever approaches the target, so finish it once the rest is inaudible. Until
+    // then the waves have to be looked up again every sample.
+    if (std::abs(m_targetPosition - m_position) < 1.0e-9) {
+        m_position = m_targetPosition;
+    }
+}
+
+void WavetableOscillator::updateSelection()
+{
+    if (m_frequency != m_mipFrequency) {
+        m_mips = m_wavetable->selectMips(m_frequency, m_sampleRate);
+        m_mipFrequency = m_frequency;
+    }
+    if (m_position != m_wavePosition) {
+        m_waves = Wavetable::selectWaves(m_position);
+        m_wavePosition = m_position;
+    }
+}
+
 void WavetableOscillator::updatePositionCoeff()
 {
     if (m_sampleRate > 0.0) {
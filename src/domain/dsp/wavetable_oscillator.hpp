@@ -20,6 +20,7 @@
 #include "wavetable.hpp"
 
 #include <memory>
+#include <span>
 
 namespace noteahead {
 
@@ -40,6 +41,12 @@ public:
     void snapPosition();
 
     double nextSample();
+
+    //! Fills @p output with the next output.size() samples at the current frequency, the same as
+    //! calling nextSample() that many times. The mip levels are only looked up again when the
+    //! frequency has changed, and the morph only while it is still gliding.
+    void render(std::span<float> output);
+
     void sync(double phase);
 
     double frequency() const;
@@ -57,8 +64,17 @@ private:
     double m_phase = 0.0;
     double m_phaseStep = 0.0;
 
+    //! What the table reads at the current frequency and position, and what they were when it was
+    //! last looked up. A negative value forces the next lookup.
+    Wavetable::MipSelection m_mips;
+    double m_mipFrequency = -1.0;
+    Wavetable::WaveSelection m_waves;
+    double m_wavePosition = -1.0;
+
     void updatePhaseStep();
     void updatePositionCoeff();
+    void glidePosition();
+    void updateSelection();
 };
 
 } // namespace noteahead
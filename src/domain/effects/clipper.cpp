@@ -17,6 +17,7 @@
 #include "../../common/constants.hpp"
 #include "../../common/utils.hpp"
 #include "../dsp/audio_context.hpp"
+#include "../dsp/fast_math.hpp"
 #include "../dsp/upsampler.hpp"
 
 #include <algorithm>
@@ -51,7 +52,7 @@ float Clipper::clipSample(float sample, double thresholdLin) const
     if (m_mode == Mode::Hard) {
         return std::clamp(sample, -t, t);
     }
-    return t * std::tanh(sample / t);
+    return t * FastMath::tanh(sample / t);
 }
 
 void Clipper::processSample(double & left, double & right)
@@ -16,6 +16,7 @@
 #include "drive.hpp"
 #include "../../common/constants.hpp"
 #include "../../common/utils.hpp"
+#include "../dsp/fast_math.hpp"
 #include "../dsp/upsampler.hpp"
 
 #include <algorithm>
@@ -86,11 +87,11 @@ double Drive::shape(double x) const
         // before a steep tanh adds even harmonics for a richer, buzzier tone; the bias is subtracted
         // back out afterwards so the output stays centred, then clamped so it never exceeds unity.
         static const double bias = 0.15;
-        return std::clamp(std::tanh((x + bias) * 2.0) - std::tanh(bias * 2.0), -1.0, 1.0);
+        return std::clamp(FastMath::tanh((x + bias) * 2.0) - FastMath::tanh(bias * 2.0), -1.0, 1.0);
     }
     case Mode::Soft:
     default:
-        return std::tanh(x);
+        return FastMath::tanh(x);
     }
 }
 
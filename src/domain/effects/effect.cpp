@@ -36,6 +36,7 @@ Effect::Effect(const Effect & other)
   , m_enabled { other.m_enabled }
   , m_bpm { other.m_bpm }
   , m_oversampleFactor { other.m_oversampleFactor }
+  , m_tailThresholdDb { other.m_tailThresholdDb }
 {
     resolveSharedParameters();
 }
@@ -50,6 +51,7 @@ Effect & Effect::operator=(const Effect & other)
         m_enabled = other.m_enabled;
         m_bpm = other.m_bpm;
         m_oversampleFactor = other.m_oversampleFactor;
+        m_tailThresholdDb = other.m_tailThresholdDb;
         resolveSharedParameters();
     }
     return *this;
@@ -63,6 +65,7 @@ Effect::Effect(Effect && other)
   , m_enabled { other.m_enabled }
   , m_bpm { other.m_bpm }
   , m_oversampleFactor { other.m_oversampleFactor }
+  , m_tailThresholdDb { other.m_tailThresholdDb }
 {
     resolveSharedParameters();
     other.resolveSharedParameters();
@@ -78,6 +81,7 @@ Effect & Effect::operator=(Effect && other)
         m_enabled = other.m_enabled;
         m_bpm = other.m_bpm;
         m_oversampleFactor = other.m_oversampleFactor;
+        m_tailThresholdDb = other.m_tailThresholdDb;
         resolveSharedParameters();
         other.resolveSharedParameters();
     }
@@ -273,4 +277,29 @@ uint8_t Effect::oversampleFactor() const
     return m_oversampleFactor;
 }
 
+Effect::TailState Effect::tailState() const
+{
+    return m_enabled ? ownTailState() : TailState::Silent;
+}
+
+Effect::TailState Effect::ownTailState() const
+{
+    return TailState::Unknown;
+}
+
+void Effect::setTailThresholdDb(double thresholdDb)
+{
+    m_tailThresholdDb = thresholdDb;
+}
+
+double Effect::tailThresholdDb() const
+{
+    return m_tailThresholdDb;
+}
+
+double Effect::tailThreshold() const
+{
+    return std::pow(10.0, m_tailThresholdDb / 20.0);
+}
+
 } // namespace noteahead
@@ -61,6 +61,15 @@ public:
         Internal
     };
 
+    //! Whether an effect is still playing out what it was fed earlier.
+    enum class TailState
+    {
+        //! The effect does not keep track, and only its output can tell.
+        Unknown,
+        Ringing,
+        Silent
+    };
+
     virtual std::string type() const = 0;
     virtual std::string typeId() const = 0;
 
@@ -91,6 +100,16 @@ public:
     void setOversampleFactor(uint8_t factor);
     uint8_t oversampleFactor() const;
 
+    //! Lets a send go to sleep as soon as its tail drops below the tail threshold, rather than when
+    //! its output finally reads as zero, which for a long reverb is minutes of inaudible work later.
+    //! Not virtual for the same reason process() is not: a disabled effect is silent whatever it
+    //! would report.
+    TailState tailState() const;
+
+    //! Where a tail counts as finished. -120 dBFS unless set.
+    void setTailThresholdDb(double thresholdDb);
+    double tailThresholdDb() const;
+
 protected:
     //! The effect's own work on one frame.
     virtual void processSample(double & left, double & right) = 0;
@@ -117,6 +136,12 @@ protected:
     //! Whether Solo is registered and engaged.
     bool solo() const;
 
+    //! The effect's own account of its tail. Unknown unless overridden.
+    virtual TailState ownTailState() const;
+
+    //! The tail threshold as a linear magnitude.
+    double tailThreshold() const;
+
 private:
     //! Everything the shared controls need for one block, read once instead of once per sample.
     //! Resolving Mix and Solo means a map lookup keyed by a name that has to be built first, which
@@ -152,6 +177,7 @@ private:
     bool m_enabled { true };
     float m_bpm = 120;
     uint8_t m_oversampleFactor { 1 };
+    double m_tailThresholdDb { -120.0 };
 };
 
 } // namespace noteahead
@@ -48,6 +48,11 @@ public:
     size_t effectCount() const;
     bool hasEffects() const;
 
+    //! Whether anything in the rack is still ringing out. Silent when every effect in it says so,
+    //! and when the rack is bypassed; Ringing as soon as one effect says it is; Unknown otherwise,
+    //! when only the rack's output can tell.
+    Effect::TailState tailState() const;
+
     //! Monotonically increasing counter bumped whenever the effect list changes (effects added,
     //! removed, swapped, cleared or deserialized). Lets callers cache a snapshot of effects() and
     //! only refresh it when this changes, avoiding a per-audio-callback copy. Cheap atomic read.
@@ -108,6 +108,11 @@ void EndlessReverb::processBlock(AudioContext & context)
     for (uint32_t i = 0; i < context.frameCount; i++) {
         renderSample(context.buffer[i * 2], context.buffer[i * 2 + 1]);
     }
+
+    // Freeze keeps the tank at full level forever, so it never reads as finished, as it should not.
+    m_tail.setThreshold(tailThreshold());
+    m_tail.addBlock(m_storedPeak, context.frameCount);
+    m_storedPeak = 0.0;
 }
 
 void EndlessReverb::renderSample(double & left, double & right)
@@ -120,6 +125,7 @@ void EndlessReverb::renderSample(double & left, double & right)
     const double dryR = right;
 
     double input = (dryL + dryR) * 0.5;
+    m_storedPeak = std::max(m_storedPeak, std::abs(input));
 
     // Pre-delay
     if (!m_preDelayBuffer.empty()) {
@@ -181,7 +187,9 @@ void EndlessReverb::renderSample(double & left, double & right)
 
     for (size_t i = 0; i < NumDelays; i++) {
         const double mixed = feedbackSignals[i] - average;
-        m_delays[i].write(input * inputGains[i] * inputGainScale + mixed * effFeedback);
+        const double stored = input * inputGains[i] * inputGainScale + mixed * effFeedback;
+        m_storedPeak = std::max(m_storedPeak, std::abs(stored));
+        m_delays[i].write(stored);
     }
 
     double wetL = (outs[0] - outs[2] + outs[4] - outs[6]) * 0.25;
@@ -222,6 +230,13 @@ void EndlessReverb::reset()
     m_wetLpfR.reset();
     m_wetHpfL.reset();
     m_wetHpfR.reset();
+    m_tail.reset();
+    m_storedPeak = 0.0;
+}
+
+Effect::TailState EndlessReverb::ownTailState() const
+{
+    return m_tail.active() ? TailState::Ringing : TailState::Silent;
 }
 
 void EndlessReverb::sync()
@@ -320,6 +335,18 @@ void EndlessReverb::updateBuffers()
         m_preDelayBuffer.assign(preDelaySize, 0.0);
         m_preDelayWritePos = 0;
     }
+
+    // On its way into the tank a sample passes the pre-delay and every diffuser, and the longest
+    // tank line is the last to hand it back.
+    uint32_t tailLength = preDelaySize;
+    for (auto && diffuser : m_diffusers) {
+        tailLength += diffuser.size;
+    }
+    uint32_t longestDelay = 0;
+    for (auto && delay : m_delays) {
+        longestDelay = std::max(longestDelay, delay.bufferLen);
+    }
+    m_tail.setLength(tailLength + longestDelay);
 }
 
 void EndlessReverb::updateFilters()
@@ -17,6 +17,7 @@
 #define ENDLESS_REVERB_HPP
 
 #include "../dsp/cascaded_svf.hpp"
+#include "../dsp/tail_tracker.hpp"
 #include "effect.hpp"
 
 #include <algorithm>
@@ -42,6 +43,9 @@ public:
     void reset() override;
     void sync() override;
 
+protected:
+    TailState ownTailState() const override;
+
 private:
     void syncParameters();
     void updateBuffers();
@@ -148,6 +152,10 @@ private:
     CascadedSvf m_wetLpfR;
     CascadedSvf m_wetHpfL;
     CascadedSvf m_wetHpfR;
+
+    TailTracker m_tail;
+    //! The largest magnitude fed to the pre-delay or written into the tank this block.
+    double m_storedPeak { 0.0 };
 };
 
 } // namespace noteahead
@@ -78,6 +78,7 @@ void Reverb::processSample(double & left, double & right)
     const double dryR = right;
 
     double input = (dryL + dryR) * 0.5;
+    m_storedPeak = std::max(m_storedPeak, std::abs(input));
 
     if (!m_preDelayBuffer.empty()) {
         const double delayedInput = m_preDelayBuffer[m_preDelayWritePos];
@@ -131,7 +132,9 @@ void Reverb::processSample(double & left, double & right)
             continue;
         }
         const double feedback = feedbackSignals[i] - average;
-        m_delays[i].buffer[m_delays[i].writePos] = input * inputGains[i] + feedback * m_delays[i].feedback;
+        const double stored = input * inputGains[i] + feedback * m_delays[i].feedback;
+        m_storedPeak = std::max(m_storedPeak, std::abs(stored));
+        m_delays[i].buffer[m_delays[i].writePos] = stored;
         m_delays[i].writePos = (m_delays[i].writePos + 1) % m_delays[i].size;
     }
 
@@ -170,6 +173,10 @@ void Reverb::processBlock(AudioContext & context)
     for (uint32_t i = 0; i < context.frameCount; i++) {
         processSample(context.buffer[i * 2], context.buffer[i * 2 + 1]);
     }
+
+    m_tail.setThreshold(tailThreshold());
+    m_tail.addBlock(m_storedPeak, context.frameCount);
+    m_storedPeak = 0.0;
 }
 
 void Reverb::reset()
@@ -185,6 +192,13 @@ void Reverb::reset()
     m_wetHpfR.reset();
     m_gateGain = 1.0;
     m_gateHoldCounter = 0;
+    m_tail.reset();
+    m_storedPeak = 0.0;
+}
+
+Effect::TailState Reverb::ownTailState() const
+{
+    return m_tail.active() ? TailState::Ringing : TailState::Silent;
 }
 
 void Reverb::sync()
@@ -572,6 +586,14 @@ void Reverb::updateBuffers()
         m_preDelayBuffer.assign(preDelaySize, 0.0);
         m_preDelayWritePos = 0;
     }
+
+    // A sample goes through the pre-delay once and then lives in the delay lines, where the
+    // longest one is the last to hand it back.
+    uint32_t longestDelay = 0;
+    for (auto && delay : m_delays) {
+        longestDelay = std::max(longestDelay, delay.size);
+    }
+    m_tail.setLength(preDelaySize + longestDelay);
 }
 
 void Reverb::updateFilters()
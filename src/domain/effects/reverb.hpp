@@ -17,6 +17,7 @@
 #define REVERB_HPP
 
 #include "../dsp/cascaded_svf.hpp"
+#include "../dsp/tail_tracker.hpp"
 #include "effect.hpp"
 
 #include <algorithm>
@@ -81,6 +82,9 @@ public:
     static Preset stringToPreset(const std::string & presetName);
     static std::vector<std::string> presetNames();
 
+protected:
+    TailState ownTailState() const override;
+
 private:
     void syncParameters();
     void updateBuffers();
@@ -143,6 +147,10 @@ private:
     CascadedSvf m_wetLpfR;
     CascadedSvf m_wetHpfL;
     CascadedSvf m_wetHpfR;
+
+    TailTracker m_tail;
+    //! The largest magnitude fed to the pre-delay or written into a delay line this block.
+    double m_storedPeak { 0.0 };
 };
 
 } // namespace noteahead
@@ -16,6 +16,7 @@
 #include "saturator.hpp"
 #include "../../common/constants.hpp"
 #include "../../common/utils.hpp"
+#include "../dsp/fast_math.hpp"
 #include "../dsp/upsampler.hpp"
 
 #include <algorithm>
@@ -69,10 +70,10 @@ double Saturator::shape(double x) const
 {
     switch (m_mode) {
     case Mode::Tape:
-        return std::tanh(x);
+        return FastMath::tanh(x);
     case Mode::Tube:
         // Asymmetric curve: softer negative half emulates tube-style even harmonics
-        return x >= 0.0 ? std::tanh(x) : std::tanh(x * 1.4) * 0.9;
+        return x >= 0.0 ? FastMath::tanh(x) : FastMath::tanh(x * 1.4) * 0.9;
     case Mode::Diode:
     default: {
         const double ax = std::abs(x);
@@ -17,6 +17,7 @@
 
 #include "../../common/constants.hpp"
 #include "../../common/utils.hpp"
+#include "../dsp/fast_math.hpp"
 #include "../dsp/upsampler.hpp"
 
 #include <algorithm>
@@ -106,7 +107,7 @@ double TubeStage::shape(double v) const
     if (m_mode == Mode::Triode) {
         // Grid side compresses gently; the cutoff side saturates sooner and lower, so the curve is
         // not odd-symmetric and the stage generates even harmonics.
-        return v >= 0.0 ? std::tanh(v) : std::tanh(v * TriodeAsymmetry) / TriodeAsymmetry;
+        return v >= 0.0 ? FastMath::tanh(v) : FastMath::tanh(v * TriodeAsymmetry) / TriodeAsymmetry;
     }
 
     // Pentode: same ceiling either side, but a knee that stays linear longer before it gives way.
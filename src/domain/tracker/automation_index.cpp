@@ -0,0 +1,108 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "automation_index.hpp"
+
+#include "automation_location.hpp"
+
+#include <bit>
+
+namespace noteahead {
+
+void AutomationIndex::clear()
+{
+    m_columns.clear();
+}
+
+AutomationIndex::Key AutomationIndex::key(const AutomationLocation & location)
+{
+    return { location.pattern(), location.track(), location.column() };
+}
+
+void AutomationIndex::Column::rebuild()
+{
+    leafCount = std::bit_ceil(std::max<size_t>(entries.size(), 1));
+    maxLine1.assign(leafCount * 2, 0);
+    for (size_t i = 0; i < entries.size(); i++) {
+        maxLine1.at(leafCount + i) = entries.at(i).line1;
+    }
+    for (size_t node = leafCount - 1; node > 0; node--) {
+        maxLine1.at(node) = std::max(maxLine1.at(node * 2), maxLine1.at(node * 2 + 1));
+    }
+}
+
+void AutomationIndex::add(const AutomationLocation & location, size_t line0, size_t line1, size_t position)
+{
+    auto && column = m_columns[key(location)];
+    const auto where = std::upper_bound(column.entries.begin(), column.entries.end(), line0, [](size_t value, const Entry & entry) {
+        return value < entry.line0;
+    });
+    column.entries.insert(where, { line0, line1, position });
+    column.rebuild();
+}
+
+void AutomationIndex::erase(const AutomationLocation & location, size_t position)
+{
+    if (const auto iter = m_columns.find(key(location)); iter != m_columns.end()) {
+        auto && column = iter->second;
+        std::erase_if(column.entries, [&](auto && entry) { return entry.position == position; });
+        if (column.entries.empty()) {
+            m_columns.erase(iter);
+        } else {
+            column.rebuild();
+        }
+    }
+}
+
+void AutomationIndex::remove(const AutomationLocation & location, size_t position)
+{
+    erase(location, position);
+    // Only the positions move, not the lines, so no tree needs rebuilding.
+    for (auto && [columnKey, column] : m_columns) {
+        for (auto && entry : column.entries) {
+            if (entry.position > position) {
+                entry.position--;
+            }
+        }
+    }
+}
+
+void AutomationIndex::update(const AutomationLocation & oldLocation, const AutomationLocation & newLocation, size_t line0, size_t line1, size_t position)
+{
+    erase(oldLocation, position);
+    add(newLocation, line0, line1, position);
+}
+
+AutomationIndex::PositionList AutomationIndex::positionsAt(const AutomationLocation & location, size_t line) const
+{
+    PositionList positions;
+    forEachAt(location, line, [&](size_t position) { positions.push_back(position); });
+    std::ranges::sort(positions);
+    return positions;
+}
+
+AutomationIndex::PositionList AutomationIndex::positions(const AutomationLocation & location) const
+{
+    PositionList positions;
+    if (const auto iter = m_columns.find(key(location)); iter != m_columns.end()) {
+        for (auto && entry : iter->second.entries) {
+            positions.push_back(entry.position);
+        }
+    }
+    std::ranges::sort(positions);
+    return positions;
+}
+
+} // namespace noteahead
@@ -0,0 +1,130 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef AUTOMATION_INDEX_HPP
+#define AUTOMATION_INDEX_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace noteahead {
+
+class AutomationLocation;
+
+//! Which automations of one kind cover which lines, per pattern, track and column. Automations are
+//! referred to by their position in the owner's list, so the owner keeps the order it serializes in.
+//!
+//! Each column keeps its automations sorted by first line, with a tree of the largest last line over
+//! every run of them: a line's automations are the ones starting at or before it whose subtree still
+//! reaches it, so finding them costs a binary search plus a walk down to the matches instead of a
+//! pass over every automation in the song.
+class AutomationIndex
+{
+public:
+    using PositionList = std::vector<size_t>;
+
+    void clear();
+
+    void add(const AutomationLocation & location, size_t line0, size_t line1, size_t position);
+    //! Positions after the removed one move down by one, as they do in the owner's list.
+    void remove(const AutomationLocation & location, size_t position);
+    //! For an automation whose location or lines changed while its position stayed.
+    void update(const AutomationLocation & oldLocation, const AutomationLocation & newLocation, size_t line0, size_t line1, size_t position);
+
+    //! Positions of the automations at the location that cover the line, in list order.
+    PositionList positionsAt(const AutomationLocation & location, size_t line) const;
+    //! Positions of every automation at the location, in list order.
+    PositionList positions(const AutomationLocation & location) const;
+
+    //! Calls the predicate with each position covering the line until it returns true, without
+    //! allocating. Order is unspecified.
+    template<typename Predicate>
+    bool anyAt(const AutomationLocation & location, size_t line, Predicate && predicate) const;
+
+    template<typename Visitor>
+    void forEachAt(const AutomationLocation & location, size_t line, Visitor && visitor) const
+    {
+        anyAt(location, line, [&](size_t position) {
+            visitor(position);
+            return false;
+        });
+    }
+
+private:
+    struct Entry
+    {
+        size_t line0 = 0;
+        size_t line1 = 0;
+        size_t position = 0;
+    };
+
+    struct Column
+    {
+        //! Sorted by first line.
+        std::vector<Entry> entries;
+        //! Implicit binary tree over the entries: node n has children 2n and 2n + 1, and holds the
+        //! largest last line below it. Leaves start at leafCount.
+        std::vector<size_t> maxLine1;
+        size_t leafCount = 0;
+
+        void rebuild();
+    };
+
+    using Key = std::tuple<size_t, size_t, size_t>;
+
+    static Key key(const AutomationLocation & location);
+    void erase(const AutomationLocation & location, size_t position);
+
+    template<typename Predicate>
+    static bool findAt(const Column & column, size_t line, size_t end, size_t node, size_t begin, size_t width, Predicate & predicate);
+
+    std::map<Key, Column> m_columns;
+};
+
+template<typename Predicate>
+bool AutomationIndex::anyAt(const AutomationLocation & location, size_t line, Predicate && predicate) const
+{
+    const auto iter = m_columns.find(key(location));
+    if (iter == m_columns.end() || iter->second.entries.empty()) {
+        return false;
+    }
+    const auto & column = iter->second;
+    // Only entries starting at or before the line can cover it.
+    const auto end = static_cast<size_t>(std::distance(column.entries.begin(), std::upper_bound(column.entries.begin(), column.entries.end(), line, [](size_t value, const Entry & entry) {
+                                                           return value < entry.line0;
+                                                       })));
+    return end && findAt(column, line, end, 1, 0, column.leafCount, predicate);
+}
+
+template<typename Predicate>
+bool AutomationIndex::findAt(const Column & column, size_t line, size_t end, size_t node, size_t begin, size_t width, Predicate & predicate)
+{
+    if (begin >= end || column.maxLine1.at(node) < line) {
+        return false;
+    }
+    if (width == 1) {
+        return predicate(column.entries.at(begin).position);
+    }
+    const auto half = width / 2;
+    return findAt(column, line, end, node * 2, begin, half, predicate) || findAt(column, line, end, node * 2 + 1, begin + half, half, predicate);
+}
+
+} // namespace noteahead
+
+#endif // AUTOMATION_INDEX_HPP
@@ -42,11 +42,12 @@ Column::Column(size_t index, size_t length)
 
 void Column::initialize(size_t length)
 {
-    m_lines.clear();
+    m_lines = std::make_shared<LineBlock>();
+    m_lines->reserve(length);
     for (size_t i = 0; i < length; i++) {
-        m_lines.push_back(std::make_shared<Line>(i));
+        m_lines->emplace_back(i);
     }
-    m_virtualLineCount = m_lines.size();
+    m_virtualLineCount = m_lines->size();
 }
 
 void Column::setSettings(ColumnSettingsS settings)
@@ -61,8 +62,8 @@ Column::ColumnSettingsS Column::settings() const
 
 bool Column::hasData() const
 {
-    return !name().empty() || m_settings->isEnabled() || std::ranges::any_of(m_lines, [](auto && line) {
-        return line->hasData();
+    return !name().empty() || m_settings->isEnabled() || std::ranges::any_of(*m_lines, [](auto && line) {
+        return line.hasData();
     });
 }
 
@@ -79,24 +80,29 @@ size_t Column::lineCount() const
 void Column::setLineCount(size_t lineCount)
 {
     m_virtualLineCount = lineCount;
-    if (m_virtualLineCount > m_lines.size()) {
-        m_lines.reserve(m_virtualLineCount);
-        for (size_t i = m_lines.size(); i < m_virtualLineCount; i++) {
-            m_lines.push_back(std::make_shared<Line>(i));
+    if (m_virtualLineCount > m_lines->size()) {
+        // A new block rather than growing this one, which would move lines out from under the
+        // handles lines() has given out.
+        auto lines = std::make_shared<LineBlock>();
+        lines->reserve(m_virtualLineCount);
+        lines->insert(lines->end(), m_lines->begin(), m_lines->end());
+        for (size_t i = lines->size(); i < m_virtualLineCount; i++) {
+            lines->emplace_back(i);
         }
+        m_lines = std::move(lines);
     }
 }
 
-void Column::addOrReplaceLine(LineS line)
+void Column::addOrReplaceLine(const Line & line)
 {
-    m_lines.at(line->index()) = line;
+    m_lines->at(line.index()) = line;
 }
 
 Position Column::nextNoteDataOnSameColumn(const Position & position) const
 {
     auto nextNoteDataPosition = position;
-    for (size_t line = position.line + 1; line < m_lines.size(); line++) {
-        if (const auto noteData = m_lines.at(line)->noteData(); noteData->type() != NoteData::Type::None) {
+    for (size_t line = position.line + 1; line < m_lines->size(); line++) {
+        if (m_lines->at(line).noteData().type() != NoteData::Type::None) {
             nextNoteDataPosition.line = line;
             break;
         }
@@ -108,7 +114,7 @@ Position Column::prevNoteDataOnSameColumn(const Position & position) const
 {
     auto prevNoteDataPosition = position;
     for (size_t line = 0; line < position.line; line++) {
-        if (const auto noteData = m_lines.at(line)->noteData(); noteData->type() != NoteData::Type::None) {
+        if (m_lines->at(line).noteData().type() != NoteData::Type::None) {
             prevNoteDataPosition.line = line;
         }
     }
@@ -120,34 +126,31 @@ std::optional<uint8_t> Column::pan(size_t line) const
     if (line >= m_virtualLineCount) {
         return {};
     }
-    if (const auto lineObject = m_lines.at(line); lineObject) {
-        if (const auto noteData = lineObject->noteData(); noteData) {
-            return noteData->pan();
-        }
-    }
-    return {};
+    return m_lines->at(line).noteData().pan();
 }
 
 Column::NoteDataS Column::noteDataAtPosition(const Position & position) const
 {
-    return m_lines.at(static_cast<size_t>(position.line))->noteData();
+    // Shares ownership of the block, so the note stays valid for as long as the caller holds it
+    return { m_lines, &m_lines->at(static_cast<size_t>(position.line)).noteData() };
 }
 
 void Column::setNoteDataAtPosition(const NoteData & noteData, const Position & position)
 {
-    juzzlin::L(TAG).debug() << "Set note data at position: " << noteData.toString() << " @ " << position.toString();
     auto newNoteData = noteData;
     newNoteData.setColumn(index());
     newNoteData.setTrack(position.track); // Set the track from the position
-    m_lines.at(static_cast<size_t>(position.line))->setNoteData(newNoteData);
+    m_lines->at(static_cast<size_t>(position.line)).setNoteData(newNoteData);
 }
 
 Column::LineList Column::lines() const
 {
-    return {
-        m_lines.begin(),
-        m_lines.begin() + static_cast<long>(m_virtualLineCount)
-    };
+    LineList lines;
+    lines.reserve(m_virtualLineCount);
+    for (size_t i = 0; i < m_virtualLineCount; i++) {
+        lines.emplace_back(m_lines, &m_lines->at(i));
+    }
+    return lines;
 }
 
 Column::PositionList Column::addChangedPosition(const Column::PositionList & changedPositions, const Position & position, size_t line) const
@@ -165,11 +168,12 @@ Column::PositionList Column::deleteNoteDataAtPosition(const Position & position)
 {
     juzzlin::L(TAG).debug() << "Delete note data at position: " << position.toString();
     Column::PositionList changedPositions;
-    for (size_t i = position.line; i < m_lines.size(); i++) {
-        if (i + 1 < m_lines.size()) {
-            m_lines.at(i)->setNoteData(*m_lines.at(i + 1)->noteData());
+    auto && lines = *m_lines;
+    for (size_t i = position.line; i < lines.size(); i++) {
+        if (i + 1 < lines.size()) {
+            lines.at(i).setNoteData(lines.at(i + 1).noteData());
         } else {
-            m_lines.at(i)->setNoteData({});
+            lines.at(i).setNoteData({});
         }
         changedPositions = addChangedPosition(changedPositions, position, i);
     }
@@ -181,14 +185,15 @@ Column::PositionList Column::insertNoteDataAtPosition(const NoteData & noteData,
     juzzlin::L(TAG).debug() << "Insert note data at position: " << noteData.toString() << " @ " << position.toString();
     Column::PositionList changedPositions;
     const size_t newIndex = position.line;
-    if (newIndex >= m_lines.size()) {
+    auto && lines = *m_lines;
+    if (newIndex >= lines.size()) {
         return changedPositions;
     }
-    for (size_t i = m_lines.size() - 1; i > newIndex; i--) {
-        m_lines.at(i)->setNoteData(*m_lines.at(i - 1)->noteData());
+    for (size_t i = lines.size() - 1; i > newIndex; i--) {
+        lines.at(i).setNoteData(lines.at(i - 1).noteData());
         changedPositions = addChangedPosition(changedPositions, position, i);
     }
-    m_lines.at(newIndex)->setNoteData(noteData);
+    lines.at(newIndex).setNoteData(noteData);
     changedPositions = addChangedPosition(changedPositions, position, newIndex);
     return changedPositions;
 }
@@ -196,14 +201,14 @@ Column::PositionList Column::insertNoteDataAtPosition(const NoteData & noteData,
 NoteChangeList Column::transposeColumn(const Position & position, int semitones)
 {
     NoteChangeList changes;
-    for (size_t i = 0; i < m_lines.size(); i++) {
-        if (const auto noteData = m_lines.at(i)->noteData(); noteData->type() == NoteData::Type::NoteOn) {
-            auto newNoteData = *noteData;
+    for (size_t i = 0; i < m_lines->size(); i++) {
+        if (const auto & noteData = m_lines->at(i).noteData(); noteData.type() == NoteData::Type::NoteOn) {
+            auto newNoteData = noteData;
             newNoteData.transpose(semitones);
             auto pos = position;
             pos.column = index();
             pos.line = i;
-            changes.emplace_back(pos, *noteData, newNoteData);
+            changes.emplace_back(pos, noteData, newNoteData);
         }
     }
     return changes;
@@ -214,16 +219,13 @@ Column::EventList Column::renderToEvents(size_t startTick, size_t ticksPerLine)
     EventList eventList;
     size_t tick = startTick;
     for (size_t i = 0; i < m_virtualLineCount; i++) {
-        if (auto && line = m_lines.at(i)) {
-            if (line->lineEvent()) {
-                if (line->lineEvent()->instrumentSettings()) {
-                    eventList.push_back(std::make_shared<Event>(tick, line->lineEvent()->instrumentSettings()));
-                }
-            }
-            // Pan is rendered by the track, which averages it over the columns.
-            if (const auto noteData = line->noteData(); noteData->type() == NoteData::Type::NoteOn || noteData->type() == NoteData::Type::NoteOff) {
-                eventList.push_back(std::make_shared<Event>(tick + noteData->delay(), *noteData));
-            }
+        auto && line = m_lines->at(i);
+        if (const auto lineEvent = line.lineEvent(); lineEvent && lineEvent->instrumentSettings()) {
+            eventList.push_back(std::make_shared<Event>(tick, lineEvent->instrumentSettings()));
+        }
+        // Pan is rendered by the track, which averages it over the columns.
+        if (const auto & noteData = line.noteData(); noteData.type() == NoteData::Type::NoteOn || noteData.type() == NoteData::Type::NoteOff) {
+            eventList.push_back(std::make_shared<Event>(tick + noteData.delay(), noteData));
         }
         tick += ticksPerLine;
     }
@@ -232,7 +234,7 @@ Column::EventList Column::renderToEvents(size_t startTick, size_t ticksPerLine)
 
 Column::InstrumentSettingsS Column::instrumentSettings(const Position & position) const
 {
-    const auto lineEvent = m_lines.at(position.line)->lineEvent();
+    const auto lineEvent = m_lines->at(position.line).lineEvent();
     return lineEvent ? lineEvent->instrumentSettings() : nullptr;
 }
 
@@ -240,7 +242,7 @@ void Column::setInstrumentSettings(const Position & position, InstrumentSettings
 {
     LineEvent lineEvent { position.track, position.column };
     lineEvent.setInstrumentSettings(instrumentSettings);
-    m_lines.at(position.line)->setLineEvent(lineEvent);
+    m_lines->at(position.line).setLineEvent(lineEvent);
 }
 
 void Column::serializeToXml(ProjectWriter & writer) const
@@ -261,9 +263,7 @@ void Column::serializeToXml(ProjectWriter & writer) const
     writer.writeStartElement(Constants::NahdXml::xmlKeyLines());
 
     for (size_t i = 0; i < m_virtualLineCount; i++) {
-        if (auto && line = m_lines.at(i); line) {
-            line->serializeToXml(writer);
-        }
+        m_lines->at(i).serializeToXml(writer);
     }
 
     writer.writeEndElement(); // Lines
@@ -302,7 +302,7 @@ void Column::deserializeLines(ProjectReader & reader, size_t trackIndex, Column
     while (!(reader.isEndElement() && !reader.name().compare(Constants::NahdXml::xmlKeyLines()))) {
         juzzlin::L(TAG).trace() << "Deserializing Line: " << reader.name().toString().toStdString();
         if (reader.isStartElement() && !reader.name().compare(Constants::NahdXml::xmlKeyLine())) {
-            column.addOrReplaceLine(Line::deserializeFromXml(reader, trackIndex, column.index()));
+            column.addOrReplaceLine(*Line::deserializeFromXml(reader, trackIndex, column.index()));
         }
         reader.readNext();
     }
@@ -47,11 +47,15 @@ public:
     bool hasPosition(const Position & position) const;
 
     size_t lineCount() const;
+    //! Growing past the lines the column holds moves them all to a new block. A handle taken
+    //! before, from lines() or noteDataAtPosition(), then belongs to the old block: it stays safe
+    //! to use but no longer sees or makes changes to the column. Take handles again after growing.
     void setLineCount(size_t lineCount);
     using LineS = std::shared_ptr<Line>;
     using LineList = std::vector<LineS>;
+    //! Handles to the lines themselves, not copies: each keeps the column's line block alive.
     LineList lines() const;
-    void addOrReplaceLine(LineS line);
+    void addOrReplaceLine(const Line & line);
 
     Position nextNoteDataOnSameColumn(const Position & position) const;
     Position prevNoteDataOnSameColumn(const Position & position) const;
@@ -89,7 +93,11 @@ private:
     void initialize(size_t length);
 
     size_t m_virtualLineCount = 0;
-    LineList m_lines;
+    //! Every line of the column in one block, empty or not, instead of a node per line and
+    //! another per note: a big song has millions of lines and nearly all of them are empty.
+    //! Grown by replacing the block, so a handle into the old one never dangles, see setLineCount().
+    using LineBlock = std::vector<Line>;
+    std::shared_ptr<LineBlock> m_lines;
     ColumnSettingsS m_settings;
 };
 
@@ -28,13 +28,12 @@ static const auto TAG = "Line";
 
 Line::Line(size_t index)
   : m_index { index }
-  , m_noteData { std::make_unique<NoteData>() }
 {
 }
 
 Line::Line(size_t index, const NoteData & noteData)
   : m_index { index }
-  , m_noteData { std::make_unique<NoteData>(noteData) }
+  , m_noteData { noteData }
 {
 }
 
@@ -55,8 +54,7 @@ void Line::clear()
 
 void Line::setNoteData(const NoteData & noteData)
 {
-    juzzlin::L(TAG).trace() << "Set note data " << noteData.toString();
-    *m_noteData = noteData;
+    m_noteData = noteData;
 }
 
 Line::LineEventOpt Line::lineEvent() const
@@ -78,7 +76,7 @@ void Line::setLineEvent(LineEventOpt lineEvent)
 
 bool Line::hasData() const
 {
-    return (m_noteData && (m_noteData->type() != NoteData::Type::None || m_noteData->pan().has_value())) || m_lineEvent;
+    return m_noteData.type() != NoteData::Type::None || m_noteData.pan().has_value() || m_lineEvent;
 }
 
 void Line::serializeToXml(ProjectWriter & writer) const
@@ -86,8 +84,8 @@ void Line::serializeToXml(ProjectWriter & writer) const
     if (hasData()) {
         writer.writeStartElement(Constants::NahdXml::xmlKeyLine());
         writer.writeAttribute(Constants::NahdXml::xmlKeyIndex(), QString::number(m_index));
-        if (m_noteData->type() != NoteData::Type::None || m_noteData->pan().has_value()) {
-            m_noteData->serializeToXml(writer);
+        if (m_noteData.type() != NoteData::Type::None || m_noteData.pan().has_value()) {
+            m_noteData.serializeToXml(writer);
         }
         if (m_lineEvent) {
             m_lineEvent->serializeToXml(writer);
@@ -114,7 +112,12 @@ Line::LineU Line::deserializeFromXml(ProjectReader & reader, size_t trackIndex,
     return line;
 }
 
-Line::NoteDataS Line::noteData() const
+const NoteData & Line::noteData() const
+{
+    return m_noteData;
+}
+
+NoteData & Line::noteData()
 {
     return m_noteData;
 }
@@ -39,8 +39,8 @@ public:
     void clear();
     bool hasData() const;
 
-    using NoteDataS = std::shared_ptr<NoteData>;
-    NoteDataS noteData() const;
+    const NoteData & noteData() const;
+    NoteData & noteData();
     void setNoteData(const NoteData & noteData);
 
     using LineEventOpt = std::optional<LineEvent>;
@@ -54,7 +54,9 @@ public:
 private:
     size_t m_index = 0;
 
-    NoteDataS m_noteData;
+    //! Held in place rather than behind a pointer: a Column keeps its lines in one block, so an
+    //! empty line costs no allocation at all.
+    NoteData m_noteData;
 
     LineEventOpt m_lineEvent;
 };
@@ -426,7 +426,6 @@ Pattern::NoteDataS Pattern::noteDataAtPosition(const Position & position) const
 
 void Pattern::setNoteDataAtPosition(const NoteData & noteData, const Position & position) const
 {
-    juzzlin::L(TAG).debug() << "Set note data at position: " << noteData.toString() << " @ " << position.toString();
     trackByIndexThrow(position.track)->setNoteDataAtPosition(noteData, position);
 }
 
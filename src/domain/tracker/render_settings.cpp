@@ -184,6 +184,26 @@ void RenderSettings::setAnalyzeEnabled(bool enabled)
     m_analyzeEnabled = enabled;
 }
 
+bool RenderSettings::reproducibleEnabled() const
+{
+    return m_reproducibleEnabled;
+}
+
+void RenderSettings::setReproducibleEnabled(bool enabled)
+{
+    m_reproducibleEnabled = enabled;
+}
+
+int RenderSettings::randomSeed() const
+{
+    return m_randomSeed;
+}
+
+void RenderSettings::setRandomSeed(int seed)
+{
+    m_randomSeed = seed;
+}
+
 void RenderSettings::serializeToXml(ProjectWriter & writer) const
 {
     writer.writeStartElement(Constants::NahdXml::xmlKeyRenderSettings());
@@ -204,6 +224,8 @@ void RenderSettings::serializeToXml(ProjectWriter & writer) const
     writer.writeAttribute(Constants::NahdXml::xmlKeySilenceSeconds(), QString::number(m_silenceSeconds));
     writer.writeAttribute(Constants::NahdXml::xmlKeySilenceTenths(), QString::number(m_silenceTenths));
     writer.writeAttribute(Constants::NahdXml::xmlKeyAnalyzeEnabled(), m_analyzeEnabled ? Constants::NahdXml::xmlValueTrue() : Constants::NahdXml::xmlValueFalse());
+    writer.writeAttribute(Constants::NahdXml::xmlKeyReproducibleEnabled(), m_reproducibleEnabled ? Constants::NahdXml::xmlValueTrue() : Constants::NahdXml::xmlValueFalse());
+    writer.writeAttribute(Constants::NahdXml::xmlKeyRandomSeed(), QString::number(m_randomSeed));
 
     writer.writeEndElement(); // RenderSettings
 }
@@ -235,6 +257,8 @@ void RenderSettings::deserializeFromXml(ProjectReader & reader)
     m_silenceSeconds = integer(Constants::NahdXml::xmlKeySilenceSeconds(), m_silenceSeconds);
     m_silenceTenths = integer(Constants::NahdXml::xmlKeySilenceTenths(), m_silenceTenths);
     m_analyzeEnabled = boolean(Constants::NahdXml::xmlKeyAnalyzeEnabled(), m_analyzeEnabled);
+    m_reproducibleEnabled = boolean(Constants::NahdXml::xmlKeyReproducibleEnabled(), m_reproducibleEnabled);
+    m_randomSeed = integer(Constants::NahdXml::xmlKeyRandomSeed(), m_randomSeed);
 }
 
 } // namespace noteahead
@@ -91,6 +91,15 @@ public:
     bool analyzeEnabled() const;
     void setAnalyzeEnabled(bool enabled);
 
+    //! A reproducible render is bit-identical every time it is run: every random draw starts over
+    //! from randomSeed(), the devices are summed in a fixed order however the worker threads happened
+    //! to pick them up, and a hash of the rendered audio is written beside each file.
+    bool reproducibleEnabled() const;
+    void setReproducibleEnabled(bool enabled);
+
+    int randomSeed() const;
+    void setRandomSeed(int seed);
+
     void serializeToXml(ProjectWriter & writer) const;
     void deserializeFromXml(ProjectReader & reader);
 
@@ -112,6 +121,8 @@ private:
     int m_silenceSeconds = 0;
     int m_silenceTenths = 0;
     bool m_analyzeEnabled = true;
+    bool m_reproducibleEnabled = false;
+    int m_randomSeed = 0;
 };
 
 } // namespace noteahead
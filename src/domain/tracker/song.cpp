@@ -158,12 +158,19 @@ NoteChangeList Song::transposeSong(int semitones) const
         }
     }
 
-    NoteChangeList changes;
-    for (auto && [index, pattern] : m_patterns) {
+    // Patterns are scanned side by side and their changes joined in pattern order, so the result
+    // is the same as from a scan in line.
+    const std::vector<std::pair<size_t, PatternS>> patterns { m_patterns.begin(), m_patterns.end() };
+    std::vector<NoteChangeList> patternChanges(patterns.size());
+    Utils::Parallel::run(patterns.size(), [&](size_t i) {
         Position position;
-        position.pattern = index;
-        auto patternChanges = pattern->transposePattern(position, semitones, drumTracks);
-        changes.insert(changes.end(), patternChanges.begin(), patternChanges.end());
+        position.pattern = patterns.at(i).first;
+        patternChanges.at(i) = patterns.at(i).second->transposePattern(position, semitones, drumTracks);
+    });
+
+    NoteChangeList changes;
+    for (auto && patternChange : patternChanges) {
+        changes.insert(changes.end(), patternChange.begin(), patternChange.end());
     }
     return changes;
 }
@@ -609,6 +616,38 @@ void Song::setNoteDataAtPosition(const NoteData & noteData, const Position & pos
     m_patterns.at(position.pattern)->setNoteDataAtPosition(noteData, position);
 }
 
+void Song::applyNoteChanges(const NoteChangeList & changes, bool revert)
+{
+    juzzlin::L(TAG).debug() << "Applying " << changes.size() << " note changes";
+    const auto apply = [&](const NoteChange & change) {
+        m_patterns.at(change.position.pattern)->setNoteDataAtPosition(revert ? change.oldNoteData : change.newNoteData, change.position);
+    };
+
+    // Tracks share no lines, so each one is written on its own thread. A change list small enough
+    // to apply in the time a thread takes to start is applied in line.
+    static const size_t minChangesToSplit = 4096;
+    if (changes.size() < minChangesToSplit) {
+        std::ranges::for_each(changes, apply);
+        return;
+    }
+
+    // The order within a track is kept, so a position changed twice ends up as it would in line.
+    std::map<std::pair<size_t, size_t>, std::vector<const NoteChange *>> trackChanges;
+    for (auto && change : changes) {
+        trackChanges[{ change.position.pattern, change.position.track }].push_back(&change);
+    }
+    std::vector<std::vector<const NoteChange *>> groups;
+    groups.reserve(trackChanges.size());
+    for (auto && [address, group] : trackChanges) {
+        groups.push_back(std::move(group));
+    }
+    Utils::Parallel::run(groups.size(), [&](size_t i) {
+        for (auto && change : groups.at(i)) {
+            apply(*change);
+        }
+    });
+}
+
 Song::PositionList Song::deleteNoteDataAtPosition(const Position & position)
 {
     juzzlin::L(TAG).trace() << "Delete note data at position: " << position.toString();
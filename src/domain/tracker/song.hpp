@@ -175,6 +175,9 @@ public:
     using NoteDataS = std::shared_ptr<NoteData>;
     NoteDataS noteDataAtPosition(const Position & position) const;
     void setNoteDataAtPosition(const NoteData & noteData, const Position & position);
+    //! Sets the new note data of each change, or the old one when reverting. Large lists are
+    //! written in parallel, one track at a time per thread; all of it is done on return.
+    void applyNoteChanges(const NoteChangeList & changes, bool revert = false);
     PositionList deleteNoteDataAtPosition(const Position & position);
     PositionList insertNoteDataAtPosition(const NoteData & noteData, const Position & position);
 
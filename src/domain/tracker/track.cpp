@@ -361,7 +361,6 @@ Track::NoteDataS Track::noteDataAtPosition(const Position & position) const
 
 void Track::setNoteDataAtPosition(const NoteData & noteData, const Position & position)
 {
-    juzzlin::L(TAG).debug() << "Set note data at position: " << noteData.toString() << " @ " << position.toString();
     auto newNoteData = noteData;
     newNoteData.setTrack(index());
     columnByIndexThrow(position.column)->setNoteDataAtPosition(newNoteData, position);
@@ -0,0 +1,188 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "analysis_worker.hpp"
+
+#include <algorithm>
+
+namespace noteahead {
+
+AnalysisWorker & AnalysisWorker::instance()
+{
+    static AnalysisWorker worker;
+    return worker;
+}
+
+AnalysisWorker::~AnalysisWorker()
+{
+    // Every tap has normally left, and with it the thread, long before statics are destroyed.
+    {
+        const std::scoped_lock lock { m_tapMutex };
+        m_stopping = true;
+    }
+    m_condition.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+size_t AnalysisWorker::tapCount() const
+{
+    const std::scoped_lock lock { m_tapMutex };
+    return m_taps.size();
+}
+
+void AnalysisWorker::add(AnalysisTap * tap)
+{
+    const std::scoped_lock lifecycleLock { m_lifecycleMutex };
+    {
+        const std::scoped_lock lock { m_tapMutex };
+        m_taps.push_back(tap);
+        if (m_thread.joinable()) {
+            return;
+        }
+        m_stopping = false;
+    }
+    m_thread = std::thread { [this] { run(); } };
+}
+
+void AnalysisWorker::remove(AnalysisTap * tap)
+{
+    const std::scoped_lock lifecycleLock { m_lifecycleMutex };
+    {
+        // Once this returns the worker cannot be inside the tap: it only drains while holding the
+        // same lock.
+        const std::scoped_lock lock { m_tapMutex };
+        std::erase(m_taps, tap);
+        if (!m_taps.empty()) {
+            return;
+        }
+        m_stopping = true;
+    }
+    m_condition.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+void AnalysisWorker::run()
+{
+    std::unique_lock lock { m_tapMutex };
+    while (!m_stopping) {
+        for (auto && tap : m_taps) {
+            tap->drain();
+        }
+        m_condition.wait_for(lock, DrainInterval, [this] { return m_stopping; });
+    }
+}
+
+AnalysisTap::AnalysisTap(Analyser analyser, size_t capacityFrames)
+  : AnalysisTap { std::move(analyser), {}, capacityFrames }
+{
+}
+
+AnalysisTap::AnalysisTap(Analyser analyser, Reset reset, size_t capacityFrames)
+  : m_analyser { std::move(analyser) }
+  , m_reset { std::move(reset) }
+  , m_ring(capacityFrames * 2, 0.0)
+  , m_capacityFrames { capacityFrames }
+  , m_chunk(ChunkFrames * 2, 0.0)
+{
+    AnalysisWorker::instance().add(this);
+}
+
+AnalysisTap::~AnalysisTap()
+{
+    AnalysisWorker::instance().remove(this);
+}
+
+void AnalysisTap::capture(std::span<const double> interleaved, uint32_t frameCount, uint32_t sampleRate)
+{
+    const size_t head = m_head.load(std::memory_order_relaxed);
+    const size_t tail = m_tail.load(std::memory_order_acquire);
+    if (frameCount > m_capacityFrames - (head - tail)) {
+        m_dropped.fetch_add(frameCount, std::memory_order_relaxed);
+        return;
+    }
+
+    // At most two copies, either side of the wrap.
+    const size_t index = head % m_capacityFrames;
+    const size_t firstFrames = std::min<size_t>(frameCount, m_capacityFrames - index);
+    std::copy_n(interleaved.begin(), firstFrames * 2, m_ring.begin() + static_cast<ptrdiff_t>(index * 2));
+    std::copy_n(interleaved.begin() + static_cast<ptrdiff_t>(firstFrames * 2), (frameCount - firstFrames) * 2, m_ring.begin());
+
+    m_sampleRate.store(sampleRate, std::memory_order_relaxed);
+    m_head.store(head + frameCount, std::memory_order_release);
+}
+
+void AnalysisTap::discard()
+{
+    const size_t head = m_head.load(std::memory_order_acquire);
+    size_t discardedUpTo = m_discardedUpTo.load(std::memory_order_relaxed);
+    while (discardedUpTo < head && !m_discardedUpTo.compare_exchange_weak(discardedUpTo, head, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+    // Counted after the cut is stored, so a consumer that sees the count also sees the cut.
+    m_discards.fetch_add(1, std::memory_order_release);
+}
+
+void AnalysisTap::drain()
+{
+    const std::scoped_lock lock { m_drainMutex };
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+    const size_t head = m_head.load(std::memory_order_acquire);
+    const uint32_t sampleRate = m_sampleRate.load(std::memory_order_relaxed);
+    while (true) {
+        const uint32_t discards = m_discards.load(std::memory_order_acquire);
+        if (discards != m_handledDiscards) {
+            m_handledDiscards = discards;
+            tail = std::max(tail, m_discardedUpTo.load(std::memory_order_acquire));
+            m_tail.store(tail, std::memory_order_release);
+            if (m_reset) {
+                m_reset();
+            }
+        }
+        if (tail >= head) {
+            break;
+        }
+
+        const size_t index = tail % m_capacityFrames;
+        const size_t frames = std::min({ head - tail, m_capacityFrames - index, ChunkFrames });
+        const auto source = m_ring.begin() + static_cast<ptrdiff_t>(index * 2);
+        std::copy(source, source + static_cast<ptrdiff_t>(frames * 2), m_chunk.begin());
+
+        // Room is given back before the analysis runs, not after, so the audio thread can refill
+        // the ring while the worker is still busy measuring.
+        tail += frames;
+        m_tail.store(tail, std::memory_order_release);
+
+        // A discard that landed while the chunk was read may have been meant for it.
+        if (m_discards.load(std::memory_order_acquire) != discards) {
+            continue;
+        }
+        m_analyser(std::span<const double> { m_chunk.data(), frames * 2 }, static_cast<uint32_t>(frames), sampleRate);
+    }
+}
+
+void AnalysisTap::flush()
+{
+    drain();
+}
+
+uint64_t AnalysisTap::droppedFrames() const
+{
+    return m_dropped.load(std::memory_order_relaxed);
+}
+
+} // namespace noteahead
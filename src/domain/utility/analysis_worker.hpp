@@ -0,0 +1,154 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef ANALYSIS_WORKER_HPP
+#define ANALYSIS_WORKER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace noteahead {
+
+class AnalysisTap;
+
+//! The one thread every meter does its measuring on.
+//!
+//! A meter's passthrough costs nothing, but what it measures can cost a great deal: the RTA runs
+//! FFTs tens of thousands of points long, the LUFS meter K-weights and gates every sample, the
+//! dBTP meter interpolates four points per sample per channel. None of that has to happen before
+//! the block is handed to the sound card, only before the next screen refresh, so the audio thread
+//! just copies what it would have measured into an AnalysisTap and this thread does the rest.
+//!
+//! Shared rather than one per meter, since a rack full of meters would otherwise be a rack full of
+//! threads. An ordinary thread, which the real-time audio threads preempt whenever they need the
+//! core. It runs only while at least one tap exists.
+class AnalysisWorker
+{
+public:
+    static AnalysisWorker & instance();
+
+    AnalysisWorker(const AnalysisWorker &) = delete;
+    AnalysisWorker & operator=(const AnalysisWorker &) = delete;
+
+    //! Taps currently registered, which is also whether the thread is running.
+    size_t tapCount() const;
+
+private:
+    friend class AnalysisTap;
+
+    //! Well inside a screen refresh, so a reading is never more than a frame behind the audio.
+    static constexpr std::chrono::milliseconds DrainInterval { 5 };
+
+    AnalysisWorker() = default;
+    ~AnalysisWorker();
+
+    void add(AnalysisTap * tap);
+    void remove(AnalysisTap * tap);
+    void run();
+
+    //! Serialises starting and stopping the thread, so a tap arriving while the last one leaves
+    //! cannot see a thread that is about to exit.
+    std::mutex m_lifecycleMutex;
+
+    mutable std::mutex m_tapMutex;
+    std::condition_variable m_condition;
+    std::vector<AnalysisTap *> m_taps;
+    bool m_stopping { false };
+    std::thread m_thread;
+};
+
+//! A meter's way out of the audio thread: a lock-free single-producer, single-consumer ring the
+//! audio thread copies each block into, and the analysis the worker runs on whatever it finds there.
+//!
+//! Capturing takes no lock and allocates nothing. When the worker has fallen so far behind that the
+//! ring is full, the block is dropped and counted instead of waiting for room: a meter missing a
+//! block is a meter, the audio thread missing its deadline is a dropout.
+//!
+//! The analyser usually reaches into the meter that owns the tap, so the tap must be the owner's
+//! last member: members are destroyed in reverse order, and this one has to leave the worker before
+//! anything its analyser uses is gone.
+class AnalysisTap
+{
+public:
+    //! Interleaved stereo frames, and the rate they were captured at.
+    using Analyser = std::function<void(std::span<const double> interleaved, uint32_t frameCount, uint32_t sampleRate)>;
+    //! Clears whatever the analyser has accumulated. Run on the measuring thread; see discard().
+    using Reset = std::function<void()>;
+
+    //! Well over half a second at 48 kHz, so the worker can be starved for most of that before
+    //! anything is dropped.
+    static constexpr size_t DefaultCapacityFrames { 32768 };
+
+    explicit AnalysisTap(Analyser analyser, size_t capacityFrames = DefaultCapacityFrames);
+    AnalysisTap(Analyser analyser, Reset reset, size_t capacityFrames = DefaultCapacityFrames);
+    ~AnalysisTap();
+
+    AnalysisTap(const AnalysisTap &) = delete;
+    AnalysisTap & operator=(const AnalysisTap &) = delete;
+
+    //! Audio-thread: queues a block of interleaved stereo frames for analysis.
+    void capture(std::span<const double> interleaved, uint32_t frameCount, uint32_t sampleRate);
+
+    //! Analyses whatever has been captured so far on the calling thread, instead of waiting for the
+    //! worker. For tests and other callers that need the readings to reflect everything they fed in.
+    void flush();
+
+    //! Any thread, lock-free: drops every frame captured so far, and has the measuring thread run the
+    //! reset before it analyses anything captured since. A chunk already being analysed finishes
+    //! first and is then cleared with the rest, so no frame from before the call is counted after it.
+    void discard();
+
+    uint64_t droppedFrames() const;
+
+private:
+    friend class AnalysisWorker;
+
+    //! Frames handed to the analyser at once: large enough to amortise the call, small enough that
+    //! the consumer frees room in the ring steadily rather than all at the end.
+    static constexpr size_t ChunkFrames { 1024 };
+
+    void drain();
+
+    Analyser m_analyser;
+    Reset m_reset;
+    std::vector<double> m_ring;
+    size_t m_capacityFrames { 0 };
+    //! Frames written and read since the start. They only grow, so a position is never ambiguous
+    //! the way an index into the ring is once it wraps; the index is the position modulo capacity.
+    std::atomic<size_t> m_head { 0 };
+    std::atomic<size_t> m_tail { 0 };
+    std::atomic<uint32_t> m_sampleRate { 0 };
+    std::atomic<uint64_t> m_dropped { 0 };
+
+    //! Where the latest discard() cut the stream, and how many there have been.
+    std::atomic<size_t> m_discardedUpTo { 0 };
+    std::atomic<uint32_t> m_discards { 0 };
+
+    //! Only the consuming side locks: the worker and flush() may both want to drain.
+    std::mutex m_drainMutex;
+    std::vector<double> m_chunk;
+    uint32_t m_handledDiscards { 0 };
+};
+
+} // namespace noteahead
+
+#endif // ANALYSIS_WORKER_HPP
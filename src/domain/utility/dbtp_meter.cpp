@@ -16,6 +16,7 @@
 #include "dbtp_meter.hpp"
 
 #include "../../common/constants.hpp"
+#include "../dsp/audio_context.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -25,6 +26,9 @@ namespace noteahead {
 static constexpr float dbtpFloor = -70.0f;
 
 DbTpMeter::DbTpMeter()
+  : m_tap { [this](std::span<const double> interleaved, uint32_t frameCount, uint32_t sampleRate) {
+      analyse(interleaved, frameCount, sampleRate);
+  }, [this] { resetState(); } }
 {
 }
 
@@ -43,16 +47,16 @@ std::string DbTpMeter::typeId() const
     return typeIdString();
 }
 
-void DbTpMeter::updateDecayParams()
+void DbTpMeter::updateDecayParams(double sampleRate)
 {
-    if (m_sampleRate <= 0) {
+    if (sampleRate <= 0) {
         return;
     }
     // Running bar: -20 dB/s release (PPM-style)
-    m_decayPerSample = std::pow(10.0, -1.0 / m_sampleRate);
+    m_decayPerSample = std::pow(10.0, -1.0 / sampleRate);
     // Peak hold: 2 seconds, then -60 dB/s decay
-    m_holdSamples = static_cast<int>(2.0 * m_sampleRate);
-    m_holdDecayPerSample = std::pow(10.0, -3.0 / m_sampleRate);
+    m_holdSamples = static_cast<int>(2.0 * sampleRate);
+    m_holdDecayPerSample = std::pow(10.0, -3.0 / sampleRate);
 }
 
 // Catmull-Rom / Hermite interpolation at position t ∈ (0, 1)
@@ -116,10 +120,41 @@ void DbTpMeter::processSample(double & left, double & right)
         return;
     }
 
-    if (const auto sr = static_cast<uint32_t>(m_sampleRate); sr != m_lastSampleRate) {
-        m_lastSampleRate = sr;
-        updateDecayParams();
-        reset();
+    if (m_resetRequested.exchange(false)) {
+        resetState();
+    }
+
+    measure(left, right, static_cast<uint32_t>(m_sampleRate));
+}
+
+void DbTpMeter::processBlock(AudioContext & context)
+{
+    const auto sampleRate = context.sampleRate ? context.sampleRate : static_cast<uint32_t>(m_sampleRate);
+    if (!sampleRate) {
+        return;
+    }
+
+    m_tap.capture(context.buffer, context.frameCount, sampleRate);
+}
+
+void DbTpMeter::analyse(std::span<const double> interleaved, uint32_t frameCount, uint32_t sampleRate)
+{
+    for (uint32_t i = 0; i < frameCount; i++) {
+        measure(interleaved[i * 2], interleaved[i * 2 + 1], sampleRate);
+    }
+}
+
+void DbTpMeter::flushAnalysis()
+{
+    m_tap.flush();
+}
+
+void DbTpMeter::measure(double left, double right, uint32_t sampleRate)
+{
+    if (sampleRate != m_lastSampleRate) {
+        m_lastSampleRate = sampleRate;
+        updateDecayParams(sampleRate);
+        resetState();
     }
 
     processChannel(left, m_peakL, m_peakHoldL, m_holdCounterL, m_bufL);
@@ -132,6 +167,19 @@ void DbTpMeter::processSample(double & left, double & right)
 }
 
 void DbTpMeter::reset()
+{
+    // The running state belongs to whichever thread measures, which drops it before it next does,
+    // along with every block still queued from before. The readings blank here so the display
+    // drops at once.
+    m_truePeakL = dbtpFloor;
+    m_truePeakR = dbtpFloor;
+    m_truePeakHoldL = dbtpFloor;
+    m_truePeakHoldR = dbtpFloor;
+    m_resetRequested = true;
+    m_tap.discard();
+}
+
+void DbTpMeter::resetState()
 {
     m_bufL.fill(0.0);
     m_bufR.fill(0.0);
@@ -17,14 +17,17 @@
 #define DBTP_METER_HPP
 
 #include "../effects/effect.hpp"
+#include "analysis_worker.hpp"
 
 #include <array>
+#include <atomic>
 #include <cstdint>
 
 namespace noteahead {
 
 // ITU-R BS.1770-4 True Peak meter using 4x Hermite interpolation.
 // Exposes per-channel running peak and 2-second peak hold, both in dBTP.
+// Block input is only captured on the audio thread and measured on the AnalysisWorker.
 class DbTpMeter : public Effect
 {
 public:
@@ -35,6 +38,7 @@ public:
     std::string typeId() const override;
 
     void processSample(double & left, double & right) override;
+    void processBlock(AudioContext & context) override;
     void reset() override;
     void sync() override;
 
@@ -43,8 +47,14 @@ public:
     float truePeakHoldL() const;
     float truePeakHoldR() const;
 
+    //! Measures everything captured so far on the calling thread.
+    void flushAnalysis();
+
 private:
-    void updateDecayParams();
+    void measure(double left, double right, uint32_t sampleRate);
+    void analyse(std::span<const double> interleaved, uint32_t frameCount, uint32_t sampleRate);
+    void resetState();
+    void updateDecayParams(double sampleRate);
 
     double hermiteAt(const std::array<double, 4> & buf, double t) const;
     void processChannel(double sample, double & peak, double & peakHold, int & holdCounter, std::array<double, 4> & buf);
@@ -72,12 +82,17 @@ private:
     double m_holdDecayPerSample { 0.0 };
     int m_holdSamples { 0 };
 
-    float m_truePeakL { -70.0f };
-    float m_truePeakR { -70.0f };
-    float m_truePeakHoldL { -70.0f };
-    float m_truePeakHoldR { -70.0f };
+    // Read from the UI thread while the measuring thread writes them.
+    std::atomic<float> m_truePeakL { -70.0f };
+    std::atomic<float> m_truePeakR { -70.0f };
+    std::atomic<float> m_truePeakHoldL { -70.0f };
+    std::atomic<float> m_truePeakHoldR { -70.0f };
+    std::atomic<bool> m_resetRequested { false };
 
     uint32_t m_lastSampleRate { 0 };
+
+    //! Last, so it stops measuring before anything above is destroyed.
+    AnalysisTap m_tap;
 };
 
 } // namespace noteahead
@@ -0,0 +1,393 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "dsp_profiler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <set>
+#include <sstream>
+
+namespace noteahead {
+
+namespace {
+
+//! The binding of the calling thread, innermost first. A device's insert rack is processed inside
+//! the device's own binding, so bindings nest.
+thread_local const DspProfiler::LaneBinding * currentBinding { nullptr };
+
+std::string engineScopeName(DspProfiler::Scope scope)
+{
+    switch (scope) {
+    case DspProfiler::Scope::Callback:
+        return "Engine: callback";
+    case DspProfiler::Scope::GraphRebuild:
+        return "Engine: graph rebuild";
+    case DspProfiler::Scope::Devices:
+        return "Engine: devices";
+    case DspProfiler::Scope::LaneSumming:
+        return "Engine: lane summing";
+    case DspProfiler::Scope::Sends:
+        return "Engine: sends";
+    case DspProfiler::Scope::MasterInserts:
+        return "Engine: master inserts";
+    default:
+        return "Engine";
+    }
+}
+
+const char * categoryName(DspProfiler::Scope scope)
+{
+    if (scope == DspProfiler::Scope::Lane) {
+        return "lane";
+    }
+    return scope < DspProfiler::Scope::Lane ? "engine" : "dsp";
+}
+
+std::string escapeJson(const std::string & text)
+{
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (auto && c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+
+} // namespace
+
+DspProfiler::DspProfiler(size_t laneCount)
+{
+    m_lanes.reserve(laneCount + 1);
+    for (size_t lane = 0; lane < laneCount + 1; lane++) {
+        auto ring = std::make_unique<LaneRing>();
+        ring->events.resize(RingCapacity);
+        m_lanes.push_back(std::move(ring));
+    }
+}
+
+DspProfiler::~DspProfiler()
+{
+    setActive(false);
+}
+
+std::string DspProfiler::scopeName(uint32_t key)
+{
+    const auto scope = static_cast<Scope>(key >> 24);
+    const auto owner = std::to_string((key >> 12) & 0xfff);
+    const auto index = std::to_string(key & 0xfff);
+    switch (scope) {
+    case Scope::Lane:
+        return "Lane " + owner;
+    case Scope::Device:
+        return "Device " + owner;
+    case Scope::DeviceInserts:
+        return "Device " + owner + " inserts";
+    case Scope::InsertEffect:
+        return "Device " + owner + " insert " + index;
+    case Scope::SendEffect:
+        return "Send " + index;
+    case Scope::MasterInsertEffect:
+        return "Master insert " + index;
+    default:
+        return engineScopeName(scope);
+    }
+}
+
+void DspProfiler::setActive(bool active)
+{
+    std::unique_lock lock { m_collectorMutex };
+    if (active == m_active.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    if (active) {
+        lock.unlock();
+        clear();
+        lock.lock();
+        m_collectorStopping = false;
+        m_active.store(true, std::memory_order_release);
+        m_collector = std::thread { [this] { collectorLoop(); } };
+    } else {
+        m_active.store(false, std::memory_order_release);
+        m_collectorStopping = true;
+        lock.unlock();
+        m_collectorCondition.notify_all();
+        if (m_collector.joinable()) {
+            m_collector.join();
+        }
+        collect();
+    }
+}
+
+bool DspProfiler::active() const
+{
+    return m_active.load(std::memory_order_relaxed);
+}
+
+size_t DspProfiler::laneCount() const
+{
+    return m_lanes.size();
+}
+
+size_t DspProfiler::callbackLane() const
+{
+    return m_lanes.size() - 1;
+}
+
+void DspProfiler::record(size_t lane, uint32_t key, Clock::time_point started, Clock::time_point finished)
+{
+    record(lane, key, started, finished, m_session.load(std::memory_order_acquire));
+}
+
+void DspProfiler::record(size_t lane, uint32_t key, Clock::time_point started, Clock::time_point finished, uint32_t session)
+{
+    if (!m_active.load(std::memory_order_relaxed) || lane >= m_lanes.size()) {
+        return;
+    }
+
+    auto && ring = *m_lanes.at(lane);
+    const size_t head = ring.head.load(std::memory_order_relaxed);
+    const size_t next = (head + 1) % RingCapacity;
+    if (next == ring.tail.load(std::memory_order_acquire)) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    ring.events[head] = {
+        key,
+        static_cast<uint32_t>(lane),
+        std::chrono::duration_cast<std::chrono::nanoseconds>(started - m_origin).count(),
+        std::chrono::duration_cast<std::chrono::nanoseconds>(finished - started).count(),
+        session
+    };
+    ring.head.store(next, std::memory_order_release);
+}
+
+void DspProfiler::collect()
+{
+    const std::scoped_lock lock { m_dataMutex };
+    const uint32_t session = m_session.load(std::memory_order_acquire);
+    for (auto && ring : m_lanes) {
+        size_t tail = ring->tail.load(std::memory_order_relaxed);
+        const size_t head = ring->head.load(std::memory_order_acquire);
+        while (tail != head) {
+            const auto & event = ring->events[tail];
+            if (event.session != session) {
+                tail = (tail + 1) % RingCapacity;
+                continue;
+            }
+            m_histograms[event.key].add(event.durationNs);
+            if (m_trace.size() == MaxTraceEvents) {
+                m_trace.pop_front();
+            }
+            m_trace.push_back(event);
+            tail = (tail + 1) % RingCapacity;
+        }
+        ring->tail.store(tail, std::memory_order_release);
+    }
+}
+
+void DspProfiler::collectorLoop()
+{
+    std::unique_lock lock { m_collectorMutex };
+    while (!m_collectorStopping) {
+        m_collectorCondition.wait_for(lock, CollectInterval, [this] { return m_collectorStopping; });
+        lock.unlock();
+        collect();
+        lock.lock();
+    }
+}
+
+void DspProfiler::clear()
+{
+    const std::scoped_lock lock { m_dataMutex };
+    // Draining the rings is not enough on its own: a scope still open on an audio thread records
+    // into them after this returns. The new session tells its event apart.
+    m_session.fetch_add(1, std::memory_order_acq_rel);
+    for (auto && ring : m_lanes) {
+        ring->tail.store(ring->head.load(std::memory_order_acquire), std::memory_order_release);
+    }
+    m_histograms.clear();
+    m_trace.clear();
+    m_dropped.store(0, std::memory_order_relaxed);
+    m_origin = Clock::now();
+}
+
+std::vector<DspProfiler::Statistics> DspProfiler::statistics() const
+{
+    std::vector<Statistics> result;
+    {
+        const std::scoped_lock lock { m_dataMutex };
+        result.reserve(m_histograms.size());
+        for (auto && [key, histogram] : m_histograms) {
+            result.push_back({ key,
+                               scopeName(key),
+                               histogram.count,
+                               histogram.percentileUs(0.5),
+                               histogram.percentileUs(0.99),
+                               static_cast<double>(histogram.maxNs) / 1000.0 });
+        }
+    }
+
+    std::ranges::stable_sort(result, [](auto && a, auto && b) { return a.p99Us > b.p99Us; });
+    return result;
+}
+
+std::string DspProfiler::chromeTraceJson() const
+{
+    std::ostringstream json;
+    json << "{\"traceEvents\":[";
+
+    const std::scoped_lock lock { m_dataMutex };
+    bool first = true;
+    std::set<uint32_t> lanes;
+    for (auto && event : m_trace) {
+        json << (first ? "" : ",") << "\n{\"name\":\"" << escapeJson(scopeName(event.key)) << "\",\"cat\":\""
+             << categoryName(static_cast<Scope>(event.key >> 24))
+             << "\",\"ph\":\"X\",\"ts\":" << static_cast<double>(event.startNs) / 1000.0
+             << ",\"dur\":" << static_cast<double>(event.durationNs) / 1000.0
+             << ",\"pid\":1,\"tid\":" << event.lane << "}";
+        lanes.insert(event.lane);
+        first = false;
+    }
+
+    for (auto && lane : lanes) {
+        json << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << lane
+             << ",\"args\":{\"name\":\"" << (lane == callbackLane() ? std::string { "Callback" } : "Lane " + std::to_string(lane)) << "\"}}";
+        first = false;
+    }
+
+    json << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    return json.str();
+}
+
+bool DspProfiler::writeChromeTrace(const std::string & path) const
+{
+    std::ofstream file { path, std::ios::binary | std::ios::trunc };
+    if (!file) {
+        return false;
+    }
+    file << chromeTraceJson();
+    return static_cast<bool>(file);
+}
+
+uint64_t DspProfiler::droppedEvents() const
+{
+    return m_dropped.load(std::memory_order_relaxed);
+}
+
+size_t DspProfiler::binFor(int64_t durationNs)
+{
+    if (durationNs <= FirstBinNs) {
+        return 0;
+    }
+
+    const double octaves = std::log2(static_cast<double>(durationNs) / static_cast<double>(FirstBinNs));
+    return std::min(static_cast<size_t>(std::ceil(octaves * BinsPerOctave)), BinCount - 1);
+}
+
+double DspProfiler::binUpperNs(size_t bin)
+{
+    return static_cast<double>(FirstBinNs) * std::exp2(static_cast<double>(bin) / BinsPerOctave);
+}
+
+void DspProfiler::Histogram::add(int64_t durationNs)
+{
+    bins.at(binFor(durationNs))++;
+    count++;
+    maxNs = std::max(maxNs, durationNs);
+}
+
+double DspProfiler::Histogram::percentileUs(double fraction) const
+{
+    if (!count) {
+        return 0.0;
+    }
+
+    // The upper edge of the bin the percentile falls in, so the figure errs high, never low, and
+    // never above the largest duration actually seen.
+    const auto target = static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(count)));
+    uint64_t seen = 0;
+    for (size_t bin = 0; bin < BinCount; bin++) {
+        seen += bins.at(bin);
+        if (seen >= target) {
+            return std::min(binUpperNs(bin), static_cast<double>(maxNs)) / 1000.0;
+        }
+    }
+    return static_cast<double>(maxNs) / 1000.0;
+}
+
+DspProfiler::LaneBinding::LaneBinding(DspProfiler * profiler, size_t lane, Scope rackEffectScope, uint32_t owner)
+  : m_profiler { profiler }
+  , m_lane { lane }
+  , m_rackEffectScope { rackEffectScope }
+  , m_owner { owner }
+  , m_previous { currentBinding }
+{
+    if (m_profiler && m_profiler->active()) {
+        currentBinding = this;
+    } else {
+        m_profiler = nullptr;
+    }
+}
+
+DspProfiler::LaneBinding::~LaneBinding()
+{
+    if (m_profiler) {
+        currentBinding = m_previous;
+    }
+}
+
+DspProfiler::ScopedTimer::ScopedTimer(DspProfiler * profiler, size_t lane, uint32_t key)
+  : m_profiler { profiler && profiler->active() ? profiler : nullptr }
+  , m_lane { lane }
+  , m_key { key }
+{
+    if (m_profiler) {
+        m_session = m_profiler->m_session.load(std::memory_order_acquire);
+        m_started = Clock::now();
+    }
+}
+
+DspProfiler::ScopedTimer::~ScopedTimer()
+{
+    if (m_profiler) {
+        m_profiler->record(m_lane, m_key, m_started, Clock::now(), m_session);
+    }
+}
+
+DspProfiler::RackEffectTimer::RackEffectTimer(size_t effectIndex)
+  : m_binding { currentBinding }
+{
+    if (m_binding) {
+        m_key = key(m_binding->m_rackEffectScope, m_binding->m_owner, static_cast<uint32_t>(effectIndex));
+        m_session = m_binding->m_profiler->m_session.load(std::memory_order_acquire);
+        m_started = Clock::now();
+    }
+}
+
+DspProfiler::RackEffectTimer::~RackEffectTimer()
+{
+    if (m_binding) {
+        m_binding->m_profiler->record(m_binding->m_lane, m_key, m_started, Clock::now(), m_session);
+    }
+}
+
+} // namespace noteahead
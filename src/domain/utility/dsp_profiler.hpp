@@ -0,0 +1,242 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DSP_PROFILER_HPP
+#define DSP_PROFILER_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace noteahead {
+
+//! Where the audio callback's time goes, one timed scope at a time.
+//!
+//! LoadMeter answers "how busy", this answers "busy with what": every device, every insert and send
+//! effect, every engine phase and every worker lane records how long it took, each block. The audio
+//! side only writes fixed-size events into a ring of its own lane, so recording takes no lock and
+//! allocates nothing; a collector thread drains the rings into per-scope latency histograms and a
+//! bounded event history that exports as a Chrome trace (chrome://tracing, or ui.perfetto.dev).
+//!
+//! A lane is a worker index of the RealTimeWorkerPool, plus one more, callbackLane(), for the
+//! engine's own phases. Each lane has one writer at a time: a worker only runs inside the pool's
+//! fan-out, and the callback thread only borrows lane 0 when it is processing serially, with the
+//! pool's handshake ordering the two.
+//!
+//! Like the meters it is a no-op until switched on.
+class DspProfiler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class Scope : uint8_t
+    {
+        Callback,
+        GraphRebuild,
+        Devices,
+        LaneSumming,
+        Sends,
+        MasterInserts,
+        Lane,
+        Device,
+        DeviceInserts,
+        InsertEffect,
+        SendEffect,
+        MasterInsertEffect
+    };
+
+    //! A scope and what it belongs to, packed: a device slot, a send or a lane as the owner, and an
+    //! effect's position in its rack as the index. Packed so the audio side records a plain integer.
+    static constexpr uint32_t key(Scope scope, uint32_t owner = 0, uint32_t index = 0)
+    {
+        return (static_cast<uint32_t>(scope) << 24) | ((owner & 0xfff) << 12) | (index & 0xfff);
+    }
+    static std::string scopeName(uint32_t key);
+
+    struct Event
+    {
+        uint32_t key { 0 };
+        uint32_t lane { 0 };
+        int64_t startNs { 0 };
+        int64_t durationNs { 0 };
+        //! The recording session the scope started in; see setActive().
+        uint32_t session { 0 };
+    };
+
+    struct Statistics
+    {
+        uint32_t key { 0 };
+        std::string name;
+        uint64_t count { 0 };
+        double p50Us { 0.0 };
+        double p99Us { 0.0 };
+        double maxUs { 0.0 };
+    };
+
+    explicit DspProfiler(size_t laneCount);
+    ~DspProfiler();
+
+    DspProfiler(const DspProfiler &) = delete;
+    DspProfiler & operator=(const DspProfiler &) = delete;
+
+    //! Starts or stops recording. Starting clears what the previous session gathered, and a scope
+    //! that started before that is not counted when it finishes.
+    void setActive(bool active);
+    bool active() const;
+
+    //! Lanes available to record on, callbackLane() included.
+    size_t laneCount() const;
+    size_t callbackLane() const;
+
+    //! Audio-thread: records one timed scope on the given lane. Dropped, and counted, when the lane's
+    //! ring is full, rather than ever blocking.
+    void record(size_t lane, uint32_t key, Clock::time_point started, Clock::time_point finished);
+
+    //! Drains the rings now instead of waiting for the collector. Safe from any non-audio thread.
+    void collect();
+
+    //! Latency per scope over everything gathered so far, worst p99 first.
+    std::vector<Statistics> statistics() const;
+
+    //! The gathered history as Chrome trace event JSON.
+    std::string chromeTraceJson() const;
+    bool writeChromeTrace(const std::string & path) const;
+
+    uint64_t droppedEvents() const;
+
+    //! Binds the calling thread to a lane for as long as it lives, and names whose effect rack it is
+    //! about to process. Lets code that knows nothing about the engine, an effect rack, time its
+    //! own parts through RackEffectTimer.
+    class LaneBinding
+    {
+    public:
+        LaneBinding(DspProfiler * profiler, size_t lane, Scope rackEffectScope, uint32_t owner);
+        ~LaneBinding();
+
+        LaneBinding(const LaneBinding &) = delete;
+        LaneBinding & operator=(const LaneBinding &) = delete;
+
+    private:
+        friend class DspProfiler;
+        DspProfiler * m_profiler { nullptr };
+        size_t m_lane { 0 };
+        Scope m_rackEffectScope { Scope::InsertEffect };
+        uint32_t m_owner { 0 };
+        const LaneBinding * m_previous { nullptr };
+    };
+
+    //! Times a scope on a lane. Costs one atomic load when the profiler is off or absent.
+    class ScopedTimer
+    {
+    public:
+        ScopedTimer(DspProfiler * profiler, size_t lane, uint32_t key);
+        ~ScopedTimer();
+
+        ScopedTimer(const ScopedTimer &) = delete;
+        ScopedTimer & operator=(const ScopedTimer &) = delete;
+
+    private:
+        DspProfiler * m_profiler { nullptr };
+        size_t m_lane { 0 };
+        uint32_t m_key { 0 };
+        uint32_t m_session { 0 };
+        Clock::time_point m_started {};
+    };
+
+    //! Times one effect of the rack the calling thread's LaneBinding is processing. Does nothing
+    //! when the thread has no binding, which is the case for every rack outside the engine.
+    class RackEffectTimer
+    {
+    public:
+        explicit RackEffectTimer(size_t effectIndex);
+        ~RackEffectTimer();
+
+        RackEffectTimer(const RackEffectTimer &) = delete;
+        RackEffectTimer & operator=(const RackEffectTimer &) = delete;
+
+    private:
+        const LaneBinding * m_binding { nullptr };
+        uint32_t m_key { 0 };
+        uint32_t m_session { 0 };
+        Clock::time_point m_started {};
+    };
+
+private:
+    //! A quarter octave per bin from 64 ns up, which is plenty to tell a p99 from a p50 and keeps a
+    //! histogram small enough to hold one per scope without thinking about it.
+    static constexpr size_t BinsPerOctave { 4 };
+    static constexpr size_t BinCount { 24 * BinsPerOctave };
+    static constexpr int64_t FirstBinNs { 64 };
+    //! Events per lane between two collector passes. At a 64-frame buffer and a few dozen scopes
+    //! that is still well over a collector interval's worth.
+    static constexpr size_t RingCapacity { 16384 };
+    //! About six megabytes of history, and several seconds of a busy song.
+    static constexpr size_t MaxTraceEvents { 262144 };
+    static constexpr std::chrono::milliseconds CollectInterval { 20 };
+
+    struct Histogram
+    {
+        std::array<uint64_t, BinCount> bins {};
+        uint64_t count { 0 };
+        int64_t maxNs { 0 };
+
+        void add(int64_t durationNs);
+        double percentileUs(double fraction) const;
+    };
+
+    struct LaneRing
+    {
+        std::vector<Event> events;
+        std::atomic<size_t> head { 0 };
+        std::atomic<size_t> tail { 0 };
+    };
+
+    static size_t binFor(int64_t durationNs);
+    static double binUpperNs(size_t bin);
+
+    void record(size_t lane, uint32_t key, Clock::time_point started, Clock::time_point finished, uint32_t session);
+    void collectorLoop();
+    void clear();
+
+    std::vector<std::unique_ptr<LaneRing>> m_lanes;
+    std::atomic<bool> m_active { false };
+    std::atomic<uint64_t> m_dropped { 0 };
+    //! Bumped by every clear(). Events tagged with an earlier session are still in flight from
+    //! before it, or were recorded by a scope that straddled it, and are dropped when collected.
+    std::atomic<uint32_t> m_session { 0 };
+    Clock::time_point m_origin { Clock::now() };
+
+    mutable std::mutex m_dataMutex;
+    std::map<uint32_t, Histogram> m_histograms;
+    std::deque<Event> m_trace;
+
+    std::mutex m_collectorMutex;
+    std::condition_variable m_collectorCondition;
+    bool m_collectorStopping { false };
+    std::thread m_collector;
+};
+
+} // namespace noteahead
+
+#endif // DSP_PROFILER_HPP
@@ -35,14 +35,21 @@ bool LoadMeter::active() const
 
 void LoadMeter::addBlock(std::chrono::nanoseconds elapsed, double bufferSeconds)
 {
-    if (!m_active.load() || bufferSeconds <= 0.0) {
+    if (bufferSeconds <= 0.0) {
+        return;
+    }
+
+    const float smoothing = std::min(1.0f, static_cast<float>(bufferSeconds) / WindowSeconds);
+    const float cost = m_costNanoseconds.load(std::memory_order_relaxed);
+    m_costNanoseconds.store(cost + smoothing * (static_cast<float>(elapsed.count()) - cost), std::memory_order_relaxed);
+
+    if (!m_active.load()) {
         return;
     }
 
     const double seconds = std::chrono::duration<double>(elapsed).count();
     const auto percent = static_cast<float>(100.0 * seconds / bufferSeconds);
 
-    const float smoothing = std::min(1.0f, static_cast<float>(bufferSeconds) / WindowSeconds);
     const float load = m_load.load();
     m_load.store(load + smoothing * (percent - load));
 
@@ -80,6 +87,11 @@ uint64_t LoadMeter::overrunCount() const
     return m_overruns.load();
 }
 
+float LoadMeter::costNanoseconds() const
+{
+    return m_costNanoseconds.load(std::memory_order_relaxed);
+}
+
 void LoadMeter::reset()
 {
     m_load.store(0.0f);
@@ -34,7 +34,8 @@ public:
     void setActive(bool active);
     bool active() const;
 
-    //! Audio-thread: record how long a buffer took against how long it lasts. No-op when inactive.
+    //! Audio-thread: record how long a buffer took against how long it lasts. Only the cost is
+    //! tracked while inactive.
     void addBlock(std::chrono::nanoseconds elapsed, double bufferSeconds);
 
     //! Smoothed load, in percent of the real-time budget.
@@ -46,6 +47,11 @@ public:
     //! counts what the listener hears as a dropout.
     uint64_t overrunCount() const;
 
+    //! Recent time taken per block, smoothed, in nanoseconds. Unlike the rest this is tracked even
+    //! while the meter is off: the engine orders its threaded work by it, and that cannot wait for
+    //! the meters to be on screen. Survives reset() for the same reason.
+    float costNanoseconds() const;
+
     void reset();
 
 private:
@@ -61,6 +67,7 @@ private:
     std::atomic<float> m_peak { 0.0f };
     std::atomic<float> m_peakHoldSeconds { 0.0f };
     std::atomic<uint64_t> m_overruns { 0 };
+    std::atomic<float> m_costNanoseconds { 0.0f };
 };
 
 } // namespace noteahead
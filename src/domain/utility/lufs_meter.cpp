@@ -16,6 +16,7 @@
 #include "lufs_meter.hpp"
 
 #include "../../common/constants.hpp"
+#include "../dsp/audio_context.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -44,6 +45,9 @@ float powerToDisplayLufs(double power)
 } // namespace
 
 LufsMeter::LufsMeter()
+  : m_tap { [this](std::span<const double> interleaved, uint32_t frameCount, uint32_t sampleRate) {
+      analyse(interleaved, frameCount, sampleRate);
+  }, [this] { resetState(); } }
 {
 }
 
@@ -62,9 +66,9 @@ std::string LufsMeter::typeId() const
     return typeIdString();
 }
 
-void LufsMeter::updateCoefficients()
+void LufsMeter::updateCoefficients(double sampleRate)
 {
-    const double fs = m_sampleRate;
+    const double fs = sampleRate;
     if (fs <= 0) {
         return;
     }
@@ -208,13 +212,40 @@ void LufsMeter::processSample(double & left, double & right)
     }
 
     if (m_resetRequested.exchange(false)) {
-        reset();
+        resetState();
     }
 
-    if (const auto sr = static_cast<uint32_t>(m_sampleRate); sr != m_lastSampleRate) {
-        m_lastSampleRate = sr;
-        updateCoefficients();
-        reset();
+    measure(left, right, static_cast<uint32_t>(m_sampleRate));
+}
+
+void LufsMeter::processBlock(AudioContext & context)
+{
+    const auto sampleRate = context.sampleRate ? context.sampleRate : static_cast<uint32_t>(m_sampleRate);
+    if (!sampleRate) {
+        return;
+    }
+
+    m_tap.capture(context.buffer, context.frameCount, sampleRate);
+}
+
+void LufsMeter::analyse(std::span<const double> interleaved, uint32_t frameCount, uint32_t sampleRate)
+{
+    for (uint32_t i = 0; i < frameCount; i++) {
+        measure(interleaved[i * 2], interleaved[i * 2 + 1], sampleRate);
+    }
+}
+
+void LufsMeter::flushAnalysis()
+{
+    m_tap.flush();
+}
+
+void LufsMeter::measure(double left, double right, uint32_t sampleRate)
+{
+    if (sampleRate != m_lastSampleRate) {
+        m_lastSampleRate = sampleRate;
+        updateCoefficients(sampleRate);
+        resetState();
     }
 
     const double wL = applyKWeightL(left);
@@ -230,6 +261,11 @@ void LufsMeter::processSample(double & left, double & right)
 }
 
 void LufsMeter::reset()
+{
+    requestReset();
+}
+
+void LufsMeter::resetState()
 {
     m_z1s1L = m_z2s1L = m_z1s2L = m_z2s2L = 0.0;
     m_z1s1R = m_z2s1R = m_z1s2R = m_z2s2R = 0.0;
@@ -255,6 +291,8 @@ void LufsMeter::requestReset()
     m_shortTermLufs = lufsMin;
     m_integratedLufs = lufsMin;
     m_resetRequested = true;
+    // Blocks still queued from before the reset would otherwise be counted after it.
+    m_tap.discard();
 }
 
 void LufsMeter::sync()
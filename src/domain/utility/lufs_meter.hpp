@@ -17,6 +17,7 @@
 #define LUFS_METER_HPP
 
 #include "../effects/effect.hpp"
+#include "analysis_worker.hpp"
 
 #include <array>
 #include <atomic>
@@ -24,6 +25,9 @@
 
 namespace noteahead {
 
+//! K-weighted loudness per ITU-R BS.1770-4. Fed a block at a time, as the racks do, it only
+//! captures on the audio thread and measures on the AnalysisWorker; fed sample by sample it
+//! measures in place.
 class LufsMeter : public Effect
 {
 public:
@@ -34,6 +38,7 @@ public:
     std::string typeId() const override;
 
     void processSample(double & left, double & right) override;
+    void processBlock(AudioContext & context) override;
     void reset() override;
     void sync() override;
 
@@ -43,11 +48,17 @@ public:
     float integratedLufs() const;
 
     //! Clear the meter from another thread. The readings blank immediately; the accumulated state is
-    //! dropped by the audio thread at the next sample, so no state is touched from under it.
+    //! dropped by whichever thread measures next, so no state is touched from under it.
     void requestReset();
 
+    //! Measures everything captured so far on the calling thread.
+    void flushAnalysis();
+
 private:
-    void updateCoefficients();
+    void measure(double left, double right, uint32_t sampleRate);
+    void analyse(std::span<const double> interleaved, uint32_t frameCount, uint32_t sampleRate);
+    void resetState();
+    void updateCoefficients(double sampleRate);
     double applyKWeightL(double x);
     double applyKWeightR(double x);
     void advanceBlock(double meanPower);
@@ -91,13 +102,16 @@ private:
     double m_absGatedPowerSum { 0.0 };
     uint64_t m_absGatedCount { 0 };
 
-    // Read from the UI thread while the audio thread writes them.
+    // Read from the UI thread while the measuring thread writes them.
     std::atomic<float> m_momentaryLufs { -70.0f };
     std::atomic<float> m_shortTermLufs { -70.0f };
     std::atomic<float> m_integratedLufs { -70.0f };
     std::atomic<bool> m_resetRequested { false };
 
     uint32_t m_lastSampleRate { 0 };
+
+    //! Last, so it stops measuring before anything above is destroyed.
+    AnalysisTap m_tap;
 };
 
 } // namespace noteahead
@@ -26,6 +26,9 @@
 namespace noteahead {
 
 Rta::Rta()
+  : m_tap { [this](std::span<const double> interleaved, uint32_t frameCount, uint32_t sampleRate) {
+      analyse(interleaved, frameCount, sampleRate);
+  }, [this] { resetAnalysis(); } }
 {
     addParameter(Parameter { Constants::NahdXml::xmlKeyBandCount().toStdString(), 0.0f, 0, 2, 0, 1, Parameter::Type::Discrete });
     addParameter(Parameter { Constants::NahdXml::xmlKeyDbRange().toStdString(), 2.0f, 0, 3, 2, 1, Parameter::Type::Discrete });
@@ -287,18 +290,28 @@ void Rta::processBlock(AudioContext & context)
         return;
     }
 
+    m_tap.capture(context.buffer, context.frameCount, context.sampleRate);
+}
+
+void Rta::flushAnalysis()
+{
+    m_tap.flush();
+}
+
+void Rta::analyse(std::span<const double> interleaved, uint32_t frameCount, uint32_t sampleRate)
+{
     if (m_shouldSync) {
         syncParameters();
     }
 
-    if (context.sampleRate != m_lastSampleRate) {
-        m_lastSampleRate = context.sampleRate;
-        m_sampleRateCached = static_cast<double>(context.sampleRate);
+    if (sampleRate != m_lastSampleRate) {
+        m_lastSampleRate = sampleRate;
+        m_sampleRateCached = static_cast<double>(sampleRate);
         buildBands();
     }
 
-    for (uint32_t i = 0; i < context.frameCount; i++) {
-        const double mono = (context.buffer[i * 2] + context.buffer[i * 2 + 1]) * 0.5;
+    for (uint32_t i = 0; i < frameCount; i++) {
+        const double mono = (interleaved[i * 2] + interleaved[i * 2 + 1]) * 0.5;
 
         // Slow FFT — LF bands
         m_slowInBuf[m_slowFftN - SlowHopSize + m_slowHopFill] = mono;
@@ -321,16 +334,24 @@ void Rta::processBlock(AudioContext & context)
 }
 
 void Rta::reset()
+{
+    // The buffers belong to the analysis thread, which clears them, and drops every block still
+    // queued from before, before it next uses them. The bands are blanked here so the display drops
+    // at once.
+    m_tap.discard();
+    const std::lock_guard<std::mutex> lock { m_bandMutex };
+    std::fill(m_bandDb.begin(), m_bandDb.end(), -100.0f);
+}
+
+void Rta::resetAnalysis()
 {
     std::fill(m_slowInBuf.data(), m_slowInBuf.data() + m_slowFftN, 0.0);
     std::fill(m_fastInBuf.data(), m_fastInBuf.data() + m_fastFftN, 0.0);
     m_slowHopFill = 0;
     m_fastHopFill = 0;
     std::fill(m_smoothedPow.begin(), m_smoothedPow.end(), 0.0);
-    {
-        const std::lock_guard<std::mutex> lock { m_bandMutex };
-        std::fill(m_bandDb.begin(), m_bandDb.end(), -100.0f);
-    }
+    const std::lock_guard<std::mutex> lock { m_bandMutex };
+    std::fill(m_bandDb.begin(), m_bandDb.end(), -100.0f);
 }
 
 void Rta::sync()
@@ -17,6 +17,7 @@
 #define RTA_HPP
 
 #include "../effects/effect.hpp"
+#include "analysis_worker.hpp"
 
 #include <array>
 #include <atomic>
@@ -33,6 +34,7 @@ namespace noteahead {
 //   32 bands  → slow 8192,  fast 2048
 //   64 bands  → slow 16384, fast 4096
 //   128 bands → slow 32768, fast 8192
+// The audio thread only captures; the FFTs run on the AnalysisWorker.
 class Rta : public Effect
 {
 public:
@@ -50,6 +52,9 @@ public:
 
     void setAnalysisEnabled(bool enabled);
 
+    //! Runs the analysis of everything captured so far on the calling thread.
+    void flushAnalysis();
+
     std::vector<float> bandMagnitudesDb() const;
     std::vector<std::pair<float, float>> bandLogPositions() const;
 
@@ -68,6 +73,8 @@ private:
     void buildBands();
     void runSlowAnalysis();
     void runFastAnalysis();
+    void analyse(std::span<const double> interleaved, uint32_t frameCount, uint32_t sampleRate);
+    void resetAnalysis();
 
     std::array<double, MaxSlowFftSize> m_slowWindow;
     std::array<double, MaxSlowFftSize> m_slowInBuf;
@@ -88,13 +95,13 @@ private:
     int m_fastSpecBins = MaxFastFftSize / 2 + 1;
     int m_fastHopSize = MaxFastFftSize / 16; // Normal overlap; recomputed in syncParameters
 
-    // Audio-thread only:
+    // Analysis-thread only:
     std::vector<double> m_smoothedPow;
     std::vector<std::pair<int, int>> m_bandBins;
     std::vector<bool> m_bandFast;
     std::vector<std::pair<float, float>> m_bandLogX;
 
-    // Shared between audio and UI thread (protected by m_bandMutex):
+    // Shared between analysis and UI thread (protected by m_bandMutex):
     mutable std::mutex m_bandMutex;
     std::vector<float> m_bandDb;
     std::vector<std::pair<float, float>> m_bandLogXPublic;
@@ -110,7 +117,10 @@ private:
     int m_fftRateMode = 1; // 0=Fast(32x overlap), 1=Normal(16x), 2=Slow(8x)
 
     std::atomic<bool> m_analysisEnabled { false };
-    bool m_shouldSync = false;
+    std::atomic<bool> m_shouldSync { false };
+
+    //! Last, so it stops analysing before anything above is destroyed.
+    AnalysisTap m_tap;
 };
 
 } // namespace noteahead
@@ -43,6 +43,9 @@ constexpr float floorDb = -100.0f;
 } // namespace
 
 StereoFieldMeter::StereoFieldMeter()
+  : m_tap { [this](std::span<const double> interleaved, uint32_t frameCount, uint32_t sampleRate) {
+      analyseBlock(interleaved, frameCount, sampleRate);
+  }, [this] { resetAnalysis(); } }
 {
     addParameter(Parameter { Constants::NahdXml::xmlKeySpeed().toStdString(), 1.0f, 0, 2, 1, 1, Parameter::Type::Discrete });
     addParameter(Parameter { Constants::NahdXml::xmlKeyZoom().toStdString(), 0.5f, 0, 10000, 5000, 100, Parameter::Type::Continuous });
@@ -162,6 +165,10 @@ void StereoFieldMeter::processSample(double & left, double & right)
         return;
     }
 
+    if (m_resetRequested.exchange(false)) {
+        resetAnalysis();
+    }
+
     updateState();
     analyse(left, right);
 }
@@ -172,23 +179,32 @@ void StereoFieldMeter::processBlock(AudioContext & context)
         return;
     }
 
-    if (context.sampleRate != m_lastSampleRate) {
-        m_lastSampleRate = context.sampleRate;
+    m_tap.capture(context.buffer, context.frameCount, context.sampleRate);
+}
+
+void StereoFieldMeter::flushAnalysis()
+{
+    m_tap.flush();
+}
+
+void StereoFieldMeter::analyseBlock(std::span<const double> interleaved, uint32_t frameCount, uint32_t sampleRate)
+{
+    if (sampleRate != m_lastSampleRate) {
+        m_lastSampleRate = sampleRate;
         m_shouldSyncParameters = true;
     }
-    if (m_shouldSyncParameters) {
+    if (m_shouldSyncParameters.exchange(false)) {
         syncParameters();
-        m_shouldSyncParameters = false;
     }
 
-    for (uint32_t i = 0; i < context.frameCount; i++) {
-        analyse(context.buffer[i * 2], context.buffer[i * 2 + 1]);
+    for (uint32_t i = 0; i < frameCount; i++) {
+        analyse(interleaved[i * 2], interleaved[i * 2 + 1]);
     }
 
-    m_scope.write(context.buffer.data(), context.frameCount, context.sampleRate);
+    m_scope.write(interleaved.data(), frameCount, sampleRate);
 
-    // Published once per block rather than per sample: the dialog reads it thirty times a second,
-    // and taking the lock for every frame would be the only expensive thing this effect does.
+    // Published once per chunk rather than per sample: the dialog reads it thirty times a second,
+    // and taking the lock for every frame would be the most expensive thing the analysis does.
     Reading reading;
     reading.correlation = m_broadband.correlation();
     for (size_t i = 0; i < NumBands; i++) {
@@ -244,6 +260,17 @@ void StereoFieldMeter::syncParameters()
 }
 
 void StereoFieldMeter::reset()
+{
+    // The running statistics belong to the analysis thread, which clears them, and drops every
+    // block still queued from before, before it next uses them. The reading is blanked here so the
+    // display drops at once.
+    m_resetRequested = true;
+    m_tap.discard();
+    const std::lock_guard<std::mutex> lock { m_readingMutex };
+    m_reading = Reading {};
+}
+
+void StereoFieldMeter::resetAnalysis()
 {
     m_broadband.reset();
     m_midSide.reset();
@@ -18,6 +18,7 @@
 
 #include "../dsp/linkwitz_riley_crossover.hpp"
 #include "../effects/effect.hpp"
+#include "analysis_worker.hpp"
 #include "audio_scope.hpp"
 
 #include <array>
@@ -47,6 +48,9 @@ namespace noteahead {
 //! The goniometer trace is the same information with nothing averaged away: it shows the shape of
 //! the field rather than a number describing it, which is what catches a single wide element in an
 //! otherwise narrow mix.
+//!
+//! The racks feed it a block at a time, and the audio thread then only captures; the crossovers and
+//! the averaging run on the AnalysisWorker.
 class StereoFieldMeter : public Effect
 {
 public:
@@ -64,6 +68,9 @@ public:
     //! Analysis costs nothing while no dialog is showing it, so it is gated rather than always run.
     void setAnalysisEnabled(bool enabled);
 
+    //! Runs the analysis of everything captured so far on the calling thread.
+    void flushAnalysis();
+
     static constexpr size_t NumBands = 3;
 
     //! One frame's worth of everything the dialog draws, taken together so that the numbers it
@@ -120,6 +127,8 @@ private:
     void updateState();
     void syncParameters();
     void analyse(double left, double right);
+    void analyseBlock(std::span<const double> interleaved, uint32_t frameCount, uint32_t sampleRate);
+    void resetAnalysis();
 
     std::atomic<bool> m_analysisEnabled { false };
 
@@ -138,8 +147,12 @@ private:
     Reading m_reading;
 
     double m_meterCoefficient { 0.0 };
-    bool m_shouldSyncParameters { false };
+    std::atomic<bool> m_shouldSyncParameters { false };
+    std::atomic<bool> m_resetRequested { false };
     uint32_t m_lastSampleRate { 0 };
+
+    //! Last, so it stops analysing before anything above is destroyed.
+    AnalysisTap m_tap;
 };
 
 } // namespace noteahead
@@ -20,11 +20,15 @@
 #include "../../contrib/SimpleLogger/src/simple_logger.hpp"
 #include "../../domain/effects/effect_rack.hpp"
 #include "../../domain/effects/reverb.hpp"
+#include "../../domain/utility/dsp_profiler.hpp"
+#include "frozen_device_player.hpp"
 #include "real_time_worker_pool.hpp"
+#include "render_ahead_buffer.hpp"
 
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <optional>
 #include <pthread.h>
 
 namespace noteahead {
@@ -40,7 +44,12 @@ struct DeviceProcessContext
 {
     std::vector<AudioEngine::DeviceS> * devices {};
     std::vector<AudioEngineWorkBuffer> * workBuffers {};
+    //! Per snapshot index: whether the device put anything out this block. Written by its own task,
+    //! so a device the graph runs later can read it for the devices it depends on.
     std::vector<uint8_t> * deviceActiveFlags {};
+    //! Per snapshot index: the devices it reads, as SubMixer members or sidechains, whose playing
+    //! wakes it.
+    const std::vector<std::vector<size_t>> * deviceWakeSources {};
     std::vector<double> * deviceSends {};
     //! Per snapshot index: 0 when a SubMixer claims this device, so it must not also reach
     //! the master or the global sends. Its output buffer is still written for the SubMixer.
@@ -49,12 +58,62 @@ struct DeviceProcessContext
     std::vector<size_t> * slotSnapshot {};
     std::vector<std::vector<double>> * deviceOutputBuffersMutable {};
     std::span<const std::span<const double>> deviceOutputBuffers {};
+    //! Per snapshot index. Set when the devices are summed in a fixed order afterwards, in which
+    //! case a device hands its block over here instead of adding it to its lane.
+    std::vector<AudioEngineDeviceOutput> * fixedOrderOutputs {};
     size_t sendCount {};
     uint32_t frameCount {};
     uint32_t sampleRate {};
     uint32_t bufferSize {};
     double bpm {};
     uint8_t oversampleFactor {};
+    DspProfiler * profiler {};
+    //! Set when the master is pipelined: the graph's last task is then the master insert rack,
+    //! working on the previous block's mix, rather than a device.
+    EffectRack * pipelinedMasterRack {};
+    AudioContext * pipelinedMasterContext {};
+    LoadMeter * pipelinedMasterLoadMeter {};
+    //! Set when the devices run as a graph on the pool, so a device can fork its voices across it.
+    RealTimeWorkerPool * workerPool {};
+    //! Per snapshot index: the file playing in place of the device, or null.
+    const std::vector<FrozenDevicePlayer *> * frozenPlayers {};
+    //! Whether the song has played its first tick, which is where the files start.
+    bool frozenPlayersStarted {};
+    //! The slot whose output, ahead of its fader, is being captured.
+    std::optional<size_t> captureSlot {};
+};
+
+//! A device's voices forked across the pool from the lane its own task runs on.
+class LaneFork final : public TaskFork
+{
+public:
+    LaneFork(RealTimeWorkerPool & pool, size_t lane)
+      : m_pool { pool }
+      , m_lane { lane }
+    {
+    }
+
+    void run(size_t count, void * context, Task task) override
+    {
+        Job job { task, context };
+        m_pool.fork(m_lane, count, &job, runJob);
+    }
+
+private:
+    struct Job
+    {
+        Task task;
+        void * context;
+    };
+
+    static void runJob(void * context, size_t taskIndex, size_t)
+    {
+        const auto & job = *static_cast<Job *>(context);
+        job.task(job.context, taskIndex);
+    }
+
+    RealTimeWorkerPool & m_pool;
+    size_t m_lane;
 };
 
 struct EffectProcessContext
@@ -63,11 +122,12 @@ struct EffectProcessContext
     std::vector<std::vector<double>> * sendBusBuffers {};
     std::vector<std::vector<double>> * effectWetBuffers {};
     std::vector<uint8_t> * effectActiveFlags {};
-    std::vector<uint8_t> * sendBusHasSignal {};
+    std::vector<uint8_t> * sendAwake {};
     uint32_t frameCount {};
     uint32_t sampleRate {};
     double bpm {};
     uint8_t oversampleFactor {};
+    DspProfiler * profiler {};
 };
 
 bool bufferContainsSignal(const std::vector<double> & buffer, uint32_t bufferSize)
@@ -81,36 +141,112 @@ bool bufferContainsSignal(const std::vector<double> & buffer, uint32_t bufferSiz
     return false;
 }
 
+void processMasterInserts(EffectRack & rack, AudioContext & context, DspProfiler * profiler, size_t lane, LoadMeter & loadMeter)
+{
+    const auto started = std::chrono::steady_clock::now();
+    {
+        const DspProfiler::LaneBinding profilerBinding { profiler, lane, DspProfiler::Scope::MasterInsertEffect, 0 };
+        const DspProfiler::ScopedTimer timer { profiler, lane, DspProfiler::key(DspProfiler::Scope::MasterInserts) };
+        rack.processInPlace(context);
+    }
+    loadMeter.addBlock(std::chrono::steady_clock::now() - started, static_cast<double>(context.frameCount) / context.sampleRate);
+}
+
+//! Hands a device's finished block on: to the devices that read it, to the master unless a
+//! SubMixer claims it, and to its sends.
+void routeDeviceOutput(DeviceProcessContext & deviceContext, AudioEngineWorkBuffer & workBuffer, size_t deviceSnapshotIndex, bool preFaderSend, bool sendsSignal);
+
 void processDeviceTask(void * context, size_t taskIndex, size_t workerIndex)
 {
     auto & deviceContext = *static_cast<DeviceProcessContext *>(context);
+    if (deviceContext.pipelinedMasterRack && taskIndex == deviceContext.devices->size()) {
+        processMasterInserts(*deviceContext.pipelinedMasterRack, *deviceContext.pipelinedMasterContext, deviceContext.profiler, workerIndex, *deviceContext.pipelinedMasterLoadMeter);
+        return;
+    }
+
     const auto deviceSnapshotIndex = deviceContext.layerDevices ? deviceContext.layerDevices->at(taskIndex) : taskIndex;
     auto & device = deviceContext.devices->at(deviceSnapshotIndex);
     auto & workBuffer = deviceContext.workBuffers->at(workerIndex);
 
     const double bufferSeconds = static_cast<double>(deviceContext.frameCount) / deviceContext.sampleRate;
 
-    std::fill(workBuffer.deviceBuffer.begin(), workBuffer.deviceBuffer.begin() + deviceContext.bufferSize, 0.0);
-    if (!device->hasActiveAudio() && !deviceContext.deviceActiveFlags->at(deviceSnapshotIndex)) {
+    // A frozen device's file stands in for everything ahead of its fader. It is not asked whether it
+    // sleeps, because it is always left asleep.
+    FrozenDevicePlayer * frozenPlayer = nullptr;
+    if (deviceContext.frozenPlayers) {
+        if (auto * const player = deviceContext.frozenPlayers->at(deviceSnapshotIndex); player && player->sampleRate() == deviceContext.sampleRate) {
+            frozenPlayer = player;
+        }
+    }
+
+    // Asleep: not rendered, and not even asked whether it should be. A note-on, CC or pitch bend
+    // has already woken it before the block began if it is to play; the devices it reads, the
+    // members a SubMixer sums or a sidechain source, wake it here, having already been rendered
+    // this block.
+    const auto & wakeSources = deviceContext.deviceWakeSources->at(deviceSnapshotIndex);
+    if (!frozenPlayer && device->lifecycle() == Device::Lifecycle::Asleep
+        && std::ranges::none_of(wakeSources, [&](size_t source) { return deviceContext.deviceActiveFlags->at(source) != 0; })) {
+        deviceContext.deviceActiveFlags->at(deviceSnapshotIndex) = 0;
+        if (deviceContext.fixedOrderOutputs) {
+            deviceContext.fixedOrderOutputs->at(deviceSnapshotIndex).rendered = false;
+        }
         if (deviceContext.deviceOutputBuffersMutable) {
             const auto slotIndex = deviceContext.slotSnapshot->at(deviceSnapshotIndex);
             auto & outputBuffer = deviceContext.deviceOutputBuffersMutable->at(slotIndex);
-            std::fill(outputBuffer.begin(), outputBuffer.begin() + deviceContext.bufferSize, 0.0);
+            std::ranges::fill(outputBuffer, 0.0);
         }
         // A skipped device produces nothing and costs nothing, and has to say so: without these
         // its meters would keep reading whatever they last showed, for as long as it stays silent.
-        // The device buffer was just cleared, so it is the silence to report.
-        device->meter().write(workBuffer.deviceBuffer.data(), deviceContext.frameCount, deviceContext.sampleRate);
+        if (device->meter().active()) {
+            std::fill(workBuffer.deviceBuffer.begin(), workBuffer.deviceBuffer.begin() + deviceContext.bufferSize, 0.0);
+            device->meter().write(workBuffer.deviceBuffer.data(), deviceContext.frameCount, deviceContext.sampleRate);
+        }
         device->loadMeter().addBlock(std::chrono::nanoseconds::zero(), bufferSeconds);
         return;
     }
 
+    std::fill(workBuffer.deviceBuffer.begin(), workBuffer.deviceBuffer.begin() + deviceContext.bufferSize, 0.0);
+
     AudioContext audioContext { std::span(workBuffer.deviceBuffer.data(), deviceContext.bufferSize), deviceContext.frameCount, deviceContext.sampleRate, deviceContext.bpm, deviceContext.deviceOutputBuffers, deviceContext.oversampleFactor };
+    std::optional<LaneFork> laneFork;
+    if (deviceContext.workerPool) {
+        audioContext.fork = &laneFork.emplace(*deviceContext.workerPool, workerIndex);
+    }
 
     // Cheap enough to read unconditionally; the meter itself is a no-op while nothing is displayed.
     const auto processingStarted = std::chrono::steady_clock::now();
 
-    device->processAudio(audioContext);
+    // Lets the device's insert rack time each of its effects on this worker's lane.
+    const auto slot = static_cast<uint32_t>(deviceContext.slotSnapshot->at(deviceSnapshotIndex));
+    const DspProfiler::LaneBinding profilerBinding { deviceContext.profiler, workerIndex, DspProfiler::Scope::InsertEffect, slot };
+    std::optional<DspProfiler::ScopedTimer> renderTimer { std::in_place, deviceContext.profiler, workerIndex, DspProfiler::key(DspProfiler::Scope::Device, slot) };
+
+    if (frozenPlayer) {
+        // Silent until the song plays its first tick, so that the file starts with it.
+        if (deviceContext.frozenPlayersStarted) {
+            frozenPlayer->read(audioContext.buffer, deviceContext.frameCount);
+        }
+    } else if (device->supportsPlanarAudio()) {
+        // The one conversion this device costs: everything after it, the inserts, the fader and the
+        // lane sums, stays in double precision where many signals meet.
+        auto & planarBuffer = workBuffer.planarBuffer;
+        planarBuffer.clear(deviceContext.frameCount);
+        audioContext.left = planarBuffer.left();
+        audioContext.right = planarBuffer.right();
+        device->processAudio(audioContext);
+        planarBuffer.addToInterleaved(audioContext.buffer, deviceContext.frameCount);
+        audioContext.left = nullptr;
+        audioContext.right = nullptr;
+    } else {
+        device->processAudio(audioContext);
+    }
+    renderTimer.reset();
+
+    // Sounding voices are all the lifecycle needs to know. A device whose voices have stopped may
+    // still be ringing out a delay or chorus of its own, which only its output shows.
+    // A frozen device's voices are never rendered, so they would claim to sound for good.
+    const bool voicesSounding = !frozenPlayer && device->hasActiveAudio();
+    const bool ownTail = !voicesSounding && bufferContainsSignal(workBuffer.deviceBuffer, deviceContext.bufferSize);
 
     // Level tap for gain staging: post-gain and pre-insert, the level the Gain knob is set against.
     device->meter().write(workBuffer.deviceBuffer.data(), deviceContext.frameCount, deviceContext.sampleRate);
@@ -119,18 +255,27 @@ void processDeviceTask(void * context, size_t taskIndex, size_t workerIndex)
     // behaved before the setting existed and stays the default; post-inserts is the gain-staging
     // arrangement, where riding the fader can no longer change how hard the inserts are driven.
     const bool preFaderSend = device->sendTap() == Device::SendTap::PreFader && deviceContext.sendCount;
+    const bool captured = deviceContext.captureSlot == slot;
     const auto capturePreFader = [&] {
-        if (preFaderSend) {
+        if (preFaderSend || captured) {
             std::copy(workBuffer.deviceBuffer.begin(), workBuffer.deviceBuffer.begin() + deviceContext.bufferSize, workBuffer.preFaderBuffer.begin());
         }
     };
 
+    const auto processInsertEffects = [&] {
+        const DspProfiler::ScopedTimer insertsTimer { deviceContext.profiler, workerIndex, DspProfiler::key(DspProfiler::Scope::DeviceInserts, slot) };
+        device->processInsertEffects(audioContext);
+    };
+
     if (device->faderPosition() == Device::FaderPosition::PreInserts) {
         capturePreFader();
         device->applyFader(audioContext);
-        device->processInsertEffects(audioContext);
+        processInsertEffects();
     } else {
-        device->processInsertEffects(audioContext);
+        // The file already holds what the inserts did.
+        if (!frozenPlayer) {
+            processInsertEffects();
+        }
         capturePreFader();
         device->applyFader(audioContext);
     }
@@ -144,14 +289,66 @@ void processDeviceTask(void * context, size_t taskIndex, size_t workerIndex)
     // boost past unity and whatever the insert rack did.
     device->clipDetector().write(workBuffer.deviceBuffer.data(), deviceContext.frameCount);
 
+    // A playing device is taken to put something out without scanning for it. One that has stopped
+    // tails until its own effects and its insert rack are done, by their own account where they
+    // keep one, which for a reverb comes long before its output finally rounds to zero.
+    const bool hasOutputSignal = voicesSounding || bufferContainsSignal(workBuffer.deviceBuffer, deviceContext.bufferSize);
+    deviceContext.deviceActiveFlags->at(deviceSnapshotIndex) = hasOutputSignal ? 1 : 0;
+    if (frozenPlayer) {
+        // The notes playback still sends it wake it, but it has nothing to render: left awake, it
+        // would count towards fanning the devices out for work it never does.
+        device->setLifecycle(Device::Lifecycle::Asleep);
+    } else if (voicesSounding) {
+        device->setLifecycle(Device::Lifecycle::Active);
+    } else if (ownTail) {
+        device->setLifecycle(Device::Lifecycle::Tailing);
+    } else {
+        bool tailing = false;
+        switch (device->insertEffectRack().tailState()) {
+        case Effect::TailState::Ringing:
+            tailing = true;
+            break;
+        case Effect::TailState::Silent:
+            break;
+        case Effect::TailState::Unknown:
+            tailing = hasOutputSignal;
+            break;
+        }
+        device->setLifecycle(tailing ? Device::Lifecycle::Tailing : Device::Lifecycle::Asleep);
+    }
+
+    const bool sendsSignal = preFaderSend && !voicesSounding ? bufferContainsSignal(workBuffer.preFaderBuffer, deviceContext.bufferSize) : hasOutputSignal;
+    routeDeviceOutput(deviceContext, workBuffer, deviceSnapshotIndex, preFaderSend, sendsSignal);
+}
+
+void routeDeviceOutput(DeviceProcessContext & deviceContext, AudioEngineWorkBuffer & workBuffer, size_t deviceSnapshotIndex, bool preFaderSend, bool sendsSignal)
+{
     if (deviceContext.deviceOutputBuffersMutable) {
         const auto slotIndex = deviceContext.slotSnapshot->at(deviceSnapshotIndex);
         auto & outputBuffer = deviceContext.deviceOutputBuffersMutable->at(slotIndex);
-        std::copy(workBuffer.deviceBuffer.begin(), workBuffer.deviceBuffer.begin() + deviceContext.bufferSize, outputBuffer.begin());
+        // Empty unless some device reads this one.
+        std::copy_n(workBuffer.deviceBuffer.begin(), outputBuffer.size(), outputBuffer.begin());
     }
 
-    const bool hasOutputSignal = bufferContainsSignal(workBuffer.deviceBuffer, deviceContext.bufferSize);
-    deviceContext.deviceActiveFlags->at(deviceSnapshotIndex) = hasOutputSignal ? 1 : 0;
+    if (sendsSignal) {
+        for (size_t sendIndex = 0; sendIndex < deviceContext.sendCount; sendIndex++) {
+            if (deviceContext.deviceSends->at(deviceSnapshotIndex * deviceContext.sendCount + sendIndex) != 0.0) {
+                workBuffer.sendHasSignal[sendIndex] = 1;
+            }
+        }
+    }
+
+    // Summed later, in slot order, together with the sends; see AudioEngine::setFixedOrderSumming().
+    if (deviceContext.fixedOrderOutputs) {
+        auto & deviceOutput = deviceContext.fixedOrderOutputs->at(deviceSnapshotIndex);
+        std::copy_n(workBuffer.deviceBuffer.begin(), deviceContext.bufferSize, deviceOutput.outputBuffer.begin());
+        if (preFaderSend || deviceContext.captureSlot == deviceContext.slotSnapshot->at(deviceSnapshotIndex)) {
+            std::copy_n(workBuffer.preFaderBuffer.begin(), deviceContext.bufferSize, deviceOutput.preFaderBuffer.begin());
+        }
+        deviceOutput.preFaderSend = preFaderSend;
+        deviceOutput.rendered = true;
+        return;
+    }
 
     // A device claimed by a SubMixer is heard only through that SubMixer, which sums the output
     // buffer written above. Letting its dry path also reach the master here would play the group
@@ -165,23 +362,31 @@ void processDeviceTask(void * context, size_t taskIndex, size_t workerIndex)
         return;
     }
 
-    for (uint32_t i = 0; i < deviceContext.bufferSize; i++) {
-        const double sample = workBuffer.deviceBuffer[i];
-        if (directOut) {
-            workBuffer.outputBuffer[i] += sample;
+    if (directOut) {
+        for (uint32_t i = 0; i < deviceContext.bufferSize; i++) {
+            workBuffer.outputBuffer[i] += workBuffer.deviceBuffer[i];
         }
+    }
 
-        // A pre-fader send keeps its level when the fader moves, so it reads the captured buffer
-        // rather than the one the fader has already scaled.
-        const double sendSample = preFaderSend ? workBuffer.preFaderBuffer[i] : sample;
-        for (size_t sendIndex = 0; sendIndex < deviceContext.sendCount; sendIndex++) {
-            const double send = deviceContext.deviceSends->at(deviceSnapshotIndex * deviceContext.sendCount + sendIndex);
-            workBuffer.sendBuffers[sendIndex][i] += sendSample * send;
+    // The rack's every send slot counts towards sendCount, filled or not, and a device usually
+    // feeds one or two of them at most. Only those get a pass over the block.
+    //
+    // A pre-fader send keeps its level when the fader moves, so it reads the captured buffer
+    // rather than the one the fader has already scaled.
+    const auto & sendSource = preFaderSend ? workBuffer.preFaderBuffer : workBuffer.deviceBuffer;
+    for (size_t sendIndex = 0; sendIndex < deviceContext.sendCount; sendIndex++) {
+        const double send = deviceContext.deviceSends->at(deviceSnapshotIndex * deviceContext.sendCount + sendIndex);
+        if (send == 0.0) {
+            continue;
+        }
+        auto & sendBuffer = workBuffer.sendBuffers[sendIndex];
+        for (uint32_t i = 0; i < deviceContext.bufferSize; i++) {
+            sendBuffer[i] += sendSource[i] * send;
         }
     }
 }
 
-void processEffectTask(void * context, size_t taskIndex, size_t /*workerIndex*/)
+void processEffectTask(void * context, size_t taskIndex, size_t workerIndex)
 {
     auto & effectContext = *static_cast<EffectProcessContext *>(context);
     auto & effect = effectContext.effects->at(taskIndex);
@@ -195,11 +400,12 @@ void processEffectTask(void * context, size_t taskIndex, size_t /*workerIndex*/)
         return;
     }
 
-    if (!effectContext.sendBusHasSignal->at(taskIndex) && !effectContext.effectActiveFlags->at(taskIndex)) {
-        std::fill(wetBuffer.begin(), wetBuffer.begin() + bufferSize, 0.0);
+    // Asleep: nothing to add, and the wet buffer is not summed, so not even that to clear.
+    if (!effectContext.sendAwake->at(taskIndex)) {
         return;
     }
 
+    const DspProfiler::ScopedTimer timer { effectContext.profiler, workerIndex, DspProfiler::key(DspProfiler::Scope::SendEffect, 0, static_cast<uint32_t>(taskIndex)) };
     effect->setSampleRate(effectContext.sampleRate);
 
     // Copy dry signal to wet buffer for in-place processing
@@ -208,32 +414,100 @@ void processEffectTask(void * context, size_t taskIndex, size_t /*workerIndex*/)
     AudioContext context_obj { std::span(wetBuffer.data(), bufferSize), effectContext.frameCount, effectContext.sampleRate, effectContext.bpm, {}, effectContext.oversampleFactor };
     effect->process(context_obj);
 
-    bool hasWetSignal = false;
     for (uint32_t i = 0; i < bufferSize; i++) {
         wetBuffer[i] -= sendBus[i];
-        if (std::abs(wetBuffer[i]) > 1.0e-12) {
-            hasWetSignal = true;
-        }
     }
 
-    effectContext.effectActiveFlags->at(taskIndex) = hasWetSignal ? 1 : 0;
+    // An effect that keeps track of its tail says when it is done, at its tail threshold rather
+    // than wherever the output last rounds to zero. Any other is judged by what it put out.
+    switch (effect->tailState()) {
+    case Effect::TailState::Ringing:
+        effectContext.effectActiveFlags->at(taskIndex) = 1;
+        break;
+    case Effect::TailState::Silent:
+        effectContext.effectActiveFlags->at(taskIndex) = 0;
+        break;
+    case Effect::TailState::Unknown:
+        effectContext.effectActiveFlags->at(taskIndex) = bufferContainsSignal(wetBuffer, bufferSize) ? 1 : 0;
+        break;
+    }
 }
 
 } // namespace
 
 void AudioEngine::ensureDeviceOutputBuffers(uint32_t bufferSize)
 {
-    const auto deviceCount = Constants::deviceRackSize();
-    if (m_deviceOutputBuffers.size() != deviceCount) {
-        m_deviceOutputBuffers.resize(deviceCount);
-        m_deviceOutputBufferSpans.resize(deviceCount);
+    // Only a new block size gets this far: the slots themselves are set up with the devices.
+    if (m_deviceOutputBufferSize == bufferSize) {
+        return;
+    }
+    m_deviceOutputBufferSize = bufferSize;
+    for (const auto slot : m_deviceOutputSlots) {
+        auto & buffer = m_deviceOutputBuffers[slot];
+        buffer.assign(bufferSize, 0.0);
+        m_deviceOutputBufferSpans[slot] = std::span<const double> { buffer.data(), bufferSize };
+    }
+}
+
+void AudioEngine::updateDeviceOutputSlots()
+{
+    if (m_deviceOutputBuffers.size() != Constants::deviceRackSize()) {
+        m_deviceOutputBuffers.resize(Constants::deviceRackSize());
+        m_deviceOutputBufferSpans.resize(Constants::deviceRackSize());
     }
 
-    for (size_t i = 0; i < deviceCount; i++) {
-        if (m_deviceOutputBuffers[i].size() != bufferSize) {
-            m_deviceOutputBuffers[i].assign(bufferSize, 0.0);
+    // Which occupied slot is read, as a sidechain or a SubMixer member, is a device setting that
+    // can change between any two blocks. Every occupied slot gets its buffer, so that the callback
+    // never has to allocate one when a reader turns up.
+    for (const auto slot : m_deviceOutputSlots) {
+        if (!std::ranges::binary_search(m_deviceSlotSnapshot, slot)) {
+            m_deviceOutputBuffers[slot] = {};
+            m_deviceOutputBufferSpans[slot] = {};
+        }
+    }
+    m_deviceOutputSlots.clear();
+    for (const auto slot : m_deviceSlotSnapshot) {
+        if (slot >= Constants::deviceRackSize()) {
+            continue;
+        }
+        m_deviceOutputSlots.push_back(slot);
+        if (auto & buffer = m_deviceOutputBuffers[slot]; buffer.size() != m_deviceOutputBufferSize) {
+            buffer.assign(m_deviceOutputBufferSize, 0.0);
+            m_deviceOutputBufferSpans[slot] = std::span<const double> { buffer.data(), buffer.size() };
+        }
+    }
+}
+
+void AudioEngine::rebuildDeviceSnapshot()
+{
+    // Where each device stands in its lifecycle stays with the device, so whatever tail it is
+    // ringing out is not cut short because another slot changed.
+    std::vector<DeviceS> devices;
+    std::vector<size_t> deviceSlots;
+    devices.reserve(m_devices.size());
+    deviceSlots.reserve(m_devices.size());
+    for (auto const & [index, device] : m_devices) {
+        if (device) {
+            devices.push_back(device);
+            deviceSlots.push_back(index);
+        }
+    }
+    // The old snapshot may hold the last reference to a removed device, which is then destroyed
+    // here rather than on the audio thread.
+    m_deviceSnapshot = std::move(devices);
+    m_deviceSlotSnapshot = std::move(deviceSlots);
+    m_deviceActiveFlags.assign(m_deviceSnapshot.size(), 0);
+    updateDeviceOutputSlots();
+    rebuildFrozenDevicePlayerSnapshot();
+}
+
+void AudioEngine::rebuildFrozenDevicePlayerSnapshot()
+{
+    m_frozenDevicePlayerSnapshot.assign(m_deviceSnapshot.size(), nullptr);
+    for (size_t deviceIndex = 0; deviceIndex < m_deviceSlotSnapshot.size(); deviceIndex++) {
+        if (const auto it = m_frozenDevicePlayers.find(m_deviceSlotSnapshot[deviceIndex]); it != m_frozenDevicePlayers.end()) {
+            m_frozenDevicePlayerSnapshot[deviceIndex] = it->second.get();
         }
-        m_deviceOutputBufferSpans[i] = std::span<const double> { m_deviceOutputBuffers[i].data(), bufferSize };
     }
 }
 
@@ -327,19 +601,100 @@ void AudioEngine::rebuildProcessingGraph()
     if (!circularLayer.empty()) {
         m_processingLayers.push_back(circularLayer);
     }
+
+    // The graph keeps every edge the layers honour. The one it drops is between two devices of the
+    // circular layer, which wait for nothing among themselves there either.
+    auto & graph = m_deviceTaskGraph;
+    graph.dependentOffsets.assign(deviceCount + 1, 0);
+    graph.dependents.clear();
+    graph.dependencyCounts.assign(deviceCount, 0);
+    graph.roots.clear();
+    for (size_t j = 0; j < deviceCount; j++) {
+        graph.dependentOffsets[j] = graph.dependents.size();
+        for (const auto i : adj[j]) {
+            if (processed[i] || processed[j]) {
+                graph.dependents.push_back(i);
+                graph.dependencyCounts[i]++;
+            }
+        }
+    }
+    graph.dependentOffsets[deviceCount] = graph.dependents.size();
+    for (size_t i = 0; i < deviceCount; i++) {
+        if (!graph.dependencyCounts[i]) {
+            graph.roots.push_back(i);
+        }
+    }
+
+    m_deviceTopologicalOrder.clear();
+    for (auto && layer : m_processingLayers) {
+        m_deviceTopologicalOrder.insert(m_deviceTopologicalOrder.end(), layer.begin(), layer.end());
+    }
+    m_pipelinedTaskGraph = graph;
+    m_pipelinedTaskGraph.dependentOffsets.push_back(graph.dependents.size());
+    m_pipelinedTaskGraph.dependencyCounts.push_back(0);
+    m_pipelinedTaskGraph.roots.push_back(deviceCount);
+
+    m_deviceCriticalPath.assign(deviceCount + 1, 0.0);
+    m_workerPool->reserveGraph(deviceCount + 1);
+    if (m_renderAheadPool) {
+        m_renderAheadPool->reserveGraph(deviceCount + 1);
+    }
+}
+
+void AudioEngine::prioritizeDeviceTasks(RealTimeWorkerPool::TaskGraph & graph)
+{
+    // Longest-processing-time first alone would start the heaviest device first. Ranking by the
+    // whole chain still ahead of a device is what shortens the block: a light device feeding a
+    // heavy one goes before a moderately heavy one that feeds nothing.
+    for (auto it = m_deviceTopologicalOrder.rbegin(); it != m_deviceTopologicalOrder.rend(); it++) {
+        const auto device = *it;
+        double longestDependent = 0.0;
+        for (size_t index = graph.dependentOffsets[device]; index < graph.dependentOffsets[device + 1]; index++) {
+            longestDependent = std::max(longestDependent, m_deviceCriticalPath[graph.dependents[index]]);
+        }
+        m_deviceCriticalPath[device] = static_cast<double>(m_deviceSnapshot[device]->loadMeter().costNanoseconds()) + longestDependent;
+    }
+    // The pipelined master, when the graph has it, is a chain of one.
+    m_deviceCriticalPath[m_deviceSnapshot.size()] = static_cast<double>(m_masterLoadMeter.costNanoseconds());
+
+    const auto mostUrgentFirst = [this](size_t a, size_t b) { return m_deviceCriticalPath[a] > m_deviceCriticalPath[b]; };
+    std::ranges::sort(graph.roots, mostUrgentFirst);
+    for (size_t device = 0; device < graph.taskCount(); device++) {
+        std::sort(graph.dependents.begin() + static_cast<std::ptrdiff_t>(graph.dependentOffsets[device]),
+                  graph.dependents.begin() + static_cast<std::ptrdiff_t>(graph.dependentOffsets[device + 1]),
+                  mostUrgentFirst);
+    }
+}
+
+void AudioEngine::updateMasterPipeline(bool pipelined, uint32_t bufferSize)
+{
+    if (pipelined == m_masterPipelined && (!pipelined || m_masterPipelineBuffer.size() == bufferSize)) {
+        return;
+    }
+
+    // Switching costs one block of silence or one repeated block, which only happens when the
+    // setting, the threading or the block size changes.
+    m_masterPipelineBuffer.assign(pipelined ? bufferSize : 0, 0.0);
+    m_masterPipelined = pipelined;
 }
 
 void AudioEngine::updateDirectOutSnapshot()
 {
     m_deviceDirectOutSnapshot.assign(m_deviceSnapshot.size(), 1);
+    m_deviceWakeSources.assign(m_deviceSnapshot.size(), {});
 
-    for (const auto & device : m_deviceSnapshot) {
-        for (const auto claimedSlot : device->claimedOutputSlots()) {
-            for (size_t i = 0; i < m_deviceSlotSnapshot.size(); i++) {
-                if (m_deviceSlotSnapshot[i] == claimedSlot) {
-                    m_deviceDirectOutSnapshot[i] = 0;
-                    break;
-                }
+    for (size_t owner = 0; owner < m_deviceSnapshot.size(); owner++) {
+        for (const auto claimedSlot : m_deviceSnapshot[owner]->claimedOutputSlots()) {
+            if (const auto it = std::ranges::find(m_deviceSlotSnapshot, claimedSlot); it != m_deviceSlotSnapshot.end()) {
+                m_deviceDirectOutSnapshot[static_cast<size_t>(it - m_deviceSlotSnapshot.begin())] = 0;
+            }
+        }
+        // Whatever the device reads can bring it to life: a SubMixer its members, a ducker or a
+        // vocoder its sidechain source.
+        m_deviceSnapshot[owner]->sidechainDependencies(m_scratchDeps);
+        for (const auto slot : m_scratchDeps) {
+            if (const auto it = std::ranges::find(m_deviceSlotSnapshot, slot); it != m_deviceSlotSnapshot.end()) {
+                m_deviceWakeSources[owner].push_back(static_cast<size_t>(it - m_deviceSlotSnapshot.begin()));
             }
         }
     }
@@ -349,11 +704,19 @@ AudioEngine::AudioEngine()
   : m_sendEffectRack { std::make_unique<EffectRack>() }
   , m_insertEffectRack { std::make_unique<EffectRack>() }
   , m_workerPool { std::make_unique<RealTimeWorkerPool>() }
+  , m_dspProfiler { std::make_unique<DspProfiler>(m_workerPool->laneCount()) }
 {
+    m_workerPool->setProfiler(m_dspProfiler.get());
     enableHardwareDenormalProtection();
 }
 
-AudioEngine::~AudioEngine() = default;
+AudioEngine::~AudioEngine()
+{
+    m_workerPool->setProfiler(nullptr);
+    if (m_renderAheadPool) {
+        m_renderAheadPool->setProfiler(nullptr);
+    }
+}
 
 EffectRack & AudioEngine::sendEffectRack()
 {
@@ -369,12 +732,14 @@ void AudioEngine::setDevice(size_t slotIndex, DeviceS device)
 {
     std::lock_guard<std::mutex> lock { m_mutex };
     m_devices[slotIndex] = std::move(device);
+    rebuildDeviceSnapshot();
 }
 
 void AudioEngine::clearDevice(size_t slotIndex)
 {
     std::lock_guard<std::mutex> lock { m_mutex };
     m_devices.erase(slotIndex);
+    rebuildDeviceSnapshot();
 }
 
 AudioEngine::DeviceS AudioEngine::device(size_t slotIndex) const
@@ -410,6 +775,18 @@ AudioEngine::DeviceS AudioEngine::device(const std::string & name) const
     return nullptr;
 }
 
+AudioEngine::DeviceSlots AudioEngine::deviceSlots() const
+{
+    std::lock_guard<std::mutex> lock { m_mutex };
+    DeviceSlots occupied;
+    for (auto const & [index, device] : m_devices) {
+        if (device) {
+            occupied.push_back(index);
+        }
+    }
+    return occupied;
+}
+
 AudioEngine::DeviceNames AudioEngine::deviceNames() const
 {
     std::lock_guard<std::mutex> lock { m_mutex };
@@ -433,11 +810,66 @@ void AudioEngine::setBpm(float bpm)
 }
 
 void AudioEngine::process(AudioContext & context)
+{
+    // An export owns the devices, whatever playback had going.
+    if (!m_isExclusive.load() && playRenderedAhead(context)) {
+        return;
+    }
+
+    render(context, m_isExclusive.load(), *m_workerPool);
+}
+
+void AudioEngine::renderAhead(AudioContext & context)
+{
+    {
+        std::lock_guard<std::mutex> lock { m_mutex };
+        if (!m_renderAheadPool) {
+            m_renderAheadPool = std::make_unique<RealTimeWorkerPool>();
+            m_renderAheadPool->setProfiler(m_dspProfiler.get());
+            m_renderAheadPool->reserveGraph(m_deviceSnapshot.size() + 1);
+        }
+    }
+    render(context, true, *m_renderAheadPool);
+}
+
+bool AudioEngine::playRenderedAhead(AudioContext & context)
+{
+    std::lock_guard<std::mutex> lock { m_renderAheadMutex };
+    if (!m_renderAheadBuffer) {
+        return false;
+    }
+
+    m_playbackSampleRate = context.sampleRate;
+    if (m_renderAheadBuffer->sampleRate() != context.sampleRate) {
+        std::fill_n(context.buffer.begin(), static_cast<size_t>(context.frameCount) * 2, 0.0);
+        return true;
+    }
+
+    const auto frames = m_renderAheadBuffer->read(context.buffer, context.frameCount);
+    if (frames == context.frameCount) {
+        return true;
+    }
+
+    // The render has handed the devices back where it stopped, rounded up to a whole block, so the
+    // next block is theirs. A block size changed since leaves the end of this one silent.
+    m_renderAheadBuffer.reset();
+    if (frames) {
+        std::fill(context.buffer.begin() + static_cast<std::ptrdiff_t>(frames) * 2, context.buffer.begin() + static_cast<std::ptrdiff_t>(context.frameCount) * 2, 0.0);
+        return true;
+    }
+    return false;
+}
+
+void AudioEngine::render(AudioContext & context, bool offline, RealTimeWorkerPool & workerPool)
 {
     std::lock_guard<std::mutex> lock { m_mutex };
 
     const auto callbackStarted = std::chrono::steady_clock::now();
 
+    auto * const profiler = m_dspProfiler.get();
+    const size_t profilerLane = profiler->callbackLane();
+    const DspProfiler::ScopedTimer callbackTimer { profiler, profilerLane, DspProfiler::key(DspProfiler::Scope::Callback) };
+
     const uint32_t bufferSize = context.frameCount * 2;
     if (!bufferSize) {
         return;
@@ -450,10 +882,11 @@ void AudioEngine::process(AudioContext & context)
     }
     auto & effects = m_sendEffectsSnapshot;
     const size_t sendCount = effects.size();
-    const size_t laneCount = m_workerPool->laneCount();
+    const size_t laneCount = workerPool.laneCount();
 
-    if (!m_isExclusive.load()) {
+    if (!offline) {
         detectCallbackScheduling();
+        m_playbackSampleRate = context.sampleRate;
     }
 
     // Offline rendering always fans out: it has no deadline and only gains from the throughput.
@@ -462,7 +895,14 @@ void AudioEngine::process(AudioContext & context)
     // as the others: real-time workers above an ordinary callback thread preempt the very thread
     // waiting on them, which is heard as stuttering. Some backends — PulseAudio through RtAudio in
     // particular — do not give their callback thread real-time scheduling at all.
-    const bool useWorkers = m_isExclusive.load() || (m_playbackThreadingEnabled.load() && callbackIsRealTime() && m_workerPool->hasRealTimeScheduling());
+    const bool useWorkers = offline || (m_playbackThreadingEnabled.load() && callbackIsRealTime() && workerPool.hasRealTimeScheduling());
+
+    // The pipelined master delays the output by a block, which playback can report to the backend
+    // and an export cannot, so an export keeps the master in line.
+    const bool pipelineMaster = useWorkers && !offline && m_masterPipelineEnabled.load();
+    updateMasterPipeline(pipelineMaster, bufferSize);
+    AudioContext pipelinedMasterContext { std::span(m_masterPipelineBuffer.data(), m_masterPipelineBuffer.size()), context.frameCount, context.sampleRate, context.bpm, {}, context.oversampleFactor };
+    bool masterProcessed = false;
 
     ensureWorkBuffers(laneCount, sendCount, bufferSize);
     ensureEffectWetBuffers(sendCount, bufferSize);
@@ -471,6 +911,11 @@ void AudioEngine::process(AudioContext & context)
     if (m_sendBusBuffers.size() != sendCount) {
         m_sendBusBuffers.resize(sendCount);
     }
+    if (m_sendBusHasSignal.size() != sendCount) {
+        m_sendBusHasSignal.resize(sendCount);
+        m_sendAwake.resize(sendCount);
+    }
+    std::ranges::fill(m_sendBusHasSignal, 0);
 
     for (auto & bus : m_sendBusBuffers) {
         if (bus.size() < bufferSize) {
@@ -480,29 +925,21 @@ void AudioEngine::process(AudioContext & context)
         }
     }
 
-    m_deviceSnapshot.clear();
-    m_deviceSlotSnapshot.clear();
-    if (!m_devices.empty()) {
-        m_deviceSnapshot.reserve(m_devices.size());
-        m_deviceSlotSnapshot.reserve(m_devices.size());
-        for (auto const & [index, device] : m_devices) {
-            if (device) {
-                m_deviceSnapshot.push_back(device);
-                m_deviceSlotSnapshot.push_back(index);
-            }
-        }
-    }
-
     if (!m_deviceSnapshot.empty()) {
         ensureDeviceActiveFlags(m_deviceSnapshot.size());
+        {
+            const DspProfiler::ScopedTimer timer { profiler, profilerLane, DspProfiler::key(DspProfiler::Scope::GraphRebuild) };
+            rebuildProcessingGraph();
+        }
         ensureDeviceOutputBuffers(bufferSize);
-        rebuildProcessingGraph();
+        const bool fixedOrder = m_fixedOrderSumming.load() || m_captureSlot.has_value();
+        if (fixedOrder) {
+            ensureFixedOrderOutputs(m_deviceSnapshot.size(), bufferSize);
+        }
 
         m_deviceSendSnapshot.resize(m_deviceSnapshot.size() * sendCount);
         for (size_t deviceIndex = 0; deviceIndex < m_deviceSnapshot.size(); deviceIndex++) {
-            for (size_t sendIndex = 0; sendIndex < sendCount; sendIndex++) {
-                m_deviceSendSnapshot[deviceIndex * sendCount + sendIndex] = static_cast<double>(m_deviceSnapshot[deviceIndex]->reverbSend(sendIndex));
-            }
+            m_deviceSnapshot[deviceIndex]->reverbSends(std::span { m_deviceSendSnapshot }.subspan(deviceIndex * sendCount, sendCount));
         }
 
         // Recomputed only when the topology changes; this is just a cheap safety guard so the
@@ -510,19 +947,32 @@ void AudioEngine::process(AudioContext & context)
         if (m_deviceDirectOutSnapshot.size() != m_deviceSnapshot.size()) {
             m_deviceDirectOutSnapshot.assign(m_deviceSnapshot.size(), 1);
         }
+        if (m_deviceWakeSources.size() != m_deviceSnapshot.size()) {
+            m_deviceWakeSources.resize(m_deviceSnapshot.size());
+        }
 
         // Fanning out costs the same whether or not the workers find anything to do: they are woken
         // and have to be waited for either way, and the handshake spins on both sides. With at most
         // one device actually producing audio there is nothing to overlap, so the work is cheaper
         // done in place. That is also what keeps the workers off the CPU between songs: a stopped
         // song leaves every device silent, and the callback keeps running to stay ready.
+        // The exception is a device that splits its own voices across the lanes, which has plenty
+        // to overlap even when it plays alone.
+        //
+        // Whatever was woken since the last block is counted in, so that a note-on landing on a
+        // sleeping device is heard in the very next block.
         size_t activeDeviceCount = 0;
-        for (size_t i = 0; i < m_deviceSnapshot.size(); i++) {
-            if (m_deviceSnapshot[i]->hasActiveAudio() || m_deviceActiveFlags[i]) {
+        bool activeDeviceForksVoices = false;
+        for (const auto & device : m_deviceSnapshot) {
+            if (device->takeWake()) {
+                device->setLifecycle(Device::Lifecycle::Active);
+            }
+            if (device->lifecycle() != Device::Lifecycle::Asleep) {
                 activeDeviceCount++;
+                activeDeviceForksVoices = activeDeviceForksVoices || device->rendersVoicesInParallel();
             }
         }
-        const bool fanOutDevices = useWorkers && activeDeviceCount > 1;
+        const bool fanOutDevices = useWorkers && (activeDeviceCount > 1 || activeDeviceForksVoices);
 
         // Serial processing uses only lane 0, so clear/sum just that lane then; parallel rendering
         // spreads work across all lanes. The buffers stay allocated at the full lane count either way,
@@ -535,42 +985,124 @@ void AudioEngine::process(AudioContext & context)
             for (auto & sendBuffer : workBuffer.sendBuffers) {
                 std::fill(sendBuffer.begin(), sendBuffer.begin() + bufferSize, 0.0);
             }
+            std::ranges::fill(workBuffer.sendHasSignal, 0);
         }
 
-        for (auto & layer : m_processingLayers) {
-            DeviceProcessContext deviceContext {
-                &m_deviceSnapshot,
-                &m_workBuffers,
-                &m_deviceActiveFlags,
-                &m_deviceSendSnapshot,
-                &m_deviceDirectOutSnapshot,
-                &layer,
-                &m_deviceSlotSnapshot,
-                &m_deviceOutputBuffers,
-                std::span<const std::span<const double>>(m_deviceOutputBufferSpans),
-                sendCount,
-                context.frameCount,
-                context.sampleRate,
-                bufferSize,
-                context.bpm,
-                context.oversampleFactor
-            };
-            if (fanOutDevices) {
-                m_workerPool->run(layer.size(), &deviceContext, processDeviceTask);
-            } else {
+        std::optional<DspProfiler::ScopedTimer> phaseTimer { std::in_place, profiler, profilerLane, DspProfiler::key(DspProfiler::Scope::Devices) };
+        DeviceProcessContext deviceContext {
+            &m_deviceSnapshot,
+            &m_workBuffers,
+            &m_deviceActiveFlags,
+            &m_deviceWakeSources,
+            &m_deviceSendSnapshot,
+            &m_deviceDirectOutSnapshot,
+            nullptr,
+            &m_deviceSlotSnapshot,
+            &m_deviceOutputBuffers,
+            std::span<const std::span<const double>>(m_deviceOutputBufferSpans),
+            fixedOrder ? &m_fixedOrderOutputs : nullptr,
+            sendCount,
+            context.frameCount,
+            context.sampleRate,
+            bufferSize,
+            context.bpm,
+            context.oversampleFactor,
+            profiler
+        };
+        deviceContext.frozenPlayers = &m_frozenDevicePlayerSnapshot;
+        deviceContext.frozenPlayersStarted = m_frozenDevicePlayersStarted;
+        deviceContext.captureSlot = m_captureSlot;
+        bool ranAsGraph = false;
+        if (fanOutDevices) {
+            // One graph run instead of a barrier per layer: a device starts as soon as its own
+            // sidechain sources are done, and idle lanes steal whatever is ready elsewhere. A
+            // pipelined master is just one more task of it, next to the devices it no longer waits on.
+            auto & graph = pipelineMaster ? m_pipelinedTaskGraph : m_deviceTaskGraph;
+            if (pipelineMaster) {
+                deviceContext.pipelinedMasterRack = m_insertEffectRack.get();
+                deviceContext.pipelinedMasterContext = &pipelinedMasterContext;
+                deviceContext.pipelinedMasterLoadMeter = &m_masterLoadMeter;
+            }
+            deviceContext.workerPool = &workerPool;
+            prioritizeDeviceTasks(graph);
+            ranAsGraph = workerPool.runGraph(graph, &deviceContext, processDeviceTask);
+            // A graph the pool has not been sized for runs nothing; the devices then go through the
+            // serial path below rather than dropping out of the block.
+            masterProcessed = ranAsGraph && pipelineMaster;
+            deviceContext.pipelinedMasterRack = nullptr;
+            deviceContext.workerPool = nullptr;
+        }
+        if (!ranAsGraph) {
+            for (auto & layer : m_processingLayers) {
+                deviceContext.layerDevices = &layer;
                 for (size_t taskIndex = 0; taskIndex < layer.size(); taskIndex++) {
                     processDeviceTask(&deviceContext, taskIndex, 0);
                 }
             }
         }
 
+        phaseTimer.emplace(profiler, profilerLane, DspProfiler::key(DspProfiler::Scope::LaneSumming));
+
+        // The devices left their blocks untouched by the lanes, which are still clear. They are
+        // gathered into lane 0 in slot order, so the sum no longer depends on where each one ran.
+        size_t summedLanes = usedLanes;
+        if (fixedOrder && usedLanes > 0) {
+            auto & gathered = m_workBuffers[0];
+            for (size_t deviceIndex = 0; deviceIndex < m_deviceSnapshot.size(); deviceIndex++) {
+                const auto & deviceOutput = m_fixedOrderOutputs[deviceIndex];
+                if (!deviceOutput.rendered) {
+                    continue;
+                }
+                // Captured whether or not a SubMixer claims it: the freeze is of the device itself.
+                // Taken ahead of the fader, which stays live on the frozen device.
+                if (m_captureSlot) {
+                    if (m_deviceSlotSnapshot[deviceIndex] == *m_captureSlot) {
+                        for (uint32_t i = 0; i < bufferSize; i++) {
+                            gathered.outputBuffer[i] += deviceOutput.preFaderBuffer[i];
+                        }
+                    }
+                    continue;
+                }
+                if (m_deviceDirectOutSnapshot[deviceIndex]) {
+                    for (uint32_t i = 0; i < bufferSize; i++) {
+                        gathered.outputBuffer[i] += deviceOutput.outputBuffer[i];
+                    }
+                }
+                const auto & sendSource = deviceOutput.preFaderSend ? deviceOutput.preFaderBuffer : deviceOutput.outputBuffer;
+                for (size_t sendIndex = 0; sendIndex < sendCount; sendIndex++) {
+                    const double send = m_deviceSendSnapshot[deviceIndex * sendCount + sendIndex];
+                    if (send == 0.0) {
+                        continue;
+                    }
+                    auto & sendBuffer = gathered.sendBuffers[sendIndex];
+                    for (uint32_t i = 0; i < bufferSize; i++) {
+                        sendBuffer[i] += sendSource[i] * send;
+                    }
+                }
+            }
+            if (m_captureSlot) {
+                std::ranges::fill(gathered.sendHasSignal, 0);
+            } else {
+                for (size_t lane = 1; lane < usedLanes; lane++) {
+                    for (size_t sendIndex = 0; sendIndex < sendCount; sendIndex++) {
+                        gathered.sendHasSignal[sendIndex] |= m_workBuffers[lane].sendHasSignal[sendIndex];
+                    }
+                }
+            }
+            summedLanes = 1;
+        }
+
         // Sum the (parallel) lane results into the main output and send buses.
-        for (size_t lane = 0; lane < usedLanes; lane++) {
+        for (size_t lane = 0; lane < summedLanes; lane++) {
             const auto & workBuffer = m_workBuffers[lane];
             for (uint32_t i = 0; i < bufferSize; i++) {
                 context.buffer[i] += workBuffer.outputBuffer[i];
             }
             for (size_t sendIndex = 0; sendIndex < sendCount; sendIndex++) {
+                if (!workBuffer.sendHasSignal[sendIndex]) {
+                    continue;
+                }
+                m_sendBusHasSignal[sendIndex] = 1;
                 auto & sendBus = m_sendBusBuffers[sendIndex];
                 const auto & laneSendBus = workBuffer.sendBuffers[sendIndex];
                 for (uint32_t i = 0; i < bufferSize; i++) {
@@ -580,19 +1112,15 @@ void AudioEngine::process(AudioContext & context)
         }
     }
 
-    if (m_sendEffectRack->enabled() && std::ranges::any_of(effects, [](const auto & effect) { return effect != nullptr; })) {
-        if (m_sendBusHasSignal.size() != sendCount) {
-            m_sendBusHasSignal.assign(sendCount, 0);
-        }
-        // A send whose bus is quiet and whose tail has run out is skipped, so the dispatch counts
-        // only the ones that will really run. A reverb tail keeps its send alive well past the last
+    if (m_sendEffectRack->enabled() && !m_captureSlot && std::ranges::any_of(effects, [](const auto & effect) { return effect != nullptr; })) {
+        const DspProfiler::ScopedTimer sendsTimer { profiler, profilerLane, DspProfiler::key(DspProfiler::Scope::Sends) };
+        // A send whose bus is quiet and whose tail has run out sleeps, so the dispatch counts only
+        // the ones that will really run. A reverb tail keeps its send alive well past the last
         // note, which is exactly when this matters.
         size_t activeSendCount = 0;
         for (size_t i = 0; i < sendCount; i++) {
-            m_sendBusHasSignal[i] = bufferContainsSignal(m_sendBusBuffers[i], bufferSize) ? 1 : 0;
-            if (effects[i] && (m_sendBusHasSignal[i] || m_effectActiveFlags[i])) {
-                activeSendCount++;
-            }
+            m_sendAwake[i] = effects[i] && (m_sendBusHasSignal[i] || m_effectActiveFlags[i]) ? 1 : 0;
+            activeSendCount += m_sendAwake[i];
         }
 
         EffectProcessContext effectContext {
@@ -600,21 +1128,26 @@ void AudioEngine::process(AudioContext & context)
             &m_sendBusBuffers,
             &m_effectWetBuffers,
             &m_effectActiveFlags,
-            &m_sendBusHasSignal,
+            &m_sendAwake,
             context.frameCount,
             context.sampleRate,
             context.bpm,
-            context.oversampleFactor
+            context.oversampleFactor,
+            profiler
         };
         if (useWorkers && activeSendCount > 1) {
-            m_workerPool->run(sendCount, &effectContext, processEffectTask);
+            workerPool.run(sendCount, &effectContext, processEffectTask);
         } else {
             for (size_t taskIndex = 0; taskIndex < sendCount; taskIndex++) {
                 processEffectTask(&effectContext, taskIndex, 0);
             }
         }
 
-        for (const auto & wetBuffer : m_effectWetBuffers) {
+        for (size_t sendIndex = 0; sendIndex < sendCount; sendIndex++) {
+            if (!m_sendAwake[sendIndex]) {
+                continue;
+            }
+            const auto & wetBuffer = m_effectWetBuffers[sendIndex];
             for (uint32_t i = 0; i < bufferSize; i++) {
                 context.buffer[i] += wetBuffer[i];
             }
@@ -628,7 +1161,16 @@ void AudioEngine::process(AudioContext & context)
         }
     }
 
-    m_insertEffectRack->processInPlace(context);
+    if (pipelineMaster) {
+        // Nothing to overlap with this block, so the pending block is finished here instead.
+        if (!masterProcessed) {
+            processMasterInserts(*m_insertEffectRack, pipelinedMasterContext, profiler, profilerLane, m_masterLoadMeter);
+        }
+        // Out goes the previous block, now through the master; this block's mix waits for the next.
+        std::swap_ranges(context.buffer.begin(), context.buffer.begin() + bufferSize, m_masterPipelineBuffer.begin());
+    } else if (!m_captureSlot) {
+        processMasterInserts(*m_insertEffectRack, context, profiler, profilerLane, m_masterLoadMeter);
+    }
 
     // Whole-callback load. Over 100% is what the listener hears as a dropout, so the meter counts
     // those separately.
@@ -646,6 +1188,11 @@ const LoadMeter & AudioEngine::loadMeter() const
     return m_loadMeter;
 }
 
+DspProfiler & AudioEngine::dspProfiler()
+{
+    return *m_dspProfiler;
+}
+
 void AudioEngine::reset()
 {
     std::lock_guard<std::mutex> lock { m_mutex };
@@ -659,6 +1206,18 @@ void AudioEngine::reset()
 
     std::fill(m_deviceActiveFlags.begin(), m_deviceActiveFlags.end(), 0);
     std::fill(m_effectActiveFlags.begin(), m_effectActiveFlags.end(), 0);
+    std::ranges::fill(m_masterPipelineBuffer, 0.0);
+}
+
+void AudioEngine::resetDevices()
+{
+    std::lock_guard<std::mutex> lock { m_mutex };
+    for (auto const & [index, device] : m_devices) {
+        if (device) {
+            device->resetAudio();
+        }
+    }
+    std::fill(m_deviceActiveFlags.begin(), m_deviceActiveFlags.end(), 0);
 }
 
 void AudioEngine::clear()
@@ -670,6 +1229,7 @@ void AudioEngine::clear()
         }
     }
     m_devices.clear();
+    rebuildDeviceSnapshot();
     m_sendEffectRack->reset();
     m_insertEffectRack->reset();
 
@@ -683,6 +1243,7 @@ void AudioEngine::clear()
 
     std::fill(m_deviceActiveFlags.begin(), m_deviceActiveFlags.end(), 0);
     std::fill(m_effectActiveFlags.begin(), m_effectActiveFlags.end(), 0);
+    std::ranges::fill(m_masterPipelineBuffer, 0.0);
 }
 
 void AudioEngine::setIsExclusive(bool exclusive)
@@ -732,6 +1293,8 @@ void AudioEngine::prepare(uint32_t frameCount)
     if (m_sendBusBuffers.size() != sendCount) {
         m_sendBusBuffers.resize(sendCount);
     }
+    m_sendBusHasSignal.resize(sendCount);
+    m_sendAwake.resize(sendCount);
     for (auto & bus : m_sendBusBuffers) {
         if (bus.size() < bufferSize) {
             bus.resize(bufferSize, 0.0);
@@ -785,6 +1348,78 @@ bool AudioEngine::supportsPlaybackThreading() const
     return callbackIsRealTime() && m_workerPool->hasRealTimeScheduling();
 }
 
+void AudioEngine::setMasterPipelineEnabled(bool enabled)
+{
+    m_masterPipelineEnabled = enabled;
+}
+
+bool AudioEngine::masterPipelineEnabled() const
+{
+    return m_masterPipelineEnabled;
+}
+
+uint32_t AudioEngine::masterPipelineLatency(uint32_t frameCount) const
+{
+    const bool inEffect = m_masterPipelineEnabled.load() && m_playbackThreadingEnabled.load() && supportsPlaybackThreading();
+    return inEffect ? frameCount : 0;
+}
+
+void AudioEngine::setFixedOrderSumming(bool enabled)
+{
+    m_fixedOrderSumming = enabled;
+}
+
+bool AudioEngine::fixedOrderSumming() const
+{
+    return m_fixedOrderSumming;
+}
+
+void AudioEngine::setFrozenDevicePlayer(size_t slotIndex, FrozenDevicePlayerS player)
+{
+    std::lock_guard<std::mutex> lock { m_mutex };
+    m_frozenDevicePlayers[slotIndex] = std::move(player);
+    rebuildFrozenDevicePlayerSnapshot();
+}
+
+void AudioEngine::clearFrozenDevicePlayers()
+{
+    std::lock_guard<std::mutex> lock { m_mutex };
+    for (auto const & [index, player] : m_frozenDevicePlayers) {
+        if (const auto it = m_devices.find(index); it != m_devices.end() && it->second) {
+            it->second->resetAudio();
+        }
+    }
+    // The players are stopped by whoever started them, once they are off the audio thread.
+    m_frozenDevicePlayers.clear();
+    m_frozenDevicePlayersStarted = false;
+    rebuildFrozenDevicePlayerSnapshot();
+}
+
+void AudioEngine::startFrozenDevicePlayers()
+{
+    m_frozenDevicePlayersStarted = true;
+}
+
+void AudioEngine::setCaptureSlot(std::optional<size_t> slotIndex)
+{
+    std::lock_guard<std::mutex> lock { m_mutex };
+    m_captureSlot = slotIndex;
+}
+
+uint32_t AudioEngine::playbackSampleRate() const
+{
+    return m_playbackSampleRate;
+}
+
+void AudioEngine::setRenderAheadBuffer(RenderAheadBufferS buffer)
+{
+    std::lock_guard<std::mutex> lock { m_renderAheadMutex };
+    if (buffer && m_renderAheadBuffer) {
+        buffer->takeOver(m_renderAheadBuffer);
+    }
+    m_renderAheadBuffer = std::move(buffer);
+}
+
 bool AudioEngine::isExclusive() const
 {
     return m_isExclusive;
@@ -816,8 +1451,10 @@ void AudioEngine::ensureWorkBuffers(size_t laneCount, size_t sendCount, uint32_t
         if (workBuffer.outputBuffer.size() < bufferSize) {
             workBuffer.outputBuffer.resize(bufferSize, 0.0);
         }
+        workBuffer.planarBuffer.reserve(bufferSize / 2);
         if (workBuffer.sendBuffers.size() != sendCount) {
             workBuffer.sendBuffers.resize(sendCount);
+            workBuffer.sendHasSignal.assign(sendCount, 0);
         }
         for (auto & sendBuffer : workBuffer.sendBuffers) {
             if (sendBuffer.size() < bufferSize) {
@@ -847,6 +1484,21 @@ void AudioEngine::ensureEffectActiveFlags(size_t effectCount)
     }
 }
 
+void AudioEngine::ensureFixedOrderOutputs(size_t deviceCount, uint32_t bufferSize)
+{
+    if (m_fixedOrderOutputs.size() != deviceCount) {
+        m_fixedOrderOutputs.resize(deviceCount);
+    }
+
+    for (auto & deviceOutput : m_fixedOrderOutputs) {
+        if (deviceOutput.outputBuffer.size() < bufferSize) {
+            deviceOutput.outputBuffer.resize(bufferSize, 0.0);
+            deviceOutput.preFaderBuffer.resize(bufferSize, 0.0);
+        }
+        deviceOutput.rendered = false;
+    }
+}
+
 void AudioEngine::ensureDeviceActiveFlags(size_t deviceCount)
 {
     if (m_deviceActiveFlags.size() != deviceCount) {
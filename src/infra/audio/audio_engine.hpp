@@ -17,21 +17,26 @@
 #define AUDIO_ENGINE_HPP
 
 #include "../../domain/devices/device.hpp"
+#include "../../domain/dsp/planar_buffer.hpp"
 
 #include <cstdint>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "../../domain/utility/load_meter.hpp"
+#include "real_time_worker_pool.hpp"
 
 namespace noteahead {
 
+class DspProfiler;
 class EffectRack;
-class RealTimeWorkerPool;
+class FrozenDevicePlayer;
+class RenderAheadBuffer;
 
 struct AudioEngineWorkBuffer
 {
@@ -40,6 +45,22 @@ struct AudioEngineWorkBuffer
     std::vector<double> preFaderBuffer {};
     std::vector<double> outputBuffer {};
     std::vector<std::vector<double>> sendBuffers {};
+    //! Whether anything on this lane reached each send bus this block, so waking a send does not
+    //! take a scan of its bus.
+    std::vector<uint8_t> sendHasSignal {};
+    //! Where a device that renders planar float does so, before it joins the double-precision path.
+    PlanarBuffer planarBuffer {};
+};
+
+//! One device's share of the mix, held back so the devices can be summed in a fixed order. See
+//! AudioEngine::setFixedOrderSumming().
+struct AudioEngineDeviceOutput
+{
+    std::vector<double> outputBuffer {};
+    std::vector<double> preFaderBuffer {};
+    //! Whether the device rendered this block; one left asleep adds nothing.
+    bool rendered {};
+    bool preFaderSend {};
 };
 
 class AudioEngine
@@ -57,12 +78,17 @@ public:
 
     using DeviceNames = std::vector<std::string>;
     DeviceNames deviceNames() const;
+    //! The occupied slots, in order.
+    using DeviceSlots = std::vector<size_t>;
+    DeviceSlots deviceSlots() const;
 
     void setBpm(float bpm);
 
     void process(AudioContext & context);
 
     void reset();
+    //! Like reset(), but for the devices only: the send and master effects ring on.
+    void resetDevices();
     void clear();
 
     void setIsExclusive(bool exclusive);
@@ -75,6 +101,58 @@ public:
     //! Whether threaded playback can be used at all on this system.
     bool supportsPlaybackThreading() const;
 
+    //! Opt-in trade of one block of latency for a shorter callback: the master insert rack then
+    //! works on the previous block's mix, on a worker, while this block's devices render. Only in
+    //! effect while playback is threaded; offline renders stay sample-aligned regardless.
+    void setMasterPipelineEnabled(bool enabled);
+    bool masterPipelineEnabled() const;
+    //! The output latency the pipeline adds at the given block size: a whole block while it is in
+    //! effect, nothing otherwise. For the backend to report on to the rest of the audio graph.
+    uint32_t masterPipelineLatency(uint32_t frameCount) const;
+
+    //! Sums the devices into the master and the send buses in slot order rather than lane by lane.
+    //! Which lane a device lands on is up to the worker threads, and floating-point addition is not
+    //! associative, so the threaded mix otherwise varies in its last bits from one run to the next.
+    //! Costs a copy of every device's block; meant for reproducible renders.
+    void setFixedOrderSumming(bool enabled);
+    bool fixedOrderSumming() const;
+
+    //! Plays a rendered file in place of the device in the slot. The file stands in for the device's
+    //! output ahead of its fader: the instrument, and the inserts too where the fader comes after
+    //! them. The fader and whatever the fader precedes still run, so the device's sends and
+    //! whatever reads it as a sidechain hear the file as they would the device. A file rendered at
+    //! any other rate than the block's is ignored, and the device plays live.
+    //!
+    //! The device stays silent until startFrozenDevicePlayers(), from whose next block the files run.
+    using FrozenDevicePlayerS = std::shared_ptr<FrozenDevicePlayer>;
+    void setFrozenDevicePlayer(size_t slotIndex, FrozenDevicePlayerS player);
+    //! Lets the frozen files run from the next block, the one the song's first tick lands in. Safe
+    //! to call from any thread.
+    void startFrozenDevicePlayers();
+    //! Hands every frozen slot back to its device, reset, so that none of them sounds the notes it
+    //! was sent while the file played for it.
+    void clearFrozenDevicePlayers();
+
+    //! Puts out only the device in the given slot, as it reaches its fader: after its inserts when
+    //! the fader follows them, and without the sends and the master inserts. What freezing a device
+    //! records. Sums in a fixed order while set, the capture being one device's share of that sum.
+    void setCaptureSlot(std::optional<size_t> slotIndex);
+
+    //! Rate of the last block played back rather than rendered offline, or 0 before the first.
+    uint32_t playbackSampleRate() const;
+
+    //! Plays the song out of a buffer rendered ahead of the playhead instead of rendering it, for as
+    //! long as one is set, so that playback costs the callback a copy. The devices then belong to
+    //! the thread filling the buffer through renderAhead(). A buffer rendered at any other rate than
+    //! the block's plays silence. Replacing a buffer hands playback over to the new one; see
+    //! RenderAheadBuffer::takeOver().
+    using RenderAheadBufferS = std::shared_ptr<RenderAheadBuffer>;
+    void setRenderAheadBuffer(RenderAheadBufferS buffer);
+    //! Renders a block as an export does, fanned out and without a deadline, for the render-ahead
+    //! thread. Never reads the render-ahead buffer. Fans out on workers of its own rather than on
+    //! those of playback.
+    void renderAhead(AudioContext & context);
+
     //! Told by a backend that knows its callback thread's real-time priority up front — JACK does,
     //! through jack_client_real_time_priority(). Without this the engine only learns the priority
     //! from inside the callback, too late to have sized the workers against it.
@@ -99,6 +177,9 @@ public:
     LoadMeter & loadMeter();
     const LoadMeter & loadMeter() const;
 
+    //! Per-device, per-effect and per-phase timings of the callback. Off until switched on.
+    DspProfiler & dspProfiler();
+
     //! Oversampling factor used for realtime playback (offline export sets its own factor directly on
     //! the AudioContext). Read by the playback context builders and stamped onto each device's context.
     void setPlaybackOversampleFactor(uint8_t factor);
@@ -108,20 +189,43 @@ public:
     EffectRack & insertEffectRack();
 
 private:
+    //! The block proper, fanned out on the given pool. Offline for an export and for the
+    //! render-ahead thread: no deadline, so it always fans out and keeps the master in line.
+    void render(AudioContext & context, bool offline, RealTimeWorkerPool & workerPool);
+    //! Fills the block from the render-ahead buffer, if one is set. Drops a finished buffer once it
+    //! has run out, and returns false for the block to be rendered live.
+    bool playRenderedAhead(AudioContext & context);
+
     void ensureWorkBuffers(size_t laneCount, size_t sendCount, uint32_t bufferSize);
     void ensureEffectWetBuffers(size_t effectCount, uint32_t bufferSize);
     void ensureEffectActiveFlags(size_t effectCount);
     void ensureDeviceActiveFlags(size_t deviceCount);
     void ensureDeviceOutputBuffers(uint32_t bufferSize);
+    void ensureFixedOrderOutputs(size_t deviceCount, uint32_t bufferSize);
+    //! Re-reads the devices from m_devices into m_deviceSnapshot. Only called when a device comes
+    //! or goes, with the lock held, so the callback never walks the map or copies its pointers.
+    void rebuildDeviceSnapshot();
+    //! Lines the frozen players up with m_deviceSnapshot. Called with the lock held, as above.
+    void rebuildFrozenDevicePlayerSnapshot();
+    //! Keeps an output buffer for exactly the occupied slots and releases the rest. Part of
+    //! rebuildDeviceSnapshot(), so the buffers come and go under the lock, not on the callback.
+    void updateDeviceOutputSlots();
 
     void rebuildProcessingGraph();
     //! Marks which devices still feed the master directly. A device claimed as a SubMixer member
     //! is heard through that SubMixer instead, so its direct contribution has to be suppressed.
+    //! Also records the devices that wake each device by playing: its members and sidechains.
     void updateDirectOutSnapshot();
     //! Builds a signature of the current graph inputs (device slots + their sidechain deps) into a
     //! reusable buffer and reports whether it changed since the last rebuild. Allocation-free in
     //! steady state so it is safe to call every audio callback.
     bool processingGraphChanged();
+    //! Orders the device graph's ready tasks by the longest chain of recent cost still ahead of
+    //! each, so the threaded path starts the work that bounds the block first. Allocation-free.
+    void prioritizeDeviceTasks(RealTimeWorkerPool::TaskGraph & graph);
+    //! Brings the pipelined master's pending block in line with whether the pipeline runs this
+    //! block. Whatever was pending is dropped when it starts, stops or the block size changes.
+    void updateMasterPipeline(bool pipelined, uint32_t bufferSize);
 
     std::map<size_t, DeviceS> m_devices;
     std::unique_ptr<EffectRack> m_sendEffectRack;
@@ -132,27 +236,70 @@ private:
     std::vector<std::shared_ptr<Effect>> m_sendEffectsSnapshot;
     uint64_t m_sendEffectsVersion = std::numeric_limits<uint64_t>::max();
     std::unique_ptr<RealTimeWorkerPool> m_workerPool;
+    //! The render-ahead thread's own, at normal priority and made on its first block. It has no
+    //! deadline, and the playback workers may be real-time, which would let it preempt the UI.
+    std::unique_ptr<RealTimeWorkerPool> m_renderAheadPool;
+    //! Sized from the pool, so it has to come after it.
+    std::unique_ptr<DspProfiler> m_dspProfiler;
     std::vector<AudioEngineWorkBuffer> m_workBuffers;
     std::vector<DeviceS> m_deviceSnapshot;
     std::vector<size_t> m_deviceSlotSnapshot;
     std::vector<uint8_t> m_deviceActiveFlags;
     std::vector<double> m_deviceSendSnapshot;
     std::vector<uint8_t> m_deviceDirectOutSnapshot;
+    //! Per snapshot index: the devices a SubMixer sums, which wake it from sleep when they play.
+    std::vector<std::vector<size_t>> m_deviceWakeSources;
     std::vector<std::vector<double>> m_sendBusBuffers;
     std::vector<std::vector<double>> m_effectWetBuffers;
     std::vector<uint8_t> m_effectActiveFlags;
-    //! Whether each send bus carries anything this block. Decided once here rather than inside the
-    //! per-effect task, because the dispatch has to know how much work there is before handing it out.
+    //! Whether each send bus carries anything this block, as the devices reported it.
     std::vector<uint8_t> m_sendBusHasSignal;
+    //! Whether each send runs this block: its bus carries something or its tail is still ringing.
+    //! Decided once here rather than inside the per-effect task, because the dispatch has to know
+    //! how much work there is before handing it out.
+    std::vector<uint8_t> m_sendAwake;
+    //! Indexed by slot, but only the occupied slots, listed in m_deviceOutputSlots, hold a buffer:
+    //! an empty span tells a reader there is nothing in that slot to read.
     std::vector<std::vector<double>> m_deviceOutputBuffers;
     std::vector<std::span<const double>> m_deviceOutputBufferSpans;
+    std::vector<size_t> m_deviceOutputSlots;
+    uint32_t m_deviceOutputBufferSize = 0;
+    //! Per snapshot index, while summing in a fixed order.
+    std::vector<AudioEngineDeviceOutput> m_fixedOrderOutputs;
+    std::map<size_t, FrozenDevicePlayerS> m_frozenDevicePlayers;
+    //! Per snapshot index, null for a device that plays live.
+    std::vector<FrozenDevicePlayer *> m_frozenDevicePlayerSnapshot;
+    std::atomic<bool> m_frozenDevicePlayersStarted { false };
+    std::optional<size_t> m_captureSlot;
+    //! Under a lock of its own, so that the callback playing it never waits for the engine mutex,
+    //! which the render-ahead thread holds through a whole block.
+    RenderAheadBufferS m_renderAheadBuffer;
+    std::mutex m_renderAheadMutex;
     std::vector<std::vector<size_t>> m_processingLayers;
+    //! The same dependencies as m_processingLayers, for the threaded path, which does not wait for
+    //! a whole layer before starting a device whose own inputs are ready.
+    RealTimeWorkerPool::TaskGraph m_deviceTaskGraph;
+    //! m_deviceTaskGraph plus one last task, depending on nothing, that runs the master insert rack
+    //! on the previous block while the devices render this one.
+    RealTimeWorkerPool::TaskGraph m_pipelinedTaskGraph;
+    std::vector<size_t> m_deviceTopologicalOrder;
+    //! Per device: its own recent cost plus the costliest chain of devices waiting on it, in ns.
+    //! One entry more than there are devices, for the pipelined master.
+    std::vector<double> m_deviceCriticalPath;
     std::vector<size_t> m_scratchDeps;
     std::vector<size_t> m_graphSignature;
     std::vector<size_t> m_prevGraphSignature;
     mutable std::mutex m_mutex;
     std::atomic<bool> m_isExclusive { false };
     std::atomic<bool> m_playbackThreadingEnabled { false };
+    std::atomic<bool> m_masterPipelineEnabled { false };
+    std::atomic<bool> m_fixedOrderSumming { false };
+    std::atomic<uint32_t> m_playbackSampleRate { 0 };
+    //! Whether the last block was pipelined, and the pre-master mix it left for the next one.
+    bool m_masterPipelined { false };
+    std::vector<double> m_masterPipelineBuffer;
+    //! Only its cost is used, to rank the pipelined master among the device tasks.
+    LoadMeter m_masterLoadMeter;
     //! Scheduling of the thread that drives playback, sampled once from process(). Threading
     //! playback is only safe when that thread is itself real-time: workers above a non-real-time
     //! callback preempt the very thread waiting on them, which is heard as stuttering.
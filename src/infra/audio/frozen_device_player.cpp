@@ -0,0 +1,112 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "frozen_device_player.hpp"
+
+#include "backend/audio_file_reader.hpp"
+
+#include <algorithm>
+
+namespace noteahead {
+
+namespace {
+//! Samples, not frames: a few seconds of stereo at the usual rates, to ride out a busy disk.
+constexpr size_t RingBufferSize = 1 << 18;
+constexpr size_t ReadBufferFrames = 1024;
+} // namespace
+
+FrozenDevicePlayer::FrozenDevicePlayer(std::unique_ptr<AudioFileReader> reader)
+  : m_streamer { std::move(reader) }
+{
+}
+
+FrozenDevicePlayer::~FrozenDevicePlayer()
+{
+    stop();
+}
+
+void FrozenDevicePlayer::start(const std::string & fileName, double startSeconds)
+{
+    stop();
+
+    m_streamer.start(fileName, RingBufferSize);
+    m_sampleRate = static_cast<uint32_t>(m_streamer.sampleRate());
+    m_readBuffer.resize(ReadBufferFrames * static_cast<size_t>(std::max(m_streamer.channels(), 1)));
+    m_framesOwed = 0;
+
+    // The streamer seeks by fraction of the file; the song only knows its time.
+    if (const auto frames = m_streamer.frames(); frames > 0 && startSeconds > 0.0) {
+        m_streamer.setPosition(std::min(startSeconds * m_sampleRate / static_cast<double>(frames), 1.0));
+    }
+
+    m_channelCount = static_cast<size_t>(std::max(m_streamer.channels(), 0));
+}
+
+void FrozenDevicePlayer::stop()
+{
+    m_streamer.stop();
+    m_channelCount = 0;
+}
+
+uint32_t FrozenDevicePlayer::sampleRate() const
+{
+    return m_sampleRate;
+}
+
+void FrozenDevicePlayer::read(std::span<double> buffer, uint32_t frameCount)
+{
+    if (!m_channelCount) {
+        std::fill_n(buffer.begin(), static_cast<size_t>(frameCount) * 2, 0.0);
+        return;
+    }
+
+    const auto popFrames = [this](size_t frames) {
+        return m_streamer.pop(m_readBuffer.data(), frames * m_channelCount) / m_channelCount;
+    };
+
+    // What should have been heard earlier is dropped, not played late.
+    while (m_framesOwed > 0) {
+        const auto popped = popFrames(static_cast<size_t>(std::min<uint64_t>(m_framesOwed, ReadBufferFrames)));
+        if (!popped) {
+            break;
+        }
+        m_framesOwed -= popped;
+    }
+
+    size_t frame = 0;
+    while (frame < frameCount) {
+        const auto wanted = std::min<size_t>(frameCount - frame, ReadBufferFrames);
+        const auto popped = popFrames(wanted);
+        for (size_t i = 0; i < popped; i++) {
+            const auto left = static_cast<double>(m_readBuffer[i * m_channelCount]);
+            const auto right = m_channelCount > 1 ? static_cast<double>(m_readBuffer[i * m_channelCount + 1]) : left;
+            buffer[(frame + i) * 2] = left;
+            buffer[(frame + i) * 2 + 1] = right;
+        }
+        frame += popped;
+        if (popped < wanted) {
+            break;
+        }
+    }
+
+    if (frame < frameCount) {
+        std::fill(buffer.begin() + static_cast<std::ptrdiff_t>(frame * 2), buffer.begin() + static_cast<std::ptrdiff_t>(frameCount) * 2, 0.0);
+        if (!m_streamer.isFinished()) {
+            m_framesOwed += frameCount - frame;
+        }
+    }
+}
+
+} // namespace noteahead
@@ -0,0 +1,66 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef FROZEN_DEVICE_PLAYER_HPP
+#define FROZEN_DEVICE_PLAYER_HPP
+
+#include "audio_file_streamer.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace noteahead {
+
+class AudioFileReader;
+
+//! Plays a frozen device's rendered output in place of the device. See
+//! AudioEngine::setFrozenDevicePlayer().
+//!
+//! The file is streamed from disk on the streamer's own thread, so reading it on the audio thread
+//! costs no more than a copy out of a ring buffer.
+class FrozenDevicePlayer
+{
+public:
+    explicit FrozenDevicePlayer(std::unique_ptr<AudioFileReader> reader = nullptr);
+    ~FrozenDevicePlayer();
+
+    //! Starts streaming the file from the given time into it. Throws if the file cannot be opened.
+    void start(const std::string & fileName, double startSeconds);
+    void stop();
+
+    //! The rate the file was rendered at. The engine plays the device live rather than play the
+    //! file at any other rate.
+    uint32_t sampleRate() const;
+
+    //! Writes the next frameCount frames over the start of an interleaved stereo buffer.
+    //!
+    //! Frames the disk has not delivered yet come out as silence and are skipped once they do
+    //! arrive, so a slow disk costs a gap rather than putting the device behind the song for good.
+    void read(std::span<double> buffer, uint32_t frameCount);
+
+private:
+    AudioFileStreamer m_streamer;
+    std::vector<float> m_readBuffer;
+    uint64_t m_framesOwed { 0 };
+    uint32_t m_sampleRate { 0 };
+    size_t m_channelCount { 0 };
+};
+
+} // namespace noteahead
+
+#endif // FROZEN_DEVICE_PLAYER_HPP
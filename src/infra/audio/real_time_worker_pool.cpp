@@ -16,6 +16,7 @@
 #include "real_time_worker_pool.hpp"
 #include "../../common/denormal_protection.hpp"
 #include "../../contrib/SimpleLogger/src/simple_logger.hpp"
+#include "../../domain/utility/dsp_profiler.hpp"
 
 #include <algorithm>
 #include <cstdlib>
@@ -62,6 +63,10 @@ RealTimeWorkerPool::RealTimeWorkerPool(size_t workerCount)
     juzzlin::L(TAG).info() << "Worker pool: " << workerCount << " worker thread(s)"
                            << (workerCount == 0 ? " (single-threaded)" : "");
     startWorkers();
+    for (size_t lane = 0; lane < workerCount + 1; lane++) {
+        m_readyTasks.push_back(std::make_unique<WorkStealingDeque>());
+    }
+    m_forks = std::make_unique<Fork[]>(workerCount + 1);
 }
 
 RealTimeWorkerPool::~RealTimeWorkerPool()
@@ -113,6 +118,11 @@ void RealTimeWorkerPool::setRealTimePriority(int priority)
     startWorkers();
 }
 
+void RealTimeWorkerPool::setProfiler(DspProfiler * profiler)
+{
+    m_profiler.store(profiler, std::memory_order_relaxed);
+}
+
 bool RealTimeWorkerPool::hasRealTimeScheduling() const
 {
     if (m_workerIsRealTime.empty()) {
@@ -176,12 +186,21 @@ void RealTimeWorkerPool::workerLoop(size_t workerIndex)
 {
     uint64_t lastGeneration = 0;
     while (waitForWork(lastGeneration)) {
-        while (true) {
-            const size_t taskIndex = m_nextTask.fetch_add(1, std::memory_order_relaxed);
-            if (taskIndex >= m_taskCount) {
-                break;
+        {
+            // Recorded before signing off below: once this worker has, the callback thread may be
+            // serially processing on lane 0 and the lane would have two writers.
+            const DspProfiler::ScopedTimer laneTimer { m_profiler.load(std::memory_order_relaxed), workerIndex, DspProfiler::key(DspProfiler::Scope::Lane, static_cast<uint32_t>(workerIndex)) };
+            if (m_graph) {
+                executeGraph(workerIndex);
+            } else {
+                while (true) {
+                    const size_t taskIndex = m_nextTask.fetch_add(1, std::memory_order_relaxed);
+                    if (taskIndex >= m_taskCount) {
+                        break;
+                    }
+                    m_callback(m_context, taskIndex, workerIndex);
+                }
             }
-            m_callback(m_context, taskIndex, workerIndex);
         }
 
         if (m_activeWorkers.fetch_sub(1, std::memory_order_acq_rel) == 1) {
@@ -206,6 +225,7 @@ void RealTimeWorkerPool::run(size_t taskCount, void * context, TaskCallback call
     m_context = context;
     m_callback = callback;
     m_taskCount = taskCount;
+    m_graph = nullptr;
     const size_t mainWorkerIndex = m_workers.size();
     m_nextTask.store(1, std::memory_order_relaxed);
     // Every worker wakes on the generation bump and decrements exactly once, whether or not it
@@ -216,19 +236,218 @@ void RealTimeWorkerPool::run(size_t taskCount, void * context, TaskCallback call
     m_generation.fetch_add(1, std::memory_order_release);
     m_generation.notify_all();
 
-    callback(context, 0, mainWorkerIndex);
+    {
+        // The caller's own share, without the wait for the others after it.
+        const DspProfiler::ScopedTimer laneTimer { m_profiler.load(std::memory_order_relaxed), mainWorkerIndex, DspProfiler::key(DspProfiler::Scope::Lane, static_cast<uint32_t>(mainWorkerIndex)) };
+        callback(context, 0, mainWorkerIndex);
 
-    while (true) {
-        const size_t taskIndex = m_nextTask.fetch_add(1, std::memory_order_relaxed);
-        if (taskIndex >= m_taskCount) {
-            break;
+        while (true) {
+            const size_t taskIndex = m_nextTask.fetch_add(1, std::memory_order_relaxed);
+            if (taskIndex >= m_taskCount) {
+                break;
+            }
+            callback(context, taskIndex, mainWorkerIndex);
         }
-        callback(context, taskIndex, mainWorkerIndex);
     }
 
     waitForWorkers();
 }
 
+void RealTimeWorkerPool::reserveGraph(size_t taskCount)
+{
+    if (taskCount <= m_graphCapacity) {
+        return;
+    }
+
+    // Any one lane may end up holding every task, so each deque is sized for all of them.
+    for (auto && readyTasks : m_readyTasks) {
+        readyTasks->reserve(taskCount);
+    }
+    m_pendingDependencies = std::make_unique<std::atomic<uint32_t>[]>(taskCount);
+    m_graphCapacity = taskCount;
+}
+
+bool RealTimeWorkerPool::runGraph(const TaskGraph & graph, void * context, TaskCallback callback)
+{
+    const size_t taskCount = graph.taskCount();
+    if (taskCount > m_graphCapacity) {
+        return false;
+    }
+    if (taskCount == 0 || callback == nullptr) {
+        return true;
+    }
+
+    m_context = context;
+    m_callback = callback;
+    m_taskCount = taskCount;
+    m_graph = &graph;
+    for (size_t task = 0; task < taskCount; task++) {
+        m_pendingDependencies[task].store(graph.dependencyCounts[task], std::memory_order_relaxed);
+    }
+    m_remainingTasks.store(taskCount, std::memory_order_relaxed);
+
+    // Deal the roots out round-robin, most urgent to the caller's lane, which starts right away
+    // while the workers are still waking. A lane runs its own deque newest-first, so each lane's
+    // share is pushed least urgent first.
+    const size_t laneCount = m_workers.size() + 1;
+    const size_t mainWorkerIndex = m_workers.size();
+    for (auto && readyTasks : m_readyTasks) {
+        readyTasks->clear();
+    }
+    for (size_t rank = graph.roots.size(); rank-- > 0;) {
+        m_readyTasks[(mainWorkerIndex + rank) % laneCount]->push(graph.roots[rank]);
+    }
+
+    if (m_workers.empty()) {
+        executeGraph(mainWorkerIndex);
+        m_graph = nullptr;
+        return true;
+    }
+
+    m_activeWorkers.store(m_workers.size(), std::memory_order_release);
+    m_generation.fetch_add(1, std::memory_order_release);
+    m_generation.notify_all();
+
+    {
+        const DspProfiler::ScopedTimer laneTimer { m_profiler.load(std::memory_order_relaxed), mainWorkerIndex, DspProfiler::key(DspProfiler::Scope::Lane, static_cast<uint32_t>(mainWorkerIndex)) };
+        executeGraph(mainWorkerIndex);
+    }
+
+    waitForWorkers();
+    m_graph = nullptr;
+    return true;
+}
+
+void RealTimeWorkerPool::executeGraph(size_t lane)
+{
+    const auto & graph = *m_graph;
+    auto && ownTasks = *m_readyTasks[lane];
+    const size_t laneCount = m_readyTasks.size();
+
+    const auto takeTask = [&] {
+        auto task = ownTasks.pop();
+        for (size_t offset = 1; !task && offset < laneCount; offset++) {
+            task = m_readyTasks[(lane + offset) % laneCount]->steal();
+        }
+        return task;
+    };
+
+    int idleSpins = 0;
+    while (m_remainingTasks.load(std::memory_order_acquire)) {
+        auto task = takeTask();
+        if (!task) {
+            // Everything left is either running elsewhere or waiting for something that is. A task
+            // running elsewhere may have split itself up, so lend it a hand; otherwise spin, as the
+            // wait is usually a matter of microseconds.
+            if (helpForks(lane)) {
+                idleSpins = 0;
+                continue;
+            }
+            if (++idleSpins < SpinCount) {
+                spinPause();
+                continue;
+            }
+
+            // What is left is one long task, or a chain waiting on it: sleep until a task finishes
+            // or a fork opens. Announced before the last look, so an event after it either shows
+            // up in that look or wakes this lane.
+            idleSpins = 0;
+            m_graphWaiters.fetch_add(1);
+            const uint32_t events = m_graphEvents.load();
+            task = takeTask();
+            if (!task && m_remainingTasks.load() && !helpForks(lane)) {
+                m_graphEvents.wait(events);
+            }
+            m_graphWaiters.fetch_sub(1);
+            if (!task) {
+                continue;
+            }
+        }
+        idleSpins = 0;
+
+        m_callback(m_context, *task, lane);
+
+        // Whatever this made ready runs here next, while its inputs are still warm in this core's
+        // cache. Pushed in reverse so the most urgent is on top.
+        const size_t first = graph.dependentOffsets[*task];
+        for (size_t index = graph.dependentOffsets[*task + 1]; index-- > first;) {
+            const size_t dependent = graph.dependents[index];
+            if (m_pendingDependencies[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                ownTasks.push(dependent);
+            }
+        }
+        m_remainingTasks.fetch_sub(1, std::memory_order_acq_rel);
+        signalGraphEvent();
+    }
+}
+
+void RealTimeWorkerPool::signalGraphEvent()
+{
+    m_graphEvents.fetch_add(1);
+    if (m_graphWaiters.load()) {
+        m_graphEvents.notify_all();
+    }
+}
+
+void RealTimeWorkerPool::fork(size_t lane, size_t taskCount, void * context, const TaskCallback & callback)
+{
+    if (!m_graph || m_workers.empty() || taskCount < 2 || lane > m_workers.size()) {
+        for (size_t taskIndex = 0; taskIndex < taskCount; taskIndex++) {
+            callback(context, taskIndex, lane);
+        }
+        return;
+    }
+
+    auto & fork = m_forks[lane];
+    fork.callback = &callback;
+    fork.context = context;
+    fork.taskCount = taskCount;
+    fork.nextTask.store(0, std::memory_order_relaxed);
+    fork.remainingTasks.store(taskCount, std::memory_order_relaxed);
+    fork.open.store(true);
+    signalGraphEvent();
+
+    for (size_t taskIndex = fork.nextTask.fetch_add(1, std::memory_order_relaxed); taskIndex < taskCount; taskIndex = fork.nextTask.fetch_add(1, std::memory_order_relaxed)) {
+        callback(context, taskIndex, lane);
+        fork.remainingTasks.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    // Only the subtasks already taken are left, each a voice's worth of a block at most.
+    while (fork.remainingTasks.load(std::memory_order_acquire)) {
+        spinPause();
+    }
+
+    fork.open.store(false);
+    while (fork.helpers.load()) {
+        spinPause();
+    }
+}
+
+bool RealTimeWorkerPool::helpForks(size_t lane)
+{
+    bool helped = false;
+    const size_t laneCount = m_workers.size() + 1;
+    for (size_t offset = 1; offset < laneCount; offset++) {
+        auto & fork = m_forks[(lane + offset) % laneCount];
+        if (!fork.open.load(std::memory_order_acquire)) {
+            continue;
+        }
+
+        // Sequentially consistent with the owner's closing store and its read of helpers: one of
+        // the two sees the other.
+        fork.helpers.fetch_add(1);
+        if (fork.open.load()) {
+            for (size_t taskIndex = fork.nextTask.fetch_add(1, std::memory_order_relaxed); taskIndex < fork.taskCount; taskIndex = fork.nextTask.fetch_add(1, std::memory_order_relaxed)) {
+                (*fork.callback)(fork.context, taskIndex, lane);
+                fork.remainingTasks.fetch_sub(1, std::memory_order_acq_rel);
+                helped = true;
+            }
+        }
+        fork.helpers.fetch_sub(1);
+    }
+    return helped;
+}
+
 size_t RealTimeWorkerPool::defaultWorkerCount()
 {
     const auto hardwareThreads = std::thread::hardware_concurrency();
@@ -24,8 +24,12 @@
 #include <thread>
 #include <vector>
 
+#include "work_stealing_deque.hpp"
+
 namespace noteahead {
 
+class DspProfiler;
+
 //! Fan-out/fan-in worker pool for the audio engine, usable from a real-time callback.
 //!
 //! Two things make that possible, and both matter — an earlier attempt at threading playback had
@@ -44,11 +48,38 @@ namespace noteahead {
 //! straggler from the previous run and consumed by the next one, which desynchronises the fan-in
 //! and eventually hangs the caller. atomic::wait re-checks the value itself, so there is no token
 //! to lose or to misattribute.
+//!
+//! Besides a flat batch of independent tasks it runs a dependency graph, runGraph(), where a task
+//! starts the moment its own inputs are done rather than when a whole layer is. Each lane keeps its
+//! ready tasks in a WorkStealingDeque and idle lanes steal, so one heavy task no longer holds every
+//! other lane at a barrier.
+//!
+//! A graph task can in turn fork() into subtasks of its own, such as a device's voices, which
+//! lanes with nothing else ready help to run while the task waits for them.
 class RealTimeWorkerPool
 {
 public:
     using TaskCallback = std::function<void(void * context, size_t taskIndex, size_t workerIndex)>;
 
+    //! Tasks and what waits on them. The order of roots and of each task's dependents is the order
+    //! they are started in, so the caller puts the most urgent first: the ones heading the longest
+    //! remaining chain of work, which is what bounds how soon the whole graph can finish.
+    struct TaskGraph
+    {
+        //! Task i's dependents are dependents[dependentOffsets[i]] up to dependentOffsets[i + 1].
+        std::vector<size_t> dependentOffsets;
+        std::vector<size_t> dependents;
+        //! How many tasks each task waits for.
+        std::vector<uint32_t> dependencyCounts;
+        //! Tasks that wait for nothing.
+        std::vector<size_t> roots;
+
+        size_t taskCount() const
+        {
+            return dependencyCounts.size();
+        }
+    };
+
     explicit RealTimeWorkerPool(size_t workerCount = defaultWorkerCount());
     ~RealTimeWorkerPool();
 
@@ -60,12 +91,30 @@ public:
 
     void run(size_t taskCount, void * context, TaskCallback callback);
 
+    //! Runs every task of the graph once, each only after all it depends on. The graph must be
+    //! acyclic and have been reserved for with reserveGraph(). A graph larger than that runs
+    //! nothing and returns false, so the caller can run its tasks another way.
+    bool runGraph(const TaskGraph & graph, void * context, TaskCallback callback);
+    //! Sizes the scheduling state for graphs of up to taskCount tasks. Allocates, so call it before
+    //! the run and never while one is in progress.
+    void reserveGraph(size_t taskCount);
+
+    //! From inside a task of runGraph(): runs taskCount subtasks on this lane and on whichever
+    //! lanes run out of graph tasks meanwhile, and returns once all are done. The calling task keeps
+    //! its lane throughout, and with it whatever locks it holds. Anywhere else, and for a single
+    //! subtask, everything runs in order on the calling thread. Not to be called from a subtask.
+    void fork(size_t lane, size_t taskCount, void * context, const TaskCallback & callback);
+
     //! True only when *every* worker got real-time scheduling. Playback must not fan out otherwise.
     bool hasRealTimeScheduling() const;
 
     //! Priority the default factory asks for, when positive. Ignored by a custom factory.
     void setRealTimePriority(int priority);
 
+    //! Times each lane's share of every run, so a profile shows how evenly the work spread. Null,
+    //! the default, times nothing.
+    void setProfiler(DspProfiler * profiler);
+
     static size_t defaultWorkerCount();
 
 private:
@@ -76,6 +125,13 @@ private:
     bool waitForWork(uint64_t & lastGeneration);
     //! Blocks until every enlisted worker has finished this run.
     void waitForWorkers();
+    //! One lane's part in a graph run: its own tasks first, then whatever it can steal, until none
+    //! are left anywhere.
+    void executeGraph(size_t lane);
+    //! Runs subtasks of any other lane's open fork. False when there were none to take.
+    bool helpForks(size_t lane);
+    //! Wakes the lanes blocked in executeGraph() to look for work again.
+    void signalGraphEvent();
 
     //! Spins before blocking. A few microseconds on a modern core, which covers the gap between
     //! the callback starting a run and a worker noticing it.
@@ -101,9 +157,44 @@ private:
     //! count cannot be left inconsistent by a straggler crossing into the next run.
     std::atomic<size_t> m_activeWorkers { 0 };
 
+    std::atomic<DspProfiler *> m_profiler { nullptr };
+
     TaskCallback m_callback { nullptr };
     void * m_context { nullptr };
     size_t m_taskCount { 0 };
+
+    //! The graph being run, or null for a flat run.
+    const TaskGraph * m_graph { nullptr };
+    std::vector<std::unique_ptr<WorkStealingDeque>> m_readyTasks;
+    std::unique_ptr<std::atomic<uint32_t>[]> m_pendingDependencies;
+    size_t m_graphCapacity { 0 };
+    //! Tasks of the graph not finished yet. A lane keeps looking for work until this reaches zero.
+    std::atomic<size_t> m_remainingTasks { 0 };
+    //! Bumped whenever a graph task finishes or a fork opens, the only two ways new work turns up.
+    //! A lane that has spun out blocks on it.
+    std::atomic<uint32_t> m_graphEvents { 0 };
+    //! Lanes blocked on m_graphEvents, so that the syscall to wake them is only made when there is
+    //! someone to wake.
+    std::atomic<size_t> m_graphWaiters { 0 };
+
+    //! A graph task's subtasks, open to any lane that has nothing else to do.
+    //!
+    //! A helper announces itself in helpers before it looks at anything else, and the owner, having
+    //! closed the fork, waits for helpers to drop to zero before it returns. So a helper either sees
+    //! the fork closed and backs out, or is waited for: it can never read one fork's fields while the
+    //! owner is already filling them in for the next.
+    struct Fork
+    {
+        const TaskCallback * callback { nullptr };
+        void * context { nullptr };
+        size_t taskCount { 0 };
+        std::atomic<size_t> nextTask { 0 };
+        std::atomic<size_t> remainingTasks { 0 };
+        std::atomic<bool> open { false };
+        std::atomic<size_t> helpers { 0 };
+    };
+    //! One per lane, since each lane runs at most one task at a time.
+    std::unique_ptr<Fork[]> m_forks;
 };
 
 } // namespace noteahead
@@ -0,0 +1,142 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "render_ahead_buffer.hpp"
+
+#include <algorithm>
+
+namespace noteahead {
+
+RenderAheadBuffer::RenderAheadBuffer(uint32_t sampleRate, size_t capacityFrames, uint64_t startFrame)
+  // The ring keeps one slot empty to tell full from empty.
+  : m_ring { capacityFrames * 2 + 1 }
+  , m_sampleRate { sampleRate }
+  , m_startFrame { startFrame }
+  , m_position { startFrame }
+{
+}
+
+uint32_t RenderAheadBuffer::sampleRate() const
+{
+    return m_sampleRate;
+}
+
+uint64_t RenderAheadBuffer::startFrame() const
+{
+    return m_startFrame;
+}
+
+bool RenderAheadBuffer::write(std::span<const double> buffer, uint32_t frameCount)
+{
+    return m_ring.push(buffer.data(), static_cast<size_t>(frameCount) * 2);
+}
+
+size_t RenderAheadBuffer::framesAvailable() const
+{
+    return m_ring.readAvailable() / 2;
+}
+
+void RenderAheadBuffer::finish()
+{
+    m_isFinished.store(true, std::memory_order_release);
+}
+
+uint32_t RenderAheadBuffer::blockFrames() const
+{
+    return m_blockFrames.load(std::memory_order_relaxed);
+}
+
+void RenderAheadBuffer::start()
+{
+    m_isStarted.store(true, std::memory_order_release);
+}
+
+uint32_t RenderAheadBuffer::read(std::span<double> buffer, uint32_t frameCount)
+{
+    const auto sampleCount = static_cast<size_t>(frameCount) * 2;
+    m_blockFrames.store(frameCount, std::memory_order_relaxed);
+    if (!m_isStarted.load(std::memory_order_acquire)) {
+        std::fill_n(buffer.begin(), sampleCount, 0.0);
+        return frameCount;
+    }
+
+    // Read ahead of the frames: once it is set, every frame the render is going to write is there.
+    const bool finished = m_isFinished.load(std::memory_order_acquire);
+
+    const auto position = m_position.load(std::memory_order_relaxed);
+    size_t frame = 0;
+    // Short of this buffer's start, the one it took over from still has the song.
+    if (position < m_startFrame) {
+        frame = static_cast<size_t>(std::min<uint64_t>(frameCount, m_startFrame - position));
+        if (m_previous) {
+            m_previous->read(buffer, static_cast<uint32_t>(frame));
+        } else {
+            std::fill_n(buffer.begin(), frame * 2, 0.0);
+        }
+    }
+
+    // What should have been heard earlier is dropped, not played late. The part of the block still
+    // to be written is the scratch space for it.
+    const auto rest = buffer.subspan(frame * 2, sampleCount - frame * 2);
+    while (m_framesOwed > 0 && !rest.empty()) {
+        const auto popped = m_ring.pop(rest.data(), static_cast<size_t>(std::min<uint64_t>(m_framesOwed * 2, rest.size()))) / 2;
+        if (!popped) {
+            break;
+        }
+        m_framesOwed -= popped;
+    }
+
+    frame += m_ring.pop(rest.data(), rest.size()) / 2;
+    if (frame < frameCount && finished) {
+        m_position.store(position + frame, std::memory_order_release);
+        return static_cast<uint32_t>(frame);
+    }
+    if (frame < frameCount) {
+        std::fill(buffer.begin() + static_cast<std::ptrdiff_t>(frame * 2), buffer.begin() + static_cast<std::ptrdiff_t>(sampleCount), 0.0);
+        m_framesOwed += frameCount - frame;
+    }
+
+    m_position.store(position + frameCount, std::memory_order_release);
+    return frameCount;
+}
+
+uint64_t RenderAheadBuffer::position() const
+{
+    return m_position.load(std::memory_order_acquire);
+}
+
+void RenderAheadBuffer::takeOver(std::shared_ptr<RenderAheadBuffer> previous)
+{
+    if (previous) {
+        const auto position = previous->position();
+        m_position.store(position, std::memory_order_relaxed);
+        // Playback is already past the start of this render, which then begins that much in.
+        m_framesOwed = position > m_startFrame ? position - m_startFrame : 0;
+        // Once playback has reached the previous buffer's own start, what it took over from is done
+        // with. Short of that, it is still needed up to there.
+        if (position >= previous->m_startFrame) {
+            previous->m_previous.reset();
+        }
+        // Not started yet, the song's clock has not either, and this one waits for it likewise.
+        const bool started = previous->m_isStarted.load(std::memory_order_acquire);
+        m_previous = std::move(previous);
+        if (!started) {
+            return;
+        }
+    }
+    start();
+}
+
+} // namespace noteahead
@@ -0,0 +1,87 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef RENDER_AHEAD_BUFFER_HPP
+#define RENDER_AHEAD_BUFFER_HPP
+
+#include "ring_buffer.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace noteahead {
+
+//! The song as rendered ahead of the playhead, for the audio callback to play. See
+//! AudioEngine::setRenderAheadBuffer().
+//!
+//! One thread renders into it and the callback reads out of it, and neither waits for the other,
+//! so playing back costs the callback a copy however heavy the project is.
+class RenderAheadBuffer
+{
+public:
+    //! \param startFrame Where the first frame written goes, in frames from the start of playback.
+    RenderAheadBuffer(uint32_t sampleRate, size_t capacityFrames, uint64_t startFrame = 0);
+
+    uint32_t sampleRate() const;
+    uint64_t startFrame() const;
+
+    //! Render side: writes all of the interleaved stereo frames, or none of them if they do not fit.
+    bool write(std::span<const double> buffer, uint32_t frameCount);
+    //! Frames rendered and not yet played.
+    size_t framesAvailable() const;
+    //! Render side: nothing more is coming. Once what was written has played, playback goes on live.
+    void finish();
+    //! How many frames playback reads at a time, or 0 before it first has. What the render rounds
+    //! its last frames up to, so that live playback takes over on a block of its own.
+    uint32_t blockFrames() const;
+
+    //! Lets playback move on. Until then the callback gets silence and the position stays put, so a
+    //! render can get a head start before the song's clock starts running.
+    void start();
+
+    //! Audio side: writes the next frameCount frames over the start of an interleaved stereo buffer.
+    //!
+    //! Frames not rendered yet come out as silence and are skipped once they do arrive, so a render
+    //! that falls behind costs a gap rather than putting the song late for good.
+    //!
+    //! Returns how many of the frames it wrote: all of them, unless the render has finished and run
+    //! out, in which case playback is to go on live from there.
+    uint32_t read(std::span<double> buffer, uint32_t frameCount);
+
+    //! How far playback has got, in frames from its start.
+    uint64_t position() const;
+
+    //! Picks up playback where the given buffer has got to, and starts if it had. Until this
+    //! buffer's own start the previous one goes on playing, so that what it rendered ahead is still
+    //! heard up to where the new render begins. Only while neither is being read.
+    void takeOver(std::shared_ptr<RenderAheadBuffer> previous);
+
+private:
+    RingBuffer<double> m_ring;
+    uint32_t m_sampleRate;
+    uint64_t m_startFrame;
+    std::atomic<uint64_t> m_position;
+    std::atomic<bool> m_isStarted { false };
+    std::atomic<bool> m_isFinished { false };
+    std::atomic<uint32_t> m_blockFrames { 0 };
+    uint64_t m_framesOwed { 0 };
+    std::shared_ptr<RenderAheadBuffer> m_previous;
+};
+
+} // namespace noteahead
+
+#endif // RENDER_AHEAD_BUFFER_HPP
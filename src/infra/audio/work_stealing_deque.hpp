@@ -0,0 +1,136 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef WORK_STEALING_DEQUE_HPP
+#define WORK_STEALING_DEQUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+namespace noteahead {
+
+//! Chase-Lev work-stealing deque of task indices, with a fixed capacity.
+//!
+//! The owning lane pushes and pops at the bottom, so the task it just made ready is the next one it
+//! runs, while its inputs are still in cache. Idle lanes steal from the top, the oldest entry. Neither
+//! side ever takes a lock, which is what lets real-time workers share it; the price is that only the
+//! owner may push or pop, and a steal can fail spuriously when it races with another thief.
+//!
+//! Never grows: size it with reserve() from a thread that is not using it, ahead of the run.
+class WorkStealingDeque
+{
+public:
+    explicit WorkStealingDeque(size_t capacity = 0)
+    {
+        reserve(capacity);
+    }
+
+    //! Makes room for at least capacity entries and empties the deque. Not thread-safe.
+    void reserve(size_t capacity)
+    {
+        if (capacity > m_capacity) {
+            m_buffer = std::make_unique<std::atomic<size_t>[]>(capacity);
+            m_capacity = capacity;
+        }
+        clear();
+    }
+
+    size_t capacity() const
+    {
+        return m_capacity;
+    }
+
+    //! Empties the deque. Not thread-safe.
+    void clear()
+    {
+        m_top.store(0, std::memory_order_relaxed);
+        m_bottom.store(0, std::memory_order_relaxed);
+    }
+
+    //! Owner only. Returns false when full.
+    bool push(size_t value)
+    {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        const int64_t top = m_top.load(std::memory_order_acquire);
+        if (bottom - top >= static_cast<int64_t>(m_capacity)) {
+            return false;
+        }
+        m_buffer[static_cast<size_t>(bottom) % m_capacity].store(value, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    //! Owner only. Takes the most recently pushed entry.
+    std::optional<size_t> pop()
+    {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        std::optional<size_t> value = m_buffer[static_cast<size_t>(bottom) % m_capacity].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // The last entry: a thief may be after it too, and only one of us gets it.
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                value.reset();
+            }
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return value;
+    }
+
+    //! Any thread. Takes the oldest entry, or nothing when the deque is empty or another thread won.
+    std::optional<size_t> steal()
+    {
+        int64_t top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return std::nullopt;
+        }
+
+        const size_t value = m_buffer[static_cast<size_t>(top) % m_capacity].load(std::memory_order_relaxed);
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+    //! A snapshot only: exact just for the owner while nobody steals.
+    bool empty() const
+    {
+        return m_top.load(std::memory_order_acquire) >= m_bottom.load(std::memory_order_acquire);
+    }
+
+private:
+    std::unique_ptr<std::atomic<size_t>[]> m_buffer;
+    size_t m_capacity { 0 };
+    //! Kept on separate cache lines: the owner hammers the bottom, the thieves the top.
+    alignas(64) std::atomic<int64_t> m_top { 0 };
+    alignas(64) std::atomic<int64_t> m_bottom { 0 };
+};
+
+} // namespace noteahead
+
+#endif // WORK_STEALING_DEQUE_HPP
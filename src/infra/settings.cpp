@@ -39,6 +39,8 @@ const auto gainStagingTargetDbKey = "gainStagingTargetDb";
 const auto recordingEnabledKey = "recordingEnabled";
 const auto jackSyncEnabledKey = "jackSyncEnabled";
 const auto multiThreadedPlaybackEnabledKey = "multiThreadedPlaybackEnabled";
+const auto masterPipelineEnabledKey = "masterPipelineEnabled";
+const auto renderAheadEnabledKey = "renderAheadEnabled";
 const auto jackBpmSyncEnabledKey = "jackBpmSyncEnabled";
 const auto midiSyncEnabledKey = "midiSyncEnabled";
 const auto waveViewEnabledKey = "waveViewEnabled";
@@ -348,6 +350,42 @@ void setMultiThreadedPlaybackEnabled(bool enabled)
     settings.endGroup();
 }
 
+bool masterPipelineEnabled()
+{
+    QSettings settings;
+    settings.beginGroup(settingsGroupAudio);
+    // Off by default: it adds a block of latency, which is only worth it to someone short of CPU.
+    const auto enabled = settings.value(masterPipelineEnabledKey, false).toBool();
+    settings.endGroup();
+    return enabled;
+}
+
+void setMasterPipelineEnabled(bool enabled)
+{
+    QSettings settings;
+    settings.beginGroup(settingsGroupAudio);
+    settings.setValue(masterPipelineEnabledKey, enabled);
+    settings.endGroup();
+}
+
+bool renderAheadEnabled()
+{
+    QSettings settings;
+    settings.beginGroup(settingsGroupAudio);
+    // Off by default: edits and mutes during playback restart the render, which cuts what is sounding.
+    const auto enabled = settings.value(renderAheadEnabledKey, false).toBool();
+    settings.endGroup();
+    return enabled;
+}
+
+void setRenderAheadEnabled(bool enabled)
+{
+    QSettings settings;
+    settings.beginGroup(settingsGroupAudio);
+    settings.setValue(renderAheadEnabledKey, enabled);
+    settings.endGroup();
+}
+
 bool jackSyncEnabled()
 {
     QSettings settings;
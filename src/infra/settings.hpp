@@ -73,6 +73,12 @@ void setRecordingEnabled(bool enabled);
 bool multiThreadedPlaybackEnabled();
 void setMultiThreadedPlaybackEnabled(bool enabled);
 
+bool masterPipelineEnabled();
+void setMasterPipelineEnabled(bool enabled);
+
+bool renderAheadEnabled();
+void setRenderAheadEnabled(bool enabled);
+
 bool jackSyncEnabled();
 void setJackSyncEnabled(bool enabled);
 
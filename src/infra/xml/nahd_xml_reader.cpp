@@ -16,6 +16,7 @@
 
 #include <QVariant>
 #include <QXmlStreamReader>
+#include <QXmlStreamWriter>
 
 namespace noteahead {
 
@@ -102,4 +103,21 @@ QString NahdXmlReader::readElementText()
     return m_reader->readElementText();
 }
 
+QString NahdXmlReader::readElementXml()
+{
+    QString xml;
+    QXmlStreamWriter writer { &xml };
+    writer.writeCurrentToken(*m_reader);
+    for (int depth = 1; depth > 0 && !m_reader->atEnd();) {
+        m_reader->readNext();
+        if (m_reader->isStartElement()) {
+            depth++;
+        } else if (m_reader->isEndElement()) {
+            depth--;
+        }
+        writer.writeCurrentToken(*m_reader);
+    }
+    return xml;
+}
+
 } // namespace noteahead
@@ -15,6 +15,7 @@
 
 #include "application/application.hpp"
 #include "common/constants.hpp"
+#include "domain/dsp/wavetable_cache.hpp"
 #include "simple_logger.hpp"
 
 #include <cstdlib>
@@ -23,6 +24,7 @@
 #include <QCoreApplication>
 #include <QDir>
 #include <QSettings>
+#include <QStandardPaths>
 
 static const auto TAG = "main";
 
@@ -81,6 +83,10 @@ int main(int argc, char ** argv)
 
     try {
         initLogger();
+        // Before the application builds its default devices, which are the first to ask for a set.
+        auto & wavetables = noteahead::WavetableCache::instance();
+        wavetables.setDirectory(QStandardPaths::writableLocation(QStandardPaths::CacheLocation).toStdString());
+        wavetables.prewarm();
         return noteahead::Application(argc, argv).run();
     } catch (std::exception & e) {
         std::cerr << e.what() << std::endl;
@@ -0,0 +1,263 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "analysis_worker_test.hpp"
+
+#include "../../domain/dsp/audio_context.hpp"
+#include "../../domain/utility/analysis_worker.hpp"
+#include "../../domain/utility/lufs_meter.hpp"
+
+#include <QTest>
+
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <numbers>
+#include <thread>
+#include <vector>
+
+namespace noteahead {
+
+namespace {
+
+//! What a tap handed to its analyser, gathered under a lock since the worker may be the one calling.
+struct Collector
+{
+    std::mutex mutex;
+    std::vector<double> samples;
+    uint32_t sampleRate { 0 };
+    size_t resets { 0 };
+
+    AnalysisTap::Analyser analyser()
+    {
+        return [this](std::span<const double> interleaved, uint32_t, uint32_t rate) {
+            const std::scoped_lock lock { mutex };
+            samples.insert(samples.end(), interleaved.begin(), interleaved.end());
+            sampleRate = rate;
+        };
+    }
+
+    //! Forgets what came before, as a meter's reset does.
+    AnalysisTap::Reset reset()
+    {
+        return [this] {
+            const std::scoped_lock lock { mutex };
+            samples.clear();
+            resets++;
+        };
+    }
+
+    std::vector<double> collected()
+    {
+        const std::scoped_lock lock { mutex };
+        return samples;
+    }
+};
+
+std::vector<double> ramp(size_t frames, double start)
+{
+    std::vector<double> buffer(frames * 2);
+    for (size_t i = 0; i < buffer.size(); i++) {
+        buffer[i] = start + static_cast<double>(i);
+    }
+    return buffer;
+}
+
+} // namespace
+
+void AnalysisWorkerTest::test_flush_shouldDeliverCapturedFramesInOrder()
+{
+    Collector collector;
+    AnalysisTap tap { collector.analyser() };
+
+    const auto first = ramp(64, 0.0);
+    const auto second = ramp(32, 1000.0);
+    tap.capture(first, 64, 48000);
+    tap.capture(second, 32, 48000);
+    tap.flush();
+
+    auto expected = first;
+    expected.insert(expected.end(), second.begin(), second.end());
+    QCOMPARE(collector.collected(), expected);
+    QCOMPARE(collector.sampleRate, uint32_t { 48000 });
+    QCOMPARE(tap.droppedFrames(), uint64_t { 0 });
+}
+
+void AnalysisWorkerTest::test_capture_acrossTheWrap_shouldKeepFramesIntact()
+{
+    Collector collector;
+    AnalysisTap tap { collector.analyser(), 5 };
+
+    const auto first = ramp(3, 0.0);
+    const auto second = ramp(4, 100.0);
+    tap.capture(first, 3, 44100);
+    tap.flush();
+    // Starts three frames into a ring of five, so it has to be split either side of the end.
+    tap.capture(second, 4, 44100);
+    tap.flush();
+
+    auto expected = first;
+    expected.insert(expected.end(), second.begin(), second.end());
+    QCOMPARE(collector.collected(), expected);
+}
+
+void AnalysisWorkerTest::test_capture_fullRing_shouldDropAndCount()
+{
+    Collector collector;
+    AnalysisTap tap { collector.analyser(), 8 };
+
+    // More than the ring can ever hold, whatever the worker has drained in the meantime.
+    const auto block = ramp(9, 0.0);
+    tap.capture(block, 9, 48000);
+    tap.flush();
+
+    QVERIFY(collector.collected().empty());
+    QCOMPARE(tap.droppedFrames(), uint64_t { 9 });
+}
+
+void AnalysisWorkerTest::test_worker_shouldDrainWithoutFlush()
+{
+    Collector collector;
+    AnalysisTap tap { collector.analyser() };
+
+    const auto block = ramp(128, 0.0);
+    tap.capture(block, 128, 48000);
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds { 5 };
+    while (collector.collected().size() < block.size() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds { 1 });
+    }
+
+    QCOMPARE(collector.collected(), block);
+}
+
+void AnalysisWorkerTest::test_taps_lastOneLeaving_shouldStopTheWorker()
+{
+    auto && worker = AnalysisWorker::instance();
+    QCOMPARE(worker.tapCount(), size_t { 0 });
+    {
+        Collector collector;
+        AnalysisTap first { collector.analyser() };
+        AnalysisTap second { collector.analyser() };
+        QCOMPARE(worker.tapCount(), size_t { 2 });
+    }
+    QCOMPARE(worker.tapCount(), size_t { 0 });
+
+    // ...and comes back for the next one.
+    Collector collector;
+    AnalysisTap tap { collector.analyser() };
+    const auto block = ramp(16, 0.0);
+    tap.capture(block, 16, 48000);
+    tap.flush();
+    QCOMPARE(collector.collected(), block);
+}
+
+void AnalysisWorkerTest::test_discard_shouldDropFramesCapturedBefore()
+{
+    Collector collector;
+    AnalysisTap tap { collector.analyser(), collector.reset() };
+
+    // The worker may or may not get to the first block before the discard; either way nothing of it
+    // may be left once the reset has run.
+    const auto stale = ramp(256, 0.0);
+    const auto fresh = ramp(64, 1000.0);
+    tap.capture(stale, 256, 48000);
+    tap.discard();
+    tap.capture(fresh, 64, 48000);
+    tap.flush();
+
+    QCOMPARE(collector.collected(), fresh);
+    QCOMPARE(collector.resets, size_t { 1 });
+}
+
+void AnalysisWorkerTest::test_lufsMeter_reset_shouldNotCountQueuedBlocks()
+{
+    constexpr uint32_t sampleRate = 48000;
+    constexpr uint32_t blockFrames = 512;
+
+    LufsMeter meter;
+    meter.setSampleRate(sampleRate);
+    LufsMeter quiet;
+    quiet.setSampleRate(sampleRate);
+
+    const auto feed = [](LufsMeter & target, double amplitude, uint32_t blocks, bool flush) {
+        std::vector<double> buffer(blockFrames * 2);
+        for (uint32_t block = 0; block < blocks; block++) {
+            for (uint32_t i = 0; i < blockFrames; i++) {
+                const double value = amplitude * std::sin(2.0 * std::numbers::pi * 1000.0 * (block * blockFrames + i) / sampleRate);
+                buffer[i * 2] = value;
+                buffer[i * 2 + 1] = value;
+            }
+            AudioContext context {};
+            context.buffer = buffer;
+            context.frameCount = blockFrames;
+            context.sampleRate = sampleRate;
+            target.process(context);
+            if (flush) {
+                target.flushAnalysis();
+            }
+        }
+    };
+
+    // A loud take left queued when the meter is reset, then a quiet one: only the quiet one counts.
+    // The ring holds all of the loud take, so none of it is dropped for want of room either.
+    feed(meter, 0.9, 40, false);
+    meter.reset();
+    feed(meter, 0.05, 5 * sampleRate / blockFrames, true);
+    feed(quiet, 0.05, 5 * sampleRate / blockFrames, true);
+
+    QCOMPARE(meter.integratedLufs(), quiet.integratedLufs());
+}
+
+void AnalysisWorkerTest::test_lufsMeter_blockInput_shouldMatchPerSampleInput()
+{
+    constexpr uint32_t sampleRate = 48000;
+    constexpr uint32_t blockFrames = 512;
+
+    LufsMeter perSample;
+    perSample.setSampleRate(sampleRate);
+    LufsMeter perBlock;
+    perBlock.setSampleRate(sampleRate);
+
+    std::vector<double> buffer(blockFrames * 2);
+    for (uint32_t block = 0; block < 5 * sampleRate / blockFrames; block++) {
+        for (uint32_t i = 0; i < blockFrames; i++) {
+            const double value = 0.25 * std::sin(2.0 * std::numbers::pi * 1000.0 * (block * blockFrames + i) / sampleRate);
+            double left = value;
+            double right = value;
+            perSample.process(left, right);
+            buffer[i * 2] = value;
+            buffer[i * 2 + 1] = value;
+        }
+
+        AudioContext context {};
+        context.buffer = buffer;
+        context.frameCount = blockFrames;
+        context.sampleRate = sampleRate;
+        perBlock.process(context);
+        // A ring's worth of slack is plenty for a meter that keeps up, but this loop outruns any
+        // real-time source, so keep the ring from filling.
+        perBlock.flushAnalysis();
+    }
+
+    // The same measurement, only on another thread.
+    QCOMPARE(perBlock.integratedLufs(), perSample.integratedLufs());
+    QCOMPARE(perBlock.momentaryLufs(), perSample.momentaryLufs());
+    QCOMPARE(perBlock.shortTermLufs(), perSample.shortTermLufs());
+}
+
+} // namespace noteahead
+
+QTEST_GUILESS_MAIN(noteahead::AnalysisWorkerTest)
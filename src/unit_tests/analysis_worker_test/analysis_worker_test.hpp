@@ -0,0 +1,40 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef ANALYSIS_WORKER_TEST_HPP
+#define ANALYSIS_WORKER_TEST_HPP
+
+#include <QObject>
+
+namespace noteahead {
+
+class AnalysisWorkerTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void test_flush_shouldDeliverCapturedFramesInOrder();
+    void test_capture_acrossTheWrap_shouldKeepFramesIntact();
+    void test_capture_fullRing_shouldDropAndCount();
+    void test_worker_shouldDrainWithoutFlush();
+    void test_taps_lastOneLeaving_shouldStopTheWorker();
+    void test_discard_shouldDropFramesCapturedBefore();
+    void test_lufsMeter_reset_shouldNotCountQueuedBlocks();
+    void test_lufsMeter_blockInput_shouldMatchPerSampleInput();
+};
+
+} // namespace noteahead
+
+#endif // ANALYSIS_WORKER_TEST_HPP
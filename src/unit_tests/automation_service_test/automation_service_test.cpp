@@ -189,6 +189,47 @@ void AutomationServiceTest::test_hasAutomations_disabled_shouldReportNone()
     QVERIFY(automationService.automationCurves(pattern, track, column, 0, 8).empty());
 }
 
+void AutomationServiceTest::test_hasAutomations_afterUpdateAndDelete_shouldFollowChanges()
+{
+    AutomationService automationService { std::make_shared<PropertyService>() };
+
+    const quint64 pattern = 0, track = 1, column = 2;
+    const auto firstId = automationService.addMidiCcAutomation(pattern, track, column, 64, 0, 7, 0, 127, {}, true, 8, 0);
+    const auto secondId = automationService.addMidiCcAutomation(pattern, track, column, 65, 8, 15, 0, 127, {}, true, 8, 0);
+    const auto thirdId = automationService.addMidiCcAutomation(pattern, track, column, 66, 4, 11, 0, 127, {}, true, 8, 0);
+    automationService.addMidiCcAutomation(pattern + 1, track, column, 67, 0, 15, 0, 127, {}, true, 8, 0);
+
+    auto byLine = automationService.midiCcAutomationsByLine(pattern, track, column, 5);
+    QCOMPARE(byLine.size(), size_t { 2 });
+    QCOMPARE(byLine.at(0).id(), firstId);
+    QCOMPARE(byLine.at(1).id(), thirdId);
+
+    // Deleting shifts everything after it in the list, which the index has to follow.
+    automationService.deleteMidiCcAutomation(automationService.midiCcAutomations().at(0));
+    QVERIFY(!automationService.hasAutomations(pattern, track, column, 2));
+    byLine = automationService.midiCcAutomationsByLine(pattern, track, column, 9);
+    QCOMPARE(byLine.size(), size_t { 2 });
+    QCOMPARE(byLine.at(0).id(), secondId);
+    QCOMPARE(byLine.at(1).id(), thirdId);
+
+    // Moving an automation to another column and other lines leaves nothing behind.
+    auto moved = automationService.midiCcAutomations().at(0);
+    moved.setLocation({ pattern, track, column + 1 });
+    auto interpolation = moved.interpolation();
+    interpolation.line0 = 20;
+    interpolation.line1 = 23;
+    moved.setInterpolation(interpolation);
+    automationService.updateMidiCcAutomation(moved);
+    QVERIFY(!automationService.hasAutomations(pattern, track, column, 14));
+    QVERIFY(automationService.hasAutomations(pattern, track, column + 1, 21));
+    QCOMPARE(automationService.midiCcAutomationsByColumn(pattern, track, column).size(), size_t { 1 });
+
+    automationService.deletePatterns({ pattern });
+    QVERIFY(!automationService.hasAutomations(pattern, track, column, 5));
+    QVERIFY(!automationService.hasAutomations(pattern, track, column + 1, 21));
+    QVERIFY(automationService.hasAutomations(pattern + 1, track, column, 5));
+}
+
 void AutomationServiceTest::test_automationCurves_midiCc_shouldFollowInterpolation()
 {
     AutomationService automationService { std::make_shared<PropertyService>() };
@@ -35,6 +35,7 @@ private slots:
 
     void test_automationWeight_midiCc_shouldCalculateCorrectWeight();
     void test_hasAutomations_disabled_shouldReportNone();
+    void test_hasAutomations_afterUpdateAndDelete_shouldFollowChanges();
     void test_automationCurves_midiCc_shouldFollowInterpolation();
     void test_automationCurves_outsideRange_shouldLeaveLinesUnset();
     void test_automationCurves_sineModulation_shouldOscillate();
@@ -0,0 +1,158 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "cascaded_svf_bank_test.hpp"
+
+#include "../../domain/dsp/cascaded_svf_bank.hpp"
+
+#include <QTest>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+
+namespace noteahead {
+
+namespace {
+
+constexpr double SampleRate { 48000.0 };
+constexpr size_t Lanes { 6 };
+//! The bank does the same arithmetic as process(), and with the default flags gives the same bits.
+//! -ffast-math lets the compiler order the two differently, which moves the last of them.
+constexpr double Rounding { 1e-12 };
+
+using Filters = std::array<CascadedSvf, Lanes>;
+//! Called on a filter before each of its samples, the way a synth moves its cutoff.
+using Modulation = std::function<void(CascadedSvf & filter, size_t lane, size_t sample)>;
+
+Filters makeFilters(CascadedSvf::Mode mode, int order)
+{
+    Filters filters;
+    for (size_t lane = 0; lane < Lanes; lane++) {
+        filters.at(lane).setSampleRate(SampleRate);
+        filters.at(lane).setMode(mode);
+        filters.at(lane).setOrder(order);
+        filters.at(lane).setCutoff(0.3 + 0.1 * static_cast<double>(lane));
+        filters.at(lane).setResonance(0.1 * static_cast<double>(lane));
+    }
+    return filters;
+}
+
+//! A saw per lane, each at its own pitch.
+double input(size_t lane, size_t sample)
+{
+    return 2.0 * std::fmod(static_cast<double>(sample) * 110.0 * static_cast<double>(lane + 1) / SampleRate, 1.0) - 1.0;
+}
+
+//! Runs one set of filters through the bank and an identical set through process(), and returns
+//! the largest difference between the two outputs over @p samples.
+double worstDifference(Filters banked, Filters reference, const Modulation & modulation, size_t samples)
+{
+    CascadedSvfBank bank;
+    std::array<CascadedSvf *, Lanes> lanes {};
+    std::ranges::transform(banked, lanes.begin(), [](auto & filter) { return &filter; });
+
+    double worst = 0.0;
+    for (size_t offset = 0; offset < samples; offset += CascadedSvfBank::MaxFrames) {
+        const size_t frames = std::min(CascadedSvfBank::MaxFrames, samples - offset);
+        for (size_t lane = 0; lane < Lanes; lane++) {
+            for (size_t frame = 0; frame < frames; frame++) {
+                modulation(banked.at(lane), lane, offset + frame);
+                bank.sample(frame, lane) = input(lane, offset + frame);
+                bank.setCoefficients(frame, lane, banked.at(lane).nextCoefficients());
+            }
+        }
+        bank.run(lanes, frames);
+        for (size_t frame = 0; frame < frames; frame++) {
+            for (size_t lane = 0; lane < Lanes; lane++) {
+                modulation(reference.at(lane), lane, offset + frame);
+                const double expected = reference.at(lane).process(input(lane, offset + frame));
+                worst = std::max(worst, std::abs(bank.sample(frame, lane) - expected));
+            }
+        }
+    }
+    return worst;
+}
+
+} // namespace
+
+void CascadedSvfBankTest::test_run_rampedLanes_shouldMatchProcess()
+{
+    // Each lane ramps on a control grid of its own, so the ramps start and end mid-run and out of
+    // step with the other lanes.
+    const auto modulation = [](CascadedSvf & filter, size_t lane, size_t sample) {
+        if ((sample + lane * 5) % 16 == 0) {
+            filter.rampTo(0.4 + 0.3 * std::sin(static_cast<double>(sample) * 0.001 + static_cast<double>(lane)), 0.2 + 0.1 * static_cast<double>(lane), 16);
+        }
+    };
+    const auto filters = makeFilters(CascadedSvf::Mode::LowPass, 4);
+
+    QVERIFY(worstDifference(filters, filters, modulation, 4800) < Rounding);
+}
+
+void CascadedSvfBankTest::test_run_bypassChangedMidRun_shouldMatchProcess()
+{
+    // Odd lanes open to the bypass and close again, at points that do not line up with a run.
+    const auto modulation = [](CascadedSvf & filter, size_t lane, size_t sample) {
+        if (lane % 2 && sample % 50 == 0) {
+            filter.setCutoff(sample % 100 ? 1.0 : 0.5);
+        }
+    };
+    const auto filters = makeFilters(CascadedSvf::Mode::LowPass, 4);
+
+    QVERIFY(worstDifference(filters, filters, modulation, 1000) < Rounding);
+}
+
+void CascadedSvfBankTest::test_run_highPassSecondOrder_shouldMatchProcess()
+{
+    const auto modulation = [](CascadedSvf & filter, size_t lane, size_t sample) {
+        if (sample % 16 == 0) {
+            filter.rampTo(0.2 + 0.05 * static_cast<double>(lane) + 0.1 * std::sin(static_cast<double>(sample) * 0.01), 0.5, 16);
+        }
+    };
+    const auto filters = makeFilters(CascadedSvf::Mode::HighPass, 2);
+
+    QVERIFY(worstDifference(filters, filters, modulation, 1000) < Rounding);
+}
+
+void CascadedSvfBankTest::test_run_allBypassed_shouldPassInputThrough()
+{
+    auto filters = makeFilters(CascadedSvf::Mode::HighPass, 4);
+    for (auto & filter : filters) {
+        filter.setCutoff(0.0);
+    }
+    std::array<CascadedSvf *, Lanes> lanes {};
+    std::ranges::transform(filters, lanes.begin(), [](auto & filter) { return &filter; });
+
+    CascadedSvfBank bank;
+    for (size_t lane = 0; lane < Lanes; lane++) {
+        for (size_t frame = 0; frame < CascadedSvfBank::MaxFrames; frame++) {
+            bank.sample(frame, lane) = input(lane, frame);
+            bank.setCoefficients(frame, lane, filters.at(lane).nextCoefficients());
+        }
+    }
+    bank.run(lanes, CascadedSvfBank::MaxFrames);
+
+    for (size_t lane = 0; lane < Lanes; lane++) {
+        for (size_t frame = 0; frame < CascadedSvfBank::MaxFrames; frame++) {
+            QCOMPARE(bank.sample(frame, lane), input(lane, frame));
+        }
+    }
+}
+
+} // namespace noteahead
+
+QTEST_GUILESS_MAIN(noteahead::CascadedSvfBankTest)
@@ -0,0 +1,160 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "cascaded_svf_test.hpp"
+
+#include "../../domain/dsp/cascaded_svf.hpp"
+
+#include <QTest>
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+namespace noteahead {
+
+namespace {
+
+constexpr double SampleRate { 48000.0 };
+constexpr size_t RampLength { 16 };
+
+CascadedSvf makeFilter(double cutoff, double resonance)
+{
+    CascadedSvf filter;
+    filter.setSampleRate(SampleRate);
+    filter.setCutoff(cutoff);
+    filter.setResonance(resonance);
+    return filter;
+}
+
+//! The filter's impulse response from a cleared state, which depends on nothing but the
+//! coefficients it runs with.
+std::vector<double> impulseResponse(CascadedSvf & filter, size_t length = 64)
+{
+    filter.reset();
+    std::vector<double> response;
+    for (size_t i = 0; i < length; i++) {
+        response.push_back(filter.process(i == 0 ? 1.0 : 0.0));
+    }
+    return response;
+}
+
+void runSilence(CascadedSvf & filter, size_t samples)
+{
+    for (size_t i = 0; i < samples; i++) {
+        filter.process(0.0);
+    }
+}
+
+} // namespace
+
+void CascadedSvfTest::test_rampTo_shouldReachTargetAfterGivenSamples()
+{
+    auto filter = makeFilter(0.3, 0.1);
+    runSilence(filter, 8);
+    filter.rampTo(0.6, 0.4, RampLength);
+    runSilence(filter, RampLength);
+
+    // Exactly the coefficients a filter set there directly works out, not just close to them
+    auto target = makeFilter(0.6, 0.4);
+    QCOMPARE(impulseResponse(filter), impulseResponse(target));
+}
+
+void CascadedSvfTest::test_rampTo_shouldNotReachTargetEarly()
+{
+    auto filter = makeFilter(0.3, 0.1);
+    runSilence(filter, 8);
+    filter.rampTo(0.6, 0.4, RampLength);
+    // The sample after these is the ramp's last but one
+    runSilence(filter, RampLength - 2);
+
+    auto target = makeFilter(0.6, 0.4);
+    QVERIFY(impulseResponse(filter, 1) != impulseResponse(target, 1));
+}
+
+void CascadedSvfTest::test_setCutoff_midRamp_shouldCancelRamp()
+{
+    auto filter = makeFilter(0.3, 0.1);
+    runSilence(filter, 8);
+    filter.rampTo(0.6, 0.4, RampLength);
+    runSilence(filter, 4);
+
+    // A direct setting wins over the ramp in flight, keeping the resonance the ramp was heading for
+    filter.setCutoff(0.8);
+    auto target = makeFilter(0.8, 0.4);
+    QCOMPARE(impulseResponse(filter), impulseResponse(target));
+}
+
+void CascadedSvfTest::test_bypassed_shouldPassThrough()
+{
+    auto lowPass = makeFilter(1.0, 0.5);
+    auto highPass = makeFilter(0.0, 0.5);
+    highPass.setMode(CascadedSvf::Mode::HighPass);
+
+    for (const auto input : { 1.0, -0.5, 0.25, 0.0 }) {
+        QCOMPARE(lowPass.process(input), input);
+        QCOMPARE(highPass.process(input), input);
+    }
+
+    // Ramping into a bypass passes through at once rather than fading the filter out
+    auto filter = makeFilter(0.3, 0.1);
+    runSilence(filter, 8);
+    filter.rampTo(1.0, 0.1, RampLength);
+    QCOMPARE(filter.process(0.5), 0.5);
+}
+
+void CascadedSvfTest::test_rampTo_fromBypass_shouldJump()
+{
+    // A bypassed filter has no coefficients worth starting a line from
+    auto filter = makeFilter(1.0, 0.0);
+    runSilence(filter, 8);
+    filter.rampTo(0.5, 0.2, RampLength);
+
+    auto target = makeFilter(0.5, 0.2);
+    QCOMPARE(impulseResponse(filter), impulseResponse(target));
+}
+
+void CascadedSvfTest::test_rampTo_sweep_shouldStayCloseToPerSampleModulation()
+{
+    // A cutoff swept by a 5 Hz LFO, set every sample as the synths used to, against the same sweep
+    // evaluated every RampLength samples and ramped in between, as they do now
+    auto perSample = makeFilter(0.5, 0.6);
+    auto ramped = makeFilter(0.5, 0.6);
+    const auto cutoffAt = [](size_t n) {
+        return 0.5 + 0.3 * std::sin(2.0 * std::numbers::pi * 5.0 * static_cast<double>(n) / SampleRate);
+    };
+
+    double worst = 0.0;
+    double peak = 0.0;
+    const size_t length = static_cast<size_t>(SampleRate) / 2;
+    for (size_t n = 0; n < length; n++) {
+        if (n % RampLength == 0) {
+            ramped.rampTo(cutoffAt(n + RampLength), 0.6, RampLength);
+        }
+        perSample.setCutoff(cutoffAt(n + 1));
+        // A saw rich enough to have something above every cutoff the sweep passes
+        const double input = 2.0 * std::fmod(static_cast<double>(n) * 220.0 / SampleRate, 1.0) - 1.0;
+        const double expected = perSample.process(input);
+        worst = std::max(worst, std::abs(ramped.process(input) - expected));
+        peak = std::max(peak, std::abs(expected));
+    }
+
+    const double deviationDb = 20.0 * std::log10(worst / peak);
+    QVERIFY2(deviationDb < -40.0, qPrintable(QString { "deviation %1 dB" }.arg(deviationDb)));
+}
+
+} // namespace noteahead
+
+QTEST_GUILESS_MAIN(noteahead::CascadedSvfTest)
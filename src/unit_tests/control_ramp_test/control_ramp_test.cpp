@@ -0,0 +1,81 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "control_ramp_test.hpp"
+
+#include "../../domain/dsp/control_ramp.hpp"
+
+#include <QTest>
+
+#include <cmath>
+
+namespace noteahead {
+
+void ControlRampTest::test_setTarget_shouldLandOnTargetAfterGivenSamples()
+{
+    ControlRamp ramp;
+    ramp.reset(0.0);
+    ramp.setTarget(1.0, 16);
+
+    for (size_t i = 1; i < 16; i++) {
+        QVERIFY(std::abs(ramp.nextSample() - static_cast<double>(i) / 16.0) < 1.0e-12);
+    }
+    // Exactly on the target, however the steps rounded, and it stays there
+    QCOMPARE(ramp.nextSample(), 1.0);
+    QCOMPARE(ramp.nextSample(), 1.0);
+    QCOMPARE(ramp.value(), 1.0);
+}
+
+void ControlRampTest::test_setTarget_zeroSamples_shouldJump()
+{
+    ControlRamp ramp;
+    ramp.reset(0.25);
+    ramp.setTarget(0.75, 0);
+
+    QCOMPARE(ramp.value(), 0.75);
+    QCOMPARE(ramp.nextSample(), 0.75);
+}
+
+void ControlRampTest::test_setTarget_midRamp_shouldStartFromCurrentValue()
+{
+    ControlRamp ramp;
+    ramp.reset(0.0);
+    ramp.setTarget(1.0, 4);
+    ramp.nextSample();
+    ramp.nextSample();
+    QCOMPARE(ramp.value(), 0.5);
+
+    // A new control step heads on from where the last one got to, with no jump
+    ramp.setTarget(0.0, 2);
+    QCOMPARE(ramp.nextSample(), 0.25);
+    QCOMPARE(ramp.nextSample(), 0.0);
+    QCOMPARE(ramp.nextSample(), 0.0);
+}
+
+void ControlRampTest::test_reset_shouldCancelRamp()
+{
+    ControlRamp ramp;
+    ramp.reset(0.0);
+    ramp.setTarget(1.0, 16);
+    ramp.nextSample();
+
+    ramp.reset(0.5);
+    QCOMPARE(ramp.nextSample(), 0.5);
+    QCOMPARE(ramp.nextSample(), 0.5);
+}
+
+} // namespace noteahead
+
+QTEST_GUILESS_MAIN(noteahead::ControlRampTest)
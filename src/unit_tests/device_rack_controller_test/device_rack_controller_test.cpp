@@ -199,12 +199,31 @@ void DeviceRackControllerTest::test_devices_shouldReturnDeviceNames()
 
     DeviceRackController controller { deviceService, {}, nullptr };
 
-    QCOMPARE(controller.rowCount(), static_cast<int>(Constants::deviceRackSize()));
+    QCOMPARE(controller.rowCount(), static_cast<int>(Constants::deviceRackMinVisibleSlots()));
     QCOMPARE(controller.data(controller.index(0), static_cast<int>(DeviceRackController::DataRole::Name)).toString(), QString::fromStdString(name1));
     QCOMPARE(controller.data(controller.index(1), static_cast<int>(DeviceRackController::DataRole::Name)).toString(), QString::fromStdString(name2));
     QCOMPARE(controller.data(controller.index(2), static_cast<int>(DeviceRackController::DataRole::Name)).toString(), QString(""));
 }
 
+void DeviceRackControllerTest::test_deviceCount_deviceBeyondVisibleSlots_shouldGrowToOneFreeSlotPastIt()
+{
+    const auto audioEngine = std::make_shared<AudioEngine>();
+    const auto deviceService = std::make_shared<DeviceService>(audioEngine, std::make_shared<DataService>());
+    DeviceRackController controller { deviceService, {}, nullptr };
+    QSignalSpy countSpy { &controller, &DeviceRackController::deviceCountChanged };
+
+    deviceService->setDevice(20, std::make_shared<MockDevice>("Far Device"));
+
+    QCOMPARE(countSpy.count(), 1);
+    QCOMPARE(controller.rowCount(), 22);
+    QCOMPARE(controller.data(controller.index(20), static_cast<int>(DeviceRackController::DataRole::Name)).toString(), QString("Far Device"));
+
+    deviceService->clearDevice(20);
+
+    QCOMPARE(countSpy.count(), 2);
+    QCOMPARE(controller.rowCount(), static_cast<int>(Constants::deviceRackMinVisibleSlots()));
+}
+
 void DeviceRackControllerTest::test_trackNames_shouldReturnTrackNamesForDevice()
 {
     const auto audioEngine = std::make_shared<AudioEngine>();
@@ -471,6 +490,9 @@ public:
     void setActive(bool active)
     {
         m_active = active;
+        if (active) {
+            wake();
+        }
     }
 
 private:
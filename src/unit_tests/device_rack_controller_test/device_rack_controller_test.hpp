@@ -29,6 +29,7 @@ private slots:
     void cleanupTestCase();
 
     void test_devices_shouldReturnDeviceNames();
+    void test_deviceCount_deviceBeyondVisibleSlots_shouldGrowToOneFreeSlotPastIt();
     void test_trackNames_shouldReturnTrackNamesForDevice();
     void test_subMixerCandidates_shouldCarryTrackNames();
     void test_deviceGain_shouldDefaultToUnityAndRoundTrip();
@@ -35,6 +35,8 @@
 #include <QTest>
 #include <QVariant>
 
+#include <format>
+
 namespace noteahead {
 
 class MockAudioFileReader : public AudioFileReader
@@ -158,6 +160,7 @@ void DeviceServiceTest::test_midiCc_shouldNotEmitDataChanged()
     QSignalSpy parameterSpy { device.get(), &Device::parametersChanged };
 
     device->processMidiCc(7, 64, 0);
+    deviceService.dispatchParameterChanges();
 
     QCOMPARE(structuralSpy.count(), 0);
     QCOMPARE(parameterSpy.count(), 1);
@@ -188,6 +191,7 @@ void DeviceServiceTest::test_midiCc_drumSynthVoice_shouldNotEmitDataChanged()
 
     // Kick HPF cutoff
     device->processMidiCc(DrumSynth::CcStartRange1 + 2, 64, 0);
+    deviceService.dispatchParameterChanges();
 
     QCOMPARE(structuralSpy.count(), 0);
     QCOMPARE(parameterSpy.count(), 1);
@@ -242,11 +246,66 @@ void DeviceServiceTest::test_allNotesOff_sampler_shouldNotEmitDataChanged()
     QSignalSpy parameterSpy { device.get(), &Device::parametersChanged };
 
     device->processMidiAllNotesOff();
+    deviceService.dispatchParameterChanges();
 
     QCOMPARE(structuralSpy.count(), 0);
     QCOMPARE(parameterSpy.count(), 1);
 }
 
+void DeviceServiceTest::test_dispatchParameterChanges_denseAutomation_shouldEmitOncePerDevice()
+{
+    // A sweep sends a CC on every tick. Each one used to reach the device's dialog as a signal of
+    // its own, queued across threads and each re-reading every setting; now the frame coalesces them.
+    const auto audioEngine = std::make_shared<AudioEngine>();
+    DeviceService deviceService { audioEngine, std::make_shared<DataService>() };
+    const auto synth = std::make_shared<SynthDevice>("Synth 1");
+    deviceService.setDevice(0, synth);
+    const auto idle = std::make_shared<SynthDevice>("Synth 2");
+    deviceService.setDevice(1, idle);
+
+    QSignalSpy synthSpy { synth.get(), &Device::parametersChanged };
+    QSignalSpy idleSpy { idle.get(), &Device::parametersChanged };
+
+    for (uint8_t value = 0; value < 128; value++) {
+        synth->processMidiCc(74, value, 0);
+    }
+    QCOMPARE(synthSpy.count(), 0);
+
+    deviceService.dispatchParameterChanges();
+    QCOMPARE(synthSpy.count(), 1);
+    QCOMPARE(idleSpy.count(), 0);
+
+    // Nothing moved since, so the next frame has nothing to say
+    deviceService.dispatchParameterChanges();
+    QCOMPARE(synthSpy.count(), 1);
+}
+
+void DeviceServiceTest::test_dispatchParameterChanges_idle_shouldStopUntilTheNextMark()
+{
+    // A running frame timer wakes the GUI thread sixty times a second for nothing.
+    const auto audioEngine = std::make_shared<AudioEngine>();
+    DeviceService deviceService { audioEngine, std::make_shared<DataService>() };
+    const auto synth = std::make_shared<SynthDevice>("Synth 1");
+    deviceService.setDevice(0, synth);
+
+    // A new device gets one frame, for whatever it marked before it was connected.
+    QVERIFY(deviceService.isDispatchingParameterChanges());
+    deviceService.dispatchParameterChanges();
+    QVERIFY(!deviceService.isDispatchingParameterChanges());
+
+    synth->processMidiCc(74, 64, 0);
+    QVERIFY(deviceService.isDispatchingParameterChanges());
+
+    deviceService.dispatchParameterChanges();
+    QVERIFY(deviceService.isDispatchingParameterChanges());
+
+    deviceService.dispatchParameterChanges();
+    QVERIFY(!deviceService.isDispatchingParameterChanges());
+
+    synth->processMidiCc(74, 32, 0);
+    QVERIFY(deviceService.isDispatchingParameterChanges());
+}
+
 void DeviceServiceTest::test_exportDeviceSettings_shouldGenerateCorrectXml()
 {
     const auto audioEngine = std::make_shared<AudioEngine>();
@@ -641,6 +700,72 @@ void DeviceServiceTest::test_masterRackEnabled_shouldSaveAndLoadCorrectly()
     QVERIFY(!service2.sendEffectRack().enabled());
 }
 
+void DeviceServiceTest::test_deserializeFromXml_manyDevices_shouldLoadEachIntoItsSlot()
+{
+    // More devices than most machines have cores, so each worker loads several
+    const auto audioEngine = std::make_shared<AudioEngine>();
+    DeviceService service { audioEngine, std::make_shared<DataService>() };
+    const size_t deviceCount = 24;
+    for (size_t slot = 0; slot < deviceCount; slot++) {
+        const auto synth = std::make_shared<SynthDevice>(std::format("Synth {}", slot + 1));
+        if (slot % 2) {
+            synth->setVolume(0.75f);
+        }
+        synth->setReverbSend(0, 0.5f);
+        service.setDevice(slot, synth);
+    }
+
+    QString xml;
+    NahdXmlWriter writer { xml };
+    service.serializeToXml(writer);
+
+    const auto audioEngine2 = std::make_shared<AudioEngine>();
+    DeviceService service2 { audioEngine2, std::make_shared<DataService>() };
+    QSignalSpy progressSpy { &service2, &DeviceService::statusTextRequested };
+    NahdXmlReader reader { xml };
+    QVERIFY(reader.readNextStartElement());
+    service2.deserializeFromXml(reader);
+
+    // Devices finishing together on the workers are reported as one step
+    QVERIFY(progressSpy.count() > 0);
+    QVERIFY(progressSpy.count() <= static_cast<int>(deviceCount));
+    QVERIFY(progressSpy.last().at(0).toString().endsWith(QString { "%1/%1" }.arg(deviceCount)));
+
+    QCOMPARE(service2.deviceSlots().size(), deviceCount);
+    for (size_t slot = 0; slot < deviceCount; slot++) {
+        const auto synth = std::dynamic_pointer_cast<SynthDevice>(service2.device(slot));
+        QVERIFY(synth);
+        QCOMPARE(synth->name(), std::format("Synth {}", slot + 1));
+        QCOMPARE(synth->volume(), slot % 2 ? 0.75f : 1.0f);
+        // Sends are read after the devices, and must find every one of them in place
+        QCOMPARE(synth->reverbSend(0), 0.5f);
+    }
+}
+
+void DeviceServiceTest::test_deserializeFromXml_deviceFails_shouldPublishNoDevice()
+{
+    const auto audioEngine = std::make_shared<AudioEngine>();
+    DeviceService service { audioEngine, std::make_shared<DataService>() };
+    service.setDevice(0, std::make_shared<SynthDevice>("Synth 1"));
+    const auto sampler = std::make_shared<SamplerDevice>("Sampler 1", std::make_unique<MockAudioFileReader>());
+    sampler->loadSample(36, "/nonexistent/kick.wav");
+    service.setDevice(1, sampler);
+
+    QString xml;
+    NahdXmlWriter writer { xml };
+    service.serializeToXml(writer);
+
+    // The loaded Sampler reads from disk, where the sample is not
+    const auto audioEngine2 = std::make_shared<AudioEngine>();
+    DeviceService service2 { audioEngine2, std::make_shared<DataService>() };
+    NahdXmlReader reader { xml };
+    QVERIFY(reader.readNextStartElement());
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, service2.deserializeFromXml(reader));
+
+    // Not even the Synth that loaded fine: a project either opens whole or not at all
+    QVERIFY(service2.deviceSlots().empty());
+}
+
 } // namespace noteahead
 
 QTEST_GUILESS_MAIN(noteahead::DeviceServiceTest)
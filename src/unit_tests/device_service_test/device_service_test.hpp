@@ -32,6 +32,9 @@ private slots:
     void test_midiCc_drumSynthVoice_shouldNotEmitDataChanged();
     void test_clearAutomation_shouldRestoreEveryDevice();
     void test_allNotesOff_sampler_shouldNotEmitDataChanged();
+
+    void test_dispatchParameterChanges_denseAutomation_shouldEmitOncePerDevice();
+    void test_dispatchParameterChanges_idle_shouldStopUntilTheNextMark();
     void test_exportDeviceSettings_shouldGenerateCorrectXml();
     void test_importDeviceSettings_shouldRestoreParameters();
     void test_importDeviceSettings_shouldReplaceDeviceIfTypeDiffers();
@@ -46,6 +49,9 @@ private slots:
     void test_peekDeviceTypeInfo_nonexistentFile_shouldReturnEmpty();
     void test_reverbSends_shouldSaveAndLoadCorrectly();
     void test_masterRackEnabled_shouldSaveAndLoadCorrectly();
+
+    void test_deserializeFromXml_manyDevices_shouldLoadEachIntoItsSlot();
+    void test_deserializeFromXml_deviceFails_shouldPublishNoDevice();
 };
 
 } // namespace noteahead
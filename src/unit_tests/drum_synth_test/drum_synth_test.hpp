@@ -51,6 +51,10 @@ private slots:
     void test_resetAllControllers_shouldRestoreAuthoredVoiceValue();
     void test_drumSynthDevice_toms_shouldHaveDifferentDefaultTunes();
     void test_tomEngine_tunes_shouldSoundDifferent();
+    void test_drumHitCache_full_shouldEvictLeastRecentlyUsed();
+    void test_drumHitCache_read_shouldFollowChunks();
+    void test_drumSynthDevice_hitCache_shouldSoundAsEngine();
+    void test_drumSynthDevice_hitCache_repeatedHit_shouldNotRenderAgain();
 };
 
 } // namespace noteahead
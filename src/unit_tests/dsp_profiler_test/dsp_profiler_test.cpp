@@ -0,0 +1,173 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "dsp_profiler_test.hpp"
+
+#include "../../domain/utility/dsp_profiler.hpp"
+
+#include <QTest>
+
+#include <chrono>
+#include <string>
+
+namespace noteahead {
+
+namespace {
+
+using namespace std::chrono_literals;
+
+void feed(DspProfiler & profiler, size_t lane, uint32_t key, std::chrono::nanoseconds duration, int count)
+{
+    const auto started = DspProfiler::Clock::now();
+    for (int i = 0; i < count; i++) {
+        profiler.record(lane, key, started, started + duration);
+    }
+}
+
+} // namespace
+
+void DspProfilerTest::test_scopeName_shouldNameOwnerAndIndex()
+{
+    QCOMPARE(DspProfiler::scopeName(DspProfiler::key(DspProfiler::Scope::Device, 3)), std::string { "Device 3" });
+    QCOMPARE(DspProfiler::scopeName(DspProfiler::key(DspProfiler::Scope::InsertEffect, 3, 2)), std::string { "Device 3 insert 2" });
+    QCOMPARE(DspProfiler::scopeName(DspProfiler::key(DspProfiler::Scope::SendEffect, 0, 1)), std::string { "Send 1" });
+    QCOMPARE(DspProfiler::scopeName(DspProfiler::key(DspProfiler::Scope::MasterInsertEffect, 0, 4)), std::string { "Master insert 4" });
+    QCOMPARE(DspProfiler::scopeName(DspProfiler::key(DspProfiler::Scope::LaneSumming)), std::string { "Engine: lane summing" });
+}
+
+void DspProfilerTest::test_record_inactive_shouldRecordNothing()
+{
+    DspProfiler profiler { 2 };
+    feed(profiler, 0, DspProfiler::key(DspProfiler::Scope::Device, 1), 10us, 10);
+    {
+        const DspProfiler::ScopedTimer timer { &profiler, 0, DspProfiler::key(DspProfiler::Scope::Callback) };
+    }
+    profiler.collect();
+
+    QVERIFY(profiler.statistics().empty());
+}
+
+void DspProfilerTest::test_statistics_shouldReportPercentilesAndMax()
+{
+    DspProfiler profiler { 2 };
+    profiler.setActive(true);
+    const auto key = DspProfiler::key(DspProfiler::Scope::Device, 1);
+    feed(profiler, 1, key, 10us, 99);
+    feed(profiler, 1, key, 1ms, 1);
+    profiler.setActive(false);
+
+    const auto statistics = profiler.statistics();
+    QCOMPARE(statistics.size(), size_t { 1 });
+    QCOMPARE(statistics.front().count, uint64_t { 100 });
+    // A quarter octave per bin: the reported percentile lands within 19% above the true value.
+    QVERIFY(statistics.front().p50Us >= 10.0 && statistics.front().p50Us < 12.0);
+    QVERIFY(statistics.front().p99Us >= 10.0 && statistics.front().p99Us < 12.0);
+    QCOMPARE(statistics.front().maxUs, 1000.0);
+}
+
+void DspProfilerTest::test_statistics_shouldSortByWorstP99First()
+{
+    DspProfiler profiler { 1 };
+    profiler.setActive(true);
+    feed(profiler, 0, DspProfiler::key(DspProfiler::Scope::Device, 1), 5us, 10);
+    feed(profiler, 0, DspProfiler::key(DspProfiler::Scope::Device, 2), 500us, 10);
+    feed(profiler, 0, DspProfiler::key(DspProfiler::Scope::Device, 3), 50us, 10);
+    profiler.setActive(false);
+
+    const auto statistics = profiler.statistics();
+    QCOMPARE(statistics.size(), size_t { 3 });
+    QCOMPARE(statistics.at(0).name, std::string { "Device 2" });
+    QCOMPARE(statistics.at(1).name, std::string { "Device 3" });
+    QCOMPARE(statistics.at(2).name, std::string { "Device 1" });
+}
+
+void DspProfilerTest::test_rackEffectTimer_withBinding_shouldTimeEffect()
+{
+    DspProfiler profiler { 2 };
+    profiler.setActive(true);
+    {
+        const DspProfiler::LaneBinding binding { &profiler, 1, DspProfiler::Scope::InsertEffect, 5 };
+        const DspProfiler::RackEffectTimer timer { 2 };
+    }
+    profiler.setActive(false);
+
+    const auto statistics = profiler.statistics();
+    QCOMPARE(statistics.size(), size_t { 1 });
+    QCOMPARE(statistics.front().name, std::string { "Device 5 insert 2" });
+}
+
+void DspProfilerTest::test_rackEffectTimer_withoutBinding_shouldRecordNothing()
+{
+    DspProfiler profiler { 2 };
+    profiler.setActive(true);
+    {
+        const DspProfiler::RackEffectTimer timer { 0 };
+    }
+    profiler.setActive(false);
+
+    QVERIFY(profiler.statistics().empty());
+}
+
+void DspProfilerTest::test_chromeTraceJson_shouldContainCompleteEvents()
+{
+    DspProfiler profiler { 2 };
+    profiler.setActive(true);
+    feed(profiler, 1, DspProfiler::key(DspProfiler::Scope::SendEffect, 0, 1), 20us, 1);
+    feed(profiler, profiler.callbackLane(), DspProfiler::key(DspProfiler::Scope::Callback), 100us, 1);
+    profiler.setActive(false);
+
+    const auto json = profiler.chromeTraceJson();
+    QVERIFY(json.starts_with("{\"traceEvents\":["));
+    QVERIFY(json.find("\"name\":\"Send 1\"") != std::string::npos);
+    QVERIFY(json.find("\"ph\":\"X\"") != std::string::npos);
+    QVERIFY(json.find("\"dur\":20,") != std::string::npos);
+    QVERIFY(json.find("\"tid\":1}") != std::string::npos);
+    QVERIFY(json.find("\"args\":{\"name\":\"Callback\"}") != std::string::npos);
+}
+
+void DspProfilerTest::test_setActive_shouldClearPreviousProfile()
+{
+    DspProfiler profiler { 1 };
+    profiler.setActive(true);
+    feed(profiler, 0, DspProfiler::key(DspProfiler::Scope::Device, 1), 10us, 10);
+    profiler.setActive(false);
+    QCOMPARE(profiler.statistics().size(), size_t { 1 });
+
+    profiler.setActive(true);
+    profiler.setActive(false);
+    QVERIFY(profiler.statistics().empty());
+}
+
+void DspProfilerTest::test_setActive_scopeOpenAcrossRestart_shouldNotBeCounted()
+{
+    DspProfiler profiler { 1 };
+    profiler.setActive(true);
+    {
+        // Opened in one session and closed in the next, as a callback in flight during a restart is.
+        const DspProfiler::ScopedTimer timer { &profiler, 0, DspProfiler::key(DspProfiler::Scope::Device, 1) };
+        profiler.setActive(false);
+        profiler.setActive(true);
+    }
+    feed(profiler, 0, DspProfiler::key(DspProfiler::Scope::Device, 2), 10us, 1);
+    profiler.setActive(false);
+
+    const auto statistics = profiler.statistics();
+    QCOMPARE(statistics.size(), size_t { 1 });
+    QCOMPARE(statistics.at(0).key, DspProfiler::key(DspProfiler::Scope::Device, 2));
+}
+
+} // namespace noteahead
+
+QTEST_GUILESS_MAIN(noteahead::DspProfilerTest)
@@ -0,0 +1,41 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DSP_PROFILER_TEST_HPP
+#define DSP_PROFILER_TEST_HPP
+
+#include <QObject>
+
+namespace noteahead {
+
+class DspProfilerTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void test_scopeName_shouldNameOwnerAndIndex();
+    void test_record_inactive_shouldRecordNothing();
+    void test_statistics_shouldReportPercentilesAndMax();
+    void test_statistics_shouldSortByWorstP99First();
+    void test_rackEffectTimer_withBinding_shouldTimeEffect();
+    void test_rackEffectTimer_withoutBinding_shouldRecordNothing();
+    void test_chromeTraceJson_shouldContainCompleteEvents();
+    void test_setActive_shouldClearPreviousProfile();
+    void test_setActive_scopeOpenAcrossRestart_shouldNotBeCounted();
+};
+
+} // namespace noteahead
+
+#endif // DSP_PROFILER_TEST_HPP
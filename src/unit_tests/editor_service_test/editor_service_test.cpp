@@ -39,8 +39,29 @@
 #include <QSignalSpy>
 #include <QTest>
 
+Q_DECLARE_METATYPE(noteahead::Position)
+
 namespace noteahead {
 
+namespace {
+
+//! Lines covered by the ranges recorded by a spy on EditorService::noteDataRangeChanged.
+size_t rangeLineCount(const QSignalSpy & spy)
+{
+    size_t lineCount = 0;
+    for (auto && arguments : spy) {
+        lineCount += arguments.at(1).value<Position>().line - arguments.at(0).value<Position>().line + 1;
+    }
+    return lineCount;
+}
+
+} // namespace
+
+void EditorServiceTest::initTestCase()
+{
+    qRegisterMetaType<noteahead::Position>("Position");
+}
+
 void EditorServiceTest::test_setPatternName_sameName_shouldNotMarkModified()
 {
     EditorService editorService { std::make_shared<SelectionService>(), std::make_shared<SettingsService>(), std::make_shared<AutomationService>(std::make_shared<PropertyService>()), std::make_shared<DataService>() };
@@ -198,6 +219,7 @@ void EditorServiceTest::test_columnCutPaste_equalSizes_shouldCopyColumn()
 {
     EditorService editorService { std::make_shared<SelectionService>(), std::make_shared<SettingsService>(), std::make_shared<AutomationService>(std::make_shared<PropertyService>()), std::make_shared<DataService>() };
     QSignalSpy noteDataChangedSpy { &editorService, &EditorService::noteDataAtPositionChanged };
+    QSignalSpy noteDataRangeChangedSpy { &editorService, &EditorService::noteDataRangeChanged };
     const Position sourcePosition = { 0, 1, 0, 0, 0 };
     QVERIFY(editorService.requestPosition(sourcePosition));
     QVERIFY(editorService.requestNoteOnAtCurrentPosition(1, 3, 64));
@@ -206,13 +228,15 @@ void EditorServiceTest::test_columnCutPaste_equalSizes_shouldCopyColumn()
     editorService.setIsModified(false);
     editorService.requestColumnCut();
     QVERIFY(editorService.isModified());
-    QCOMPARE(noteDataChangedSpy.count(), 65);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 64);
     editorService.setCurrentPattern(1);
     const Position targetPosition = { 1, 2, 0, 0, 0 };
     QVERIFY(editorService.requestPosition(targetPosition));
     editorService.requestColumnPaste();
 
-    QCOMPARE(noteDataChangedSpy.count(), 129);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 128);
     QCOMPARE(editorService.displayNoteAtPosition(sourcePosition), editorService.noDataString());
     QCOMPARE(editorService.displayVelocityAtPosition(sourcePosition), editorService.noDataString());
     QCOMPARE(editorService.displayNoteAtPosition(targetPosition), "C-3");
@@ -225,6 +249,7 @@ void EditorServiceTest::test_columnCutPaste_shorterTarget_shouldCopyColumn()
 {
     EditorService editorService { std::make_shared<SelectionService>(), std::make_shared<SettingsService>(), std::make_shared<AutomationService>(std::make_shared<PropertyService>()), std::make_shared<DataService>() };
     QSignalSpy noteDataChangedSpy { &editorService, &EditorService::noteDataAtPositionChanged };
+    QSignalSpy noteDataRangeChangedSpy { &editorService, &EditorService::noteDataRangeChanged };
     const Position sourcePosition = { 0, 1, 0, 0, 0 };
     QVERIFY(editorService.requestPosition(sourcePosition));
     QVERIFY(editorService.requestNoteOnAtCurrentPosition(1, 3, 64));
@@ -233,14 +258,16 @@ void EditorServiceTest::test_columnCutPaste_shorterTarget_shouldCopyColumn()
     editorService.setIsModified(false);
     editorService.requestColumnCut();
     QVERIFY(editorService.isModified());
-    QCOMPARE(noteDataChangedSpy.count(), 65);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 64);
     editorService.setCurrentPattern(1);
     editorService.setCurrentLineCount(32);
     const Position targetPosition = { 1, 2, 0, 0, 0 };
     QVERIFY(editorService.requestPosition(targetPosition));
     editorService.requestColumnPaste();
 
-    QCOMPARE(noteDataChangedSpy.count(), 97);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 96);
     QCOMPARE(editorService.displayNoteAtPosition(sourcePosition), editorService.noDataString());
     QCOMPARE(editorService.displayVelocityAtPosition(sourcePosition), editorService.noDataString());
     QCOMPARE(editorService.displayNoteAtPosition(targetPosition), "C-3");
@@ -253,6 +280,7 @@ void EditorServiceTest::test_columnCopyPaste_equalSizes_shouldCopyColumn()
 {
     EditorService editorService { std::make_shared<SelectionService>(), std::make_shared<SettingsService>(), std::make_shared<AutomationService>(std::make_shared<PropertyService>()), std::make_shared<DataService>() };
     QSignalSpy noteDataChangedSpy { &editorService, &EditorService::noteDataAtPositionChanged };
+    QSignalSpy noteDataRangeChangedSpy { &editorService, &EditorService::noteDataRangeChanged };
     const Position sourcePosition = { 0, 1, 0, 0, 0 };
     QVERIFY(editorService.requestPosition(sourcePosition));
     QVERIFY(editorService.requestNoteOnAtCurrentPosition(1, 3, 64));
@@ -266,7 +294,8 @@ void EditorServiceTest::test_columnCopyPaste_equalSizes_shouldCopyColumn()
     QVERIFY(editorService.requestPosition(targetPosition));
     editorService.requestColumnPaste();
 
-    QCOMPARE(noteDataChangedSpy.count(), 65);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 64);
     QCOMPARE(editorService.displayNoteAtPosition(sourcePosition), "C-3");
     QCOMPARE(editorService.displayVelocityAtPosition(sourcePosition), "064");
     QCOMPARE(editorService.displayNoteAtPosition(targetPosition), "C-3");
@@ -279,6 +308,7 @@ void EditorServiceTest::test_columnCopyPaste_shorterTarget_shouldCopyColumn()
 {
     EditorService editorService { std::make_shared<SelectionService>(), std::make_shared<SettingsService>(), std::make_shared<AutomationService>(std::make_shared<PropertyService>()), std::make_shared<DataService>() };
     QSignalSpy noteDataChangedSpy { &editorService, &EditorService::noteDataAtPositionChanged };
+    QSignalSpy noteDataRangeChangedSpy { &editorService, &EditorService::noteDataRangeChanged };
     const Position sourcePosition = { 0, 1, 0, 0, 0 };
     QVERIFY(editorService.requestPosition(sourcePosition));
     QVERIFY(editorService.requestNoteOnAtCurrentPosition(1, 3, 64));
@@ -293,7 +323,8 @@ void EditorServiceTest::test_columnCopyPaste_shorterTarget_shouldCopyColumn()
     QVERIFY(editorService.requestPosition(targetPosition));
     editorService.requestColumnPaste();
 
-    QCOMPARE(noteDataChangedSpy.count(), 33);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 32);
     QCOMPARE(editorService.displayNoteAtPosition(sourcePosition), "C-3");
     QCOMPARE(editorService.displayVelocityAtPosition(sourcePosition), "064");
     QCOMPARE(editorService.displayNoteAtPosition(targetPosition), "C-3");
@@ -306,6 +337,7 @@ void EditorServiceTest::test_trackCutPaste_equalSizes_shouldCopyTrack()
 {
     EditorService editorService { std::make_shared<SelectionService>(), std::make_shared<SettingsService>(), std::make_shared<AutomationService>(std::make_shared<PropertyService>()), std::make_shared<DataService>() };
     QSignalSpy noteDataChangedSpy { &editorService, &EditorService::noteDataAtPositionChanged };
+    QSignalSpy noteDataRangeChangedSpy { &editorService, &EditorService::noteDataRangeChanged };
     const Position sourcePosition = { 0, 1, 0, 0, 0 };
     QVERIFY(editorService.requestPosition(sourcePosition));
     QVERIFY(editorService.requestNoteOnAtCurrentPosition(1, 3, 64));
@@ -314,13 +346,15 @@ void EditorServiceTest::test_trackCutPaste_equalSizes_shouldCopyTrack()
     editorService.setIsModified(false);
     editorService.requestTrackCut();
     QVERIFY(editorService.isModified());
-    QCOMPARE(noteDataChangedSpy.count(), 65);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 64);
     editorService.setCurrentPattern(1);
     const Position targetPosition = { 1, 2, 0, 0, 0 };
     QVERIFY(editorService.requestPosition(targetPosition));
     editorService.requestTrackPaste();
 
-    QCOMPARE(noteDataChangedSpy.count(), 129);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 128);
     QCOMPARE(editorService.displayNoteAtPosition(sourcePosition), editorService.noDataString());
     QCOMPARE(editorService.displayVelocityAtPosition(sourcePosition), editorService.noDataString());
     QCOMPARE(editorService.displayNoteAtPosition(targetPosition), "C-3");
@@ -333,6 +367,7 @@ void EditorServiceTest::test_trackCutPaste_shorterTarget_shouldCopyTrack()
 {
     EditorService editorService { std::make_shared<SelectionService>(), std::make_shared<SettingsService>(), std::make_shared<AutomationService>(std::make_shared<PropertyService>()), std::make_shared<DataService>() };
     QSignalSpy noteDataChangedSpy { &editorService, &EditorService::noteDataAtPositionChanged };
+    QSignalSpy noteDataRangeChangedSpy { &editorService, &EditorService::noteDataRangeChanged };
     const Position sourcePosition = { 0, 1, 0, 0, 0 };
     QVERIFY(editorService.requestPosition(sourcePosition));
     QVERIFY(editorService.requestNoteOnAtCurrentPosition(1, 3, 64));
@@ -341,14 +376,16 @@ void EditorServiceTest::test_trackCutPaste_shorterTarget_shouldCopyTrack()
     editorService.setIsModified(false);
     editorService.requestTrackCut();
     QVERIFY(editorService.isModified());
-    QCOMPARE(noteDataChangedSpy.count(), 65);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 64);
     editorService.setCurrentPattern(1);
     editorService.setCurrentLineCount(32);
     const Position targetPosition = { 1, 2, 0, 0, 0 };
     QVERIFY(editorService.requestPosition(targetPosition));
     editorService.requestTrackPaste();
 
-    QCOMPARE(noteDataChangedSpy.count(), 97);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 96);
     QCOMPARE(editorService.displayNoteAtPosition(sourcePosition), editorService.noDataString());
     QCOMPARE(editorService.displayVelocityAtPosition(sourcePosition), editorService.noDataString());
     QCOMPARE(editorService.displayNoteAtPosition(targetPosition), "C-3");
@@ -361,6 +398,7 @@ void EditorServiceTest::test_trackCopyPaste_equalSizes_shouldCopyTrack()
 {
     EditorService editorService { std::make_shared<SelectionService>(), std::make_shared<SettingsService>(), std::make_shared<AutomationService>(std::make_shared<PropertyService>()), std::make_shared<DataService>() };
     QSignalSpy noteDataChangedSpy { &editorService, &EditorService::noteDataAtPositionChanged };
+    QSignalSpy noteDataRangeChangedSpy { &editorService, &EditorService::noteDataRangeChanged };
     const Position sourcePosition = { 0, 1, 0, 0, 0 };
     QVERIFY(editorService.requestPosition(sourcePosition));
     QVERIFY(editorService.requestNoteOnAtCurrentPosition(1, 3, 64));
@@ -374,7 +412,8 @@ void EditorServiceTest::test_trackCopyPaste_equalSizes_shouldCopyTrack()
     QVERIFY(editorService.requestPosition(targetPosition));
     editorService.requestTrackPaste();
 
-    QCOMPARE(noteDataChangedSpy.count(), 65);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 64);
     QCOMPARE(editorService.displayNoteAtPosition(sourcePosition), "C-3");
     QCOMPARE(editorService.displayVelocityAtPosition(sourcePosition), "064");
     QCOMPARE(editorService.displayNoteAtPosition(targetPosition), "C-3");
@@ -387,6 +426,7 @@ void EditorServiceTest::test_trackCopyPaste_shorterTarget_shouldCopyTrack()
 {
     EditorService editorService { std::make_shared<SelectionService>(), std::make_shared<SettingsService>(), std::make_shared<AutomationService>(std::make_shared<PropertyService>()), std::make_shared<DataService>() };
     QSignalSpy noteDataChangedSpy { &editorService, &EditorService::noteDataAtPositionChanged };
+    QSignalSpy noteDataRangeChangedSpy { &editorService, &EditorService::noteDataRangeChanged };
     const Position sourcePosition = { 0, 1, 0, 0, 0 };
     QVERIFY(editorService.requestPosition(sourcePosition));
     QVERIFY(editorService.requestNoteOnAtCurrentPosition(1, 3, 64));
@@ -401,7 +441,8 @@ void EditorServiceTest::test_trackCopyPaste_shorterTarget_shouldCopyTrack()
     QVERIFY(editorService.requestPosition(targetPosition));
     editorService.requestTrackPaste();
 
-    QCOMPARE(noteDataChangedSpy.count(), 33);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 32);
     QCOMPARE(editorService.displayNoteAtPosition(sourcePosition), "C-3");
     QCOMPARE(editorService.displayVelocityAtPosition(sourcePosition), "064");
     QCOMPARE(editorService.displayNoteAtPosition(targetPosition), "C-3");
@@ -460,6 +501,7 @@ void EditorServiceTest::test_patternCutPaste_equalSizes_shouldCopyPattern()
 {
     EditorService editorService { std::make_shared<SelectionService>(), std::make_shared<SettingsService>(), std::make_shared<AutomationService>(std::make_shared<PropertyService>()), std::make_shared<DataService>() };
     QSignalSpy noteDataChangedSpy { &editorService, &EditorService::noteDataAtPositionChanged };
+    QSignalSpy noteDataRangeChangedSpy { &editorService, &EditorService::noteDataRangeChanged };
     const Position sourcePosition = { 0, 0, 0, 0, 0 };
     QVERIFY(editorService.requestPosition(sourcePosition));
     QVERIFY(editorService.requestNoteOnAtCurrentPosition(1, 3, 64));
@@ -468,11 +510,13 @@ void EditorServiceTest::test_patternCutPaste_equalSizes_shouldCopyPattern()
     editorService.setIsModified(false);
     editorService.requestPatternCut();
     QVERIFY(editorService.isModified());
-    QCOMPARE(noteDataChangedSpy.count(), 513);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 512);
     editorService.setCurrentPattern(1);
     editorService.requestPatternPaste();
 
-    QCOMPARE(noteDataChangedSpy.count(), 1025);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 1024);
     QCOMPARE(editorService.displayNoteAtPosition(sourcePosition), editorService.noDataString());
     QCOMPARE(editorService.displayVelocityAtPosition(sourcePosition), editorService.noDataString());
     const Position targetPosition = { 1, 0, 0, 0, 0 };
@@ -484,6 +528,7 @@ void EditorServiceTest::test_patternCutPaste_shorterTarget_shouldCopyPattern()
 {
     EditorService editorService { std::make_shared<SelectionService>(), std::make_shared<SettingsService>(), std::make_shared<AutomationService>(std::make_shared<PropertyService>()), std::make_shared<DataService>() };
     QSignalSpy noteDataChangedSpy { &editorService, &EditorService::noteDataAtPositionChanged };
+    QSignalSpy noteDataRangeChangedSpy { &editorService, &EditorService::noteDataRangeChanged };
     const Position sourcePosition = { 0, 0, 0, 0, 0 };
     QVERIFY(editorService.requestPosition(sourcePosition));
     QVERIFY(editorService.requestNoteOnAtCurrentPosition(1, 3, 64));
@@ -492,13 +537,15 @@ void EditorServiceTest::test_patternCutPaste_shorterTarget_shouldCopyPattern()
     editorService.setIsModified(false);
     editorService.requestPatternCut();
     QVERIFY(editorService.isModified());
-    QCOMPARE(noteDataChangedSpy.count(), 513);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 512);
     editorService.setCurrentPattern(1);
     editorService.setCurrentLineCount(32);
     editorService.requestPatternPaste();
 
     QCOMPARE(editorService.currentLineCount(), 64);
-    QCOMPARE(noteDataChangedSpy.count(), 1025);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 1024);
     QCOMPARE(editorService.displayNoteAtPosition(sourcePosition), editorService.noDataString());
     QCOMPARE(editorService.displayVelocityAtPosition(sourcePosition), editorService.noDataString());
     const Position targetPosition = { 1, 0, 0, 0, 0 };
@@ -510,6 +557,7 @@ void EditorServiceTest::test_patternCopyPaste_equalSizes_shouldCopyPattern()
 {
     EditorService editorService { std::make_shared<SelectionService>(), std::make_shared<SettingsService>(), std::make_shared<AutomationService>(std::make_shared<PropertyService>()), std::make_shared<DataService>() };
     QSignalSpy noteDataChangedSpy { &editorService, &EditorService::noteDataAtPositionChanged };
+    QSignalSpy noteDataRangeChangedSpy { &editorService, &EditorService::noteDataRangeChanged };
     const Position sourcePosition = { 0, 0, 0, 0, 0 };
     QVERIFY(editorService.requestPosition(sourcePosition));
     QVERIFY(editorService.requestNoteOnAtCurrentPosition(1, 3, 64));
@@ -521,7 +569,8 @@ void EditorServiceTest::test_patternCopyPaste_equalSizes_shouldCopyPattern()
     editorService.setCurrentPattern(1);
     editorService.requestPatternPaste();
 
-    QCOMPARE(noteDataChangedSpy.count(), 513);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 512);
     QCOMPARE(editorService.displayNoteAtPosition(sourcePosition), "C-3");
     QCOMPARE(editorService.displayVelocityAtPosition(sourcePosition), "064");
     const Position targetPosition = { 1, 0, 0, 0, 0 };
@@ -533,6 +582,7 @@ void EditorServiceTest::test_patternCopyPaste_trackDeleted_shouldCopyPattern()
 {
     EditorService editorService { std::make_shared<SelectionService>(), std::make_shared<SettingsService>(), std::make_shared<AutomationService>(std::make_shared<PropertyService>()), std::make_shared<DataService>() };
     QSignalSpy noteDataChangedSpy { &editorService, &EditorService::noteDataAtPositionChanged };
+    QSignalSpy noteDataRangeChangedSpy { &editorService, &EditorService::noteDataRangeChanged };
     const Position sourcePosition = { 0, 0, 0, 0, 0 };
     QVERIFY(editorService.requestPosition(sourcePosition));
     QVERIFY(editorService.requestNoteOnAtCurrentPosition(1, 3, 64));
@@ -546,7 +596,8 @@ void EditorServiceTest::test_patternCopyPaste_trackDeleted_shouldCopyPattern()
     editorService.setCurrentPattern(1);
     editorService.requestPatternPaste();
 
-    QCOMPARE(noteDataChangedSpy.count(), 449);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 448);
     QCOMPARE(editorService.displayNoteAtPosition(sourcePosition), "C-3");
     QCOMPARE(editorService.displayVelocityAtPosition(sourcePosition), "064");
     const Position targetPosition = { 1, 0, 0, 0, 0 };
@@ -558,6 +609,7 @@ void EditorServiceTest::test_patternCopyPaste_shorterTarget_shouldCopyPattern()
 {
     EditorService editorService { std::make_shared<SelectionService>(), std::make_shared<SettingsService>(), std::make_shared<AutomationService>(std::make_shared<PropertyService>()), std::make_shared<DataService>() };
     QSignalSpy noteDataChangedSpy { &editorService, &EditorService::noteDataAtPositionChanged };
+    QSignalSpy noteDataRangeChangedSpy { &editorService, &EditorService::noteDataRangeChanged };
     const Position sourcePosition = { 0, 0, 0, 0, 0 };
     QVERIFY(editorService.requestPosition(sourcePosition));
     QVERIFY(editorService.requestNoteOnAtCurrentPosition(1, 3, 64));
@@ -571,7 +623,8 @@ void EditorServiceTest::test_patternCopyPaste_shorterTarget_shouldCopyPattern()
     editorService.requestPatternPaste();
 
     QCOMPARE(editorService.currentLineCount(), 64);
-    QCOMPARE(noteDataChangedSpy.count(), 513);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 512);
     QCOMPARE(editorService.displayNoteAtPosition(sourcePosition), "C-3");
     QCOMPARE(editorService.displayVelocityAtPosition(sourcePosition), "064");
     const Position targetPosition = { 1, 0, 0, 0, 0 };
@@ -585,6 +638,7 @@ void EditorServiceTest::test_selectionCutPaste_shouldCopySelection()
     const auto settingsService = std::make_shared<SettingsService>();
     EditorService editorService { selectionService, settingsService, std::make_shared<AutomationService>(std::make_shared<PropertyService>()), std::make_shared<DataService>() };
     QSignalSpy noteDataChangedSpy { &editorService, &EditorService::noteDataAtPositionChanged };
+    QSignalSpy noteDataRangeChangedSpy { &editorService, &EditorService::noteDataRangeChanged };
     const Position sourcePosition = { 0, 1, 0, 8, 0 };
     QVERIFY(editorService.requestPosition(sourcePosition));
     QVERIFY(editorService.requestNoteOnAtCurrentPosition(1, 3, 64));
@@ -595,12 +649,14 @@ void EditorServiceTest::test_selectionCutPaste_shouldCopySelection()
     selectionService->requestSelectionEnd(0, 1, 0, 12);
     editorService.requestSelectionCut();
     QVERIFY(editorService.isModified());
-    QCOMPARE(noteDataChangedSpy.count(), 10);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 9);
     const Position targetPosition = { 0, 2, 0, 16, 0 };
     QVERIFY(editorService.requestPosition(targetPosition));
     editorService.requestSelectionPaste();
 
-    QCOMPARE(noteDataChangedSpy.count(), 19);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 18);
     QCOMPARE(editorService.displayNoteAtPosition(sourcePosition), editorService.noDataString());
     QCOMPARE(editorService.displayVelocityAtPosition(sourcePosition), editorService.noDataString());
     const Position pastedNotePosition = { 0, 2, 0, targetPosition.line + sourcePosition.line - selectionService->selectedPositions().at(0).line, 0 };
@@ -616,6 +672,7 @@ void EditorServiceTest::test_selectionCopyPaste_shouldCopySelection()
     const auto settingsService = std::make_shared<SettingsService>();
     EditorService editorService { selectionService, settingsService, std::make_shared<AutomationService>(std::make_shared<PropertyService>()), std::make_shared<DataService>() };
     QSignalSpy noteDataChangedSpy { &editorService, &EditorService::noteDataAtPositionChanged };
+    QSignalSpy noteDataRangeChangedSpy { &editorService, &EditorService::noteDataRangeChanged };
     const Position sourcePosition = { 0, 1, 0, 8, 0 };
     QVERIFY(editorService.requestPosition(sourcePosition));
     QVERIFY(editorService.requestNoteOnAtCurrentPosition(1, 3, 64));
@@ -631,7 +688,8 @@ void EditorServiceTest::test_selectionCopyPaste_shouldCopySelection()
     QVERIFY(editorService.requestPosition(targetPosition));
     editorService.requestSelectionPaste();
 
-    QCOMPARE(noteDataChangedSpy.count(), 10);
+    QCOMPARE(noteDataChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 9);
     QCOMPARE(editorService.displayNoteAtPosition(sourcePosition), "C-3");
     QCOMPARE(editorService.displayVelocityAtPosition(sourcePosition), "064");
     const Position pastedNotePosition = { 0, 2, 0, targetPosition.line + sourcePosition.line - selectionService->selectedPositions().at(0).line, 0 };
@@ -1333,6 +1391,7 @@ void EditorServiceTest::test_requestColumnTranspose_shouldTransposeColumn()
 {
     EditorService editorService { std::make_shared<SelectionService>(), std::make_shared<SettingsService>(), std::make_shared<AutomationService>(std::make_shared<PropertyService>()), std::make_shared<DataService>() };
     QSignalSpy noteDataChangedSpy { &editorService, &EditorService::noteDataAtPositionChanged };
+    QSignalSpy noteDataRangeChangedSpy { &editorService, &EditorService::noteDataRangeChanged };
 
     QVERIFY(editorService.requestPosition(0, 0, 0, 0, 0));
     QVERIFY(editorService.requestNoteOnAtCurrentPosition(1, 3, 64));
@@ -1342,7 +1401,9 @@ void EditorServiceTest::test_requestColumnTranspose_shouldTransposeColumn()
 
     editorService.requestColumnTranspose(1);
 
-    QCOMPARE(noteDataChangedSpy.count(), 3);
+    QCOMPARE(noteDataChangedSpy.count(), 2);
+    QCOMPARE(noteDataRangeChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 1);
     QCOMPARE(editorService.displayNoteAtPosition(0, 0, 0, 0), "C-3");
     QCOMPARE(editorService.displayVelocityAtPosition(0, 0, 0, 0), "064");
     QCOMPARE(editorService.displayNoteAtPosition(0, 0, 1, 0), "D#3");
@@ -1353,6 +1414,7 @@ void EditorServiceTest::test_requestTrackTranspose_shouldTransposeTrack()
 {
     EditorService editorService { std::make_shared<SelectionService>(), std::make_shared<SettingsService>(), std::make_shared<AutomationService>(std::make_shared<PropertyService>()), std::make_shared<DataService>() };
     QSignalSpy noteDataChangedSpy { &editorService, &EditorService::noteDataAtPositionChanged };
+    QSignalSpy noteDataRangeChangedSpy { &editorService, &EditorService::noteDataRangeChanged };
 
     QVERIFY(editorService.requestPosition(0, 0, 0, 0, 0));
     QVERIFY(editorService.requestNoteOnAtCurrentPosition(1, 3, 64));
@@ -1362,7 +1424,9 @@ void EditorServiceTest::test_requestTrackTranspose_shouldTransposeTrack()
 
     editorService.requestTrackTranspose(1);
 
-    QCOMPARE(noteDataChangedSpy.count(), 4);
+    QCOMPARE(noteDataChangedSpy.count(), 2);
+    QCOMPARE(noteDataRangeChangedSpy.count(), 2);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 2);
     QCOMPARE(editorService.displayNoteAtPosition(0, 0, 0, 0), "C#3");
     QCOMPARE(editorService.displayVelocityAtPosition(0, 0, 0, 0), "064");
     QCOMPARE(editorService.displayNoteAtPosition(0, 0, 1, 0), "D#3");
@@ -1373,6 +1437,7 @@ void EditorServiceTest::test_requestPatternTranspose_shouldTransposePattern()
 {
     EditorService editorService { std::make_shared<SelectionService>(), std::make_shared<SettingsService>(), std::make_shared<AutomationService>(std::make_shared<PropertyService>()), std::make_shared<DataService>() };
     QSignalSpy noteDataChangedSpy { &editorService, &EditorService::noteDataAtPositionChanged };
+    QSignalSpy noteDataRangeChangedSpy { &editorService, &EditorService::noteDataRangeChanged };
 
     QVERIFY(editorService.requestPosition(0, 0, 0, 0, 0));
     QVERIFY(editorService.requestNoteOnAtCurrentPosition(1, 3, 64));
@@ -1381,7 +1446,9 @@ void EditorServiceTest::test_requestPatternTranspose_shouldTransposePattern()
 
     editorService.requestPatternTranspose(1);
 
-    QCOMPARE(noteDataChangedSpy.count(), 4);
+    QCOMPARE(noteDataChangedSpy.count(), 2);
+    QCOMPARE(noteDataRangeChangedSpy.count(), 2);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 2);
     QCOMPARE(editorService.displayNoteAtPosition(0, 0, 0, 0), "C#3");
     QCOMPARE(editorService.displayVelocityAtPosition(0, 0, 0, 0), "064");
     QCOMPARE(editorService.displayNoteAtPosition(0, 1, 0, 0), "D#3");
@@ -1392,6 +1459,7 @@ void EditorServiceTest::test_requestSongTranspose_shouldTransposeSong()
 {
     EditorService editorService { std::make_shared<SelectionService>(), std::make_shared<SettingsService>(), std::make_shared<AutomationService>(std::make_shared<PropertyService>()), std::make_shared<DataService>() };
     QSignalSpy noteDataChangedSpy { &editorService, &EditorService::noteDataAtPositionChanged };
+    QSignalSpy noteDataRangeChangedSpy { &editorService, &EditorService::noteDataRangeChanged };
 
     QVERIFY(editorService.requestPosition(0, 0, 0, 0, 0));
     QVERIFY(editorService.requestNoteOnAtCurrentPosition(1, 3, 64)); // C-3
@@ -1402,6 +1470,8 @@ void EditorServiceTest::test_requestSongTranspose_shouldTransposeSong()
 
     editorService.requestSongTranspose(1);
 
+    QCOMPARE(noteDataChangedSpy.count(), 2);
+    QCOMPARE(noteDataRangeChangedSpy.count(), 2);
     QCOMPARE(editorService.displayNoteAtPosition(0, 0, 0, 0), "C#3");
     QCOMPARE(editorService.displayNoteAtPosition(1, 1, 0, 0), "D#3");
 }
@@ -1412,6 +1482,7 @@ void EditorServiceTest::test_requestSelectionTranspose_shouldTransposeSelection(
     const auto settingsService = std::make_shared<SettingsService>();
     EditorService editorService { selectionService, settingsService, std::make_shared<AutomationService>(std::make_shared<PropertyService>()), std::make_shared<DataService>() };
     QSignalSpy noteDataChangedSpy { &editorService, &EditorService::noteDataAtPositionChanged };
+    QSignalSpy noteDataRangeChangedSpy { &editorService, &EditorService::noteDataRangeChanged };
 
     editorService.requestNewColumn(0);
 
@@ -1436,7 +1507,9 @@ void EditorServiceTest::test_requestSelectionTranspose_shouldTransposeSelection(
 
     editorService.requestSelectionTranspose(1);
 
-    QCOMPARE(noteDataChangedSpy.count(), 5);
+    QCOMPARE(noteDataChangedSpy.count(), 3);
+    QCOMPARE(noteDataRangeChangedSpy.count(), 1);
+    QCOMPARE(rangeLineCount(noteDataRangeChangedSpy), 5);
     QCOMPARE(editorService.displayNoteAtPosition(0, 0, 1, 0), "C#3");
     QCOMPARE(editorService.displayVelocityAtPosition(0, 0, 1, 0), "064");
     QCOMPARE(editorService.displayNoteAtPosition(0, 0, 1, 4), "C#3");
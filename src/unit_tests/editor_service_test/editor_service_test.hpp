@@ -25,6 +25,7 @@ class EditorServiceTest : public QObject
     Q_OBJECT
 
 private slots:
+    void initTestCase();
 
     void test_setPatternName_sameName_shouldNotMarkModified();
     void test_initialize_shouldInitializeCorrectly();
@@ -36,6 +36,8 @@
 
 #include <cmath>
 #include <numbers>
+#include <span>
+#include <vector>
 
 namespace noteahead {
 
@@ -1511,6 +1513,78 @@ void EffectsTest::test_chorusEffect_shouldProcessAudio()
     QVERIFY(signalDetected);
 }
 
+namespace {
+
+//! Feeds the effect blocks of the given input level, a block at a time the way a send bus does.
+void processBlocks(Effect & effect, int blockCount, double level)
+{
+    constexpr uint32_t frameCount = 256;
+    std::vector<double> buffer(frameCount * 2);
+    for (int block = 0; block < blockCount; block++) {
+        for (uint32_t i = 0; i < frameCount * 2; i++) {
+            buffer[i] = (i / 2) % 64 < 2 ? level : 0.0;
+        }
+        AudioContext context { std::span(buffer.data(), buffer.size()), frameCount, 44100 };
+        effect.process(context);
+    }
+}
+
+} // namespace
+
+void EffectsTest::test_reverb_tailState_shouldFallSilentAfterInputStops()
+{
+    Reverb effect;
+    effect.setSampleRate(44100.0);
+    effect.setMix(1.0f);
+    effect.setDecay(0.02f);
+    QCOMPARE(effect.tailState(), Effect::TailState::Silent);
+
+    processBlocks(effect, 8, 0.8);
+    QCOMPARE(effect.tailState(), Effect::TailState::Ringing);
+
+    // Well within a second at this decay, where the output alone would keep it busy for as long as
+    // it takes to round to zero.
+    int blocks = 0;
+    while (effect.tailState() == Effect::TailState::Ringing && blocks < 200) {
+        processBlocks(effect, 1, 0.0);
+        blocks++;
+    }
+    QVERIFY2(blocks < 200, "The tail never finished");
+
+    effect.reset();
+    QCOMPARE(effect.tailState(), Effect::TailState::Silent);
+}
+
+void EffectsTest::test_reverb_disabled_shouldReportSilentTail()
+{
+    Reverb effect;
+    effect.setSampleRate(44100.0);
+    effect.setMix(1.0f);
+    processBlocks(effect, 8, 0.8);
+    QCOMPARE(effect.tailState(), Effect::TailState::Ringing);
+
+    effect.setEnabled(false);
+    QCOMPARE(effect.tailState(), Effect::TailState::Silent);
+}
+
+void EffectsTest::test_endlessReverb_freeze_shouldKeepTailRinging()
+{
+    EndlessReverb effect;
+    effect.setSampleRate(44100.0);
+    if (const auto p = effect.parameter(Constants::NahdXml::xmlKeyMix().toStdString()); p) {
+        p->get().setValue(1.0f);
+    }
+    effect.sync();
+    processBlocks(effect, 16, 0.8);
+
+    if (const auto p = effect.parameter(Constants::NahdXml::xmlKeyFreeze().toStdString()); p) {
+        p->get().setValue(1.0f);
+    }
+    effect.sync();
+    processBlocks(effect, 2000, 0.0);
+    QCOMPARE(effect.tailState(), Effect::TailState::Ringing);
+}
+
 } // namespace noteahead
 
 QTEST_GUILESS_MAIN(noteahead::EffectsTest)
@@ -53,6 +53,9 @@ private slots:
     void test_endlessReverb_shouldProduceStableWetTail();
     void test_endlessReverb_mixZero_shouldPassDrySignal();
     void test_endlessReverb_freeze_shouldSustainTail();
+    void test_endlessReverb_freeze_shouldKeepTailRinging();
+    void test_reverb_tailState_shouldFallSilentAfterInputStops();
+    void test_reverb_disabled_shouldReportSilentTail();
     void test_eq8BandParametricEffect_shouldApplyBandsAndBeStable();
     void test_eq8BandParametricEffect_stereoMode_shouldDefaultToMidSide();
     void test_eq8BandParametricEffect_midMode_shouldAffectMidOnly();
@@ -0,0 +1,161 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "fast_math_test.hpp"
+
+#include "../../domain/dsp/fast_math.hpp"
+
+#include <QTest>
+
+#include <cmath>
+#include <functional>
+#include <numbers>
+#include <span>
+#include <vector>
+
+namespace noteahead {
+
+// The bounds documented in fast_math.hpp, checked on a dense grid over each function's range.
+static constexpr int steps = 200000;
+
+static double maxError(double from, double to, const std::function<double(double)> & error)
+{
+    double worst = 0.0;
+    for (int i = 0; i <= steps; i++) {
+        worst = std::max(worst, error(from + (to - from) * i / steps));
+    }
+    return worst;
+}
+
+void FastMathTest::test_exp2_overRange_shouldStayWithinRelativeBound()
+{
+    const auto worst = maxError(-1000.0, 1000.0, [](double x) {
+        return std::abs(FastMath::exp2(x) - std::exp2(x)) / std::exp2(x);
+    });
+
+    QVERIFY(worst < 5e-10);
+}
+
+void FastMathTest::test_exp2_outOfRange_shouldSaturate()
+{
+    QVERIFY(FastMath::exp2(-5000.0) > 0.0);
+    QVERIFY(std::isfinite(FastMath::exp2(5000.0)));
+    QCOMPARE(FastMath::exp2(3.0), 8.0);
+}
+
+void FastMathTest::test_pitchRatio_octave_shouldDouble()
+{
+    QCOMPARE(FastMath::pitchRatio(12.0), 2.0);
+    QCOMPARE(FastMath::pitchRatio(-24.0), 0.25);
+    QVERIFY(std::abs(FastMath::pitchRatio(7.0) - std::exp2(7.0 / 12.0)) < 1e-9);
+}
+
+void FastMathTest::test_log2_overRange_shouldStayWithinAbsoluteBound()
+{
+    // Stepped in the exponent so that every binade gets the same coverage.
+    const auto worst = maxError(-1000.0, 1000.0, [](double e) {
+        const double x = std::exp2(e);
+        return std::abs(FastMath::log2(x) - std::log2(x));
+    });
+
+    QVERIFY(worst < 5e-11);
+    QCOMPARE(FastMath::log2(1.0), 0.0);
+}
+
+void FastMathTest::test_sin2pi_overSeveralCycles_shouldStayWithinAbsoluteBound()
+{
+    const auto worst = maxError(-4.0, 4.0, [](double x) {
+        return std::abs(FastMath::sin2pi(x) - std::sin(2.0 * std::numbers::pi * x));
+    });
+
+    QVERIFY(worst < 1e-9);
+    QVERIFY(std::abs(FastMath::sin(std::numbers::pi / 6.0) - 0.5) < 1e-9);
+}
+
+void FastMathTest::test_cos2pi_overSeveralCycles_shouldStayWithinAbsoluteBound()
+{
+    const auto worst = maxError(-4.0, 4.0, [](double x) {
+        return std::abs(FastMath::cos2pi(x) - std::cos(2.0 * std::numbers::pi * x));
+    });
+
+    QVERIFY(worst < 1e-9);
+    QVERIFY(std::abs(FastMath::cos(std::numbers::pi / 3.0) - 0.5) < 1e-9);
+}
+
+void FastMathTest::test_tanh_overRange_shouldStayWithinAbsoluteBound()
+{
+    const auto worst = maxError(-40.0, 40.0, [](double x) {
+        return std::abs(FastMath::tanh(x) - std::tanh(x));
+    });
+
+    QVERIFY(worst < 1e-9);
+}
+
+void FastMathTest::test_tanh_zero_shouldBeExactlyZero()
+{
+    // Saturators rely on silence staying silent.
+    QCOMPARE(FastMath::tanh(0.0), 0.0);
+    QCOMPARE(FastMath::tanh(0.0f), 0.0f);
+}
+
+void FastMathTest::test_float_overRange_shouldStayWithinFloatBound()
+{
+    double exp2Error = 0.0;
+    double log2Error = 0.0;
+    double sinError = 0.0;
+    double tanhError = 0.0;
+    // Stepped in powers of two, so that each input is exact in float and double alike.
+    for (int i = -steps / 2; i <= steps / 2; i++) {
+        const float phase = static_cast<float>(i) / 16384.0f;
+        const float exponent = static_cast<float>(i) / 1024.0f;
+        const double exact = std::exp2(static_cast<double>(exponent));
+        exp2Error = std::max(exp2Error, std::abs(FastMath::exp2(exponent) - exact) / exact);
+        log2Error = std::max(log2Error, std::abs(FastMath::log2(static_cast<float>(exact)) - std::log2(static_cast<double>(static_cast<float>(exact)))));
+        sinError = std::max(sinError, std::abs(FastMath::sin2pi(phase) - std::sin(2.0 * std::numbers::pi * phase)));
+        tanhError = std::max(tanhError, std::abs(FastMath::tanh(phase) - std::tanh(static_cast<double>(phase))));
+    }
+
+    QVERIFY(exp2Error < 1e-6);
+    QVERIFY(log2Error < 1e-6);
+    QVERIFY(sinError < 1e-6);
+    QVERIFY(tanhError < 1e-6);
+}
+
+void FastMathTest::test_batch_shouldMatchScalar()
+{
+    std::vector<float> values;
+    for (int i = 0; i < 1000; i++) {
+        values.push_back(-5.0f + 0.01f * static_cast<float>(i));
+    }
+    auto exp2Values = values;
+    auto sinValues = values;
+    auto tanhValues = values;
+
+    FastMath::exp2(std::span { exp2Values });
+    FastMath::sin2pi(std::span { sinValues });
+    FastMath::tanh(std::span { tanhValues });
+
+    // Under -ffast-math the vectorised loop may contract and reorder the polynomials differently
+    // from the scalar call, which moves the last bit of a float.
+    for (size_t i = 0; i < values.size(); i++) {
+        QVERIFY(std::abs(exp2Values.at(i) - FastMath::exp2(values.at(i))) < 1e-6f * FastMath::exp2(values.at(i)));
+        QVERIFY(std::abs(sinValues.at(i) - FastMath::sin2pi(values.at(i))) < 1e-6f);
+        QVERIFY(std::abs(tanhValues.at(i) - FastMath::tanh(values.at(i))) < 1e-6f);
+    }
+}
+
+} // namespace noteahead
+
+QTEST_GUILESS_MAIN(noteahead::FastMathTest)
@@ -0,0 +1,42 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef FAST_MATH_TEST_HPP
+#define FAST_MATH_TEST_HPP
+
+#include <QObject>
+
+namespace noteahead {
+
+class FastMathTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void test_exp2_overRange_shouldStayWithinRelativeBound();
+    void test_exp2_outOfRange_shouldSaturate();
+    void test_pitchRatio_octave_shouldDouble();
+    void test_log2_overRange_shouldStayWithinAbsoluteBound();
+    void test_sin2pi_overSeveralCycles_shouldStayWithinAbsoluteBound();
+    void test_cos2pi_overSeveralCycles_shouldStayWithinAbsoluteBound();
+    void test_tanh_overRange_shouldStayWithinAbsoluteBound();
+    void test_tanh_zero_shouldBeExactlyZero();
+    void test_float_overRange_shouldStayWithinFloatBound();
+    void test_batch_shouldMatchScalar();
+};
+
+} // namespace noteahead
+
+#endif // FAST_MATH_TEST_HPP
@@ -155,6 +155,17 @@ void LoadMeterTest::test_setActive_false_shouldClearEverything()
     QCOMPARE(meter.overrunCount(), uint64_t { 0 });
 }
 
+void LoadMeterTest::test_costNanoseconds_inactive_shouldStillFollowTheCost()
+{
+    // The engine schedules its threaded work by this, meters on screen or not.
+    LoadMeter meter;
+    feed(meter, 50.0, 500);
+
+    const double expected = BufferSeconds * 0.5 * 1.0e9;
+    QVERIFY2(std::abs(meter.costNanoseconds() - expected) < expected * 0.02, qPrintable(QString::number(meter.costNanoseconds())));
+    QCOMPARE(meter.loadPercent(), 0.0f);
+}
+
 } // namespace noteahead
 
 QTEST_GUILESS_MAIN(noteahead::LoadMeterTest)
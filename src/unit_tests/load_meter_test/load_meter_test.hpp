@@ -34,6 +34,7 @@ private slots:
     void test_peak_higherSpikeDuringHold_shouldTakeOver();
     void test_addBlock_zeroWork_shouldDecayToIdle();
     void test_setActive_false_shouldClearEverything();
+    void test_costNanoseconds_inactive_shouldStillFollowTheCost();
 };
 
 } // namespace noteahead
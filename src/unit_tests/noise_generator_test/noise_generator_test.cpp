@@ -0,0 +1,132 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "noise_generator_test.hpp"
+
+#include "../../domain/dsp/noise_generator.hpp"
+
+#include <QTest>
+
+#include <cmath>
+#include <span>
+#include <vector>
+
+namespace noteahead {
+
+static constexpr int sampleCount = 1 << 20;
+
+void NoiseGeneratorTest::test_next_shouldStayInRange()
+{
+    NoiseGenerator noise;
+    float minimum = 1.0f;
+    float maximum = -1.0f;
+    for (int i = 0; i < sampleCount; i++) {
+        const float sample = noise.next();
+        minimum = std::min(minimum, sample);
+        maximum = std::max(maximum, sample);
+    }
+
+    QVERIFY(minimum >= -1.0f);
+    QVERIFY(maximum < 1.0f);
+    QVERIFY(minimum < -0.999f);
+    QVERIFY(maximum > 0.999f);
+}
+
+void NoiseGeneratorTest::test_next_shouldBeWhite()
+{
+    NoiseGenerator noise;
+    std::vector<double> samples;
+    for (int i = 0; i < sampleCount; i++) {
+        samples.push_back(noise.next());
+    }
+
+    // Uniform on [-1, 1) has a mean of 0 and a variance of 1/3; white means no correlation between
+    // neighbours.
+    double mean = 0.0;
+    double power = 0.0;
+    double lag1 = 0.0;
+    double lag2 = 0.0;
+    for (size_t i = 0; i < samples.size(); i++) {
+        mean += samples.at(i);
+        power += samples.at(i) * samples.at(i);
+        lag1 += i >= 1 ? samples.at(i) * samples.at(i - 1) : 0.0;
+        lag2 += i >= 2 ? samples.at(i) * samples.at(i - 2) : 0.0;
+    }
+
+    QVERIFY(std::abs(mean / sampleCount) < 0.005);
+    QVERIFY(std::abs(power / sampleCount - 1.0 / 3.0) < 0.005);
+    QVERIFY(std::abs(lag1 / power) < 0.005);
+    QVERIFY(std::abs(lag2 / power) < 0.005);
+}
+
+void NoiseGeneratorTest::test_seed_shouldRestartTheStream()
+{
+    NoiseGenerator noise { 7 };
+    std::vector<float> first;
+    for (int i = 0; i < 1000; i++) {
+        first.push_back(noise.next());
+    }
+
+    noise.seed(7);
+
+    for (int i = 0; i < 1000; i++) {
+        QCOMPARE(noise.next(), first.at(i));
+    }
+}
+
+void NoiseGeneratorTest::test_seed_differentSeeds_shouldGiveDifferentStreams()
+{
+    NoiseGenerator a { 0 };
+    NoiseGenerator b { 1 };
+    int same = 0;
+    for (int i = 0; i < 1000; i++) {
+        same += a.next() == b.next() ? 1 : 0;
+    }
+
+    QVERIFY(same < 5);
+}
+
+void NoiseGeneratorTest::test_fill_shouldMatchNext()
+{
+    NoiseGenerator filled { 3 };
+    NoiseGenerator pulled { 3 };
+    std::vector<float> buffer(1000);
+
+    // Split unevenly, so a block boundary falls inside a vector's worth of samples.
+    filled.fill(std::span { buffer }.first(301));
+    filled.fill(std::span { buffer }.subspan(301));
+
+    for (const float sample : buffer) {
+        QCOMPARE(sample, pulled.next());
+    }
+    QCOMPARE(filled.next(), pulled.next());
+}
+
+void NoiseGeneratorTest::test_nextUnipolar_shouldStayInRange()
+{
+    NoiseGenerator noise;
+    double sum = 0.0;
+    for (int i = 0; i < sampleCount; i++) {
+        const double value = noise.nextUnipolar();
+        QVERIFY(value >= 0.0 && value < 1.0);
+        sum += value;
+    }
+
+    QVERIFY(std::abs(sum / sampleCount - 0.5) < 0.005);
+}
+
+} // namespace noteahead
+
+QTEST_GUILESS_MAIN(noteahead::NoiseGeneratorTest)
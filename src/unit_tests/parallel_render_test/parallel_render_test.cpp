@@ -15,6 +15,7 @@
 
 #include "parallel_render_test.hpp"
 
+#include "../../common/constants.hpp"
 #include "../../domain/devices/drum_synth_device.hpp"
 #include "../../domain/devices/string_ensemble_device.hpp"
 #include "../../domain/devices/sub_mixer_device.hpp"
@@ -23,12 +24,19 @@
 #include "../../domain/effects/effect_rack.hpp"
 #include "../../domain/effects/reverb.hpp"
 #include "../../infra/audio/audio_engine.hpp"
+#include "../../infra/audio/backend/audio_file_reader.hpp"
+#include "../../infra/audio/frozen_device_player.hpp"
+#include "../../infra/audio/render_ahead_buffer.hpp"
 
 #include <QTest>
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <memory>
+#include <optional>
 #include <span>
+#include <thread>
 #include <vector>
 
 namespace noteahead {
@@ -42,9 +50,12 @@ constexpr int BufferCount { 60 };
 //! Threading changes which lane a device's output is accumulated into, and the lanes are summed in
 //! a fixed order afterwards, so the additions are grouped differently. That shifts the last bits of
 //! the result — inaudible at around -180 dBFS, but it means the two paths are equal to within
-//! floating-point summation order rather than bit-identical.
+//! floating-point summation order rather than bit-identical, unless the engine sums in a fixed order.
 constexpr double Tolerance { 1.0e-9 };
 
+//! A frozen device's file holds 32-bit floats, so it matches the device to float precision only.
+constexpr double FrozenTolerance { 1.0e-6 };
+
 //! Populates an engine identically every time, so two renders differ only in how they were driven.
 //! The devices seed their own generators deterministically, so this is reproducible.
 void populate(AudioEngine & engine, bool withSubMixer)
@@ -80,15 +91,8 @@ void populate(AudioEngine & engine, bool withSubMixer)
     }
 }
 
-std::vector<double> render(bool threaded, bool withSubMixer)
+std::vector<double> collect(AudioEngine & engine)
 {
-    AudioEngine engine;
-    if (withSubMixer) {
-        engine.sendEffectRack().setEffect(0, std::make_shared<Reverb>());
-    }
-    populate(engine, withSubMixer);
-    engine.setIsExclusive(threaded);
-
     std::vector<double> collected;
     collected.reserve(static_cast<size_t>(BufferCount) * FrameCount * 2);
     std::vector<double> buffer(static_cast<size_t>(FrameCount) * 2, 0.0);
@@ -101,6 +105,150 @@ std::vector<double> render(bool threaded, bool withSubMixer)
     return collected;
 }
 
+std::vector<double> render(bool threaded, bool withSubMixer, bool masterPipeline = false, bool fixedOrder = false, std::optional<size_t> captureSlot = {})
+{
+    AudioEngine engine;
+    if (withSubMixer) {
+        engine.sendEffectRack().setEffect(0, std::make_shared<Reverb>());
+    }
+    populate(engine, withSubMixer);
+    engine.setIsExclusive(threaded);
+    engine.setMasterPipelineEnabled(masterPipeline);
+    engine.setFixedOrderSumming(fixedOrder);
+    engine.setCaptureSlot(captureSlot);
+    return collect(engine);
+}
+
+//! Plays the fixture as a real-time backend would, with threaded playback, through a master insert
+//! so that the pipeline has work to overlap. Empty where the workers cannot get real-time
+//! scheduling, as threaded playback then stays serial.
+std::vector<double> renderPlayback(bool masterPipeline, uint32_t & latency)
+{
+    AudioEngine engine;
+    engine.sendEffectRack().setEffect(0, std::make_shared<Reverb>());
+    engine.insertEffectRack().setEffect(0, std::make_shared<Reverb>());
+    populate(engine, true);
+    engine.setCallbackRealTimePriority(Constants::audioCallbackRealTimePriority());
+    engine.setPlaybackThreadingEnabled(true);
+    if (!engine.supportsPlaybackThreading()) {
+        return {};
+    }
+    engine.setMasterPipelineEnabled(masterPipeline);
+    latency = engine.masterPipelineLatency(FrameCount);
+    return collect(engine);
+}
+
+//! The one device on its own, played as the fixture plays it.
+std::vector<double> renderAlone(size_t slotIndex, std::shared_ptr<Device> device)
+{
+    AudioEngine engine;
+    engine.setDevice(slotIndex, std::move(device));
+    return collect(engine);
+}
+
+//! A Synth summed by a SubMixer, the membership set only once the engine has played a block, so
+//! the member is read from a slot no device read when it was put in.
+std::vector<double> renderSubMixerMember(size_t memberSlot, size_t subMixerSlot)
+{
+    AudioEngine engine;
+    const auto synth = std::make_shared<SynthDevice>("Synth");
+    synth->processMidiNoteOn(48, 100);
+    engine.setDevice(memberSlot, synth);
+    const auto subMixer = std::make_shared<SubMixerDevice>("SubMixer");
+    engine.setDevice(subMixerSlot, subMixer);
+
+    std::vector<double> buffer(static_cast<size_t>(FrameCount) * 2, 0.0);
+    AudioContext context { std::span(buffer.data(), buffer.size()), FrameCount, SampleRate };
+    engine.process(context);
+
+    subMixer->setMembers({ memberSlot });
+    return collect(engine);
+}
+
+//! Serves a rendered block as if it were a stereo float file.
+class MemoryAudioFileReader : public AudioFileReader
+{
+public:
+    explicit MemoryAudioFileReader(const std::vector<double> & samples)
+      : m_samples(samples.begin(), samples.end())
+    {
+    }
+
+    bool open(const std::string &, Mode, Info & info) override
+    {
+        m_position = 0;
+        m_isOpen = true;
+        info = this->info();
+        return true;
+    }
+
+    void close() override
+    {
+        m_isOpen = false;
+    }
+
+    void setTag(TagType, const std::string &) override
+    {
+    }
+
+    int64_t readFloat(std::span<float> data) override
+    {
+        const auto count = std::min(data.size() / 2 * 2, m_samples.size() - m_position);
+        std::copy_n(m_samples.begin() + static_cast<std::ptrdiff_t>(m_position), count, data.begin());
+        m_position += count;
+        return static_cast<int64_t>(count / 2);
+    }
+
+    int64_t readDouble(std::span<double>) override
+    {
+        return 0;
+    }
+
+    int64_t readInt(std::span<int32_t>) override
+    {
+        return 0;
+    }
+
+    int64_t writeFloat(std::span<const float>) override
+    {
+        return 0;
+    }
+
+    int64_t writeInt(std::span<const int32_t>) override
+    {
+        return 0;
+    }
+
+    bool seek(int64_t frames, int) override
+    {
+        m_position = static_cast<size_t>(frames) * 2;
+        return true;
+    }
+
+    bool isOpen() const override
+    {
+        return m_isOpen;
+    }
+
+    Info info() const override
+    {
+        return { static_cast<int64_t>(m_samples.size() / 2), static_cast<int>(SampleRate), 2, 0 };
+    }
+
+private:
+    std::vector<float> m_samples;
+    size_t m_position { 0 };
+    bool m_isOpen { false };
+};
+
+//! Writes the given frames of a rendered result into a render-ahead buffer, block by block.
+void writeAhead(RenderAheadBuffer & buffer, const std::vector<double> & samples, size_t firstFrame, size_t frameCount)
+{
+    for (size_t frame = firstFrame; frame < firstFrame + frameCount; frame += FrameCount) {
+        QVERIFY(buffer.write(std::span { samples }.subspan(frame * 2, static_cast<size_t>(FrameCount) * 2), FrameCount));
+    }
+}
+
 double peakLevel(const std::vector<double> & samples)
 {
     double peak = 0.0;
@@ -110,7 +258,7 @@ double peakLevel(const std::vector<double> & samples)
     return peak;
 }
 
-void compare(const std::vector<double> & a, const std::vector<double> & b)
+void compare(const std::vector<double> & a, const std::vector<double> & b, double tolerance = Tolerance)
 {
     QCOMPARE(a.size(), b.size());
     QVERIFY2(peakLevel(a) > 0.001, "The fixture produced no signal, so this would prove nothing");
@@ -119,7 +267,51 @@ void compare(const std::vector<double> & a, const std::vector<double> & b)
     for (size_t i = 0; i < a.size(); i++) {
         worst = std::max(worst, std::abs(a[i] - b[i]));
     }
-    QVERIFY2(worst < Tolerance, qPrintable(QString { "worst difference %1" }.arg(worst)));
+    QVERIFY2(worst < tolerance, qPrintable(QString { "worst difference %1" }.arg(worst)));
+}
+
+//! Streams the Strings' capture as a frozen file, the whole of it already read off the "disk".
+std::shared_ptr<FrozenDevicePlayer> startFrozenStrings()
+{
+    auto player = std::make_shared<FrozenDevicePlayer>(std::make_unique<MemoryAudioFileReader>(render(true, true, false, false, 3)));
+    player->start("Strings.wav", 0.0);
+    // The whole file fits the streamer's first read; give its thread the time to make it.
+    std::this_thread::sleep_for(std::chrono::milliseconds { 200 });
+    return player;
+}
+
+//! The fixture, its Strings played live or from their file, with their fader where it is given.
+std::vector<double> renderStrings(bool frozen, float fader)
+{
+    const auto player = frozen ? startFrozenStrings() : nullptr;
+
+    AudioEngine engine;
+    engine.sendEffectRack().setEffect(0, std::make_shared<Reverb>());
+    populate(engine, true);
+    engine.device(3)->setVolume(fader);
+    if (player) {
+        engine.setFrozenDevicePlayer(3, player);
+        engine.startFrozenDevicePlayers();
+    }
+    const auto rendered = collect(engine);
+    if (player) {
+        engine.clearFrozenDevicePlayers();
+        player->stop();
+    }
+    return rendered;
+}
+
+//! No tolerance at all: what a reproducible render promises.
+void compareExact(const std::vector<double> & a, const std::vector<double> & b)
+{
+    QCOMPARE(a.size(), b.size());
+    QVERIFY2(peakLevel(a) > 0.001, "The fixture produced no signal, so this would prove nothing");
+
+    for (size_t i = 0; i < a.size(); i++) {
+        if (a[i] != b[i]) {
+            QFAIL(qPrintable(QString { "sample %1 differs: %2 vs %3" }.arg(i).arg(a[i], 0, 'g', 17).arg(b[i], 0, 'g', 17)));
+        }
+    }
 }
 
 } // namespace
@@ -142,6 +334,328 @@ void ParallelRenderTest::test_threadedRender_repeated_shouldBeDeterministic()
     compare(render(true, true), render(true, true));
 }
 
+void ParallelRenderTest::test_fixedOrderSumming_serialAndThreaded_shouldBeBitIdentical()
+{
+    // Summed in slot order, the mix no longer depends on which lane ran which device, so threading
+    // may not move even the last bit. This is the check to run before trusting a threading change.
+    const auto serial = render(false, true, false, true);
+    compareExact(serial, render(true, true, false, true));
+    compareExact(serial, render(true, true, false, true));
+}
+
+void ParallelRenderTest::test_fixedOrderSumming_shouldMatchLaneSumming()
+{
+    // Only the order of the additions changes, not what is added.
+    compare(render(true, true), render(true, true, false, true));
+}
+
+void ParallelRenderTest::test_masterPipeline_offlineRender_shouldStayAligned()
+{
+    // The pipelined master delays playback by a block, which an export has nobody to report to.
+    compare(render(true, true, false), render(true, true, true));
+}
+
+void ParallelRenderTest::test_masterPipeline_withoutThreadedPlayback_shouldAddNoLatency()
+{
+    AudioEngine engine;
+    engine.setMasterPipelineEnabled(true);
+    QCOMPARE(engine.masterPipelineLatency(FrameCount), 0u);
+}
+
+void ParallelRenderTest::test_masterPipeline_threadedPlayback_shouldDelayByOneBlock()
+{
+    uint32_t plainLatency = 0;
+    uint32_t pipelinedLatency = 0;
+    const auto plain = renderPlayback(false, plainLatency);
+    const auto pipelined = renderPlayback(true, pipelinedLatency);
+    if (plain.empty() || pipelined.empty()) {
+        QSKIP("The worker threads cannot get real-time scheduling here");
+    }
+    QCOMPARE(plainLatency, 0u);
+    QCOMPARE(pipelinedLatency, FrameCount);
+
+    // The first block goes out before anything has been through the master, and every later one
+    // is the block the unpipelined engine put out before it: the latency that is reported.
+    const size_t shift = static_cast<size_t>(pipelinedLatency) * 2;
+    QCOMPARE(peakLevel({ pipelined.begin(), pipelined.begin() + static_cast<std::ptrdiff_t>(shift) }), 0.0);
+    compare({ plain.begin(), plain.end() - static_cast<std::ptrdiff_t>(shift) },
+            { pipelined.begin() + static_cast<std::ptrdiff_t>(shift), pipelined.end() });
+}
+
+void ParallelRenderTest::test_captureSlot_shouldPutOutThatDeviceAlone()
+{
+    // The Strings feed a reverb send, which the capture must leave out along with the other devices.
+    const auto strings = std::make_shared<StringEnsembleDevice>("Strings");
+    strings->processMidiNoteOn(64, 96);
+    compare(renderAlone(3, strings), render(true, true, false, false, 3));
+}
+
+void ParallelRenderTest::test_captureSlot_subMixerMember_shouldStillBeCaptured()
+{
+    // A member reaches the master only through its SubMixer, but a freeze is of the device itself.
+    const auto synth = std::make_shared<SynthDevice>("Synth");
+    synth->processMidiNoteOn(48, 100);
+    synth->processMidiNoteOn(55, 90);
+    compare(renderAlone(0, synth), render(true, true, false, false, 0));
+}
+
+void ParallelRenderTest::test_subMixerMember_sparseSlots_shouldBeHeardAsInDenseSlots()
+{
+    const auto sparse = renderSubMixerMember(Constants::deviceRackSize() - 100, Constants::deviceRackSize() - 1);
+    QVERIFY(std::ranges::any_of(sparse, [](double sample) { return std::abs(sample) > 1.0e-3; }));
+    compare(renderSubMixerMember(0, 1), sparse);
+}
+
+void ParallelRenderTest::test_frozenDevice_shouldSoundLikeTheDeviceItReplaces()
+{
+    // The sends are fed from the file too, so the reverb hears the Strings just as before.
+    compare(renderStrings(false, 1.0f), renderStrings(true, 1.0f), FrozenTolerance);
+}
+
+void ParallelRenderTest::test_frozenDevice_faderMoved_shouldFollowIt()
+{
+    // The file is captured ahead of the fader, so a fader moved since scales it exactly once.
+    compare(renderStrings(false, 0.4f), renderStrings(true, 0.4f), FrozenTolerance);
+}
+
+void ParallelRenderTest::test_frozenDevice_untilStarted_shouldStaySilent()
+{
+    const auto player = startFrozenStrings();
+    const auto strings = std::make_shared<StringEnsembleDevice>("Strings");
+    strings->processMidiNoteOn(64, 96);
+
+    AudioEngine engine;
+    engine.setDevice(3, strings);
+    engine.setFrozenDevicePlayer(3, player);
+    QCOMPARE(peakLevel(collect(engine)), 0.0);
+
+    // The song's first tick: the file runs from its start, however long it was held back.
+    engine.startFrozenDevicePlayers();
+    const auto started = collect(engine);
+    engine.clearFrozenDevicePlayers();
+    player->stop();
+    compare(render(true, true, false, false, 3), started, FrozenTolerance);
+}
+
+void ParallelRenderTest::test_renderAhead_shouldPlayWhatWasRenderedAhead()
+{
+    AudioEngine engine;
+    engine.sendEffectRack().setEffect(0, std::make_shared<Reverb>());
+    populate(engine, true);
+    const auto buffer = std::make_shared<RenderAheadBuffer>(SampleRate, static_cast<size_t>(BufferCount) * FrameCount);
+    engine.setRenderAheadBuffer(buffer);
+
+    std::vector<double> block(static_cast<size_t>(FrameCount) * 2, 0.0);
+    for (int i = 0; i < BufferCount; i++) {
+        std::fill(block.begin(), block.end(), 0.0);
+        AudioContext context { std::span(block.data(), block.size()), FrameCount, SampleRate };
+        engine.renderAhead(context);
+        QVERIFY(buffer->write(block, FrameCount));
+    }
+    buffer->start();
+
+    // Played back, the devices must not be rendered a second time, or the song would come out twice
+    // as far along as it should.
+    compare(render(true, true), collect(engine));
+    QCOMPARE(buffer->position(), static_cast<uint64_t>(BufferCount) * FrameCount);
+}
+
+void ParallelRenderTest::test_renderAhead_lateFrames_shouldBeSkipped()
+{
+    const auto rendered = render(true, true);
+
+    AudioEngine engine;
+    const auto buffer = std::make_shared<RenderAheadBuffer>(SampleRate, static_cast<size_t>(BufferCount) * FrameCount);
+    engine.setRenderAheadBuffer(buffer);
+
+    std::vector<double> block(static_cast<size_t>(FrameCount) * 2, 1.0);
+    AudioContext context { std::span(block.data(), block.size()), FrameCount, SampleRate };
+    // Not started yet, so the clock stands still.
+    engine.process(context);
+    QCOMPARE(buffer->position(), uint64_t { 0 });
+    QCOMPARE(peakLevel(block), 0.0);
+
+    buffer->start();
+    engine.process(context);
+    QCOMPARE(peakLevel(block), 0.0);
+
+    // The block that came too late is dropped, and the next one plays on time.
+    writeAhead(*buffer, rendered, 0, static_cast<size_t>(FrameCount) * 2);
+    engine.process(context);
+    const std::vector<double> expected(rendered.begin() + FrameCount * 2, rendered.begin() + FrameCount * 4);
+    compareExact(expected, block);
+    QCOMPARE(buffer->position(), static_cast<uint64_t>(FrameCount) * 2);
+}
+
+void ParallelRenderTest::test_renderAhead_takeOver_shouldKeepTime()
+{
+    const auto rendered = render(true, true);
+    const size_t totalFrames = static_cast<size_t>(BufferCount) * FrameCount;
+
+    AudioEngine engine;
+    const auto first = std::make_shared<RenderAheadBuffer>(SampleRate, totalFrames);
+    writeAhead(*first, rendered, 0, totalFrames);
+    first->start();
+    engine.setRenderAheadBuffer(first);
+
+    std::vector<double> played;
+    std::vector<double> block(static_cast<size_t>(FrameCount) * 2, 0.0);
+    const auto play = [&](int blockCount) {
+        for (int i = 0; i < blockCount; i++) {
+            AudioContext context { std::span(block.data(), block.size()), FrameCount, SampleRate };
+            engine.process(context);
+            played.insert(played.end(), block.begin(), block.end());
+        }
+    };
+    play(BufferCount / 4);
+
+    // A restart a little way past the playhead: the first render is heard up to it, then the second.
+    const size_t restartFrame = static_cast<size_t>(BufferCount / 2) * FrameCount;
+    const auto second = std::make_shared<RenderAheadBuffer>(SampleRate, totalFrames, restartFrame);
+    writeAhead(*second, rendered, restartFrame, totalFrames - restartFrame);
+    engine.setRenderAheadBuffer(second);
+    play(BufferCount - BufferCount / 4);
+
+    compareExact(rendered, played);
+}
+
+void ParallelRenderTest::test_renderAhead_finished_shouldHandOverToLiveAtABlockBoundary()
+{
+    AudioEngine engine;
+    engine.sendEffectRack().setEffect(0, std::make_shared<Reverb>());
+    populate(engine, true);
+    const auto buffer = std::make_shared<RenderAheadBuffer>(SampleRate, static_cast<size_t>(BufferCount) * FrameCount);
+    engine.setRenderAheadBuffer(buffer);
+
+    // The song ends half way: what was rendered plays out, then the devices go on live from where
+    // the render left them, with no notes cut off.
+    const int renderedBlocks = BufferCount / 2;
+    std::vector<double> block(static_cast<size_t>(FrameCount) * 2, 0.0);
+    for (int i = 0; i < renderedBlocks; i++) {
+        std::fill(block.begin(), block.end(), 0.0);
+        AudioContext context { std::span(block.data(), block.size()), FrameCount, SampleRate };
+        engine.renderAhead(context);
+        QVERIFY(buffer->write(block, FrameCount));
+    }
+    buffer->finish();
+    buffer->start();
+
+    compare(render(true, true), collect(engine));
+    QCOMPARE(buffer->position(), static_cast<uint64_t>(renderedBlocks) * FrameCount);
+}
+
+void ParallelRenderTest::test_renderAhead_muteWithFullBuffer_shouldBeHeardWithinTheMargin()
+{
+    const auto rendered = render(true, true);
+    std::vector<double> muted;
+    {
+        AudioEngine engine;
+        engine.sendEffectRack().setEffect(0, std::make_shared<Reverb>());
+        populate(engine, true);
+        engine.device(0)->setVolume(0.0f);
+        muted = collect(engine);
+    }
+    const size_t totalFrames = static_cast<size_t>(BufferCount) * FrameCount;
+    const size_t marginFrames = static_cast<size_t>(BufferCount / 8) * FrameCount;
+
+    // Rendered to the end, as far ahead as a restart ever finds it.
+    AudioEngine engine;
+    const auto full = std::make_shared<RenderAheadBuffer>(SampleRate, totalFrames);
+    writeAhead(*full, rendered, 0, totalFrames);
+    full->start();
+    engine.setRenderAheadBuffer(full);
+
+    std::vector<double> played;
+    std::vector<double> block(static_cast<size_t>(FrameCount) * 2, 0.0);
+    const auto play = [&](int blockCount) {
+        for (int i = 0; i < blockCount; i++) {
+            AudioContext context { std::span(block.data(), block.size()), FrameCount, SampleRate };
+            engine.process(context);
+            played.insert(played.end(), block.begin(), block.end());
+        }
+    };
+    play(BufferCount / 4);
+
+    // The mute restarts the render the margin past the playhead, and is heard from there on rather
+    // than once the rest of the full buffer has played.
+    const size_t restartFrame = static_cast<size_t>(full->position()) + marginFrames;
+    const auto restarted = std::make_shared<RenderAheadBuffer>(SampleRate, totalFrames, restartFrame);
+    writeAhead(*restarted, muted, restartFrame, totalFrames - restartFrame);
+    engine.setRenderAheadBuffer(restarted);
+    play(BufferCount - BufferCount / 4);
+
+    const auto split = static_cast<std::ptrdiff_t>(restartFrame * 2);
+    compareExact({ rendered.begin(), rendered.begin() + split }, { played.begin(), played.begin() + split });
+    compareExact({ muted.begin() + split, muted.end() }, { played.begin() + split, played.end() });
+    // And the mute is what made the difference there.
+    double difference = 0.0;
+    for (size_t i = restartFrame * 2; i < rendered.size(); i++) {
+        difference = std::max(difference, std::abs(rendered[i] - muted[i]));
+    }
+    QVERIFY(difference > 0.001);
+}
+
+void ParallelRenderTest::test_renderAhead_restartBeforeTakeOver_shouldKeepPlayingTheFirst()
+{
+    const auto rendered = render(true, true);
+    const size_t totalFrames = static_cast<size_t>(BufferCount) * FrameCount;
+    const size_t marginFrames = static_cast<size_t>(BufferCount / 8) * FrameCount;
+
+    AudioEngine engine;
+    const auto first = std::make_shared<RenderAheadBuffer>(SampleRate, totalFrames);
+    writeAhead(*first, rendered, 0, totalFrames);
+    first->start();
+    engine.setRenderAheadBuffer(first);
+
+    std::vector<double> played;
+    std::vector<double> block(static_cast<size_t>(FrameCount) * 2, 0.0);
+    const auto play = [&](int blockCount) {
+        for (int i = 0; i < blockCount; i++) {
+            AudioContext context { std::span(block.data(), block.size()), FrameCount, SampleRate };
+            engine.process(context);
+            played.insert(played.end(), block.begin(), block.end());
+        }
+    };
+    const auto restart = [&] {
+        const size_t restartFrame = static_cast<size_t>(played.size() / 2) + marginFrames;
+        const auto buffer = std::make_shared<RenderAheadBuffer>(SampleRate, totalFrames, restartFrame);
+        writeAhead(*buffer, rendered, restartFrame, totalFrames - restartFrame);
+        engine.setRenderAheadBuffer(buffer);
+    };
+    play(BufferCount / 4);
+    restart();
+    // A second change before playback reaches the first restart: the first render is still what
+    // plays up to there.
+    play(BufferCount / 16);
+    restart();
+    play(BufferCount - BufferCount / 4 - BufferCount / 16);
+
+    compareExact(rendered, played);
+}
+
+void ParallelRenderTest::test_renderAhead_takeOverBeforeStart_shouldWaitForStart()
+{
+    const auto rendered = render(true, true);
+    const size_t totalFrames = static_cast<size_t>(BufferCount) * FrameCount;
+
+    AudioEngine engine;
+    const auto first = std::make_shared<RenderAheadBuffer>(SampleRate, totalFrames);
+    engine.setRenderAheadBuffer(first);
+    const auto restarted = std::make_shared<RenderAheadBuffer>(SampleRate, totalFrames);
+    writeAhead(*restarted, rendered, 0, totalFrames);
+    engine.setRenderAheadBuffer(restarted);
+
+    // Restarted while priming: the song's clock has not started, so neither does the new render.
+    std::vector<double> block(static_cast<size_t>(FrameCount) * 2, 1.0);
+    AudioContext context { std::span(block.data(), block.size()), FrameCount, SampleRate };
+    engine.process(context);
+    QCOMPARE(peakLevel(block), 0.0);
+    QCOMPARE(restarted->position(), uint64_t { 0 });
+
+    restarted->start();
+    compareExact(rendered, collect(engine));
+}
+
 } // namespace noteahead
 
 QTEST_GUILESS_MAIN(noteahead::ParallelRenderTest)
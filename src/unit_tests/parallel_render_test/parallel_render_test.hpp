@@ -28,6 +28,24 @@ private slots:
     void test_realDevices_serialAndThreaded_shouldMatch();
     void test_subMixerAndSends_serialAndThreaded_shouldMatch();
     void test_threadedRender_repeated_shouldBeDeterministic();
+    void test_fixedOrderSumming_serialAndThreaded_shouldBeBitIdentical();
+    void test_fixedOrderSumming_shouldMatchLaneSumming();
+    void test_masterPipeline_offlineRender_shouldStayAligned();
+    void test_masterPipeline_withoutThreadedPlayback_shouldAddNoLatency();
+    void test_masterPipeline_threadedPlayback_shouldDelayByOneBlock();
+    void test_captureSlot_shouldPutOutThatDeviceAlone();
+    void test_captureSlot_subMixerMember_shouldStillBeCaptured();
+    void test_subMixerMember_sparseSlots_shouldBeHeardAsInDenseSlots();
+    void test_frozenDevice_shouldSoundLikeTheDeviceItReplaces();
+    void test_frozenDevice_faderMoved_shouldFollowIt();
+    void test_frozenDevice_untilStarted_shouldStaySilent();
+    void test_renderAhead_shouldPlayWhatWasRenderedAhead();
+    void test_renderAhead_lateFrames_shouldBeSkipped();
+    void test_renderAhead_takeOver_shouldKeepTime();
+    void test_renderAhead_finished_shouldHandOverToLiveAtABlockBoundary();
+    void test_renderAhead_muteWithFullBuffer_shouldBeHeardWithinTheMargin();
+    void test_renderAhead_restartBeforeTakeOver_shouldKeepPlayingTheFirst();
+    void test_renderAhead_takeOverBeforeStart_shouldWaitForStart();
 };
 
 } // namespace noteahead
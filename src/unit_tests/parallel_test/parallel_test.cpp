@@ -0,0 +1,87 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "parallel_test.hpp"
+#include "../../common/utils.hpp"
+
+#include <QTest>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace noteahead {
+
+void ParallelTest::test_run_shouldRunEveryIndexOnce()
+{
+    std::vector<std::atomic<int>> hits(1000);
+    Utils::Parallel::run(hits.size(), [&](size_t i) { hits.at(i)++; });
+
+    for (auto && hit : hits) {
+        QCOMPARE(hit.load(), 1);
+    }
+}
+
+void ParallelTest::test_run_noWork_shouldReturnAtOnce()
+{
+    bool called = false;
+    Utils::Parallel::run(0, [&](size_t) { called = true; }, [&](size_t) { called = true; });
+
+    QVERIFY(!called);
+}
+
+void ParallelTest::test_run_progress_shouldCountUpToAllOnTheCallingThread()
+{
+    const size_t count = 64;
+    const auto callingThread = std::this_thread::get_id();
+    std::vector<size_t> reported;
+    bool otherThread = false;
+    Utils::Parallel::run(count, [](size_t) { std::this_thread::sleep_for(std::chrono::microseconds { 100 }); }, [&](size_t done) {
+        otherThread = otherThread || std::this_thread::get_id() != callingThread;
+        reported.push_back(done);
+    });
+
+    QVERIFY(!otherThread);
+    QVERIFY(!reported.empty());
+    for (size_t i = 1; i < reported.size(); i++) {
+        QVERIFY(reported.at(i) > reported.at(i - 1));
+    }
+    QCOMPARE(reported.back(), count);
+}
+
+void ParallelTest::test_run_failingWork_shouldFinishTheRestAndRethrow()
+{
+    std::atomic<size_t> ran { 0 };
+    bool thrown = false;
+    try {
+        Utils::Parallel::run(100, [&](size_t i) {
+            ran++;
+            if (i == 10) {
+                throw std::runtime_error { "failed" };
+            }
+        });
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+
+    QVERIFY(thrown);
+    QCOMPARE(ran.load(), size_t { 100 });
+}
+
+} // namespace noteahead
+
+QTEST_GUILESS_MAIN(noteahead::ParallelTest)
@@ -28,6 +28,7 @@
 #include <numbers>
 #include <optional>
 #include <span>
+#include <thread>
 #include <vector>
 
 namespace noteahead {
@@ -509,6 +510,51 @@ void PianoSynthV2Test::test_polyphony_shouldSupportMultipleSimultaneousNotes()
              QString { "Three-note level (%1) not greater than one-note level (%2)" }.arg(rmsThree).arg(rmsOne).toUtf8().constData());
 }
 
+void PianoSynthV2Test::test_polyphony_forkedVoices_shouldMatchSerialRender()
+{
+    // Voices handed out to threads in reverse, all at once, must mix down exactly as they do
+    // rendered one after the other, including one released midway.
+    class ThreadFork final : public TaskFork
+    {
+    public:
+        void run(size_t count, void * context, Task task) override
+        {
+            std::vector<std::thread> threads;
+            for (size_t index = count; index-- > 0;) {
+                threads.emplace_back([=] { task(context, index); });
+            }
+            for (auto && thread : threads) {
+                thread.join();
+            }
+        }
+    };
+
+    const auto render = [](TaskFork * fork) {
+        PianoSynthV2Device piano { "Test Piano" };
+        for (const uint8_t note : { 48, 55, 60, 64, 67, 72 }) {
+            piano.processMidiNoteOn(note, 100);
+        }
+        std::vector<double> output;
+        std::vector<double> buffer(512, 0.0);
+        for (int block = 0; block < 64; block++) {
+            if (block == 16) {
+                piano.processMidiNoteOff(60);
+            }
+            std::ranges::fill(buffer, 0.0);
+            auto ctx = makeContext(buffer, 256, DefaultSampleRate);
+            ctx.fork = fork;
+            piano.processAudio(ctx);
+            output.insert(output.end(), buffer.begin(), buffer.end());
+        }
+        return output;
+    };
+
+    ThreadFork fork;
+    const auto serial = render(nullptr);
+    QVERIFY(peakLevel(serial) > 1e-3);
+    QVERIFY(render(&fork) == serial);
+}
+
 void PianoSynthV2Test::test_sustainPedal_shouldKeepNoteActiveAfterNoteOff()
 {
     PianoSynthV2Device piano { "Test Piano" };
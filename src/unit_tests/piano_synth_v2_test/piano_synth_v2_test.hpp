@@ -31,6 +31,7 @@ private slots:
     void test_midiNoteOn_shouldActivateAudio();
     void test_midiNoteOff_shouldDecayToSilence();
     void test_polyphony_shouldSupportMultipleSimultaneousNotes();
+    void test_polyphony_forkedVoices_shouldMatchSerialRender();
     void test_sustainPedal_shouldKeepNoteActiveAfterNoteOff();
     void test_sustainPedal_shouldReleaseNoteWhenPedalLifted();
     void test_allNotesOff_shouldSilenceAllVoices();
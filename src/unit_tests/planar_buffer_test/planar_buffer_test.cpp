@@ -0,0 +1,119 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "planar_buffer_test.hpp"
+
+#include "../../domain/dsp/planar_buffer.hpp"
+
+#include <QTest>
+
+#include <cstdint>
+#include <vector>
+
+namespace noteahead {
+
+namespace {
+
+bool isAligned(const float * data)
+{
+    return reinterpret_cast<uintptr_t>(data) % PlanarBuffer::Alignment == 0;
+}
+
+} // namespace
+
+void PlanarBufferTest::test_reserve_shouldAlignBothChannels()
+{
+    // An odd frame count is the case that would put the right channel off a cache line if the
+    // capacity were not rounded up.
+    PlanarBuffer buffer { 257 };
+
+    QVERIFY(buffer.capacity() >= 257);
+    QVERIFY(isAligned(buffer.left()));
+    QVERIFY(isAligned(buffer.right()));
+    QVERIFY(buffer.right() >= buffer.left() + 257);
+}
+
+void PlanarBufferTest::test_reserve_shouldOnlyGrow()
+{
+    PlanarBuffer buffer { 512 };
+    const float * left = buffer.left();
+
+    // The audio thread calls this every block; asking for less must not reallocate.
+    buffer.reserve(128);
+
+    QCOMPARE(buffer.left(), left);
+    QVERIFY(buffer.capacity() >= 512);
+}
+
+void PlanarBufferTest::test_clear_shouldZeroBothChannels()
+{
+    PlanarBuffer buffer { 64 };
+    for (size_t i = 0; i < 64; i++) {
+        buffer.left()[i] = 1.0f;
+        buffer.right()[i] = -1.0f;
+    }
+
+    buffer.clear(64);
+
+    for (size_t i = 0; i < 64; i++) {
+        QCOMPARE(buffer.left()[i], 0.0f);
+        QCOMPARE(buffer.right()[i], 0.0f);
+    }
+}
+
+void PlanarBufferTest::test_copyFromInterleaved_shouldSplitChannels()
+{
+    const std::vector<double> interleaved { 0.1, -0.1, 0.2, -0.2, 0.3, -0.3 };
+    PlanarBuffer buffer { 3 };
+
+    buffer.copyFromInterleaved(interleaved, 3);
+
+    QCOMPARE(buffer.left()[0], 0.1f);
+    QCOMPARE(buffer.left()[2], 0.3f);
+    QCOMPARE(buffer.right()[1], -0.2f);
+    QCOMPARE(buffer.right()[2], -0.3f);
+}
+
+void PlanarBufferTest::test_addToInterleaved_shouldAccumulate()
+{
+    PlanarBuffer buffer { 2 };
+    buffer.clear(2);
+    buffer.left()[0] = 0.5f;
+    buffer.right()[0] = -0.25f;
+    buffer.left()[1] = 0.125f;
+    std::vector<double> interleaved { 1.0, 1.0, 1.0, 1.0 };
+
+    buffer.addToInterleaved(interleaved, 2);
+
+    QCOMPARE(interleaved.at(0), 1.5);
+    QCOMPARE(interleaved.at(1), 0.75);
+    QCOMPARE(interleaved.at(2), 1.125);
+    QCOMPARE(interleaved.at(3), 1.0);
+}
+
+void PlanarBufferTest::test_move_shouldLeaveSourceEmpty()
+{
+    PlanarBuffer source { 128 };
+    const float * left = source.left();
+
+    const PlanarBuffer target { std::move(source) };
+
+    QCOMPARE(target.left(), left);
+    QCOMPARE(source.capacity(), size_t { 0 });
+}
+
+} // namespace noteahead
+
+QTEST_GUILESS_MAIN(noteahead::PlanarBufferTest)
@@ -0,0 +1,38 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef PLANAR_BUFFER_TEST_HPP
+#define PLANAR_BUFFER_TEST_HPP
+
+#include <QObject>
+
+namespace noteahead {
+
+class PlanarBufferTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void test_reserve_shouldAlignBothChannels();
+    void test_reserve_shouldOnlyGrow();
+    void test_clear_shouldZeroBothChannels();
+    void test_copyFromInterleaved_shouldSplitChannels();
+    void test_addToInterleaved_shouldAccumulate();
+    void test_move_shouldLeaveSourceEmpty();
+};
+
+} // namespace noteahead
+
+#endif // PLANAR_BUFFER_TEST_HPP
@@ -260,6 +260,41 @@ void PlayerWorkerTest::test_playback_shouldSendMidiEvents()
     QCOMPARE(midiService->stopNoteCallCount, 1);
 }
 
+void PlayerWorkerTest::test_playback_renderedAhead_shouldNotSendNotes()
+{
+    const auto midiService { std::make_shared<MockMidiService>() };
+    const auto mixerService { std::make_shared<MixerService>() };
+    TestablePlayerWorker worker { midiService, mixerService, nullptr };
+
+    mixerService->setTrackIndices({ 0 });
+    mixerService->setColumnIndices(0, { 0 });
+
+    const auto instrument { std::make_shared<Instrument>("TestPort") };
+    instrument->setMidiAddress(MidiAddress { "TestPort", 0 });
+
+    NoteData noteDataOn { 0, 0 };
+    noteDataOn.setAsNoteOn(64, 90);
+    Event eventOn { 0, noteDataOn };
+    eventOn.setInstrument(instrument);
+
+    NoteData noteDataOff { 0, 0 };
+    noteDataOff.setAsNoteOff(64);
+    Event eventOff { 10, noteDataOff };
+    eventOff.setInstrument(instrument);
+
+    // The render plays the notes, so the player does not.
+    worker.setIsRenderedAhead(true);
+    worker.test_handleEvent(eventOn);
+    worker.test_handleEvent(eventOff);
+    QCOMPARE(midiService->playNoteCallCount, 0);
+    QCOMPARE(midiService->stopNoteCallCount, 0);
+
+    // And does again once playback is back in the callback's hands.
+    worker.setIsRenderedAhead(false);
+    worker.test_handleEvent(eventOn);
+    QCOMPARE(midiService->playNoteCallCount, 1);
+}
+
 } // namespace noteahead
 
 QTEST_GUILESS_MAIN(noteahead::PlayerWorkerTest)
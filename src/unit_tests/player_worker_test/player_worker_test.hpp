@@ -30,6 +30,7 @@ private slots:
     void test_playback_shouldSendMidiEvents();
     void test_mixerChange_shouldStopNotes();
     void test_columnMute_shouldStopActiveNote();
+    void test_playback_renderedAhead_shouldNotSendNotes();
 };
 
 } // namespace noteahead
@@ -0,0 +1,52 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "random_service_test.hpp"
+
+#include "../../application/service/random_service.hpp"
+
+#include <QTest>
+
+namespace noteahead {
+
+void RandomServiceTest::test_scopedSeed_shouldDrawFromTheSeed()
+{
+    RandomService::Generator expected { 1234 };
+
+    const RandomService::ScopedSeed seed { 1234 };
+
+    QCOMPARE(RandomService::generator()(), expected());
+    QCOMPARE(RandomService::generator()(), expected());
+}
+
+void RandomServiceTest::test_scopedSeed_destroyed_shouldRestoreTheStateItFound()
+{
+    RandomService::seed(42);
+    RandomService::generator()();
+    auto expected = RandomService::generator();
+
+    {
+        const RandomService::ScopedSeed seed { 1234 };
+        RandomService::generator()();
+        RandomService::generator()();
+    }
+
+    QCOMPARE(RandomService::generator()(), expected());
+    QCOMPARE(RandomService::generator()(), expected());
+}
+
+} // namespace noteahead
+
+QTEST_GUILESS_MAIN(noteahead::RandomServiceTest)
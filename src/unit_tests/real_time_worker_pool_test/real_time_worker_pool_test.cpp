@@ -17,10 +17,13 @@
 #include "../../infra/audio/real_time_worker_pool.hpp"
 
 #include <QTest>
+
+#include <array>
 #include <chrono>
 #include <thread>
 
 #include <atomic>
+#include <utility>
 #include <vector>
 
 namespace noteahead {
@@ -43,6 +46,72 @@ struct CountingContext
     }
 };
 
+//! Records the order tasks finish in, and whether any started before what it depends on had finished.
+struct GraphContext
+{
+    const RealTimeWorkerPool::TaskGraph * graph {};
+    std::vector<std::atomic<int>> finishedAt;
+    std::atomic<int> clock { 0 };
+    std::atomic<int> violations { 0 };
+    std::atomic<int> callerThreadTasks { 0 };
+    size_t callerWorkerIndex {};
+
+    explicit GraphContext(const RealTimeWorkerPool::TaskGraph & graph_, size_t callerWorkerIndex_)
+      : graph { &graph_ }
+      , finishedAt(graph_.taskCount())
+      , callerWorkerIndex { callerWorkerIndex_ }
+    {
+        reset();
+    }
+
+    void reset()
+    {
+        for (auto & finished : finishedAt) {
+            finished.store(-1);
+        }
+    }
+};
+
+void graphTask(void * context, size_t taskIndex, size_t workerIndex)
+{
+    auto & graphContext = *static_cast<GraphContext *>(context);
+    const auto & graph = *graphContext.graph;
+    for (size_t task = 0; task < graph.taskCount(); task++) {
+        for (size_t index = graph.dependentOffsets[task]; index < graph.dependentOffsets[task + 1]; index++) {
+            if (graph.dependents[index] == taskIndex && graphContext.finishedAt[task].load() < 0) {
+                graphContext.violations.fetch_add(1);
+            }
+        }
+    }
+    if (workerIndex == graphContext.callerWorkerIndex) {
+        graphContext.callerThreadTasks.fetch_add(1);
+    }
+    graphContext.finishedAt[taskIndex].store(graphContext.clock.fetch_add(1));
+}
+
+//! Builds a graph from (task, dependency) pairs, with the roots in task order.
+RealTimeWorkerPool::TaskGraph makeGraph(size_t taskCount, const std::vector<std::pair<size_t, size_t>> & edges)
+{
+    RealTimeWorkerPool::TaskGraph graph;
+    graph.dependencyCounts.assign(taskCount, 0);
+    for (size_t task = 0; task < taskCount; task++) {
+        graph.dependentOffsets.push_back(graph.dependents.size());
+        for (auto && [dependent, dependency] : edges) {
+            if (dependency == task) {
+                graph.dependents.push_back(dependent);
+                graph.dependencyCounts[dependent]++;
+            }
+        }
+    }
+    graph.dependentOffsets.push_back(graph.dependents.size());
+    for (size_t task = 0; task < taskCount; task++) {
+        if (!graph.dependencyCounts[task]) {
+            graph.roots.push_back(task);
+        }
+    }
+    return graph;
+}
+
 void countTask(void * context, size_t taskIndex, size_t workerIndex)
 {
     auto & countingContext = *static_cast<CountingContext *>(context);
@@ -212,6 +281,195 @@ void RealTimeWorkerPoolTest::test_hasRealTimeScheduling_withoutPrivileges_should
     QVERIFY(realTime || !realTime);
 }
 
+void RealTimeWorkerPoolTest::test_runGraph_shouldRunEveryTaskAfterItsDependencies()
+{
+    // Two diamonds sharing a sink, and a few loners. Repeated so the stealing races get a chance.
+    const auto graph = makeGraph(12, { { 1, 0 }, { 2, 0 }, { 3, 1 }, { 3, 2 }, { 5, 4 }, { 6, 4 }, { 7, 5 }, { 7, 6 }, { 8, 3 }, { 8, 7 } });
+    RealTimeWorkerPool pool { 3 };
+    pool.reserveGraph(graph.taskCount());
+    GraphContext context { graph, 3 };
+
+    for (int i = 0; i < 2000; i++) {
+        context.reset();
+        pool.runGraph(graph, &context, graphTask);
+        for (size_t task = 0; task < graph.taskCount(); task++) {
+            QVERIFY(context.finishedAt[task].load() >= 0);
+        }
+    }
+
+    QCOMPARE(context.violations.load(), 0);
+    QCOMPARE(context.clock.load(), 2000 * 12);
+}
+
+void RealTimeWorkerPoolTest::test_runGraph_withoutWorkers_shouldRunOnCaller()
+{
+    const auto graph = makeGraph(4, { { 1, 0 }, { 2, 1 }, { 3, 1 } });
+    RealTimeWorkerPool pool { 0 };
+    pool.reserveGraph(graph.taskCount());
+    GraphContext context { graph, 0 };
+
+    pool.runGraph(graph, &context, graphTask);
+
+    QCOMPARE(context.violations.load(), 0);
+    QCOMPARE(context.callerThreadTasks.load(), 4);
+}
+
+void RealTimeWorkerPoolTest::test_runGraph_heavyRoot_shouldNotHoldBackIndependentChains()
+{
+    // Task 0 is heavy; 1 -> 2 -> 3 is a light chain beside it. Layered, the chain would wait for
+    // task 0 at every step. As a graph it is done long before task 0 is.
+    const auto graph = makeGraph(4, { { 2, 1 }, { 3, 2 } });
+    RealTimeWorkerPool pool { 1 };
+    pool.reserveGraph(graph.taskCount());
+
+    struct HeavyContext
+    {
+        std::atomic<bool> heavyDone { false };
+        std::atomic<int> chainDoneBeforeHeavy { 0 };
+    } context;
+
+    pool.runGraph(graph, &context, [](void * context, size_t taskIndex, size_t) {
+        auto & heavyContext = *static_cast<HeavyContext *>(context);
+        if (taskIndex == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds { 50 });
+            heavyContext.heavyDone.store(true);
+        } else if (!heavyContext.heavyDone.load()) {
+            heavyContext.chainDoneBeforeHeavy.fetch_add(1);
+        }
+    });
+
+    QCOMPARE(context.chainDoneBeforeHeavy.load(), 3);
+}
+
+void RealTimeWorkerPoolTest::test_runGraph_longTask_shouldWakeBlockedLanesForItsDependents()
+{
+    // Task 0 runs far longer than the idle lanes spin, so they block; its dependents then need them
+    // woken again. Each dependent waits for the others to start, so none can be left to the lane
+    // that ran task 0.
+    constexpr size_t DependentCount = 3;
+    const auto graph = makeGraph(DependentCount + 1, { { 1, 0 }, { 2, 0 }, { 3, 0 } });
+    RealTimeWorkerPool pool { DependentCount - 1 };
+    pool.reserveGraph(graph.taskCount());
+
+    struct LongContext
+    {
+        std::atomic<size_t> startedDependents { 0 };
+        std::atomic<bool> timedOut { false };
+    } context;
+
+    for (int i = 0; i < 5; i++) {
+        context.startedDependents.store(0);
+        QVERIFY(pool.runGraph(graph, &context, [](void * context, size_t taskIndex, size_t) {
+            auto & longContext = *static_cast<LongContext *>(context);
+            if (taskIndex == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds { 20 });
+                return;
+            }
+            longContext.startedDependents.fetch_add(1);
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds { 5 };
+            while (longContext.startedDependents.load() < DependentCount) {
+                if (std::chrono::steady_clock::now() > deadline) {
+                    longContext.timedOut.store(true);
+                    return;
+                }
+            }
+        }));
+    }
+
+    QVERIFY2(!context.timedOut.load(), "A blocked lane was not woken for a dependent");
+}
+
+void RealTimeWorkerPoolTest::test_runGraph_notReserved_shouldRunNothingAndReturnFalse()
+{
+    const auto graph = makeGraph(4, { { 1, 0 } });
+    RealTimeWorkerPool pool { 2 };
+    pool.reserveGraph(graph.taskCount() - 1);
+    GraphContext context { graph, 2 };
+
+    QVERIFY(!pool.runGraph(graph, &context, graphTask));
+    QCOMPARE(context.clock.load(), 0);
+
+    pool.reserveGraph(graph.taskCount());
+    QVERIFY(pool.runGraph(graph, &context, graphTask));
+    QCOMPARE(context.clock.load(), 4);
+}
+
+void RealTimeWorkerPoolTest::test_fork_fromGraphTask_shouldRunEverySubtaskOnceAcrossLanes()
+{
+    // Task 0 forks into subtasks, as a device does with its voices; the others finish at once and
+    // leave their lanes free to help.
+    constexpr size_t SubtaskCount = 16;
+    const auto graph = makeGraph(3, {});
+    RealTimeWorkerPool pool { 3 };
+    pool.reserveGraph(graph.taskCount());
+
+    struct ForkContext
+    {
+        RealTimeWorkerPool * pool { nullptr };
+        std::chrono::microseconds subtaskDuration { 0 };
+        std::array<std::atomic<int>, SubtaskCount> runs {};
+        std::array<std::atomic<size_t>, SubtaskCount> lanes {};
+        std::atomic<size_t> owningLane { 0 };
+    } context;
+    context.pool = &pool;
+
+    const auto run = [&] {
+        pool.runGraph(graph, &context, [](void * context, size_t taskIndex, size_t lane) {
+            auto & forkContext = *static_cast<ForkContext *>(context);
+            if (taskIndex != 0) {
+                return;
+            }
+            forkContext.owningLane.store(lane);
+            forkContext.pool->fork(lane, SubtaskCount, context, [](void * context, size_t subtaskIndex, size_t lane) {
+                auto & forkContext = *static_cast<ForkContext *>(context);
+                forkContext.runs[subtaskIndex].fetch_add(1);
+                forkContext.lanes[subtaskIndex].store(lane);
+                std::this_thread::sleep_for(forkContext.subtaskDuration);
+            });
+        });
+    };
+
+    for (int i = 0; i < 2000; i++) {
+        run();
+    }
+    for (auto && runs : context.runs) {
+        QCOMPARE(runs.load(), 2000);
+    }
+
+    // Long enough subtasks that the idle lanes cannot miss them.
+    context.subtaskDuration = std::chrono::microseconds { 500 };
+    run();
+    size_t helpedSubtasks = 0;
+    for (auto && lane : context.lanes) {
+        helpedSubtasks += lane.load() != context.owningLane.load();
+    }
+    QVERIFY(helpedSubtasks > 0);
+}
+
+void RealTimeWorkerPoolTest::test_fork_outsideGraph_shouldRunOnCaller()
+{
+    RealTimeWorkerPool pool { 2 };
+    const auto caller = std::this_thread::get_id();
+    std::vector<size_t> order;
+    bool onCaller = true;
+
+    struct ForkContext
+    {
+        std::vector<size_t> & order;
+        bool & onCaller;
+        std::thread::id caller;
+    } context { order, onCaller, caller };
+
+    pool.fork(0, 8, &context, [](void * context, size_t subtaskIndex, size_t) {
+        auto & forkContext = *static_cast<ForkContext *>(context);
+        forkContext.order.push_back(subtaskIndex);
+        forkContext.onCaller = forkContext.onCaller && std::this_thread::get_id() == forkContext.caller;
+    });
+
+    QVERIFY(onCaller);
+    QCOMPARE(order, (std::vector<size_t> { 0, 1, 2, 3, 4, 5, 6, 7 }));
+}
+
 } // namespace noteahead
 
 QTEST_GUILESS_MAIN(noteahead::RealTimeWorkerPoolTest)
@@ -33,6 +33,13 @@ private slots:
     void test_run_afterIdlePeriod_shouldWakeSleepingWorkers();
     void test_run_realisticCallbackDuration_shouldNotStall();
     void test_hasRealTimeScheduling_withoutPrivileges_shouldBeFalseNotFatal();
+    void test_runGraph_shouldRunEveryTaskAfterItsDependencies();
+    void test_runGraph_withoutWorkers_shouldRunOnCaller();
+    void test_runGraph_heavyRoot_shouldNotHoldBackIndependentChains();
+    void test_runGraph_longTask_shouldWakeBlockedLanesForItsDependents();
+    void test_runGraph_notReserved_shouldRunNothingAndReturnFalse();
+    void test_fork_fromGraphTask_shouldRunEverySubtaskOnceAcrossLanes();
+    void test_fork_outsideGraph_shouldRunOnCaller();
 };
 
 } // namespace noteahead
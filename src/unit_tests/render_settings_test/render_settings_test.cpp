@@ -49,6 +49,8 @@ void populate(RenderSettings & settings)
     settings.setSilenceSeconds(2);
     settings.setSilenceTenths(3);
     settings.setAnalyzeEnabled(false);
+    settings.setReproducibleEnabled(true);
+    settings.setRandomSeed(1234);
 }
 
 void verify(const RenderSettings & settings)
@@ -69,6 +71,8 @@ void verify(const RenderSettings & settings)
     QCOMPARE(settings.silenceSeconds(), 2);
     QCOMPARE(settings.silenceTenths(), 3);
     QCOMPARE(settings.analyzeEnabled(), false);
+    QCOMPARE(settings.reproducibleEnabled(), true);
+    QCOMPARE(settings.randomSeed(), 1234);
 }
 
 QByteArray serialize(const Metadata & metadata)
@@ -111,6 +115,8 @@ void RenderSettingsTest::test_defaults_shouldBeTheOnesANewSongStartsFrom()
     QCOMPARE(settings.trimEnabled(), false);
     QCOMPARE(settings.fadeOutEnabled(), false);
     QCOMPARE(settings.silenceEnabled(), false);
+    QCOMPARE(settings.reproducibleEnabled(), false);
+    QCOMPARE(settings.randomSeed(), 0);
 }
 
 void RenderSettingsTest::test_serialization_shouldRoundTripThroughMetadata()
@@ -616,6 +616,7 @@ void RenderingTest::test_render_shouldApplyTrackInstrumentSettings()
     QSignalSpy parameterSpy { synth.get(), &Device::parametersChanged };
 
     worker.render("dummy.wav", events, timing, 1, 44100);
+    deviceService->dispatchParameterChanges();
 
     // The settings reached the device...
     QVERIFY(parameterSpy.count() > 0);
@@ -697,6 +698,7 @@ void RenderingTest::test_render_midiSideChain_shouldProcessEventWhenSourceTrackI
 
     // Process only first tick where CC is expected
     worker.render("dummy.wav", events, timing, 1, 44100);
+    deviceService->dispatchParameterChanges();
 
     // The CC reached the device and drove its cutoff
     QVERIFY(parameterSpy.count() > 0);
@@ -980,8 +982,8 @@ void RenderingTest::test_render_shouldNormalizeAudio()
 
 namespace {
 
-//! Renders one note to the given path, with the loudness analysis on or off.
-void renderWithAnalysis(const QString & path, bool analyze)
+//! Renders one note to the given path with the given options.
+void renderOneNote(const QString & path, const RenderOptions & options)
 {
     const auto audioEngine = std::make_shared<AudioEngine>();
     const auto deviceService = std::make_shared<DeviceService>(audioEngine, std::make_shared<DataService>());
@@ -1014,9 +1016,30 @@ void renderWithAnalysis(const QString & path, bool analyze)
     timing.linesPerBeat = 4;
     timing.ticksPerLine = 6;
 
+    worker.render(path, events, timing, 48, 44100, options);
+}
+
+//! Renders one note to the given path, with the loudness analysis on or off.
+void renderWithAnalysis(const QString & path, bool analyze)
+{
     RenderOptions options;
     options.analyze = analyze;
-    worker.render(path, events, timing, 48, 44100, options);
+    renderOneNote(path, options);
+}
+
+//! Renders one note reproducibly and returns the hash written beside it.
+QString renderReproducibly(const QString & path)
+{
+    RenderOptions options;
+    options.analyze = false;
+    options.reproducible = true;
+    renderOneNote(path, options);
+
+    QFile hashFile { path + ".hash.txt" };
+    if (!hashFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return {};
+    }
+    return QString::fromUtf8(hashFile.readAll());
 }
 
 } // namespace
@@ -1058,6 +1081,31 @@ void RenderingTest::test_render_analysisDisabled_shouldWriteNoReport()
     QVERIFY(!QFileInfo::exists(path + ".loudness.txt"));
 }
 
+void RenderingTest::test_render_reproducible_shouldWriteTheSameHashEveryTime()
+{
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    // Each render starts from a fresh engine and fresh devices, as a run of the application would
+    const auto first = renderReproducibly(directory.filePath("song.flac"));
+    const auto second = renderReproducibly(directory.filePath("song.wav"));
+
+    QVERIFY(first.contains("SHA-256 of the rendered samples:"));
+    // The hash covers the samples, not the file, so the format makes no difference
+    QCOMPARE(first.section(':', -1), second.section(':', -1));
+}
+
+void RenderingTest::test_render_notReproducible_shouldWriteNoHash()
+{
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+    const auto path = directory.filePath("song.flac");
+
+    renderWithAnalysis(path, false);
+
+    QVERIFY(!QFileInfo::exists(path + ".hash.txt"));
+}
+
 } // namespace noteahead
 
 QTEST_GUILESS_MAIN(noteahead::RenderingTest)
@@ -32,6 +32,9 @@ private slots:
 
     void test_render_analysis_shouldWriteReportBesideTheRenderedFile();
     void test_render_analysisDisabled_shouldWriteNoReport();
+
+    void test_render_reproducible_shouldWriteTheSameHashEveryTime();
+    void test_render_notReproducible_shouldWriteNoHash();
 };
 
 } // namespace noteahead
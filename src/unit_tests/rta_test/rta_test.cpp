@@ -53,6 +53,7 @@ static void feedBuffer(Rta & rta, std::vector<double> & buf, uint32_t sampleRate
     ctx.frameCount = static_cast<uint32_t>(buf.size() / 2);
     ctx.sampleRate = sampleRate;
     rta.process(ctx);
+    rta.flushAnalysis();
 }
 
 void RtaTest::test_typeId_shouldReturnExpectedString()
@@ -16,6 +16,7 @@
 #include "sampler_test.hpp"
 #include "../../common/constants.hpp"
 #include "../../domain/devices/sampler_device.hpp"
+#include "../../domain/dsp/sinc_resampler.hpp"
 #include "../../domain/effects/effect_factory.hpp"
 #include "../../domain/effects/effect_rack.hpp"
 #include "../../domain/effects/reverb.hpp"
@@ -53,6 +54,13 @@ public:
 
     int64_t readFloat(std::span<float> data) override
     {
+        if (m_sineFrequency > 0.0) {
+            for (size_t i = 0; i < data.size(); i++) {
+                const auto frame = static_cast<double>(i / static_cast<size_t>(m_channels));
+                data[i] = static_cast<float>(0.5 * std::sin(2.0 * std::numbers::pi * m_sineFrequency * frame / m_sampleRate));
+            }
+            return data.size();
+        }
         std::fill(data.begin(), data.end(), 1.0f);
         return data.size();
     }
@@ -89,7 +97,7 @@ public:
 
     Info info() const override
     {
-        return { 1024, static_cast<int>(Constants::defaultSampleRate()), m_channels, 0 };
+        return { 1024, m_sampleRate, m_channels, 0 };
     }
 
     void setForceChannels(int channels)
@@ -97,10 +105,40 @@ public:
         m_channels = channels;
     }
 
+    void setForceSampleRate(int sampleRate)
+    {
+        m_sampleRate = sampleRate;
+    }
+
+    //! A sine instead of a constant, which any interpolation would leave as it is.
+    void setForceSine(double frequency)
+    {
+        m_sineFrequency = frequency;
+    }
+
 private:
     int m_channels = 2;
+    int m_sampleRate = static_cast<int>(Constants::defaultSampleRate());
+    double m_sineFrequency = 0.0;
 };
 
+//! What a mono sample file playing at unity pitch through a default pad should put out, given the
+//! data the voice reads and the step it reads it at.
+std::vector<double> expectedMonoPlayback(std::span<const float> data, double step, uint8_t oversampleFactor, uint32_t frameCount)
+{
+    SincResampler resampler;
+    resampler.setQuality(SincResampler::qualityForOversampleFactor(oversampleFactor));
+    std::vector<double> left(frameCount);
+    std::vector<double> right(frameCount);
+    double position = 0.0;
+    resampler.render(data, 1, position, step, left, right);
+    // Constant-power center pan
+    for (auto && sample : left) {
+        sample *= std::cos(std::numbers::pi * 0.25);
+    }
+    return left;
+}
+
 void SamplerTest::initTestCase()
 {
     EffectFactory::init(); // Cloning a pad's insert rack builds the effects through the factory
@@ -719,6 +757,68 @@ void SamplerTest::test_processAudio_shouldProduceOutput()
     QVERIFY(std::abs(buffer[1] - expected) < 1e-10);
 }
 
+void SamplerTest::test_loadSample_playedAtAnotherRate_shouldResampleTheFileOnce()
+{
+    constexpr int fileRate = 32000;
+    constexpr uint32_t engineRate = 44100;
+    constexpr uint32_t frameCount = 64;
+
+    auto mockReader = std::make_unique<MockAudioFileReader>();
+    mockReader->setForceChannels(1);
+    mockReader->setForceSampleRate(fileRate);
+    mockReader->setForceSine(1000.0);
+    SamplerDevice sampler { Constants::samplerDeviceName().toStdString(), std::move(mockReader) };
+    sampler.loadSample(60, "test.wav");
+
+    // Nothing has been played yet, so nothing may have been converted to a rate it only guessed.
+    const auto sample = sampler.sample(60);
+    QVERIFY(sample);
+    QVERIFY(sample->conversions.empty());
+    QCOMPARE(sample->sampleRate, fileRate);
+
+    sampler.processMidiNoteOn(60, 127);
+    std::vector<double> buffer(frameCount * 2, 0.0);
+    AudioContext context { std::span(buffer.data(), buffer.size()), frameCount, engineRate };
+    sampler.processAudio(context);
+
+    const auto expected = expectedMonoPlayback(*sample->data, static_cast<double>(fileRate) / engineRate, context.oversampleFactor, frameCount);
+    for (uint32_t i = 0; i < frameCount; i++) {
+        QVERIFY(std::abs(buffer[i * 2] - expected[i]) < 1e-9);
+        QVERIFY(std::abs(buffer[i * 2 + 1] - expected[i]) < 1e-9);
+    }
+}
+
+void SamplerTest::test_prepareSampleRate_shouldPlayTheConvertedFramesAsTheyAre()
+{
+    constexpr int fileRate = 32000;
+    constexpr uint32_t engineRate = 44100;
+    constexpr uint32_t frameCount = 64;
+
+    auto mockReader = std::make_unique<MockAudioFileReader>();
+    mockReader->setForceChannels(1);
+    mockReader->setForceSampleRate(fileRate);
+    mockReader->setForceSine(1000.0);
+    SamplerDevice sampler { Constants::samplerDeviceName().toStdString(), std::move(mockReader) };
+    sampler.loadSample(60, "test.wav");
+    sampler.prepareSampleRate(engineRate);
+
+    // Converted straight from the file, and kept alongside it.
+    const auto sample = sampler.sample(60);
+    QCOMPARE(sample->conversions.size(), size_t { 1 });
+    QCOMPARE(sample->conversions.at(0).sampleRate, static_cast<int>(engineRate));
+    QCOMPARE(*sample->conversions.at(0).data, SincResampler::convert(*sample->data, 1, fileRate, engineRate));
+
+    sampler.processMidiNoteOn(60, 127);
+    std::vector<double> buffer(frameCount * 2, 0.0);
+    AudioContext context { std::span(buffer.data(), buffer.size()), frameCount, engineRate };
+    sampler.processAudio(context);
+
+    const auto expected = expectedMonoPlayback(*sample->conversions.at(0).data, 1.0, context.oversampleFactor, frameCount);
+    for (uint32_t i = 0; i < frameCount; i++) {
+        QVERIFY(std::abs(buffer[i * 2] - expected[i]) < 1e-9);
+    }
+}
+
 void SamplerTest::test_serialization_shouldSaveAndLoadGain()
 {
     QByteArray data;
@@ -72,6 +72,8 @@ private slots:
     void test_startOffset_shouldShiftPlaybackStart();
     void test_reset_shouldResetParametersAndPads();
     void test_processAudio_shouldProduceOutput();
+    void test_loadSample_playedAtAnotherRate_shouldResampleTheFileOnce();
+    void test_prepareSampleRate_shouldPlayTheConvertedFramesAsTheyAre();
     void test_serialization_shouldSaveAndLoadGain();
     void test_midiCcResetGlobalPanAndVolume_shouldRestoreManualValues();
     void test_projectLoadMidiCcResetGlobal_shouldRestoreLoadedValues();
@@ -89,6 +89,7 @@ public:
 
     bool hasActiveAudio() const override
     {
+        m_activeAudioQueries++;
         return m_hasActiveAudio;
     }
 
@@ -97,12 +98,59 @@ public:
         m_hasActiveAudio = active;
     }
 
+    int activeAudioQueries() const
+    {
+        return m_activeAudioQueries;
+    }
+
 private:
     std::string m_name;
     bool m_generateSignal { false };
     bool m_hasActiveAudio { true };
+    mutable int m_activeAudioQueries { 0 };
+};
+
+//! Passes audio through and reports whatever tail it is told to.
+class TailEffect : public Effect
+{
+public:
+    std::string type() const override
+    {
+        return "test-tail";
+    }
+
+    std::string typeId() const override
+    {
+        return "test-tail-id";
+    }
+
+    void setRinging(bool ringing)
+    {
+        m_ringing = ringing;
+    }
+
+protected:
+    void processSample(double &, double &) override
+    {
+    }
+
+    TailState ownTailState() const override
+    {
+        return m_ringing ? TailState::Ringing : TailState::Silent;
+    }
+
+private:
+    bool m_ringing { false };
 };
 
+std::vector<double> renderBlock(AudioEngine & engine)
+{
+    std::vector<double> buffer(128, 0.0);
+    AudioContext context { std::span(buffer.data(), 128), 64, 44100 };
+    engine.process(context);
+    return buffer;
+}
+
 void SideChainAudioTest::test_audioEngine_idleDevice_shouldLetItsMetersFallBack()
 {
     // The engine skips a device that has gone silent. It still has to report that silence, or the
@@ -141,6 +189,98 @@ void SideChainAudioTest::test_audioEngine_idleDevice_shouldLetItsMetersFallBack(
     QVERIFY2(device->loadMeter().loadPercent() < 1.0f, qPrintable(QString::number(device->loadMeter().loadPercent())));
 }
 
+void SideChainAudioTest::test_audioEngine_silentDevice_shouldSleepWithoutBeingAskedAboutItsVoices()
+{
+    AudioEngine engine;
+    const auto device = std::make_shared<MockDevice>("Device");
+    device->setHasActiveAudio(false);
+    engine.setDevice(0, device);
+
+    renderBlock(engine);
+    QVERIFY(device->lifecycle() == Device::Lifecycle::Asleep);
+
+    // Asleep is what makes an idle device free: the engine no longer even takes its lock to ask.
+    const auto queries = device->activeAudioQueries();
+    for (int i = 0; i < 10; i++) {
+        renderBlock(engine);
+    }
+    QCOMPARE(device->activeAudioQueries(), queries);
+    QVERIFY(device->lifecycle() == Device::Lifecycle::Asleep);
+}
+
+void SideChainAudioTest::test_audioEngine_asleepDevice_woken_shouldPlayInTheNextBlock()
+{
+    AudioEngine engine;
+    const auto device = std::make_shared<MockDevice>("Device");
+    device->setHasActiveAudio(false);
+    engine.setDevice(0, device);
+    renderBlock(engine);
+    QVERIFY(device->lifecycle() == Device::Lifecycle::Asleep);
+
+    // Starting a voice without waking the device is not heard: nothing looks at a sleeping device.
+    device->setGenerateSignal(true);
+    device->setHasActiveAudio(true);
+    QCOMPARE(renderBlock(engine)[0], 0.0);
+
+    // Waking it, as every note-on does, is.
+    device->wake();
+    QVERIFY(renderBlock(engine)[0] != 0.0);
+    QVERIFY(device->lifecycle() == Device::Lifecycle::Active);
+}
+
+void SideChainAudioTest::test_audioEngine_asleepDevice_sidechainSourcePlays_shouldWakeIt()
+{
+    AudioEngine engine;
+    const auto source = std::make_shared<MockDevice>("Source");
+    source->setHasActiveAudio(false);
+    const auto target = std::make_shared<MockDevice>("Target");
+    target->setHasActiveAudio(false);
+    const auto compressor = std::make_shared<Compressor>();
+    if (const auto p = compressor->parameter(Constants::NahdXml::xmlKeySideChainSourceDevice().toStdString()); p) {
+        p->get().setValue(0.0f);
+        compressor->sync();
+    }
+    target->insertEffectRack().setEffect(0, compressor);
+    engine.setDevice(0, source);
+    engine.setDevice(1, target);
+    renderBlock(engine);
+    QVERIFY(target->lifecycle() == Device::Lifecycle::Asleep);
+
+    // Only the source is woken. The device keyed from it has to be rendered in the same block.
+    const auto queries = target->activeAudioQueries();
+    source->setGenerateSignal(true);
+    source->setHasActiveAudio(true);
+    source->wake();
+    renderBlock(engine);
+    QVERIFY(target->activeAudioQueries() > queries);
+}
+
+void SideChainAudioTest::test_audioEngine_stoppedDevice_ringingInserts_shouldTailUntilTheyAreDone()
+{
+    AudioEngine engine;
+    const auto device = std::make_shared<MockDevice>("Device");
+    const auto tail = std::make_shared<TailEffect>();
+    device->insertEffectRack().setEffect(0, tail);
+    engine.setDevice(0, device);
+
+    device->setGenerateSignal(true);
+    renderBlock(engine);
+    QVERIFY(device->lifecycle() == Device::Lifecycle::Active);
+
+    // The voices stop, but the inserts still hold something: the device has to keep running them.
+    device->setGenerateSignal(false);
+    device->setHasActiveAudio(false);
+    tail->setRinging(true);
+    renderBlock(engine);
+    renderBlock(engine);
+    QVERIFY(device->lifecycle() == Device::Lifecycle::Tailing);
+
+    // Once they say they are done, it sleeps.
+    tail->setRinging(false);
+    renderBlock(engine);
+    QVERIFY(device->lifecycle() == Device::Lifecycle::Asleep);
+}
+
 void SideChainAudioTest::test_audioEngine_rebuildProcessingGraph_shouldCorrectlySortIndependentDevices()
 {
     AudioEngine engine;
@@ -26,6 +26,10 @@ class SideChainAudioTest : public QObject
 
 private slots:
     void test_audioEngine_idleDevice_shouldLetItsMetersFallBack();
+    void test_audioEngine_silentDevice_shouldSleepWithoutBeingAskedAboutItsVoices();
+    void test_audioEngine_asleepDevice_woken_shouldPlayInTheNextBlock();
+    void test_audioEngine_asleepDevice_sidechainSourcePlays_shouldWakeIt();
+    void test_audioEngine_stoppedDevice_ringingInserts_shouldTailUntilTheyAreDone();
     void test_audioEngine_rebuildProcessingGraph_shouldCorrectlySortIndependentDevices();
     void test_audioEngine_rebuildProcessingGraph_shouldCorrectlySortDependentDevices();
     void test_audioEngine_process_runtimeSidechainChange_shouldRebuildGraph();
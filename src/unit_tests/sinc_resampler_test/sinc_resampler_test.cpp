@@ -0,0 +1,166 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "sinc_resampler_test.hpp"
+
+#include "../../domain/dsp/sinc_resampler.hpp"
+
+#include <QTest>
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+namespace noteahead {
+
+namespace {
+
+//! An interleaved stereo sine, @p frequency given as a fraction of the sample rate.
+std::vector<float> stereoSine(size_t frames, double frequency)
+{
+    std::vector<float> data(frames * 2);
+    for (size_t i = 0; i < frames; i++) {
+        const auto value = static_cast<float>(0.5 * std::sin(2.0 * std::numbers::pi * frequency * static_cast<double>(i)));
+        data[i * 2] = value;
+        data[i * 2 + 1] = -value;
+    }
+    return data;
+}
+
+double rms(const std::vector<double> & values, size_t from, size_t to)
+{
+    double sum = 0.0;
+    for (size_t i = from; i < to; i++) {
+        sum += values[i] * values[i];
+    }
+    return std::sqrt(sum / static_cast<double>(to - from));
+}
+
+} // namespace
+
+void SincResamplerTest::test_qualityForOversampleFactor_shouldFollowTheFactor()
+{
+    QCOMPARE(SincResampler::qualityForOversampleFactor(1), SincResampler::Quality::Draft);
+    QCOMPARE(SincResampler::qualityForOversampleFactor(2), SincResampler::Quality::Standard);
+    QCOMPARE(SincResampler::qualityForOversampleFactor(4), SincResampler::Quality::High);
+    QCOMPARE(SincResampler::tapCount(SincResampler::Quality::Draft), size_t { 8 });
+    QCOMPARE(SincResampler::tapCount(SincResampler::Quality::High), size_t { 32 });
+}
+
+void SincResamplerTest::test_render_unityStep_shouldCopyTheSource()
+{
+    const auto source = stereoSine(256, 0.37);
+    SincResampler resampler { SincResampler::Quality::High };
+
+    std::vector<double> left(64);
+    std::vector<double> right(64);
+    double position = 10.0;
+    QCOMPARE(resampler.render(source, 2, position, 1.0, left, right), size_t { 64 });
+    QCOMPARE(position, 74.0);
+
+    for (size_t i = 0; i < 64; i++) {
+        QCOMPARE(left[i], static_cast<double>(source[(10 + i) * 2]));
+        QCOMPARE(right[i], static_cast<double>(source[(10 + i) * 2 + 1]));
+    }
+}
+
+void SincResamplerTest::test_render_halfFrame_shouldInterpolateASine()
+{
+    // A tenth of the rate, where linear interpolation is already off by about 5 % of full scale.
+    // Even the 8-tap kernel has to land an order of magnitude closer.
+    constexpr double frequency = 0.1;
+    const auto source = stereoSine(512, frequency);
+
+    for (auto && quality : { SincResampler::Quality::Draft, SincResampler::Quality::Standard, SincResampler::Quality::High }) {
+        SincResampler resampler { quality };
+        std::vector<double> left(100);
+        std::vector<double> right(100);
+        double position = 200.5;
+        resampler.render(source, 2, position, 1.0, left, right);
+
+        for (size_t i = 0; i < left.size(); i++) {
+            const double expected = 0.5 * std::sin(2.0 * std::numbers::pi * frequency * (200.5 + static_cast<double>(i)));
+            QVERIFY(std::abs(left[i] - expected) < 3.0e-3);
+            QVERIFY(std::abs(right[i] + expected) < 3.0e-3);
+        }
+    }
+}
+
+void SincResamplerTest::test_render_pitchUp_shouldNotFoldHighFrequenciesBackDown()
+{
+    // Read an octave up, a sine at 0.4 of the rate lands at 0.8, far past the new Nyquist. Linear
+    // interpolation plays it back at nearly full level, aliased down to 0.2.
+    const auto source = stereoSine(8192, 0.4);
+    SincResampler resampler { SincResampler::Quality::High };
+
+    std::vector<double> left(2048);
+    std::vector<double> right(2048);
+    double position = 100.0;
+    QCOMPARE(resampler.render(source, 2, position, 2.0, left, right), left.size());
+
+    QVERIFY(rms(left, 64, left.size()) < 0.005);
+}
+
+void SincResamplerTest::test_render_endOfSource_shouldStopEarly()
+{
+    const auto source = stereoSine(100, 0.05);
+    SincResampler resampler;
+
+    std::vector<double> left(64);
+    std::vector<double> right(64);
+    double position = 50.25;
+    const auto written = resampler.render(source, 2, position, 1.0, left, right);
+
+    // The last frame that still has one after it is 98.
+    QCOMPARE(written, size_t { 49 });
+    QVERIFY(position >= 99.0);
+}
+
+void SincResamplerTest::test_render_mono_shouldFillBothChannels()
+{
+    std::vector<float> source(128);
+    for (size_t i = 0; i < source.size(); i++) {
+        source[i] = static_cast<float>(std::sin(0.2 * static_cast<double>(i)));
+    }
+    SincResampler resampler;
+
+    std::vector<double> left(16);
+    std::vector<double> right(16);
+    double position = 20.3;
+    QCOMPARE(resampler.render(source, 1, position, 0.75, left, right), size_t { 16 });
+    QCOMPARE(left, right);
+}
+
+void SincResamplerTest::test_convert_shouldPreserveASineAtTheNewRate()
+{
+    constexpr double fromRate = 44100.0;
+    constexpr double toRate = 48000.0;
+    constexpr double hz = 1000.0;
+    const auto source = stereoSine(44100, hz / fromRate);
+
+    const auto converted = SincResampler::convert(source, 2, fromRate, toRate);
+    QCOMPARE(converted.size() / 2, size_t { 47999 });
+
+    // Away from the edges, where the kernel reads past the ends of the source.
+    for (size_t i = 100; i < converted.size() / 2 - 100; i++) {
+        const double expected = 0.5 * std::sin(2.0 * std::numbers::pi * hz * static_cast<double>(i) / toRate);
+        QVERIFY(std::abs(converted[i * 2] - expected) < 1.0e-3);
+        QVERIFY(std::abs(converted[i * 2 + 1] + expected) < 1.0e-3);
+    }
+}
+
+} // namespace noteahead
+
+QTEST_GUILESS_MAIN(noteahead::SincResamplerTest)
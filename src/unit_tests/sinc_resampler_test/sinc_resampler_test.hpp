@@ -0,0 +1,39 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef SINC_RESAMPLER_TEST_HPP
+#define SINC_RESAMPLER_TEST_HPP
+
+#include <QObject>
+
+namespace noteahead {
+
+class SincResamplerTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void test_qualityForOversampleFactor_shouldFollowTheFactor();
+    void test_render_unityStep_shouldCopyTheSource();
+    void test_render_halfFrame_shouldInterpolateASine();
+    void test_render_pitchUp_shouldNotFoldHighFrequenciesBackDown();
+    void test_render_endOfSource_shouldStopEarly();
+    void test_render_mono_shouldFillBothChannels();
+    void test_convert_shouldPreserveASineAtTheNewRate();
+};
+
+} // namespace noteahead
+
+#endif // SINC_RESAMPLER_TEST_HPP
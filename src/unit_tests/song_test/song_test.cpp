@@ -223,6 +223,39 @@ void SongTest::test_prevNoteDataOnSameColumn_noteOff_shouldFindNoteData()
     QCOMPARE(prevPosition, notePosition);
 }
 
+void SongTest::test_noteDataAtPosition_lineCountIncreased_shouldKeepNoteAndHandle()
+{
+    // A column keeps its lines in a single block, which growing the pattern replaces
+    Song song;
+    const Position notePosition = { 0, 1, 0, 8, 0 };
+    const auto noteData = song.noteDataAtPosition(notePosition);
+    noteData->setAsNoteOn(60, 100);
+
+    song.setLineCount(0, song.lineCount(0) * 4);
+
+    QCOMPARE(song.noteDataAtPosition(notePosition)->note(), 60);
+    QCOMPARE(song.noteDataAtPosition({ 0, 1, 0, song.lineCount(0) - 1, 0 })->type(), NoteData::Type::None);
+    // The handle taken before still points at a live note rather than at freed memory
+    QCOMPARE(noteData->note(), 60);
+}
+
+void SongTest::test_noteDataAtPosition_lineCountIncreased_shouldDetachOldHandle()
+{
+    // What the old block's handles write is no longer the column's, so callers take them again
+    Song song;
+    const Position notePosition = { 0, 1, 0, 8, 0 };
+    const auto staleNoteData = song.noteDataAtPosition(notePosition);
+
+    song.setLineCount(0, song.lineCount(0) * 4);
+
+    staleNoteData->setAsNoteOn(60, 100);
+    QCOMPARE(song.noteDataAtPosition(notePosition)->type(), NoteData::Type::None);
+
+    song.noteDataAtPosition(notePosition)->setAsNoteOn(62, 100);
+    QCOMPARE(song.noteDataAtPosition(notePosition)->note(), 62);
+    QCOMPARE(staleNoteData->note(), 60);
+}
+
 void SongTest::test_renderToEvents_clockEvents_shouldRenderClockEvents()
 {
     Song song;
@@ -1590,6 +1623,38 @@ void SongTest::test_transposeSong_drumTrackSet_shouldNotTransposeDrumTrack()
     QCOMPARE(it1->newNoteData.note().value(), 61);
 }
 
+void SongTest::test_applyNoteChanges_manyPatterns_shouldApplyAndRevertAllChanges()
+{
+    Song song;
+    for (size_t patternIndex = 1; patternIndex < 16; patternIndex++) {
+        song.createPattern(patternIndex);
+    }
+
+    // Enough changes to be split over threads
+    NoteChangeList changes;
+    for (size_t patternIndex = 0; patternIndex < 16; patternIndex++) {
+        for (auto && trackIndex : song.trackIndices()) {
+            for (size_t line = 0; line < song.lineCount(patternIndex); line++) {
+                const Position position = { patternIndex, trackIndex, 0, line, 0 };
+                NoteData noteData { trackIndex, 0 };
+                noteData.setAsNoteOn(static_cast<uint8_t>(60 + line % 12), 100);
+                changes.emplace_back(position, *song.noteDataAtPosition(position), noteData);
+            }
+        }
+    }
+    QVERIFY(changes.size() > 4096);
+
+    song.applyNoteChanges(changes);
+    QVERIFY(std::ranges::all_of(changes, [&](auto && change) {
+        return song.noteDataAtPosition(change.position)->note() == change.newNoteData.note();
+    }));
+
+    song.applyNoteChanges(changes, true);
+    QVERIFY(std::ranges::all_of(changes, [&](auto && change) {
+        return song.noteDataAtPosition(change.position)->type() == NoteData::Type::None;
+    }));
+}
+
 void SongTest::test_duration_skippedPattern_shouldReturnCorrectDuration()
 {
     Song song;
@@ -43,6 +43,9 @@ private slots:
     void test_prevNoteDataOnSameColumn_noteOn_shouldFindNoteData();
     void test_prevNoteDataOnSameColumn_noteOff_shouldFindNoteData();
 
+    void test_noteDataAtPosition_lineCountIncreased_shouldKeepNoteAndHandle();
+    void test_noteDataAtPosition_lineCountIncreased_shouldDetachOldHandle();
+
     void test_renderToEvents_clockEvents_shouldRenderClockEvents();
     void test_renderToEvents_positiveDelaySet_shouldApplyDelay();
     void test_renderToEvents_negativeDelaySet_shouldApplyShiftedDelay();
@@ -107,6 +110,8 @@ private slots:
     void test_transposePattern_drumTrackSet_shouldNotTransposeDrumTrack();
     void test_transposeSong_drumTrackSet_shouldNotTransposeDrumTrack();
 
+    void test_applyNoteChanges_manyPatterns_shouldApplyAndRevertAllChanges();
+
     void test_duration_skippedPattern_shouldReturnCorrectDuration();
 
     void test_deleteUnusedPatterns_shouldRemoveUnusedPatterns();
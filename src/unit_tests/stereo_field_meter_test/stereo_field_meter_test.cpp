@@ -38,7 +38,7 @@ constexpr int frameCount = 96000;
 using Generator = std::function<void(int, double &, double &)>;
 
 //! Drives the meter the way the mixer does, a block at a time: the readings are published per
-//! block, so nothing is measurable until whole blocks have gone through.
+//! analysed block, so nothing is measurable until whole blocks have gone through.
 void run(StereoFieldMeter & meter, const Generator & generator, int frames = frameCount)
 {
     constexpr uint32_t blockFrames = 512;
@@ -62,6 +62,9 @@ void run(StereoFieldMeter & meter, const Generator & generator, int frames = fra
 
         i += static_cast<int>(count);
     }
+
+    // The meter only captures on the audio thread; measure what it captured before reading it.
+    meter.flushAnalysis();
 }
 
 std::unique_ptr<StereoFieldMeter> makeMeter()
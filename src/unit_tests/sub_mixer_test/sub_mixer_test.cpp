@@ -121,6 +121,36 @@ public:
     }
 };
 
+//! A ToneDevice that stops and starts the way a note stops and starts a voice.
+class GatedToneDevice : public ToneDevice
+{
+public:
+    using ToneDevice::ToneDevice;
+
+    void processAudio(AudioContext & context) override
+    {
+        if (m_playing) {
+            ToneDevice::processAudio(context);
+        }
+    }
+
+    bool hasActiveAudio() const override
+    {
+        return m_playing;
+    }
+
+    void setPlaying(bool playing)
+    {
+        m_playing = playing;
+        if (playing) {
+            wake();
+        }
+    }
+
+private:
+    bool m_playing { false };
+};
+
 std::shared_ptr<SubMixerDevice> makeSubMixer(const std::string & name)
 {
     return std::make_shared<SubMixerDevice>(name);
@@ -195,6 +225,46 @@ void SubMixerTest::test_subMixer_members_shouldRenderBeforeSubMixer()
     QVERIFY(std::abs(renderFirstSample(engine) - 0.5 * CenterPanGain) < 1.0e-9);
 }
 
+void SubMixerTest::test_subMixer_asleep_memberStartsPlaying_shouldWakeIt()
+{
+    AudioEngine engine;
+    const auto member = std::make_shared<GatedToneDevice>("A", 0.25);
+    engine.setDevice(0, member);
+    auto subMixer = makeSubMixer("Sub");
+    subMixer->setMembers({ 0 });
+    engine.setDevice(1, subMixer);
+
+    QCOMPARE(renderFirstSample(engine), 0.0);
+    QVERIFY(member->lifecycle() == Device::Lifecycle::Asleep);
+    QVERIFY(subMixer->lifecycle() == Device::Lifecycle::Asleep);
+
+    // Only the member is woken, as a note-on would wake it. The SubMixer has to follow within the
+    // same block, or the first block of every note played into a group would be lost.
+    member->setPlaying(true);
+    QVERIFY(std::abs(renderFirstSample(engine) - 0.25 * CenterPanGain) < 1.0e-9);
+    QVERIFY(subMixer->lifecycle() != Device::Lifecycle::Asleep);
+}
+
+void SubMixerTest::test_subMixer_hasActiveAudio_shouldFollowMembers()
+{
+    AudioEngine engine;
+    const auto member = std::make_shared<GatedToneDevice>("A", 0.25);
+    engine.setDevice(0, member);
+    auto subMixer = makeSubMixer("Sub");
+    subMixer->setMembers({ 0 });
+    engine.setDevice(1, subMixer);
+
+    member->setPlaying(true);
+    renderFirstSample(engine);
+    QVERIFY(subMixer->hasActiveAudio());
+    QVERIFY(subMixer->lifecycle() == Device::Lifecycle::Active);
+
+    member->setPlaying(false);
+    renderFirstSample(engine);
+    QVERIFY(!subMixer->hasActiveAudio());
+    QVERIFY(subMixer->lifecycle() == Device::Lifecycle::Asleep);
+}
+
 void SubMixerTest::test_subMixer_insertEffects_shouldApplyToWholeGroup()
 {
     AudioEngine engine;
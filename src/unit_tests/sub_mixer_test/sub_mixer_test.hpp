@@ -29,6 +29,8 @@ private slots:
     void test_subMixer_members_shouldSumMemberOutput();
     void test_subMixer_members_shouldNotReachMasterDirectly();
     void test_subMixer_members_shouldRenderBeforeSubMixer();
+    void test_subMixer_asleep_memberStartsPlaying_shouldWakeIt();
+    void test_subMixer_hasActiveAudio_shouldFollowMembers();
     void test_subMixer_insertEffects_shouldApplyToWholeGroup();
     void test_subMixer_nested_shouldSumThroughChain();
     void test_subMixer_nonMember_shouldStillReachMasterDirectly();
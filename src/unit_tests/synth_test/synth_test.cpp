@@ -19,6 +19,7 @@
 #include "../../common/utils.hpp"
 #include "../../domain/devices/synth_device.hpp"
 #include "../../domain/devices/synth_presets.hpp"
+#include "../../domain/dsp/planar_buffer.hpp"
 #include "../../infra/xml/nahd_xml_reader.hpp"
 #include "../../infra/xml/nahd_xml_writer.hpp"
 
@@ -1421,6 +1422,19 @@ void SynthTest::test_midiCcModWheel_shouldOverrideLfoIntensity()
     QCOMPARE(synth.lfoInt(), 64.0f / 127.0f);
 }
 
+void SynthTest::test_midiCcAndPitchBend_shouldWakeDevice()
+{
+    // A sleeping device is not rendered, so whatever a controller moves would go unheard.
+    SynthDevice synth { "Test Synth" };
+    QVERIFY(!synth.takeWake());
+
+    synth.processMidiCc(1, 127, 0);
+    QVERIFY(synth.takeWake());
+
+    synth.processMidiPitchBend(12000, 0);
+    QVERIFY(synth.takeWake());
+}
+
 void SynthTest::test_midiCcModWheelReset_shouldRestoreLfoIntensity()
 {
     SynthDevice synth { "Test Synth" };
@@ -2332,6 +2346,47 @@ void SynthTest::test_modCurve_serialization_shouldPreserveState()
     }
 }
 
+void SynthTest::test_planarAudio_shouldMatchInterleavedOutput()
+{
+    // The engine hands a planar-capable device float channels instead of the interleaved buffer.
+    // Which one it writes must not change what it plays beyond the float rounding of the output.
+    SynthDevice interleavedSynth { "Test Synth" };
+    SynthDevice planarSynth { "Test Synth" };
+    QVERIFY(planarSynth.supportsPlanarAudio());
+    for (auto synth : { &interleavedSynth, &planarSynth }) {
+        synth->setVoiceMode(SynthDevice::VoiceMode::Supersaw);
+        synth->processMidiNoteOn(60, 100);
+        synth->processMidiNoteOn(67, 90);
+    }
+
+    constexpr uint32_t frameCount = 512;
+    std::vector<double> interleaved(frameCount * 2);
+    std::vector<double> planarUnused(frameCount * 2);
+    PlanarBuffer planar { frameCount };
+    const auto sampleRate = static_cast<uint32_t>(Constants::defaultSampleRate());
+
+    double peak = 0.0;
+    for (int block = 0; block < 8; block++) {
+        std::ranges::fill(interleaved, 0.0);
+        AudioContext interleavedContext { std::span(interleaved), frameCount, sampleRate };
+        interleavedSynth.processAudio(interleavedContext);
+
+        planar.clear(frameCount);
+        AudioContext planarContext { std::span(planarUnused), frameCount, sampleRate };
+        planarContext.left = planar.left();
+        planarContext.right = planar.right();
+        planarSynth.processAudio(planarContext);
+
+        QVERIFY(std::ranges::all_of(planarUnused, [](double sample) { return sample == 0.0; }));
+        for (uint32_t i = 0; i < frameCount; i++) {
+            QVERIFY(std::abs(interleaved[i * 2] - static_cast<double>(planar.left()[i])) < 1.0e-6);
+            QVERIFY(std::abs(interleaved[i * 2 + 1] - static_cast<double>(planar.right()[i])) < 1.0e-6);
+            peak = std::max(peak, std::abs(interleaved[i * 2]));
+        }
+    }
+    QVERIFY(peak > 0.01);
+}
+
 } // namespace noteahead
 
 QTEST_GUILESS_MAIN(noteahead::SynthTest)
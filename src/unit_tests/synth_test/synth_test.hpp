@@ -75,6 +75,7 @@ private slots:
     void test_saveState_restore_shouldRestoreManualValues();
     void test_midiCcModWheel_shouldOverrideLfoIntensity();
     void test_midiCcModWheelReset_shouldRestoreLfoIntensity();
+    void test_midiCcAndPitchBend_shouldWakeDevice();
     void test_lfoTarget_volume_shouldModulateAmplitude();
     void test_lfoTarget_resonance_shouldModulateResonance();
     void test_lfoTarget_pan_shouldModulatePanning();
@@ -111,6 +112,8 @@ private slots:
     void test_ampCurve_shouldSteepenTheAudibleDecay();
     void test_ampCurve_serialization_shouldPreserveState();
     void test_modCurve_serialization_shouldPreserveState();
+
+    void test_planarAudio_shouldMatchInterleavedOutput();
 };
 
 } // namespace noteahead
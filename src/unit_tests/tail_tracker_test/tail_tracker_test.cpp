@@ -0,0 +1,71 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "tail_tracker_test.hpp"
+
+#include "../../domain/dsp/tail_tracker.hpp"
+
+#include <QTest>
+
+namespace noteahead {
+
+void TailTrackerTest::test_tailTracker_neverFed_shouldBeInactive()
+{
+    TailTracker tracker;
+    tracker.setLength(1000);
+    QVERIFY(!tracker.active());
+}
+
+void TailTrackerTest::test_tailTracker_loudBlock_shouldStayActiveForItsLength()
+{
+    TailTracker tracker;
+    tracker.setLength(1000);
+    tracker.addBlock(0.5, 256);
+    QVERIFY(tracker.active());
+
+    // 768 quiet samples after the loud block: still inside the 1000 it can take to come out.
+    for (int block = 0; block < 3; block++) {
+        tracker.addBlock(0.0, 256);
+        QVERIFY(tracker.active());
+    }
+
+    tracker.addBlock(0.0, 256);
+    QVERIFY(!tracker.active());
+}
+
+void TailTrackerTest::test_tailTracker_belowThreshold_shouldNotWake()
+{
+    TailTracker tracker;
+    tracker.setLength(1000);
+    tracker.setThreshold(1.0e-3);
+    tracker.addBlock(0.5e-3, 256);
+    QVERIFY(!tracker.active());
+
+    tracker.addBlock(2.0e-3, 256);
+    QVERIFY(tracker.active());
+}
+
+void TailTrackerTest::test_tailTracker_reset_shouldForgetTheTail()
+{
+    TailTracker tracker;
+    tracker.setLength(1000);
+    tracker.addBlock(0.5, 256);
+    tracker.reset();
+    QVERIFY(!tracker.active());
+}
+
+} // namespace noteahead
+
+QTEST_GUILESS_MAIN(noteahead::TailTrackerTest)
@@ -0,0 +1,100 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+#include "wavetable_cache_test.hpp"
+
+#include "../../domain/dsp/wavetable_cache.hpp"
+
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTest>
+#include <algorithm>
+
+namespace noteahead {
+
+void WavetableCacheTest::test_wavetable_withoutDirectory_shouldShareOneSet()
+{
+    WavetableCache cache;
+
+    const auto first = cache.wavetable(0);
+    const auto second = cache.wavetable(0);
+
+    QVERIFY(first);
+    QCOMPARE(first.get(), second.get());
+    QVERIFY(cache.filePath(0).empty());
+}
+
+void WavetableCacheTest::test_wavetable_withDirectory_shouldReadBackWhatItWrote()
+{
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    WavetableCache writer { directory.path().toStdString() };
+    const auto built = writer.wavetable(1);
+    QVERIFY(QFile::exists(QString::fromStdString(writer.filePath(1))));
+
+    // A second cache stands for the next session: it has nothing in memory and has to map the file.
+    WavetableCache reader { directory.path().toStdString() };
+    const auto read = reader.wavetable(1);
+
+    QVERIFY(read);
+    QVERIFY(read.get() != built.get());
+    QCOMPARE(read->name(), built->name());
+    QCOMPARE(read->data().size(), built->data().size());
+    QVERIFY(std::ranges::equal(read->data(), built->data()));
+    QCOMPARE(read->getSample(0.3, 0.6, 440.0, 48000.0), built->getSample(0.3, 0.6, 440.0, 48000.0));
+}
+
+void WavetableCacheTest::test_wavetable_staleFile_shouldBeRebuilt()
+{
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    WavetableCache cache { directory.path().toStdString() };
+    {
+        // What a file left behind by a build with a different generator could look like.
+        QFile file { QString::fromStdString(cache.filePath(0)) };
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        const std::vector<char> garbage(4096, 'x');
+        file.write(garbage.data(), static_cast<qint64>(garbage.size()));
+    }
+
+    const auto table = cache.wavetable(0);
+    const auto expected = Wavetable::createSet(0);
+
+    QVERIFY(table);
+    QVERIFY(std::ranges::equal(table->data(), expected->data()));
+
+    // And the file now holds the set, so the next session reads it.
+    WavetableCache reader { directory.path().toStdString() };
+    QVERIFY(std::ranges::equal(reader.wavetable(0)->data(), expected->data()));
+}
+
+void WavetableCacheTest::test_prewarm_shouldWriteEverySet()
+{
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    WavetableCache cache { directory.path().toStdString() };
+    cache.prewarm();
+    cache.waitForPrewarm();
+
+    for (size_t index = 0; index < Wavetable::setNames().size(); index++) {
+        QVERIFY(QFile::exists(QString::fromStdString(cache.filePath(index))));
+    }
+}
+
+} // namespace noteahead
+
+QTEST_GUILESS_MAIN(noteahead::WavetableCacheTest)
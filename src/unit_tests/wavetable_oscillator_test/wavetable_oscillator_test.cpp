@@ -20,6 +20,7 @@
 #include <QTest>
 #include <algorithm>
 #include <cmath>
+#include <vector>
 
 namespace noteahead {
 
@@ -149,6 +150,55 @@ void WavetableOscillatorTest::test_position_outOfRange_shouldClamp()
     QCOMPARE(oscillator.position(), 1.0);
 }
 
+void WavetableOscillatorTest::test_render_shouldMatchTheTable()
+{
+    const auto table = Wavetable::createClassicSet();
+    auto oscillator = createOscillator();
+    oscillator.setWavetable(table);
+    oscillator.setPosition(0.4);
+
+    // Blocks at pitches far enough apart to read different mip levels, each of which has to be
+    // picked up by the block that follows the change.
+    double phase = 0.0;
+    std::vector<float> block(300);
+    for (const double frequency : { 55.0, 3520.0, 440.0 }) {
+        oscillator.setFrequency(frequency);
+        oscillator.render(block);
+
+        for (auto && sample : block) {
+            const auto expected = table->getSample(phase, 0.4, frequency, SampleRate);
+            QVERIFY2(std::abs(sample - expected) < 1.0e-6f,
+                     qPrintable(QString { "At %1 Hz expected %2, got %3" }.arg(frequency).arg(expected).arg(sample)));
+            phase += frequency / SampleRate;
+            if (phase >= 1.0) {
+                phase -= 1.0;
+            }
+        }
+    }
+}
+
+void WavetableOscillatorTest::test_render_whileGliding_shouldMatchNextSample()
+{
+    auto rendered = createOscillator();
+    auto stepped = createOscillator();
+    rendered.setPosition(0.1);
+    stepped.setPosition(0.1);
+
+    // The block starts mid-glide and has to finish it one sample at a time before settling.
+    std::vector<float> block(2048);
+    for (const double target : { 0.9, 0.3 }) {
+        rendered.setPosition(target);
+        rendered.render(block);
+        for (auto && sample : block) {
+            stepped.setPosition(target);
+            QVERIFY(std::abs(sample - static_cast<float>(stepped.nextSample())) < 1.0e-6f);
+        }
+    }
+
+    QCOMPARE(rendered.position(), 0.3);
+    QCOMPARE(rendered.phase(), stepped.phase());
+}
+
 } // namespace noteahead
 
 QTEST_GUILESS_MAIN(noteahead::WavetableOscillatorTest)
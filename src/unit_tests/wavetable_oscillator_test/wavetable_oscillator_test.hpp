@@ -30,6 +30,8 @@ private slots:
     void test_position_firstSet_shouldApplyImmediately();
     void test_position_afterSnap_shouldApplyImmediately();
     void test_position_outOfRange_shouldClamp();
+    void test_render_shouldMatchTheTable();
+    void test_render_whileGliding_shouldMatchNextSample();
 };
 
 } // namespace noteahead
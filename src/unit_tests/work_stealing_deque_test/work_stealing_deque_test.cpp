@@ -0,0 +1,123 @@
+// This file is part of Noteahead.
+// Copyright (C) 2026 Jussi Lind <jussi.lind@iki.fi>
+//
+// Noteahead is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// Noteahead is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
+
+#include "work_stealing_deque_test.hpp"
+#include "../../infra/audio/work_stealing_deque.hpp"
+
+#include <QTest>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace noteahead {
+
+void WorkStealingDequeTest::test_pop_shouldTakeNewestFirst()
+{
+    WorkStealingDeque deque { 4 };
+    QVERIFY(deque.push(1));
+    QVERIFY(deque.push(2));
+    QVERIFY(deque.push(3));
+
+    QCOMPARE(deque.pop(), std::optional<size_t> { 3 });
+    QCOMPARE(deque.pop(), std::optional<size_t> { 2 });
+    QCOMPARE(deque.pop(), std::optional<size_t> { 1 });
+    QCOMPARE(deque.pop(), std::optional<size_t> {});
+}
+
+void WorkStealingDequeTest::test_steal_shouldTakeOldestFirst()
+{
+    WorkStealingDeque deque { 4 };
+    deque.push(1);
+    deque.push(2);
+
+    QCOMPARE(deque.steal(), std::optional<size_t> { 1 });
+    QCOMPARE(deque.pop(), std::optional<size_t> { 2 });
+    QCOMPARE(deque.steal(), std::optional<size_t> {});
+}
+
+void WorkStealingDequeTest::test_push_shouldFailWhenFull()
+{
+    WorkStealingDeque deque { 2 };
+    QVERIFY(deque.push(1));
+    QVERIFY(deque.push(2));
+    QVERIFY(!deque.push(3));
+
+    // Room made at either end is room again, wrapping around the buffer.
+    deque.steal();
+    QVERIFY(deque.push(3));
+    QCOMPARE(deque.pop(), std::optional<size_t> { 3 });
+    QCOMPARE(deque.pop(), std::optional<size_t> { 2 });
+}
+
+void WorkStealingDequeTest::test_clear_shouldEmpty()
+{
+    WorkStealingDeque deque { 4 };
+    deque.push(1);
+    deque.push(2);
+    deque.clear();
+
+    QVERIFY(deque.empty());
+    QCOMPARE(deque.pop(), std::optional<size_t> {});
+}
+
+void WorkStealingDequeTest::test_concurrentPopAndSteal_shouldHandOutEveryEntryOnce()
+{
+    // The owner pops while three thieves steal: the last entry is where the two sides race, and it
+    // must go to exactly one of them.
+    constexpr size_t entryCount { 20000 };
+    WorkStealingDeque deque { entryCount };
+    std::vector<std::atomic<int>> taken(entryCount);
+    for (auto & count : taken) {
+        count.store(0);
+    }
+    std::atomic<bool> done { false };
+
+    std::vector<std::thread> thieves;
+    for (int i = 0; i < 3; i++) {
+        thieves.emplace_back([&] {
+            while (!done.load()) {
+                if (const auto entry = deque.steal()) {
+                    taken[*entry].fetch_add(1);
+                }
+            }
+        });
+    }
+
+    for (size_t entry = 0; entry < entryCount; entry++) {
+        deque.push(entry);
+        if (entry % 3 == 0) {
+            if (const auto popped = deque.pop()) {
+                taken[*popped].fetch_add(1);
+            }
+        }
+    }
+    while (const auto popped = deque.pop()) {
+        taken[*popped].fetch_add(1);
+    }
+    // A thief that has already claimed an entry counts it before it looks at the flag again.
+    done.store(true);
+    for (auto & thief : thieves) {
+        thief.join();
+    }
+
+    for (size_t entry = 0; entry < entryCount; entry++) {
+        QCOMPARE(taken[entry].load(), 1);
+    }
+}
+
+} // namespace noteahead
+
+QTEST_GUILESS_MAIN(noteahead::WorkStealingDequeTest)
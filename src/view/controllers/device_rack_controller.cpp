@@ -30,6 +30,7 @@
 #include "../../domain/devices/sub_mixer_device.hpp"
 #include "../../domain/devices/synth_device.hpp"
 #include "../../domain/devices/wavetable_synth_device.hpp"
+#include "../../domain/utility/dsp_profiler.hpp"
 #include "../../infra/audio/audio_engine.hpp"
 #include "bass_synth_controller.hpp"
 #include "drum_synth_controller.hpp"
@@ -40,6 +41,7 @@
 
 #include <QVariantMap>
 
+#include <algorithm>
 #include <cmath>
 
 namespace noteahead {
@@ -49,6 +51,7 @@ DeviceRackController::DeviceRackController(DeviceServiceS deviceService, Control
   , m_deviceService { std::move(deviceService) }
   , m_controllers { std::move(controllers) }
   , m_editorService { std::move(editorService) }
+  , m_deviceCount { static_cast<int>(Constants::deviceRackMinVisibleSlots()) }
 {
     if (m_deviceService) {
         connect(m_deviceService.get(), &DeviceService::dataChanged, this, [this]() {
@@ -108,7 +111,7 @@ QHash<int, QByteArray> DeviceRackController::roleNames() const
 
 int DeviceRackController::deviceCount() const
 {
-    return static_cast<int>(Constants::deviceRackSize());
+    return m_deviceCount;
 }
 
 int DeviceRackController::revision() const
@@ -120,11 +123,18 @@ void DeviceRackController::refresh()
 {
     m_revision++;
     emit revisionChanged();
+    const int previousDeviceCount = m_deviceCount;
     beginResetModel();
     if (m_deviceService) {
         m_devices = m_deviceService->internalDeviceNamesQt();
+        const auto occupied = m_deviceService->deviceSlots();
+        const size_t shown = occupied.empty() ? 0 : occupied.back() + 2;
+        m_deviceCount = static_cast<int>(std::clamp(shown, Constants::deviceRackMinVisibleSlots(), Constants::deviceRackSize()));
     }
     endResetModel();
+    if (m_deviceCount != previousDeviceCount) {
+        emit deviceCountChanged();
+    }
     // Slots may have gained a device since the gate was last set, and a new device's taps start off.
     applyMetersActive();
 }
@@ -301,6 +311,66 @@ int DeviceRackController::overrunCount() const
     return engine ? static_cast<int>(engine->loadMeter().overrunCount()) : 0;
 }
 
+void DeviceRackController::setProfilingActive(bool active)
+{
+    if (const auto engine = m_deviceService->audioEngine()) {
+        engine->dspProfiler().setActive(active);
+    }
+}
+
+bool DeviceRackController::profilingActive() const
+{
+    const auto engine = m_deviceService->audioEngine();
+    return engine ? engine->dspProfiler().active() : false;
+}
+
+QVariantList DeviceRackController::profileStatistics(int maxCount) const
+{
+    QVariantList statistics;
+    const auto engine = m_deviceService->audioEngine();
+    if (!engine) {
+        return statistics;
+    }
+
+    auto && profiler = engine->dspProfiler();
+    profiler.collect();
+    for (auto && scope : profiler.statistics()) {
+        if (statistics.size() >= maxCount) {
+            break;
+        }
+        auto name = QString::fromStdString(scope.name);
+        // The profiler only knows slots; the rack knows what the user called them.
+        const auto kind = static_cast<DspProfiler::Scope>(scope.key >> 24);
+        if (kind == DspProfiler::Scope::Device || kind == DspProfiler::Scope::DeviceInserts || kind == DspProfiler::Scope::InsertEffect) {
+            if (const auto device = m_deviceService->device(static_cast<size_t>((scope.key >> 12) & 0xfff))) {
+                name += QString { " (%1)" }.arg(QString::fromStdString(device->name()));
+            }
+        }
+        statistics.append(QVariantMap {
+          { "name", name },
+          { "count", static_cast<qulonglong>(scope.count) },
+          { "p50", scope.p50Us },
+          { "p99", scope.p99Us },
+          { "max", scope.maxUs } });
+    }
+    return statistics;
+}
+
+bool DeviceRackController::exportProfile(const QUrl & fileUrl) const
+{
+    const auto engine = m_deviceService->audioEngine();
+    if (!engine) {
+        return false;
+    }
+
+    auto filePath = fileUrl.toLocalFile();
+    if (!filePath.endsWith(".json")) {
+        filePath += ".json";
+    }
+    engine->dspProfiler().collect();
+    return engine->dspProfiler().writeChromeTrace(filePath.toStdString());
+}
+
 void DeviceRackController::setDevice(int slotIndex, const QString & typeId)
 {
     const auto name = Constants::internalDevicePortPrefix().toStdString() + " " + std::to_string(slotIndex + 1);
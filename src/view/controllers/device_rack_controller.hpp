@@ -127,6 +127,15 @@ public:
     Q_INVOKABLE double totalPeakLoad() const;
     Q_INVOKABLE int overrunCount() const;
 
+    //! Records where the callback's time goes, per device, effect and engine phase. Starting clears
+    //! the previous profile; stopping keeps it for reading and exporting.
+    Q_INVOKABLE void setProfilingActive(bool active);
+    Q_INVOKABLE bool profilingActive() const;
+    //! The costliest scopes first, as maps of name, count and p50/p99/max in microseconds.
+    Q_INVOKABLE QVariantList profileStatistics(int maxCount) const;
+    //! Writes the profile as a Chrome trace, for chrome://tracing or ui.perfetto.dev.
+    Q_INVOKABLE bool exportProfile(const QUrl & fileUrl) const;
+
     Q_INVOKABLE bool addSubMixerMember(int subMixerSlot, int memberSlot);
     Q_INVOKABLE bool removeSubMixerMember(int subMixerSlot, int memberSlot);
 
@@ -172,6 +181,9 @@ private:
     EditorServiceS m_editorService;
 
     QStringList m_devices;
+    //! Slots on show: every device, one free slot past the last of them to add the next in, and
+    //! never fewer than the rack used to have. Follows the devices rather than the rack's bound.
+    int m_deviceCount { 0 };
     int m_revision { 0 };
     bool m_metersActive { false };
 };
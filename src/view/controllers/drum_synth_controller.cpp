@@ -326,6 +326,18 @@ void DrumSynthController::setVoiceResonance(int value)
     }
 }
 
+bool DrumSynthController::hitCacheEnabled() const
+{
+    return m_device ? m_device->hitCacheEnabled() : false;
+}
+
+void DrumSynthController::setHitCacheEnabled(bool value)
+{
+    if (m_device) {
+        m_device->setHitCacheEnabled(value);
+    }
+}
+
 bool DrumSynthController::isKick() const
 {
     return m_selectedVoice == static_cast<int>(DrumSynth::VoiceIndex::Kick);
@@ -404,6 +416,7 @@ void DrumSynthController::requestSettings()
     emit tomPitchDepthChanged();
     emit tomPitchDecayChanged();
     emit voiceResonanceChanged();
+    emit hitCacheEnabledChanged();
     emit activeNotesChanged();
     emit volumeChanged();
     emit gainChanged();
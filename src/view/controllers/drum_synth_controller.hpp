@@ -58,6 +58,7 @@ class DrumSynthController : public DeviceController
     Q_PROPERTY(int voiceResonance READ voiceResonance WRITE setVoiceResonance NOTIFY voiceResonanceChanged)
 
     // Global
+    Q_PROPERTY(bool hitCacheEnabled READ hitCacheEnabled WRITE setHitCacheEnabled NOTIFY hitCacheEnabledChanged)
 
     // UI Helpers
     Q_PROPERTY(bool isKick READ isKick NOTIFY selectedVoiceChanged)
@@ -126,6 +127,9 @@ public:
     int voiceResonance() const;
     void setVoiceResonance(int value);
 
+    bool hitCacheEnabled() const;
+    void setHitCacheEnabled(bool value);
+
     bool isKick() const;
     bool isSnare() const;
     bool isTom() const;
@@ -155,6 +159,7 @@ signals:
     void tomPitchDepthChanged();
     void tomPitchDecayChanged();
     void voiceResonanceChanged();
+    void hitCacheEnabledChanged();
     void activeNotesChanged();
 
 private:
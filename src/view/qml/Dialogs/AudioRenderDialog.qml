@@ -402,6 +402,32 @@ AnimatedDialog {
                                 enabled: silenceCheckBox.checked
                             }
                         }
+
+                        // Column 3: Reproducible render
+                        RowLayout {
+                            Layout.fillWidth: true
+                            Layout.alignment: Qt.AlignTop
+                            spacing: 6
+
+                            CheckBox {
+                                id: reproducibleCheckBox
+                                text: qsTr("Reproducible, seed")
+                                checked: renderSettingsModel.reproducibleEnabled
+                                onToggled: renderSettingsModel.reproducibleEnabled = checked
+                            }
+
+                            SpinBox {
+                                id: randomSeedSpinBox
+                                Layout.fillWidth: true
+                                enabled: reproducibleCheckBox.checked
+                                from: 0
+                                to: 99999
+                                value: renderSettingsModel.randomSeed
+                                editable: true
+                                onValueModified: renderSettingsModel.randomSeed = value
+                                Keys.onReturnPressed: focus = false
+                            }
+                        }
                     }
                 }
             }
@@ -13,9 +13,11 @@
 // You should have received a copy of the GNU General Public License
 // along with Noteahead. If not, see <http://www.gnu.org/licenses/>.
 
+import QtCore
 import QtQuick 2.15
 import QtQuick.Controls 2.15
 import QtQuick.Controls.Universal 2.15
+import QtQuick.Dialogs
 import QtQuick.Layouts 1.15
 import Noteahead 1.0
 import "../Components"
@@ -121,6 +123,11 @@ AnimatedDialog {
                     deviceRackController.revision;
                     return deviceRackController.deviceClipped(index);
                 }
+                readonly property bool deviceFrozen: {
+                    freezeService.revision;
+                    deviceRackController.revision;
+                    return freezeService.isDeviceFrozen(index);
+                }
 
                 Menu {
                     id: manageMenu
@@ -133,6 +140,21 @@ AnimatedDialog {
                         text: qsTr("Import Settings...")
                         onClicked: UiService.requestImportDeviceSettings(index)
                     }
+                    MenuSeparator {}
+                    MenuItem {
+                        text: deviceFrozen ? qsTr("Unfreeze") : qsTr("Freeze")
+                        onClicked: {
+                            if (deviceFrozen) {
+                                freezeService.unfreezeDevice(index);
+                            } else {
+                                freezeService.freezeDevice(index);
+                                // Nothing to wait for when the cache already holds the device as it stands
+                                if (renderService.isRendering) {
+                                    UiService.requestRenderProgressDialog();
+                                }
+                            }
+                        }
+                    }
                 }
                 MouseArea {
                     id: mouseArea
@@ -165,7 +187,7 @@ AnimatedDialog {
                     spacing: 10
                     
                     Text {
-                        text: deviceType === "" ? "" : qsTr("Slot %1: %2 (%3)").arg(index + 1).arg(deviceName).arg(deviceTypeName)
+                        text: deviceType === "" ? "" : qsTr("Slot %1: %2 (%3)").arg(index + 1).arg(deviceName).arg(deviceTypeName) + (deviceFrozen ? " " + qsTr("[frozen]") : "")
                         color: "white"
                         font.pointSize: 13
                         font.bold: deviceListView.hoveredIndex === index && root.activeFocus
@@ -309,6 +331,39 @@ AnimatedDialog {
             Item {
                 Layout.fillWidth: true
             }
+
+            CheckBox {
+                id: profileCheckBox
+                text: qsTr("Profile")
+                checked: deviceRackController.profilingActive()
+                onToggled: deviceRackController.setProfilingActive(checked)
+                ToolTip.visible: hovered
+                ToolTip.text: qsTr("Record how long each device, effect and engine phase takes")
+            }
+
+            AppButton {
+                text: qsTr("Save Trace...")
+                onClicked: profileTraceDialog.open()
+            }
+        }
+
+        Text {
+            id: profileText
+            property var scopes: []
+            // The costliest scopes by p99, refreshed once a second: the histograms behind them only
+            // move that fast in any way worth reading.
+            Timer {
+                interval: 1000
+                running: root.visible && profileCheckBox.checked
+                repeat: true
+                triggeredOnStart: true
+                onTriggered: profileText.scopes = deviceRackController.profileStatistics(3)
+            }
+            visible: profileCheckBox.checked
+            text: scopes.map(scope => qsTr("%1: p50 %2 µs, p99 %3 µs").arg(scope.name).arg(scope.p50.toFixed(1)).arg(scope.p99.toFixed(1))).join("\n")
+            color: "#aaa"
+            font.pointSize: 10
+            Layout.fillWidth: true
         }
 
         Text {
@@ -321,4 +376,12 @@ AnimatedDialog {
             horizontalAlignment: Text.AlignHCenter
         }
     }
+
+    FileDialog {
+        id: profileTraceDialog
+        currentFolder: StandardPaths.standardLocations(StandardPaths.DocumentsLocation)[0]
+        fileMode: FileDialog.SaveFile
+        nameFilters: [qsTr("Chrome trace files") + " (*.json)"]
+        onAccepted: deviceRackController.exportProfile(selectedFile)
+    }
 }
@@ -99,6 +99,22 @@ AnimatedDialog {
                             value: drumSynthController.pan
                             onMoved: (val) => drumSynthController.pan = val
                         }
+                        CheckBox {
+                            id: hitCacheCheckbox
+                            text: qsTr("Cache hits")
+                            checked: drumSynthController.hitCacheEnabled
+                            onToggled: drumSynthController.hitCacheEnabled = checked
+                            contentItem: Label {
+                                text: hitCacheCheckbox.text
+                                color: "white"
+                                verticalAlignment: Text.AlignVCenter
+                                leftPadding: hitCacheCheckbox.indicator.width + hitCacheCheckbox.spacing
+                            }
+                            ToolTip.delay: Constants.toolTipDelay
+                            ToolTip.timeout: Constants.toolTipTimeout
+                            ToolTip.visible: hovered
+                            ToolTip.text: qsTr("Synthesize each hit once per sound and play it back from memory. Saves CPU on dense patterns, but repeated hits no longer vary their noise.")
+                        }
                     }
                 }
 
@@ -93,6 +93,39 @@ GroupBox {
                     }
                 }
 
+                CheckBox {
+                    id: masterPipelineCheckbox
+                    text: qsTr("Overlap the master effects with the next block (adds one buffer of latency).")
+                    checked: settingsService.masterPipelineEnabled
+                    enabled: multiThreadedPlaybackCheckbox.checked
+                    Layout.fillWidth: true
+                    ToolTip.delay: Constants.toolTipDelay
+                    ToolTip.timeout: Constants.toolTipTimeout
+                    ToolTip.visible: hovered
+                    ToolTip.text: qsTr("Processes the master insert effects on their own thread while the devices render the next block. Leaves more time for the devices at small buffer sizes, at the cost of one buffer of extra latency.")
+                    onCheckedChanged: {
+                        if (settingsService.masterPipelineEnabled !== checked) {
+                            settingsService.masterPipelineEnabled = checked
+                        }
+                    }
+                }
+
+                CheckBox {
+                    id: renderAheadCheckbox
+                    text: qsTr("Render songs ahead of the playhead.")
+                    checked: settingsService.renderAheadEnabled
+                    Layout.fillWidth: true
+                    ToolTip.delay: Constants.toolTipDelay
+                    ToolTip.timeout: Constants.toolTipTimeout
+                    ToolTip.visible: hovered
+                    ToolTip.text: qsTr("Renders a song that only uses internal devices a few seconds ahead, the way an export does, so that heavy projects play without dropouts. A mute, a device edit or a live note during playback restarts the render or plays live from there on, which cuts what is sounding.")
+                    onCheckedChanged: {
+                        if (settingsService.renderAheadEnabled !== checked) {
+                            settingsService.renderAheadEnabled = checked
+                        }
+                    }
+                }
+
                 CheckBox {
                     id: showWaveViewCheckbox
                     text: qsTr("Show recording and playback wave view at the bottom of the editor.")
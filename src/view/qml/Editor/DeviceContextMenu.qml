@@ -74,5 +74,28 @@ Menu {
         }
         delegate: MenuItemDelegate {}
     }
+    MenuSeparator {}
+    MenuItem {
+        text: {
+            freezeService.revision;
+            const slot = rootItem.deviceSlot();
+            return slot >= 0 && freezeService.isDeviceFrozen(slot) ? qsTr("Unfreeze") : qsTr("Freeze");
+        }
+        onTriggered: {
+            const slot = rootItem.deviceSlot();
+            if (slot < 0) {
+                return;
+            }
+            if (freezeService.isDeviceFrozen(slot)) {
+                freezeService.unfreezeDevice(slot);
+            } else {
+                freezeService.freezeDevice(slot);
+                // Nothing to wait for when the cache already holds the device as it stands
+                if (renderService.isRendering) {
+                    UiService.requestRenderProgressDialog();
+                }
+            }
+        }
+    }
     delegate: MenuItemDelegate {}
 }